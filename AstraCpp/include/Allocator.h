@@ -0,0 +1,67 @@
+/**
+ * @file Allocator.h
+ * @brief Declaration of the Allocator interface used for the storage of
+ * Matrix and Vector elements, and of the functions that select it.
+ */
+
+#ifndef __ALLOCATOR_H__
+#define __ALLOCATOR_H__
+
+#include <cstddef>
+
+namespace astra {
+
+/**
+ * @class Allocator
+ * @brief Interface for the memory resource that backs Matrix and Vector
+ * element buffers.
+ *
+ * The library always asks for blocks aligned to 64 bytes (a cache line, and
+ * the width of an AVX-512 register), and pads every buffer to a multiple of
+ * 64 bytes so SIMD kernels can work on whole registers. A custom allocator
+ * must honour the requested alignment, e.g. to place buffers in an arena or
+ * in huge pages.
+ */
+class Allocator {
+  public:
+    virtual ~Allocator() = default;
+
+    /**
+     * @brief Allocates a block of memory.
+     * @param bytes The size of the block in bytes.
+     * @param alignment The required alignment in bytes, a power of two.
+     * @return Pointer to the block, or nullptr if the request cannot be met.
+     */
+    virtual void* allocate(std::size_t bytes, std::size_t alignment) = 0;
+
+    /**
+     * @brief Releases a block previously returned by allocate.
+     * @param ptr The block to release.
+     * @param bytes The size that was passed to allocate.
+     * @param alignment The alignment that was passed to allocate.
+     */
+    virtual void deallocate(void* ptr, std::size_t bytes,
+                            std::size_t alignment) = 0;
+};
+
+/**
+ * @brief Sets the allocator used for all subsequently created buffers.
+ *
+ * Every buffer remembers the allocator it came from and is returned to it, so
+ * changing the allocator does not affect existing matrices and vectors. The
+ * allocator must therefore outlive every buffer it has handed out.
+ *
+ * @param allocator The allocator to use, or nullptr to restore the default
+ * aligned allocator.
+ */
+void set_allocator(Allocator* allocator);
+
+/**
+ * @brief Returns the allocator used for new buffers.
+ * @return The current allocator, never nullptr.
+ */
+Allocator* get_allocator();
+
+} // namespace astra
+
+#endif // !__ALLOCATOR_H__
@@ -0,0 +1,218 @@
+/**
+ * @file BandedMatrix.h
+ * @brief Declaration of the BandedMatrix class, a square matrix stored as
+ * its band only, and of BandedLU, its LU factorization with partial
+ * pivoting.
+ */
+
+#ifndef __BANDED_MATRIX_H__
+#define __BANDED_MATRIX_H__
+
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class BandedMatrix
+ * @brief A square matrix whose nonzero entries lie within lower diagonals
+ * below and upper diagonals above the main diagonal.
+ *
+ * Row i keeps the columns i - lower .. i + upper contiguously, so entry
+ * (i, j) is at position i * width + (j - i + lower) of the packed array
+ * with width = lower + upper + 1, and positions that fall outside the
+ * matrix in the first and last rows stay zero. The storage is O(n * width)
+ * instead of O(n^2) and a product with a vector costs O(n * width).
+ */
+class BandedMatrix {
+  private:
+    int n;
+    int lower;
+    int upper;
+    std::vector<double> band;
+
+  public:
+    /**
+     * @brief Constructs a zero matrix with the given bandwidths.
+     * @param n The order of the matrix.
+     * @param lower The number of diagonals below the main diagonal.
+     * @param upper The number of diagonals above the main diagonal.
+     * @throws astra::internals::exceptions::invalid_size if n is <= 0.
+     * @throws astra::internals::exceptions::invalid_argument if lower or
+     * upper is negative or not below n.
+     */
+    BandedMatrix(int n, int lower, int upper);
+
+    /**
+     * @brief Constructs a banded matrix from the band of a dense one.
+     * @param A The square matrix to copy.
+     * @param lower The number of diagonals below the main diagonal.
+     * @param upper The number of diagonals above the main diagonal.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::invalid_argument if lower or
+     * upper is negative or not below n, or if A has a nonzero entry outside
+     * the band.
+     */
+    BandedMatrix(const Matrix& A, int lower, int upper);
+
+    /**
+     * @brief Returns the number of rows, n.
+     */
+    int num_row() const;
+
+    /**
+     * @brief Returns the number of columns, n.
+     */
+    int num_col() const;
+
+    /**
+     * @brief Returns the number of diagonals below the main diagonal.
+     */
+    int lower_bandwidth() const;
+
+    /**
+     * @brief Returns the number of diagonals above the main diagonal.
+     */
+    int upper_bandwidth() const;
+
+    /**
+     * @brief Returns the packed band, n rows of lower + upper + 1 entries.
+     */
+    const double* data() const;
+
+    /**
+     * @brief Gives access to an entry of the band.
+     * @param i The row index.
+     * @param j The column index.
+     * @return A reference to the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix or the band.
+     */
+    double& operator()(int i, int j);
+
+    /**
+     * @brief Returns the entry at row i and column j, zero outside the
+     * band.
+     * @param i The row index.
+     * @param j The column index.
+     * @return The value of the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix.
+     */
+    double operator()(int i, int j) const;
+
+    /**
+     * @brief Converts to a dense matrix.
+     * @return Matrix The dense n x n matrix with the same entries.
+     */
+    Matrix to_dense() const;
+
+    /**
+     * @brief Computes y = A x without allocating, the form a
+     * Solver::LinearOperator takes. The rows are split among the threads of
+     * the library pool once the band has enough entries.
+     * @param x The vector to multiply, with n entries.
+     * @param y Receives the product, a vector with n entries distinct from
+     * x.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if x or y
+     * does not have n entries.
+     */
+    void multiply(const Vector& x, Vector& y) const;
+
+    /**
+     * @brief Multiplies the matrix with a vector.
+     * @param x The vector to multiply, with n entries.
+     * @return Vector The product with n entries.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the size
+     * of x is not n.
+     */
+    Vector operator*(const Vector& x) const;
+
+    /**
+     * @brief Checks if two matrices have the same order, bandwidths and
+     * entries.
+     * @param other The matrix to compare with.
+     * @return True if they are equal, false otherwise.
+     */
+    bool operator==(const BandedMatrix& other) const;
+
+    /**
+     * @brief Checks if two matrices differ in order, bandwidths or entries.
+     * @param other The matrix to compare with.
+     * @return True if they differ, false otherwise.
+     */
+    bool operator!=(const BandedMatrix& other) const;
+};
+
+/**
+ * @class BandedLU
+ * @brief The LU factorization with partial pivoting of a banded matrix,
+ * computed once and reused.
+ *
+ * Pivoting only exchanges a row with one of the next lower rows, so L keeps
+ * lower diagonals and U widens to lower + upper diagonals above its main
+ * diagonal. Factoring costs O(n * lower * (lower + upper)) and each solve
+ * O(n * (2 * lower + upper)), against O(n^3) and O(n^2) for LUFactorization
+ * of the dense matrix. As in LAPACK's gbtrf, the row exchanges are applied
+ * to the columns right of the pivot only, so the solve interleaves them
+ * with the columns of L.
+ */
+class BandedLU {
+  private:
+    int n;
+    int lower;
+    int upper;
+    // row i keeps the columns i - lower .. i + lower + upper
+    std::vector<double> lu;
+    std::vector<int> pivots;
+    int swaps;
+    bool singular;
+
+  public:
+    /**
+     * @brief Factors a banded matrix.
+     * @param A The matrix to factor.
+     */
+    explicit BandedLU(const BandedMatrix& A);
+
+    /**
+     * @brief Returns the order n of the factored matrix.
+     */
+    int size() const;
+
+    /**
+     * @brief Checks if the factored matrix is singular, i.e. a pivot column
+     * was nearly zero (within 1e-6) during the factorization.
+     */
+    bool is_singular() const;
+
+    /**
+     * @brief Returns the pivot indices, the row exchanged with row k at
+     * step k.
+     */
+    const std::vector<int>& get_pivots() const;
+
+    /**
+     * @brief Solves Ax = b for the factored A.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the size of b is not n.
+     * @throws astra::internals::exceptions::singular_matrix if A is singular.
+     */
+    Vector solve(const Vector& b) const;
+
+    /**
+     * @brief Computes the determinant from the diagonal of U and the number
+     * of row swaps.
+     * @return The determinant of the factored matrix.
+     */
+    double det() const;
+};
+
+} // namespace astra
+
+#endif // !__BANDED_MATRIX_H__
@@ -0,0 +1,129 @@
+/**
+ * @file CirculantMatrix.h
+ * @brief Declaration of the CirculantMatrix class, a square matrix whose
+ * rows are cyclic shifts of each other, stored as its first column.
+ */
+
+#ifndef __CIRCULANT_MATRIX_H__
+#define __CIRCULANT_MATRIX_H__
+
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <complex>
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class CirculantMatrix
+ * @brief A square matrix with A(i, j) = c[(i - j) mod n], defined by its
+ * first column c. Its first row is c[0], c[n - 1], ..., c[1].
+ *
+ * Every circulant matrix is diagonalised by the discrete Fourier transform
+ * F: A = F^-1 diag(F c) F. The eigenvalues F c are computed once on
+ * construction, after which a product costs two transforms and Solver::solve
+ * three, O(n log n) for any n, with O(n) storage.
+ */
+class CirculantMatrix {
+  private:
+    std::vector<double> column;
+    std::vector<std::complex<double>> eigen;
+
+  public:
+    /**
+     * @brief Constructs a circulant matrix from its first column.
+     * @param column The n entries of the first column.
+     * @throws astra::internals::exceptions::invalid_size if column is
+     * empty.
+     */
+    explicit CirculantMatrix(std::vector<double> column);
+
+    /**
+     * @brief Constructs a circulant matrix from its first row.
+     * @param row The n entries of the first row.
+     * @return CirculantMatrix The matrix with that first row.
+     * @throws astra::internals::exceptions::invalid_size if row is empty.
+     */
+    static CirculantMatrix from_first_row(const std::vector<double>& row);
+
+    /**
+     * @brief Returns the number of rows, n.
+     */
+    int num_row() const;
+
+    /**
+     * @brief Returns the number of columns, n.
+     */
+    int num_col() const;
+
+    /**
+     * @brief Returns the n entries of the first column.
+     */
+    const std::vector<double>& first_column() const;
+
+    /**
+     * @brief Returns the n entries of the first row.
+     */
+    std::vector<double> first_row() const;
+
+    /**
+     * @brief Returns the eigenvalues, the discrete Fourier transform of the
+     * first column. The eigenvector of eigenvalue k has the entries
+     * exp(2 pi i j k / n).
+     */
+    const std::vector<std::complex<double>>& eigenvalues() const;
+
+    /**
+     * @brief Returns the entry at row i and column j.
+     * @param i The row index.
+     * @param j The column index.
+     * @return The value of the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix.
+     */
+    double operator()(int i, int j) const;
+
+    /**
+     * @brief Converts to a dense matrix.
+     * @return Matrix The dense n x n matrix with the same entries.
+     */
+    Matrix to_dense() const;
+
+    /**
+     * @brief Computes y = A x in O(n log n), the form a
+     * Solver::LinearOperator takes.
+     * @param x The vector to multiply, with n entries.
+     * @param y Receives the product, a vector with n entries.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if x or y
+     * does not have n entries.
+     */
+    void multiply(const Vector& x, Vector& y) const;
+
+    /**
+     * @brief Multiplies the matrix with a vector.
+     * @param x The vector to multiply, with n entries.
+     * @return Vector The product with n entries.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the size
+     * of x is not n.
+     */
+    Vector operator*(const Vector& x) const;
+
+    /**
+     * @brief Checks if two matrices have the same first column.
+     * @param other The matrix to compare with.
+     * @return True if they are equal, false otherwise.
+     */
+    bool operator==(const CirculantMatrix& other) const;
+
+    /**
+     * @brief Checks if two matrices differ in order or entries.
+     * @param other The matrix to compare with.
+     * @return True if they differ, false otherwise.
+     */
+    bool operator!=(const CirculantMatrix& other) const;
+};
+
+} // namespace astra
+
+#endif // !__CIRCULANT_MATRIX_H__
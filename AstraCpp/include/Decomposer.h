@@ -8,6 +8,12 @@
 #define __DECOMPOSER_H__
 
 #include "Matrix.h"
+#include "SymmetricMatrix.h"
+#include "TriangularMatrix.h"
+#include "Vector.h"
+
+#include <utility>
+#include <vector>
 
 namespace astra {
 
@@ -17,6 +23,167 @@ namespace astra {
  */
 class Decomposer {
   public:
+    /**
+     * @struct LUResult
+     * @brief Stores the result of the compact LU decomposition.
+     *
+     * L and U share one n x n matrix: U is on and above the diagonal and the
+     * multipliers of L are below it, the unit diagonal of L is not stored.
+     * The row interchanges are kept as pivot indices instead of a dense
+     * permutation matrix: at step k, row k was swapped with row pivots[k]
+     * (pivots[k] >= k), so applying the swaps in order to A gives L * U.
+     */
+    struct LUResult {
+        Matrix LU;               ///< L and U packed together.
+        std::vector<int> pivots; ///< Row swapped with row k at step k.
+        int swaps;               ///< Number of row swaps performed.
+
+        /**
+         * @brief Constructs an LUResult from the packed factors.
+         * @param lu The packed L and U factors.
+         * @param p The pivot indices.
+         * @param s The number of row swaps performed.
+         */
+        LUResult(Matrix lu, std::vector<int> p, int s)
+            : LU(std::move(lu)), pivots(std::move(p)), swaps(s) {}
+
+        /**
+         * @brief Unpacks L, with its unit diagonal, in packed storage.
+         * @return TriangularMatrix The lower triangular factor.
+         */
+        TriangularMatrix lower() const;
+
+        /**
+         * @brief Unpacks U in packed storage.
+         * @return TriangularMatrix The upper triangular factor.
+         */
+        TriangularMatrix upper() const;
+    };
+
+    /**
+     * @struct LDLTResult
+     * @brief Stores the result of the symmetric indefinite LDL^T
+     * decomposition.
+     *
+     * L is unit lower triangular and D is block diagonal with 1x1 and
+     * symmetric 2x2 blocks. A 2x2 block starting at row k is recognised by
+     * D(k + 1, k) being nonzero. The symmetric interchanges are kept as a
+     * permutation: A(perm[i], perm[j]) = (L * D * L^T)(i, j).
+     */
+    struct LDLTResult {
+        Matrix L;              ///< Unit lower triangular factor.
+        Matrix D;              ///< Block diagonal factor.
+        std::vector<int> perm; ///< Row and column k of A moved to k.
+
+        /**
+         * @brief Constructs an LDLTResult from the factors.
+         * @param l The unit lower triangular factor.
+         * @param d The block diagonal factor.
+         * @param p The symmetric permutation.
+         */
+        LDLTResult(Matrix l, Matrix d, std::vector<int> p)
+            : L(std::move(l)), D(std::move(d)), perm(std::move(p)) {}
+    };
+
+
+    /**
+     * @struct QRResult
+     * @brief Stores the result of the compact Householder QR decomposition.
+     *
+     * For an m x n matrix, R is on and above the diagonal of the m x n
+     * matrix QR and the Householder vectors are below it: reflector k is
+     * H_k = I - tau[k] * v * v^T, where v is zero above row k, one at row k
+     * and the stored column k below it. Q = H_0 * H_1 * ... * H_{p-1} with
+     * p = min(m, n) is never formed.
+     */
+    struct QRResult {
+        Matrix QR;               ///< R and the Householder vectors.
+        std::vector<double> tau; ///< Scale of each reflector.
+
+        /**
+         * @brief Constructs a QRResult from the packed factors.
+         * @param qr R and the Householder vectors packed together.
+         * @param t The reflector scales.
+         */
+        QRResult(Matrix qr, std::vector<double> t)
+            : QR(std::move(qr)), tau(std::move(t)) {}
+
+        /**
+         * @brief Unpacks the n x n R of an m x n matrix with m >= n in
+         * packed storage, the rows of R below n being zero.
+         * @return TriangularMatrix The upper triangular factor.
+         * @throws astra::internals::exceptions::invalid_argument if m < n,
+         * when R is not triangular.
+         */
+        TriangularMatrix upper() const;
+    };
+
+    /**
+     * @struct EighResult
+     * @brief Stores eigenvalues of a symmetric matrix and their
+     * eigenvectors.
+     *
+     * The eigenvalues are in ascending order and column i of vectors is the
+     * unit eigenvector of values[i], so A * vectors = vectors * diag(values).
+     */
+    struct EighResult {
+        Vector values;  ///< Eigenvalues in ascending order.
+        Matrix vectors; ///< Orthonormal eigenvectors, one per column.
+
+        /**
+         * @brief Constructs an EighResult from the eigenpairs.
+         * @param w The eigenvalues.
+         * @param v The eigenvectors as columns.
+         */
+        EighResult(Vector w, Matrix v)
+            : values(std::move(w)), vectors(std::move(v)) {}
+    };
+
+    /**
+     * @struct EigResult
+     * @brief Stores the eigenvalues of a general real matrix and their
+     * eigenvectors.
+     *
+     * Complex eigenvalues come in conjugate pairs at consecutive positions,
+     * the one with the positive imaginary part first, and their vectors are
+     * conjugates too. Column i of vectors is a unit eigenvector of
+     * values[i], so A * vectors = vectors * diag(values).
+     */
+    struct EigResult {
+        VectorC values;  ///< Eigenvalues in the order of the Schur form.
+        MatrixC vectors; ///< Unit eigenvectors, one per column.
+
+        /**
+         * @brief Constructs an EigResult from the eigenpairs.
+         * @param w The eigenvalues.
+         * @param v The eigenvectors as columns.
+         */
+        EigResult(VectorC w, MatrixC v)
+            : values(std::move(w)), vectors(std::move(v)) {}
+    };
+
+    /**
+     * @struct SVDResult
+     * @brief Stores the singular value decomposition A = U * diag(S) * VT.
+     *
+     * The singular values are in descending order. Column i of U and row i
+     * of VT are the left and right singular vectors of S[i].
+     */
+    struct SVDResult {
+        Matrix U;  ///< Orthonormal left singular vectors, one per column.
+        Vector S;  ///< Singular values in descending order.
+        Matrix VT; ///< Orthonormal right singular vectors, one per row.
+
+        /**
+         * @brief Constructs an SVDResult from the factors.
+         * @param u The left singular vectors as columns.
+         * @param s The singular values.
+         * @param vt The right singular vectors as rows.
+         */
+        SVDResult(Matrix u, Vector s, Matrix vt)
+            : U(std::move(u)), S(std::move(s)), VT(std::move(vt)) {}
+    };
+
     /**
      * @struct PLUResult
      * @brief Stores the result of the PA=LU decomposition.
@@ -38,13 +205,17 @@ class Decomposer {
 
         /**
          * @brief Constructs a PLUResult with specified matrices and swaps.
+         *
+         * The matrices are taken by value, so temporaries passed in (or
+         * arguments wrapped in std::move) are moved instead of copied.
+         *
          * @param p The permutation matrix.
          * @param l The lower triangular matrix.
          * @param u The upper triangular matrix.
          * @param s The number of row swaps performed.
          */
-        PLUResult(const Matrix& p, const Matrix& l, const Matrix& u, int s)
-            : P(p), L(l), U(u), swaps(s) {}
+        PLUResult(Matrix p, Matrix l, Matrix u, int s)
+            : P(std::move(p)), L(std::move(l)), U(std::move(u)), swaps(s) {}
     };
 
     /**
@@ -53,14 +224,456 @@ class Decomposer {
      * Decomposes a square matrix A into three matrices: P (permutation matrix),
      * L (lower triangular matrix), and U (upper triangular matrix), such that
      * P * A = L * U. It also counts the number of row swaps needed during
-     * the decomposition.
+     * the decomposition. The factors are computed by lu and then expanded,
+     * prefer lu when the explicit matrices are not needed.
      *
      * @param A The square matrix to decompose.
      * @return PLUResult The decomposition result containing P, L, U, and swaps.
      * @throws astra::internals::exceptions::non_square_matrix if A is not
      * square.
      */
-    static PLUResult palu(Matrix A);
+    static PLUResult palu(const Matrix& A);
+
+    /**
+     * @brief Performs PA=LU decomposition on the block seen by a view, without
+     * copying it into a temporary matrix first.
+     *
+     * @param A A view of the square matrix to decompose.
+     * @return PLUResult The decomposition result containing P, L, U, and swaps.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    static PLUResult palu(const MatrixView& A);
+
+    /**
+     * @brief Performs the LU decomposition with partial pivoting of a square
+     * matrix into compact storage.
+     *
+     * The factorization is blocked and right-looking: each panel of columns
+     * is factored with partial pivoting and the trailing submatrix is then
+     * updated with one matrix product, so most of the work runs in the GEMM
+     * kernel. A column whose largest remaining entry is nearly zero (within
+     * 1e-6, as in palu) is treated as already eliminated.
+     *
+     * @param A The square matrix to decompose.
+     * @return LUResult The packed factors, the pivot indices and the number
+     * of swaps.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    static LUResult lu(const Matrix& A);
+
+    /**
+     * @brief Performs the compact LU decomposition of the block seen by a
+     * view. See lu(const Matrix&).
+     *
+     * @param A A view of the square matrix to decompose.
+     * @return LUResult The packed factors, the pivot indices and the number
+     * of swaps.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    static LUResult lu(const MatrixView& A);
+
+    /**
+     * @brief Performs the compact LU decomposition in the storage of a
+     * matrix that is no longer needed, without copying it. See
+     * lu(const Matrix&).
+     *
+     * @param A The square matrix to decompose. Its storage is taken over by
+     * the result.
+     * @return LUResult The packed factors, the pivot indices and the number
+     * of swaps.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    static LUResult lu(Matrix&& A);
+
+    /**
+     * @brief Performs the Cholesky decomposition A = L * L^T of a symmetric
+     * positive definite matrix.
+     *
+     * The factorization is blocked: each block of 64 columns is factored,
+     * the rows below it are solved against it and the trailing lower
+     * triangle is updated with matrix products. Only the lower triangle of A
+     * is read once A is known to be symmetric.
+     *
+     * @param A The symmetric positive definite matrix to decompose.
+     * @return Matrix The lower triangular factor L, zero above the diagonal.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     * @throws astra::internals::exceptions::not_positive_definite if a
+     * pivot is not positive.
+     */
+    static Matrix cholesky(const Matrix& A);
+
+    /**
+     * @brief Performs the Cholesky decomposition of the block seen by a
+     * view. See cholesky(const Matrix&).
+     *
+     * @param A A view of the symmetric positive definite matrix.
+     * @return Matrix The lower triangular factor L, zero above the diagonal.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     * @throws astra::internals::exceptions::not_positive_definite if a
+     * pivot is not positive.
+     */
+    static Matrix cholesky(const MatrixView& A);
+
+    /**
+     * @brief Performs the Cholesky decomposition A = L * L^T of a symmetric
+     * positive definite matrix in packed storage, using half the memory of
+     * cholesky(const Matrix&).
+     *
+     * L is computed row by row in place of the packed lower triangle:
+     * L(i, j) = (A(i, j) - L(i, 0:j) . L(j, 0:j)) / L(j, j), where both
+     * rows are contiguous.
+     *
+     * @param A The symmetric positive definite matrix to decompose.
+     * @return TriangularMatrix The lower triangular factor L.
+     * @throws astra::internals::exceptions::not_positive_definite if a
+     * pivot is not positive.
+     */
+    static TriangularMatrix cholesky(const SymmetricMatrix& A);
+
+    /**
+     * @brief Performs the LDL^T decomposition of a symmetric, possibly
+     * indefinite, matrix with Bunch-Kaufman pivoting.
+     *
+     * Each step takes a 1x1 pivot when the diagonal is large enough relative
+     * to its column and a 2x2 pivot otherwise, which keeps the growth of L
+     * bounded where a plain LDL^T would divide by small or zero diagonals.
+     * A nearly zero column (within 1e-6) is skipped, leaving a zero in D.
+     *
+     * @param A The symmetric matrix to decompose.
+     * @return LDLTResult The factors L and D and the symmetric permutation.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     */
+    static LDLTResult ldlt(const Matrix& A);
+
+    /**
+     * @brief Performs the LDL^T decomposition of the block seen by a view.
+     * See ldlt(const Matrix&).
+     *
+     * @param A A view of the symmetric matrix to decompose.
+     * @return LDLTResult The factors L and D and the symmetric permutation.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     */
+    static LDLTResult ldlt(const MatrixView& A);
+
+    /**
+     * @brief Performs the Householder QR decomposition A = Q * R of an
+     * m x n matrix.
+     *
+     * The columns are factored in panels of 32 and each panel is applied to
+     * the columns on its right at once in the compact WY form
+     * I - V * T * V^T. Both products of that update stream over blocks of
+     * rows, so a tall matrix is read a few times per panel instead of once
+     * per column.
+     *
+     * @param A The matrix to decompose.
+     * @return QRResult R and the reflectors that form Q, see QRResult.
+     */
+    static QRResult qr(const Matrix& A);
+
+    /**
+     * @brief Performs the Householder QR decomposition of the block seen by
+     * a view. See qr(const Matrix&).
+     *
+     * @param A A view of the matrix to decompose.
+     * @return QRResult R and the reflectors that form Q, see QRResult.
+     */
+    static QRResult qr(const MatrixView& A);
+
+    /**
+     * @brief Performs the Householder QR decomposition in the storage of a
+     * matrix that is no longer needed, without copying it. See
+     * qr(const Matrix&).
+     *
+     * @param A The matrix to decompose. Its storage is taken over by the
+     * result.
+     * @return QRResult R and the reflectors that form Q, see QRResult.
+     */
+    static QRResult qr(Matrix&& A);
+
+    /**
+     * @brief Computes all eigenvalues and eigenvectors of a symmetric
+     * matrix.
+     *
+     * A is reduced to tridiagonal form T = Q^T A Q by Householder
+     * reflectors, in panels of 32 whose trailing updates are matrix
+     * products. The eigensystem of T is found by divide and conquer and the
+     * eigenvectors are transformed back by Q, again in blocks.
+     *
+     * @param A The symmetric matrix. Only its lower triangle is used once it
+     * is known to be symmetric.
+     * @return EighResult The eigenvalues in ascending order and the
+     * eigenvectors.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     */
+    static EighResult eigh(const Matrix& A);
+
+    /**
+     * @brief Computes all eigenpairs of the symmetric block seen by a view.
+     * See eigh(const Matrix&).
+     *
+     * @param A A view of the symmetric matrix.
+     * @return EighResult The eigenvalues in ascending order and the
+     * eigenvectors.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     */
+    static EighResult eigh(const MatrixView& A);
+
+    /**
+     * @brief Computes the k largest eigenvalues of a symmetric matrix and
+     * their eigenvectors, e.g. the leading components of a PCA.
+     *
+     * After the tridiagonal reduction only the wanted eigenvalues are found,
+     * by bisection, and only their eigenvectors, by inverse iteration, so
+     * the back transformation works on k columns instead of n.
+     *
+     * @param A The symmetric matrix.
+     * @param k The number of eigenpairs, 1 <= k <= n.
+     * @return EighResult The k largest eigenvalues in ascending order and
+     * their eigenvectors as the columns of an n x k matrix.
+     * @throws astra::internals::exceptions::invalid_argument if k is out of
+     * range.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     */
+    static EighResult eigh(const Matrix& A, int k);
+
+    /**
+     * @brief Computes the k largest eigenpairs of the symmetric block seen
+     * by a view. See eigh(const Matrix&, int).
+     *
+     * @param A A view of the symmetric matrix.
+     * @param k The number of eigenpairs, 1 <= k <= n.
+     * @return EighResult The k largest eigenvalues in ascending order and
+     * their eigenvectors as the columns of an n x k matrix.
+     * @throws astra::internals::exceptions::invalid_argument if k is out of
+     * range.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     */
+    static EighResult eigh(const MatrixView& A, int k);
+
+    /**
+     * @brief Computes only the eigenvalues of a symmetric matrix.
+     *
+     * The tridiagonal matrix is solved by QL iteration without
+     * accumulating any vectors, which costs O(n^2) after the O(n^3)
+     * reduction.
+     *
+     * @param A The symmetric matrix.
+     * @return Vector The eigenvalues in ascending order.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     */
+    static Vector eigvalsh(const Matrix& A);
+
+    /**
+     * @brief Computes only the eigenvalues of the symmetric block seen by a
+     * view. See eigvalsh(const Matrix&).
+     *
+     * @param A A view of the symmetric matrix.
+     * @return Vector The eigenvalues in ascending order.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is not
+     * symmetric.
+     */
+    static Vector eigvalsh(const MatrixView& A);
+
+    /**
+     * @brief Computes the eigenvalues and eigenvectors of a general real
+     * square matrix.
+     *
+     * A is balanced by diagonal scaling and reduced to upper Hessenberg
+     * form by Householder reflectors. The implicit double-shift QR
+     * algorithm of Francis then brings it to real Schur form, with
+     * aggressive early deflation on blocks of 48 rows and more. The
+     * eigenvectors of the quasi triangular Schur form are found by back
+     * substitution and transformed back.
+     *
+     * @param A The n x n matrix.
+     * @return EigResult The complex eigenvalues and unit eigenvectors.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::no_convergence if the QR
+     * iteration does not converge.
+     */
+    static EigResult eig(const Matrix& A);
+
+    /**
+     * @brief Computes the eigenvalues and eigenvectors of the square block
+     * seen by a view. See eig(const Matrix&).
+     *
+     * @param A A view of the n x n matrix.
+     * @return EigResult The complex eigenvalues and unit eigenvectors.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::no_convergence if the QR
+     * iteration does not converge.
+     */
+    static EigResult eig(const MatrixView& A);
+
+    /**
+     * @brief Computes only the eigenvalues of a general real square matrix.
+     *
+     * This is eig without the eigenvectors, the QR iteration then only
+     * updates the rows and columns of the block that is still active.
+     *
+     * @param A The n x n matrix.
+     * @return VectorC The eigenvalues, complex pairs at consecutive
+     * positions with the positive imaginary part first.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::no_convergence if the QR
+     * iteration does not converge.
+     */
+    static VectorC eigvals(const Matrix& A);
+
+    /**
+     * @brief Computes only the eigenvalues of the square block seen by a
+     * view. See eigvals(const Matrix&).
+     *
+     * @param A A view of the n x n matrix.
+     * @return VectorC The eigenvalues.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::no_convergence if the QR
+     * iteration does not converge.
+     */
+    static VectorC eigvals(const MatrixView& A);
+
+    /**
+     * @brief Computes the singular value decomposition A = U * S * V^T of
+     * an m x n matrix.
+     *
+     * A is reduced to upper bidiagonal form by Householder reflectors from
+     * both sides, in panels of 32 whose trailing updates are matrix
+     * products. The SVD of the bidiagonal is found by divide and conquer
+     * and its vectors are transformed back by the reflectors, again in
+     * blocks. A matrix at least 1.6 times as tall as it is wide is factored
+     * by QR first and only R is bidiagonalized, and a wide matrix is
+     * handled through its transpose.
+     *
+     * @param A The matrix to decompose.
+     * @param full_matrices When false (the default) the economy-size factors
+     * are returned: with p = min(m, n), U is m x p and VT is p x n. When
+     * true U is m x m and VT is n x n.
+     * @return SVDResult The factors U, S and VT.
+     * @throws astra::internals::exceptions::no_convergence if the
+     * iteration on a block of the bidiagonal does not converge.
+     */
+    static SVDResult svd(const Matrix& A, bool full_matrices = false);
+
+    /**
+     * @brief Computes the singular value decomposition of the block seen by
+     * a view. See svd(const Matrix&, bool).
+     *
+     * @param A A view of the matrix to decompose.
+     * @param full_matrices Returns the full instead of the economy-size
+     * factors when true.
+     * @return SVDResult The factors U, S and VT.
+     * @throws astra::internals::exceptions::no_convergence if the
+     * iteration on a block of the bidiagonal does not converge.
+     */
+    static SVDResult svd(const MatrixView& A, bool full_matrices = false);
+
+    /**
+     * @brief Computes only the singular values of a matrix.
+     *
+     * This is the reduction of svd without forming any singular vectors.
+     * The bidiagonal is diagonalized by implicitly shifted QR iteration,
+     * which is O(min(m, n)^2) work after the reduction.
+     *
+     * @param A The matrix.
+     * @return Vector The min(m, n) singular values in descending order.
+     * @throws astra::internals::exceptions::no_convergence if the
+     * iteration does not converge.
+     */
+    static Vector singular_values(const Matrix& A);
+
+    /**
+     * @brief Computes only the singular values of the block seen by a view.
+     * See singular_values(const Matrix&).
+     *
+     * @param A A view of the matrix.
+     * @return Vector The min(m, n) singular values in descending order.
+     * @throws astra::internals::exceptions::no_convergence if the
+     * iteration does not converge.
+     */
+    static Vector singular_values(const MatrixView& A);
+    /**
+     * @brief Computes the k largest singular triplets of a matrix by
+     * randomized range finding.
+     *
+     * A is multiplied by an n x l Gaussian matrix, l = k + oversample, and
+     * the product is orthonormalized by QR into Q. Each power iteration
+     * replaces Q by an orthonormal basis of A A^T Q, which sharpens the
+     * decay of the singular values that Q captures. The l x n matrix
+     * Q^T A then gets a full svd and its left vectors are mapped back by
+     * Q. Every step is a matrix product or a QR of a tall matrix with l
+     * columns, so the work is O(m n l) per pass over A.
+     *
+     * @param A The m x n matrix.
+     * @param k The number of singular triplets, 1 <= k <= min(m, n).
+     * @param oversample Extra columns of the sketch beyond k, l is capped
+     * at min(m, n).
+     * @param power_iters The number of power iterations.
+     * @param seed Seed of the generator for the Gaussian matrix, the same
+     * seed gives the same result.
+     * @return SVDResult U with k columns, the k singular values in
+     * descending order and VT with k rows.
+     * @throws astra::internals::exceptions::invalid_argument if k is out of
+     * range or oversample or power_iters is negative.
+     */
+    static SVDResult randomized_svd(const Matrix& A, int k,
+                                    int oversample = 10, int power_iters = 2,
+                                    unsigned long long seed = 0);
+
+    /**
+     * @brief Computes the k largest singular triplets of the block seen by
+     * a view. See randomized_svd(const Matrix&, int, int, int,
+     * unsigned long long).
+     *
+     * @param A A view of the m x n matrix.
+     * @param k The number of singular triplets, 1 <= k <= min(m, n).
+     * @param oversample Extra columns of the sketch beyond k.
+     * @param power_iters The number of power iterations.
+     * @param seed Seed of the generator for the Gaussian matrix.
+     * @return SVDResult U with k columns, the k singular values in
+     * descending order and VT with k rows.
+     * @throws astra::internals::exceptions::invalid_argument if k is out of
+     * range or oversample or power_iters is negative.
+     */
+    static SVDResult randomized_svd(const MatrixView& A, int k,
+                                    int oversample = 10, int power_iters = 2,
+                                    unsigned long long seed = 0);
 };
 } // namespace astra
 #endif // !__DECOMPOSER_H__
@@ -0,0 +1,494 @@
+/**
+ * @file Expression.h
+ * @brief Declaration of the expression templates used for lazy element-wise
+ * Matrix and Vector arithmetic.
+ *
+ * `operator+`, `operator-`, scalar `operator*` and `operator/` on matrices and
+ * vectors do not compute anything themselves. They return lightweight
+ * expression objects that record the operation, and the whole expression is
+ * evaluated in a single fused loop when it is assigned to (or used to
+ * construct) a Matrix or Vector, without intermediate buffers:
+ *
+ *     Matrix R = A + B - C * 2.0; // one pass, one allocation (for R)
+ *
+ * Matrix and Vector operands are held by reference, so an expression must not
+ * outlive them. Store results in a Matrix or Vector rather than `auto`.
+ */
+
+#ifndef __EXPRESSION_H__
+#define __EXPRESSION_H__
+
+#include "../internals/Exceptions.h"
+#include "../internals/MathUtils.h"
+#include "../internals/Simd.h"
+#include "../internals/ThreadPool.h"
+
+#include <type_traits>
+
+namespace astra {
+
+template <typename T>
+class BasicMatrix;
+
+template <typename T>
+class BasicVector;
+
+/**
+ * @class MatrixExpr
+ * @brief CRTP base of everything that can be evaluated element-wise into a
+ * Matrix, including Matrix itself.
+ */
+template <typename E>
+class MatrixExpr {
+  public:
+    /**
+     * @brief Returns the concrete expression.
+     */
+    const E& derived() const { return static_cast<const E&>(*this); }
+};
+
+/**
+ * @class VectorExpr
+ * @brief CRTP base of everything that can be evaluated element-wise into a
+ * Vector, including Vector itself.
+ */
+template <typename E>
+class VectorExpr {
+  public:
+    /**
+     * @brief Returns the concrete expression.
+     */
+    const E& derived() const { return static_cast<const E&>(*this); }
+};
+
+namespace internals::expr {
+
+    template <typename T>
+    constexpr bool is_matrix_expr = std::is_base_of<MatrixExpr<T>, T>::value;
+
+    template <typename T>
+    constexpr bool is_vector_expr = std::is_base_of<VectorExpr<T>, T>::value;
+
+    // true for the containers that own their elements, BasicMatrix and
+    // BasicVector
+    template <typename T>
+    struct is_dense : std::false_type {};
+
+    template <typename T>
+    struct is_dense<BasicMatrix<T>> : std::true_type {};
+
+    template <typename T>
+    struct is_dense<BasicVector<T>> : std::true_type {};
+
+    // element type shared by two operands, operands of different element
+    // types cannot be combined
+    template <typename L, typename R>
+    using common_value_t = std::enable_if_t<
+        std::is_same<typename L::value_type, typename R::value_type>::value,
+        typename L::value_type>;
+
+    // Matrix and Vector operands are stored by reference, nested expression
+    // nodes are small and stored by value so temporaries never dangle
+    template <typename T>
+    using operand_t =
+        std::conditional_t<is_dense<T>::value, const T&, const T>;
+
+    // raw storage of the leaf operands, defined in Matrix.h and Vector.h
+    template <typename T>
+    inline const T* data_of(const BasicMatrix<T>& mat);
+
+    template <typename T>
+    inline const T* data_of(const BasicVector<T>& vec);
+
+    struct add {
+        template <typename T>
+        static T apply(const T& a, const T& b) {
+            return a + b;
+        }
+
+        template <typename T>
+        static void kernel(const T* a, const T* b, T* dst, int n) {
+            simd::add(a, b, dst, n);
+        }
+    };
+
+    struct sub {
+        template <typename T>
+        static T apply(const T& a, const T& b) {
+            return a - b;
+        }
+
+        template <typename T>
+        static void kernel(const T* a, const T* b, T* dst, int n) {
+            simd::sub(a, b, dst, n);
+        }
+    };
+
+    struct mul {
+        template <typename T>
+        static T apply(const T& a, const T& b) {
+            return a * b;
+        }
+
+        template <typename T>
+        static void kernel(const T* a, const T* b, T* dst, int n) {
+            simd::mul(a, b, dst, n);
+        }
+
+        template <typename T>
+        static void kernel(const T* a, const T& s, T* dst, int n) {
+            simd::mul_scalar(a, s, dst, n);
+        }
+    };
+
+    struct div {
+        template <typename T>
+        static T apply(const T& a, const T& b) {
+            return a / b;
+        }
+
+        template <typename T>
+        static void kernel(const T* a, const T* b, T* dst, int n) {
+            simd::div(a, b, dst, n);
+        }
+
+        template <typename T>
+        static void kernel(const T* a, const T& s, T* dst, int n) {
+            simd::div_scalar(a, s, dst, n);
+        }
+    };
+
+    /**
+     * @brief Writes dst[i] = expr.coeff(i) for i in [0, n), split across the
+     * thread pool for large sizes.
+     *
+     * Every node is element-wise, so dst may be one of the operands.
+     */
+    template <typename T, typename E>
+    void assign(T* dst, const E& expr, int n) {
+        threading::parallel_for(
+            0, n, threading::MIN_PARALLEL_WORK,
+            [dst, &expr](int lo, int hi) { expr.eval(dst, lo, hi); });
+    }
+
+} // namespace internals::expr
+
+/**
+ * @class MatrixBinaryExpr
+ * @brief Lazy element-wise combination of two equally sized matrix
+ * expressions.
+ */
+template <typename L, typename R, typename Op>
+class MatrixBinaryExpr : public MatrixExpr<MatrixBinaryExpr<L, R, Op>> {
+  private:
+    internals::expr::operand_t<L> lhs;
+    internals::expr::operand_t<R> rhs;
+
+  public:
+    using value_type = internals::expr::common_value_t<L, R>;
+
+    /**
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the
+     * operands are not of the same size.
+     */
+    MatrixBinaryExpr(const L& l, const R& r) : lhs(l), rhs(r) {
+        if (lhs.num_row() != rhs.num_row() || lhs.num_col() != rhs.num_col()) {
+            throw astra::internals::exceptions::matrix_size_mismatch();
+        }
+    }
+
+    int num_row() const { return lhs.num_row(); }
+    int num_col() const { return lhs.num_col(); }
+
+    value_type coeff(int i) const {
+        return Op::apply(lhs.coeff(i), rhs.coeff(i));
+    }
+
+    /**
+     * @brief Writes coeff(i) to dst[i] for i in [lo, hi). Two plain matrices
+     * are combined with a SIMD kernel.
+     */
+    void eval(value_type* dst, int lo, int hi) const {
+        if constexpr (internals::expr::is_dense<L>::value &&
+                      internals::expr::is_dense<R>::value) {
+            Op::kernel(internals::expr::data_of(lhs) + lo,
+                       internals::expr::data_of(rhs) + lo, dst + lo, hi - lo);
+        }
+        else {
+            for (int i = lo; i < hi; ++i) {
+                dst[i] = coeff(i);
+            }
+        }
+    }
+};
+
+/**
+ * @class MatrixScalarExpr
+ * @brief Lazy element-wise combination of a matrix expression with a scalar.
+ */
+template <typename E, typename Op>
+class MatrixScalarExpr : public MatrixExpr<MatrixScalarExpr<E, Op>> {
+  private:
+    internals::expr::operand_t<E> expr;
+    typename E::value_type scalar;
+
+  public:
+    using value_type = typename E::value_type;
+
+    MatrixScalarExpr(const E& e, const value_type& s) : expr(e), scalar(s) {}
+
+    int num_row() const { return expr.num_row(); }
+    int num_col() const { return expr.num_col(); }
+
+    value_type coeff(int i) const { return Op::apply(expr.coeff(i), scalar); }
+
+    /**
+     * @brief Writes coeff(i) to dst[i] for i in [lo, hi). A plain matrix is
+     * scaled with a SIMD kernel.
+     */
+    void eval(value_type* dst, int lo, int hi) const {
+        if constexpr (internals::expr::is_dense<E>::value) {
+            Op::kernel(internals::expr::data_of(expr) + lo, scalar, dst + lo,
+                       hi - lo);
+        }
+        else {
+            for (int i = lo; i < hi; ++i) {
+                dst[i] = coeff(i);
+            }
+        }
+    }
+};
+
+/**
+ * @class VectorBinaryExpr
+ * @brief Lazy element-wise combination of two equally sized vector
+ * expressions.
+ */
+template <typename L, typename R, typename Op>
+class VectorBinaryExpr : public VectorExpr<VectorBinaryExpr<L, R, Op>> {
+  private:
+    internals::expr::operand_t<L> lhs;
+    internals::expr::operand_t<R> rhs;
+
+  public:
+    using value_type = internals::expr::common_value_t<L, R>;
+
+    /**
+     * @throws astra::internals::exceptions::vector_size_mismatch if the
+     * operands are not of the same size.
+     */
+    VectorBinaryExpr(const L& l, const R& r) : lhs(l), rhs(r) {
+        if (lhs.get_size() != rhs.get_size()) {
+            throw astra::internals::exceptions::vector_size_mismatch();
+        }
+    }
+
+    int get_size() const { return lhs.get_size(); }
+
+    value_type coeff(int i) const {
+        return Op::apply(lhs.coeff(i), rhs.coeff(i));
+    }
+
+    /**
+     * @brief Writes coeff(i) to dst[i] for i in [lo, hi). Two plain vectors
+     * are combined with a SIMD kernel.
+     */
+    void eval(value_type* dst, int lo, int hi) const {
+        if constexpr (internals::expr::is_dense<L>::value &&
+                      internals::expr::is_dense<R>::value) {
+            Op::kernel(internals::expr::data_of(lhs) + lo,
+                       internals::expr::data_of(rhs) + lo, dst + lo, hi - lo);
+        }
+        else {
+            for (int i = lo; i < hi; ++i) {
+                dst[i] = coeff(i);
+            }
+        }
+    }
+};
+
+/**
+ * @class VectorScalarExpr
+ * @brief Lazy element-wise combination of a vector expression with a scalar.
+ */
+template <typename E, typename Op>
+class VectorScalarExpr : public VectorExpr<VectorScalarExpr<E, Op>> {
+  private:
+    internals::expr::operand_t<E> expr;
+    typename E::value_type scalar;
+
+  public:
+    using value_type = typename E::value_type;
+
+    VectorScalarExpr(const E& e, const value_type& s) : expr(e), scalar(s) {}
+
+    int get_size() const { return expr.get_size(); }
+
+    value_type coeff(int i) const { return Op::apply(expr.coeff(i), scalar); }
+
+    /**
+     * @brief Writes coeff(i) to dst[i] for i in [lo, hi). A plain vector is
+     * scaled with a SIMD kernel.
+     */
+    void eval(value_type* dst, int lo, int hi) const {
+        if constexpr (internals::expr::is_dense<E>::value) {
+            Op::kernel(internals::expr::data_of(expr) + lo, scalar, dst + lo,
+                       hi - lo);
+        }
+        else {
+            for (int i = lo; i < hi; ++i) {
+                dst[i] = coeff(i);
+            }
+        }
+    }
+};
+
+/**
+ * @brief Element-wise sum of two matrix expressions.
+ * @throws astra::internals::exceptions::matrix_size_mismatch if the
+ * matrices are not of the same size.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_matrix_expr<L> &&
+                               internals::expr::is_matrix_expr<R>,
+                           int> = 0,
+          typename = internals::expr::common_value_t<L, R>>
+MatrixBinaryExpr<L, R, internals::expr::add> operator+(const L& lhs,
+                                                       const R& rhs) {
+    return MatrixBinaryExpr<L, R, internals::expr::add>(lhs, rhs);
+}
+
+/**
+ * @brief Element-wise difference of two matrix expressions.
+ * @throws astra::internals::exceptions::matrix_size_mismatch if the
+ * matrices are not of the same size.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_matrix_expr<L> &&
+                               internals::expr::is_matrix_expr<R>,
+                           int> = 0,
+          typename = internals::expr::common_value_t<L, R>>
+MatrixBinaryExpr<L, R, internals::expr::sub> operator-(const L& lhs,
+                                                       const R& rhs) {
+    return MatrixBinaryExpr<L, R, internals::expr::sub>(lhs, rhs);
+}
+
+/**
+ * @brief Multiplies each element of a matrix expression by a scalar.
+ */
+template <typename E,
+          std::enable_if_t<internals::expr::is_matrix_expr<E>, int> = 0>
+MatrixScalarExpr<E, internals::expr::mul>
+operator*(const E& mat, const typename E::value_type& scalar) {
+    return MatrixScalarExpr<E, internals::expr::mul>(mat, scalar);
+}
+
+template <typename E,
+          std::enable_if_t<internals::expr::is_matrix_expr<E>, int> = 0>
+MatrixScalarExpr<E, internals::expr::mul>
+operator*(const typename E::value_type& scalar, const E& mat) {
+    return MatrixScalarExpr<E, internals::expr::mul>(mat, scalar);
+}
+
+/**
+ * @brief Divides each element of a matrix expression by a scalar.
+ * @throws astra::internals::exceptions::zero_division if scalar is zero.
+ */
+template <typename E,
+          std::enable_if_t<internals::expr::is_matrix_expr<E>, int> = 0>
+MatrixScalarExpr<E, internals::expr::div>
+operator/(const E& mat, const typename E::value_type& scalar) {
+    if (internals::mathutils::nearly_equal(
+            scalar, typename E::value_type(0))) {
+        throw astra::internals::exceptions::zero_division();
+    }
+    return MatrixScalarExpr<E, internals::expr::div>(mat, scalar);
+}
+
+/**
+ * @brief Element-wise sum of two vector expressions.
+ * @throws astra::internals::exceptions::vector_size_mismatch if sizes don't
+ * match.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_vector_expr<L> &&
+                               internals::expr::is_vector_expr<R>,
+                           int> = 0,
+          typename = internals::expr::common_value_t<L, R>>
+VectorBinaryExpr<L, R, internals::expr::add> operator+(const L& lhs,
+                                                       const R& rhs) {
+    return VectorBinaryExpr<L, R, internals::expr::add>(lhs, rhs);
+}
+
+/**
+ * @brief Element-wise difference of two vector expressions.
+ * @throws astra::internals::exceptions::vector_size_mismatch if sizes don't
+ * match.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_vector_expr<L> &&
+                               internals::expr::is_vector_expr<R>,
+                           int> = 0,
+          typename = internals::expr::common_value_t<L, R>>
+VectorBinaryExpr<L, R, internals::expr::sub> operator-(const L& lhs,
+                                                       const R& rhs) {
+    return VectorBinaryExpr<L, R, internals::expr::sub>(lhs, rhs);
+}
+
+/**
+ * @brief Multiplies each element of a vector expression by a scalar.
+ */
+template <typename E,
+          std::enable_if_t<internals::expr::is_vector_expr<E>, int> = 0>
+VectorScalarExpr<E, internals::expr::mul>
+operator*(const E& vec, const typename E::value_type& scalar) {
+    return VectorScalarExpr<E, internals::expr::mul>(vec, scalar);
+}
+
+template <typename E,
+          std::enable_if_t<internals::expr::is_vector_expr<E>, int> = 0>
+VectorScalarExpr<E, internals::expr::mul>
+operator*(const typename E::value_type& scalar, const E& vec) {
+    return VectorScalarExpr<E, internals::expr::mul>(vec, scalar);
+}
+
+/**
+ * @brief Divides each element of a vector expression by a scalar.
+ * @throws astra::internals::exceptions::zero_division if scalar is zero.
+ */
+template <typename E,
+          std::enable_if_t<internals::expr::is_vector_expr<E>, int> = 0>
+VectorScalarExpr<E, internals::expr::div>
+operator/(const E& vec, const typename E::value_type& scalar) {
+    if (scalar == typename E::value_type(0)) {
+        throw astra::internals::exceptions::zero_division();
+    }
+    return VectorScalarExpr<E, internals::expr::div>(vec, scalar);
+}
+
+/**
+ * @brief Dot product of two vector expressions, computed without
+ * materializing either operand. For complex vectors the left operand is
+ * conjugated.
+ * @throws astra::internals::exceptions::vector_size_mismatch if sizes don't
+ * match.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_vector_expr<L> &&
+                               internals::expr::is_vector_expr<R>,
+                           int> = 0,
+          typename T = internals::expr::common_value_t<L, R>>
+T operator*(const L& lhs, const R& rhs) {
+    if (lhs.get_size() != rhs.get_size()) {
+        throw astra::internals::exceptions::vector_size_mismatch();
+    }
+    T result = T(0);
+    for (int i = 0; i < lhs.get_size(); ++i) {
+        result += internals::mathutils::conj(lhs.coeff(i)) * rhs.coeff(i);
+    }
+    return result;
+}
+
+} // namespace astra
+
+#endif // !__EXPRESSION_H__
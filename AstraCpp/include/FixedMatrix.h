@@ -0,0 +1,516 @@
+/**
+ * @file FixedMatrix.h
+ * @brief Declaration of the FixedMatrix class template, a matrix whose
+ * dimensions are known at compile time and whose elements live in the object
+ * itself.
+ */
+
+#ifndef __FIXED_MATRIX_H__
+#define __FIXED_MATRIX_H__
+
+#include "../internals/Config.h"
+#include "../internals/Exceptions.h"
+#include "../internals/MathUtils.h"
+#include "../internals/Utils.h"
+#include "FixedVector.h"
+#include "Matrix.h"
+
+#include <iostream>
+#include <type_traits>
+
+namespace astra {
+
+/**
+ * @class FixedMatrix
+ * @brief An R x C matrix with stack storage in row-major order.
+ *
+ * Meant for the many small (2x2, 3x3 and 4x4) matrices used in geometry,
+ * where the heap allocation and the runtime-sized loops of Matrix dominate.
+ * Products are unrolled at compile time, and det and inv use closed forms up
+ * to 4x4. For real element types everything except the comparisons is
+ * usable in constant expressions. A FixedMatrix converts to and from a Matrix
+ * of the same element type.
+ *
+ * @tparam R The number of rows.
+ * @tparam C The number of columns.
+ * @tparam T The element type, double by default.
+ */
+template <int R, int C, typename T = double>
+class FixedMatrix {
+    static_assert(R > 0 && C > 0, "a FixedMatrix needs at least one element");
+
+  private:
+    T values[R * C];
+
+    template <int R2, int C2, typename U>
+    friend class FixedMatrix;
+
+    // squared magnitude for complex numbers, used to pick pivots and to
+    // test for singularity without calls that are not constexpr
+    static constexpr internals::mathutils::real_t<T> size_of(const T& x) {
+        if constexpr (internals::mathutils::is_complex_v<T>) {
+            return x.real() * x.real() + x.imag() * x.imag();
+        }
+        else {
+            return x < T(0) ? -x : x;
+        }
+    }
+
+    // the tolerance Matrix::is_singular uses
+    static constexpr bool nearly_zero(const T& x) {
+        if constexpr (internals::mathutils::is_complex_v<T>) {
+            return size_of(x) <= 1e-12;
+        }
+        else {
+            return size_of(x) <= 1e-6;
+        }
+    }
+
+    // determinant by elimination with partial pivoting, for sizes above 4
+    constexpr T det_elimination() const {
+        FixedMatrix a(*this);
+        T det = T(1);
+        for (int k = 0; k < R; ++k) {
+            int pivot = k;
+            for (int i = k + 1; i < R; ++i) {
+                if (size_of(a.values[i * C + k]) >
+                    size_of(a.values[pivot * C + k])) {
+                    pivot = i;
+                }
+            }
+            if (nearly_zero(a.values[pivot * C + k])) {
+                return T(0);
+            }
+            if (pivot != k) {
+                for (int j = k; j < C; ++j) {
+                    T temp = a.values[k * C + j];
+                    a.values[k * C + j] = a.values[pivot * C + j];
+                    a.values[pivot * C + j] = temp;
+                }
+                det = -det;
+            }
+            det *= a.values[k * C + k];
+            for (int i = k + 1; i < R; ++i) {
+                T factor = a.values[i * C + k] / a.values[k * C + k];
+                for (int j = k + 1; j < C; ++j) {
+                    a.values[i * C + j] -= factor * a.values[k * C + j];
+                }
+            }
+        }
+        return det;
+    }
+
+    // inverse by Gauss-Jordan elimination with partial pivoting, for sizes
+    // above 4
+    constexpr FixedMatrix inv_elimination() const {
+        FixedMatrix a(*this);
+        FixedMatrix inverse = identity();
+        for (int k = 0; k < R; ++k) {
+            int pivot = k;
+            for (int i = k + 1; i < R; ++i) {
+                if (size_of(a.values[i * C + k]) >
+                    size_of(a.values[pivot * C + k])) {
+                    pivot = i;
+                }
+            }
+            if (nearly_zero(a.values[pivot * C + k])) {
+                throw astra::internals::exceptions::singular_matrix();
+            }
+            if (pivot != k) {
+                for (int j = 0; j < C; ++j) {
+                    T temp = a.values[k * C + j];
+                    a.values[k * C + j] = a.values[pivot * C + j];
+                    a.values[pivot * C + j] = temp;
+                    temp = inverse.values[k * C + j];
+                    inverse.values[k * C + j] = inverse.values[pivot * C + j];
+                    inverse.values[pivot * C + j] = temp;
+                }
+            }
+            T scale = T(1) / a.values[k * C + k];
+            for (int j = 0; j < C; ++j) {
+                a.values[k * C + j] *= scale;
+                inverse.values[k * C + j] *= scale;
+            }
+            for (int i = 0; i < R; ++i) {
+                if (i == k) {
+                    continue;
+                }
+                T factor = a.values[i * C + k];
+                for (int j = 0; j < C; ++j) {
+                    a.values[i * C + j] -= factor * a.values[k * C + j];
+                    inverse.values[i * C + j] -=
+                        factor * inverse.values[k * C + j];
+                }
+            }
+        }
+        return inverse;
+    }
+
+  public:
+    using value_type = T;
+    using real_type = internals::mathutils::real_t<T>;
+
+    /**
+     * @brief Constructs a matrix with all elements set to zero.
+     */
+    constexpr FixedMatrix() : values{} {}
+
+    /**
+     * @brief Constructs a matrix from exactly R * C values in row-major
+     * order.
+     * @param args The values of the elements.
+     */
+    template <typename... Args,
+              std::enable_if_t<sizeof...(Args) == R * C &&
+                                   (std::is_convertible<Args, T>::value &&
+                                    ...),
+                               int> = 0>
+    constexpr FixedMatrix(Args... args) : values{static_cast<T>(args)...} {}
+
+    /**
+     * @brief Constructs a matrix by copying a dynamic matrix.
+     * @param mat The matrix to copy from.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if `mat` is
+     * not R x C.
+     */
+    explicit FixedMatrix(const BasicMatrix<T>& mat) : values{} {
+        if (mat.num_row() != R || mat.num_col() != C) {
+            throw astra::internals::exceptions::matrix_size_mismatch();
+        }
+        const T* data = mat.data();
+        internals::utils::unroll<R * C>([&](int i) { values[i] = data[i]; });
+    }
+
+    /**
+     * @brief Converts this matrix to a dynamic matrix of the same size.
+     */
+    operator BasicMatrix<T>() const { return BasicMatrix<T>(R, C, values); }
+
+    /**
+     * @brief Returns the identity matrix.
+     */
+    static constexpr FixedMatrix identity() {
+        static_assert(R == C, "identity is defined for square matrices only");
+        FixedMatrix result;
+        internals::utils::unroll<R>(
+            [&](int i) { result.values[i * C + i] = T(1); });
+        return result;
+    }
+
+    /**
+     * @brief Returns the number of rows, R.
+     */
+    static constexpr int num_row() { return R; }
+
+    /**
+     * @brief Returns the number of columns, C.
+     */
+    static constexpr int num_col() { return C; }
+
+    /**
+     * @brief Gives access to the element at row i and column j.
+     * @param i The row index.
+     * @param j The column index.
+     * @return A reference to the element.
+     * @throws astra::internals::exceptions::index_out_of_range if i or j is
+     * out of bounds and ASTRA_BOUNDS_CHECK is on.
+     */
+    constexpr T& operator()(int i, int j) {
+#if ASTRA_BOUNDS_CHECK
+        if (i < 0 || i >= R || j < 0 || j >= C) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return values[i * C + j];
+    }
+
+    constexpr const T& operator()(int i, int j) const {
+#if ASTRA_BOUNDS_CHECK
+        if (i < 0 || i >= R || j < 0 || j >= C) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return values[i * C + j];
+    }
+
+    constexpr FixedMatrix& operator+=(const FixedMatrix& other) {
+        internals::utils::unroll<R * C>(
+            [&](int i) { values[i] += other.values[i]; });
+        return *this;
+    }
+
+    constexpr FixedMatrix& operator-=(const FixedMatrix& other) {
+        internals::utils::unroll<R * C>(
+            [&](int i) { values[i] -= other.values[i]; });
+        return *this;
+    }
+
+    constexpr FixedMatrix& operator*=(const T& scalar) {
+        internals::utils::unroll<R * C>([&](int i) { values[i] *= scalar; });
+        return *this;
+    }
+
+    /**
+     * @throws astra::internals::exceptions::zero_division if scalar is zero.
+     */
+    constexpr FixedMatrix& operator/=(const T& scalar) {
+        if (scalar == T(0)) {
+            throw astra::internals::exceptions::zero_division();
+        }
+        internals::utils::unroll<R * C>([&](int i) { values[i] /= scalar; });
+        return *this;
+    }
+
+    friend constexpr FixedMatrix operator+(FixedMatrix lhs,
+                                           const FixedMatrix& rhs) {
+        return lhs += rhs;
+    }
+
+    friend constexpr FixedMatrix operator-(FixedMatrix lhs,
+                                           const FixedMatrix& rhs) {
+        return lhs -= rhs;
+    }
+
+    friend constexpr FixedMatrix operator-(FixedMatrix mat) {
+        internals::utils::unroll<R * C>(
+            [&](int i) { mat.values[i] = -mat.values[i]; });
+        return mat;
+    }
+
+    friend constexpr FixedMatrix operator*(FixedMatrix mat, const T& scalar) {
+        return mat *= scalar;
+    }
+
+    friend constexpr FixedMatrix operator*(const T& scalar, FixedMatrix mat) {
+        return mat *= scalar;
+    }
+
+    friend constexpr FixedMatrix operator/(FixedMatrix mat, const T& scalar) {
+        return mat /= scalar;
+    }
+
+    /**
+     * @brief Multiplies this matrix with a C x K matrix, fully unrolled.
+     * @param other The right hand side of the product.
+     * @return The R x K product.
+     */
+    template <int K>
+    constexpr FixedMatrix<R, K, T>
+    operator*(const FixedMatrix<C, K, T>& other) const {
+        FixedMatrix<R, K, T> result;
+        internals::utils::unroll<R * K>([&](int ij) {
+            const int i = ij / K;
+            const int j = ij % K;
+            T sum = T(0);
+            internals::utils::unroll<C>([&](int k) {
+                sum += values[i * C + k] * other.values[k * K + j];
+            });
+            result.values[ij] = sum;
+        });
+        return result;
+    }
+
+    /**
+     * @brief Multiplies this matrix with a vector of C elements, fully
+     * unrolled.
+     * @param vec The vector to multiply.
+     * @return The product, a vector of R elements.
+     */
+    constexpr FixedVector<R, T> operator*(const FixedVector<C, T>& vec) const {
+        FixedVector<R, T> result;
+        internals::utils::unroll<R>([&](int i) {
+            T sum = T(0);
+            internals::utils::unroll<C>(
+                [&](int k) { sum += values[i * C + k] * vec.values[k]; });
+            result.values[i] = sum;
+        });
+        return result;
+    }
+
+    /**
+     * @brief Compares two matrices element by element with a tolerance of
+     * 1e-8, like Vector. Matrix compares exactly.
+     */
+    friend bool operator==(const FixedMatrix& lhs, const FixedMatrix& rhs) {
+        bool equal = true;
+        internals::utils::unroll<R * C>([&](int i) {
+            equal = equal && internals::mathutils::abs(lhs.values[i] -
+                                                       rhs.values[i]) <= 1e-8;
+        });
+        return equal;
+    }
+
+    friend bool operator!=(const FixedMatrix& lhs, const FixedMatrix& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const FixedMatrix& mat) {
+        return os << BasicMatrix<T>(mat);
+    }
+
+    /**
+     * @brief Returns the transpose of this matrix. Unlike Matrix::transpose
+     * it does not work in place, since the shape changes with it.
+     */
+    constexpr FixedMatrix<C, R, T> transposed() const {
+        FixedMatrix<C, R, T> result;
+        internals::utils::unroll<R * C>([&](int ij) {
+            result.values[(ij % C) * R + ij / C] = values[ij];
+        });
+        return result;
+    }
+
+    /**
+     * @brief Returns the sum of the elements.
+     */
+    constexpr T sum() const {
+        T result = T(0);
+        internals::utils::unroll<R * C>([&](int i) { result += values[i]; });
+        return result;
+    }
+
+    /**
+     * @brief Returns the sum of the diagonal elements.
+     */
+    constexpr T trace() const {
+        static_assert(R == C, "trace is defined for square matrices only");
+        T result = T(0);
+        internals::utils::unroll<R>(
+            [&](int i) { result += values[i * C + i]; });
+        return result;
+    }
+
+    /**
+     * @brief Computes the determinant, with closed forms up to 4x4.
+     * @return The determinant of the matrix.
+     */
+    constexpr T det() const {
+        static_assert(R == C, "det is defined for square matrices only");
+        const T* a = values;
+        if constexpr (R == 1) {
+            return a[0];
+        }
+        else if constexpr (R == 2) {
+            return a[0] * a[3] - a[1] * a[2];
+        }
+        else if constexpr (R == 3) {
+            return a[0] * (a[4] * a[8] - a[5] * a[7]) -
+                   a[1] * (a[3] * a[8] - a[5] * a[6]) +
+                   a[2] * (a[3] * a[7] - a[4] * a[6]);
+        }
+        else if constexpr (R == 4) {
+            // Laplace expansion along the top two rows, using the 2x2 minors
+            // of rows 0 and 1 (s) and of rows 2 and 3 (c)
+            T s0 = a[0] * a[5] - a[4] * a[1];
+            T s1 = a[0] * a[6] - a[4] * a[2];
+            T s2 = a[0] * a[7] - a[4] * a[3];
+            T s3 = a[1] * a[6] - a[5] * a[2];
+            T s4 = a[1] * a[7] - a[5] * a[3];
+            T s5 = a[2] * a[7] - a[6] * a[3];
+            T c5 = a[10] * a[15] - a[14] * a[11];
+            T c4 = a[9] * a[15] - a[13] * a[11];
+            T c3 = a[9] * a[14] - a[13] * a[10];
+            T c2 = a[8] * a[15] - a[12] * a[11];
+            T c1 = a[8] * a[14] - a[12] * a[10];
+            T c0 = a[8] * a[13] - a[12] * a[9];
+            return s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+        }
+        else {
+            return det_elimination();
+        }
+    }
+
+    /**
+     * @brief Checks if the matrix is singular, i.e. its determinant is
+     * nearly zero.
+     */
+    constexpr bool is_singular() const { return nearly_zero(det()); }
+
+    /**
+     * @brief Computes the inverse, with closed forms (the adjugate over the
+     * determinant) up to 4x4.
+     * @return The inverse of the matrix.
+     * @throws astra::internals::exceptions::singular_matrix if the matrix is
+     * singular.
+     */
+    constexpr FixedMatrix inv() const {
+        static_assert(R == C, "inv is defined for square matrices only");
+        const T* a = values;
+        if constexpr (R == 1) {
+            if (nearly_zero(a[0])) {
+                throw astra::internals::exceptions::singular_matrix();
+            }
+            return FixedMatrix(T(1) / a[0]);
+        }
+        else if constexpr (R == 2) {
+            T det = this->det();
+            if (nearly_zero(det)) {
+                throw astra::internals::exceptions::singular_matrix();
+            }
+            return FixedMatrix(a[3], -a[1], -a[2], a[0]) / det;
+        }
+        else if constexpr (R == 3) {
+            FixedMatrix adj(a[4] * a[8] - a[5] * a[7],
+                            a[2] * a[7] - a[1] * a[8],
+                            a[1] * a[5] - a[2] * a[4],
+                            a[5] * a[6] - a[3] * a[8],
+                            a[0] * a[8] - a[2] * a[6],
+                            a[2] * a[3] - a[0] * a[5],
+                            a[3] * a[7] - a[4] * a[6],
+                            a[1] * a[6] - a[0] * a[7],
+                            a[0] * a[4] - a[1] * a[3]);
+            T det = a[0] * adj.values[0] + a[1] * adj.values[3] +
+                    a[2] * adj.values[6];
+            if (nearly_zero(det)) {
+                throw astra::internals::exceptions::singular_matrix();
+            }
+            return adj / det;
+        }
+        else if constexpr (R == 4) {
+            T s0 = a[0] * a[5] - a[4] * a[1];
+            T s1 = a[0] * a[6] - a[4] * a[2];
+            T s2 = a[0] * a[7] - a[4] * a[3];
+            T s3 = a[1] * a[6] - a[5] * a[2];
+            T s4 = a[1] * a[7] - a[5] * a[3];
+            T s5 = a[2] * a[7] - a[6] * a[3];
+            T c5 = a[10] * a[15] - a[14] * a[11];
+            T c4 = a[9] * a[15] - a[13] * a[11];
+            T c3 = a[9] * a[14] - a[13] * a[10];
+            T c2 = a[8] * a[15] - a[12] * a[11];
+            T c1 = a[8] * a[14] - a[12] * a[10];
+            T c0 = a[8] * a[13] - a[12] * a[9];
+            T det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            if (nearly_zero(det)) {
+                throw astra::internals::exceptions::singular_matrix();
+            }
+            FixedMatrix adj(a[5] * c5 - a[6] * c4 + a[7] * c3,
+                            -a[1] * c5 + a[2] * c4 - a[3] * c3,
+                            a[13] * s5 - a[14] * s4 + a[15] * s3,
+                            -a[9] * s5 + a[10] * s4 - a[11] * s3,
+                            -a[4] * c5 + a[6] * c2 - a[7] * c1,
+                            a[0] * c5 - a[2] * c2 + a[3] * c1,
+                            -a[12] * s5 + a[14] * s2 - a[15] * s1,
+                            a[8] * s5 - a[10] * s2 + a[11] * s1,
+                            a[4] * c4 - a[5] * c2 + a[7] * c0,
+                            -a[0] * c4 + a[1] * c2 - a[3] * c0,
+                            a[12] * s4 - a[13] * s2 + a[15] * s0,
+                            -a[8] * s4 + a[9] * s2 - a[11] * s0,
+                            -a[4] * c3 + a[5] * c1 - a[6] * c0,
+                            a[0] * c3 - a[1] * c1 + a[2] * c0,
+                            -a[12] * s3 + a[13] * s1 - a[14] * s0,
+                            a[8] * s3 - a[9] * s1 + a[10] * s0);
+            return adj / det;
+        }
+        else {
+            return inv_elimination();
+        }
+    }
+};
+
+// the common small matrices
+using Matrix2 = FixedMatrix<2, 2>;
+using Matrix3 = FixedMatrix<3, 3>;
+using Matrix4 = FixedMatrix<4, 4>;
+
+} // namespace astra
+#endif // !__FIXED_MATRIX_H__
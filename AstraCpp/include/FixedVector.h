@@ -0,0 +1,292 @@
+/**
+ * @file FixedVector.h
+ * @brief Declaration of the FixedVector class template, a vector whose size
+ * is known at compile time and whose elements live in the object itself.
+ */
+
+#ifndef __FIXED_VECTOR_H__
+#define __FIXED_VECTOR_H__
+
+#include "../internals/Config.h"
+#include "../internals/Exceptions.h"
+#include "../internals/MathUtils.h"
+#include "../internals/Utils.h"
+#include "Vector.h"
+
+#include <cmath>
+#include <iostream>
+#include <type_traits>
+
+namespace astra {
+
+template <int R, int C, typename T>
+class FixedMatrix;
+
+/**
+ * @class FixedVector
+ * @brief A vector of N elements with stack storage.
+ *
+ * Meant for the many small (2, 3 and 4 element) vectors used in geometry,
+ * where the heap allocation and the runtime-sized loops of Vector dominate.
+ * Every operation is unrolled at compile time and, for real element types,
+ * usable in constant expressions. A FixedVector converts to and from a
+ * Vector of the same element type.
+ *
+ * @tparam N The number of elements.
+ * @tparam T The element type, double by default.
+ */
+template <int N, typename T = double>
+class FixedVector {
+    static_assert(N > 0, "a FixedVector needs at least one element");
+
+  private:
+    T values[N];
+
+    template <int R, int C, typename U>
+    friend class FixedMatrix;
+
+  public:
+    using value_type = T;
+    using real_type = internals::mathutils::real_t<T>;
+
+    /**
+     * @brief Constructs a vector with all elements set to zero.
+     */
+    constexpr FixedVector() : values{} {}
+
+    /**
+     * @brief Constructs a vector from exactly N values.
+     * @param args The values of the elements, in order.
+     */
+    template <typename... Args,
+              std::enable_if_t<sizeof...(Args) == N &&
+                                   (std::is_convertible<Args, T>::value &&
+                                    ...),
+                               int> = 0>
+    constexpr FixedVector(Args... args) : values{static_cast<T>(args)...} {}
+
+    /**
+     * @brief Constructs a vector by copying a dynamic vector.
+     * @param vec The vector to copy from.
+     * @throws astra::internals::exceptions::vector_size_mismatch if the size
+     * of `vec` is not N.
+     */
+    explicit FixedVector(const BasicVector<T>& vec) : values{} {
+        if (vec.get_size() != N) {
+            throw astra::internals::exceptions::vector_size_mismatch();
+        }
+        const T* data = vec.data();
+        internals::utils::unroll<N>([&](int i) { values[i] = data[i]; });
+    }
+
+    /**
+     * @brief Converts this vector to a dynamic vector of the same size.
+     */
+    operator BasicVector<T>() const { return BasicVector<T>(N, values); }
+
+    /**
+     * @brief Returns the number of elements, N.
+     */
+    static constexpr int get_size() { return N; }
+
+    /**
+     * @brief Gives access to the element at index i.
+     * @param i The index of the element.
+     * @return A reference to the element.
+     * @throws astra::internals::exceptions::index_out_of_range if i is out of
+     * bounds and ASTRA_BOUNDS_CHECK is on.
+     */
+    constexpr T& operator[](int i) {
+#if ASTRA_BOUNDS_CHECK
+        if (i < 0 || i >= N) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return values[i];
+    }
+
+    constexpr const T& operator[](int i) const {
+#if ASTRA_BOUNDS_CHECK
+        if (i < 0 || i >= N) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return values[i];
+    }
+
+    constexpr FixedVector& operator+=(const FixedVector& other) {
+        internals::utils::unroll<N>(
+            [&](int i) { values[i] += other.values[i]; });
+        return *this;
+    }
+
+    constexpr FixedVector& operator-=(const FixedVector& other) {
+        internals::utils::unroll<N>(
+            [&](int i) { values[i] -= other.values[i]; });
+        return *this;
+    }
+
+    constexpr FixedVector& operator*=(const T& scalar) {
+        internals::utils::unroll<N>([&](int i) { values[i] *= scalar; });
+        return *this;
+    }
+
+    /**
+     * @throws astra::internals::exceptions::zero_division if scalar is zero.
+     */
+    constexpr FixedVector& operator/=(const T& scalar) {
+        if (scalar == T(0)) {
+            throw astra::internals::exceptions::zero_division();
+        }
+        internals::utils::unroll<N>([&](int i) { values[i] /= scalar; });
+        return *this;
+    }
+
+    friend constexpr FixedVector operator+(FixedVector lhs,
+                                           const FixedVector& rhs) {
+        return lhs += rhs;
+    }
+
+    friend constexpr FixedVector operator-(FixedVector lhs,
+                                           const FixedVector& rhs) {
+        return lhs -= rhs;
+    }
+
+    friend constexpr FixedVector operator-(FixedVector vec) {
+        internals::utils::unroll<N>(
+            [&](int i) { vec.values[i] = -vec.values[i]; });
+        return vec;
+    }
+
+    friend constexpr FixedVector operator*(FixedVector vec, const T& scalar) {
+        return vec *= scalar;
+    }
+
+    friend constexpr FixedVector operator*(const T& scalar, FixedVector vec) {
+        return vec *= scalar;
+    }
+
+    friend constexpr FixedVector operator/(FixedVector vec, const T& scalar) {
+        return vec /= scalar;
+    }
+
+    /**
+     * @brief Computes the dot product of two vectors. For complex vectors the
+     * left operand is conjugated.
+     */
+    friend constexpr T operator*(const FixedVector& lhs,
+                                 const FixedVector& rhs) {
+        T result = T(0);
+        internals::utils::unroll<N>([&](int i) {
+            if constexpr (internals::mathutils::is_complex_v<T>) {
+                result += std::conj(lhs.values[i]) * rhs.values[i];
+            }
+            else {
+                result += lhs.values[i] * rhs.values[i];
+            }
+        });
+        return result;
+    }
+
+    /**
+     * @brief Computes the cross product of two 3 element vectors.
+     */
+    friend constexpr FixedVector operator^(const FixedVector& lhs,
+                                           const FixedVector& rhs) {
+        static_assert(N == 3, "cross product is defined for 3D vectors only");
+        const T* a = lhs.values;
+        const T* b = rhs.values;
+        return FixedVector(a[1] * b[2] - a[2] * b[1],
+                           a[2] * b[0] - a[0] * b[2],
+                           a[0] * b[1] - a[1] * b[0]);
+    }
+
+    /**
+     * @brief Compares two vectors element by element with a tolerance of
+     * 1e-8, like Vector.
+     */
+    friend bool operator==(const FixedVector& lhs, const FixedVector& rhs) {
+        bool equal = true;
+        internals::utils::unroll<N>([&](int i) {
+            equal = equal && internals::mathutils::abs(lhs.values[i] -
+                                                       rhs.values[i]) <= 1e-8;
+        });
+        return equal;
+    }
+
+    friend bool operator!=(const FixedVector& lhs, const FixedVector& rhs) {
+        return !(lhs == rhs);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const FixedVector& vec) {
+        return os << BasicVector<T>(vec);
+    }
+
+    /**
+     * @brief Returns the sum of the elements.
+     */
+    constexpr T sum() const {
+        T result = T(0);
+        internals::utils::unroll<N>([&](int i) { result += values[i]; });
+        return result;
+    }
+
+    /**
+     * @brief Returns the magnitude (Euclidean norm) of the vector.
+     */
+    real_type mag() const {
+        real_type sum_of_squares = 0;
+        internals::utils::unroll<N>([&](int i) {
+            sum_of_squares += internals::mathutils::abs_sq(values[i]);
+        });
+        return std::sqrt(sum_of_squares);
+    }
+
+    /**
+     * @brief Returns the unit vector in the direction of this vector.
+     * @throws astra::internals::exceptions::zero_division if the vector is
+     * the zero vector.
+     */
+    FixedVector normalize() const {
+        real_type mag = this->mag();
+        if (mag == 0) {
+            throw astra::internals::exceptions::zero_division();
+        }
+        return *this / T(mag);
+    }
+
+    /**
+     * @brief Computes the angle between two vectors in radians.
+     * @throws astra::internals::exceptions::null_vector if either vector is
+     * the zero vector.
+     */
+    static real_type angle(const FixedVector& v1, const FixedVector& v2) {
+        real_type mag_v1 = v1.mag();
+        real_type mag_v2 = v2.mag();
+        if (mag_v1 == 0 || mag_v2 == 0) {
+            throw astra::internals::exceptions::null_vector();
+        }
+        double cos_theta =
+            internals::mathutils::real(v1 * v2) / (mag_v1 * mag_v2);
+        cos_theta = internals::mathutils::clamp(cos_theta, -1.0, 1.0);
+        return static_cast<real_type>(std::acos(cos_theta));
+    }
+
+    /**
+     * @brief Computes the angle between two vectors in degrees.
+     * @throws astra::internals::exceptions::null_vector if either vector is
+     * the zero vector.
+     */
+    static real_type angle_deg(const FixedVector& v1, const FixedVector& v2) {
+        return static_cast<real_type>(
+            internals::mathutils::rad_to_deg(angle(v1, v2)));
+    }
+};
+
+// the common small vectors
+using Vector2 = FixedVector<2>;
+using Vector3 = FixedVector<3>;
+using Vector4 = FixedVector<4>;
+
+} // namespace astra
+#endif // !__FIXED_VECTOR_H__
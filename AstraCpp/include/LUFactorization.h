@@ -0,0 +1,123 @@
+/**
+ * @file LUFactorization.h
+ * @brief Declaration of the LUFactorization class, a reusable LU
+ * factorization that solves many systems with the same coefficient matrix.
+ */
+
+#ifndef __LU_FACTORIZATION_H__
+#define __LU_FACTORIZATION_H__
+
+#include "Decomposer.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class LUFactorization
+ * @brief The LU factorization with partial pivoting of a square matrix,
+ * computed once and reused.
+ *
+ * Factoring costs O(n^3) while every solve afterwards costs O(n^2) per
+ * right-hand side, so a system matrix used with many right-hand sides
+ * should be factored once here instead of calling Solver::solve repeatedly.
+ * The factors are kept in the compact form of Decomposer::lu.
+ */
+class LUFactorization {
+  private:
+    Matrix lu;
+    std::vector<int> pivots;
+    int swaps;
+    bool singular;
+
+    explicit LUFactorization(Decomposer::LUResult res);
+
+    // solves A X = B in place for the n x k row-major block x
+    void solve_in_place(double* x, int k) const;
+
+  public:
+    /**
+     * @brief Factors a square matrix.
+     * @param A The matrix to factor.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    explicit LUFactorization(const Matrix& A);
+
+    /**
+     * @brief Factors the square block seen by a view.
+     * @param A A view of the matrix to factor.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    explicit LUFactorization(const MatrixView& A);
+
+    /**
+     * @brief Factors a matrix that is no longer needed, in its own storage.
+     * @param A The matrix to factor. Its storage is taken over.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    explicit LUFactorization(Matrix&& A);
+
+    /**
+     * @brief Returns the order n of the factored n x n matrix.
+     */
+    int size() const;
+
+    /**
+     * @brief Checks if the factored matrix is singular, i.e. a pivot column
+     * was nearly zero (within 1e-6) during the factorization.
+     */
+    bool is_singular() const;
+
+    /**
+     * @brief Returns the packed L and U factors, see Decomposer::LUResult.
+     */
+    const Matrix& packed() const;
+
+    /**
+     * @brief Returns the pivot indices, see Decomposer::LUResult.
+     */
+    const std::vector<int>& get_pivots() const;
+
+    /**
+     * @brief Solves Ax = b for the factored A.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the size of b is not n.
+     * @throws astra::internals::exceptions::singular_matrix if A is singular.
+     */
+    Vector solve(const VectorView& b) const;
+
+    /**
+     * @brief Solves AX = B for the factored A and every column of B at once.
+     * @param B The right-hand sides, one per column.
+     * @return Matrix The solutions, one per column.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if B does not have n rows.
+     * @throws astra::internals::exceptions::singular_matrix if A is singular.
+     */
+    Matrix solve(const MatrixView& B) const;
+
+    /**
+     * @brief Computes the determinant from the diagonal of U and the number
+     * of row swaps.
+     * @return The determinant of the factored matrix.
+     */
+    double det() const;
+
+    /**
+     * @brief Computes the inverse by solving against the identity.
+     * @return Matrix The inverse of the factored matrix.
+     * @throws astra::internals::exceptions::singular_matrix if A is singular.
+     */
+    Matrix inverse() const;
+};
+
+} // namespace astra
+
+#endif // !__LU_FACTORIZATION_H__
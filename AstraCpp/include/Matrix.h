@@ -1,33 +1,52 @@
 /**
  * @file Matrix.h
- * @brief Declaration of the Matrix class, which provides some basic matrix
- * operations for linear algebra.
+ * @brief Declaration of the BasicMatrix class template, which provides some
+ * basic matrix operations for linear algebra, and of its Matrix aliases.
  */
 
 #ifndef __MATRIX_H__
 #define __MATRIX_H__
 
+#include "../internals/Config.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Memory.h"
+#include "Expression.h"
+#include "MatrixView.h"
+#include "Vector.h"
+
+#include <complex>
 #include <iostream>
 
 namespace astra {
 
-class Vector;
-
 /**
- * @class Matrix
+ * @class BasicMatrix
  * @brief A class for representing mathematical matrices with various operations.
  *
  * This class supports basic matrix operations such as addition, subtraction,
  * scalar multiplication, matrix multiplication, transpose and more.
+ * Element-wise operations are lazy, see Expression.h.
+ *
+ * @tparam T The element type: float, double, std::complex<float> or
+ * std::complex<double>. Matrix is the double instantiation.
  */
-class Matrix {
+template <typename T>
+class BasicMatrix : public MatrixExpr<BasicMatrix<T>> {
   private:
     int rows;
     int cols;
     int current_index;
-    double* values;
+    T* values;
+
+    // reduces this matrix to its row reduced echelon form
+    void rref_in_place(double tol);
+
+    friend class BasicMatrixView<T>;
 
   public:
+    using value_type = T;
+    using real_type = internals::mathutils::real_t<T>;
+
     /**
      * @brief Constructs a matrix of a specified size, initializing all elements
      * to zero.
@@ -35,7 +54,7 @@ class Matrix {
      * @param col The number of columns in the matrix.
      * @throws astra::internals::exceptions::invalid_size if r or c is <= 0.
      */
-    Matrix(int row, int col);
+    BasicMatrix(int row, int col);
 
     /**
      * @brief Constructs a matrix from an array of values.
@@ -44,7 +63,7 @@ class Matrix {
      * @param values An array of values to initialize the matrix.
      * @throws astra::internals::exceptions::invalid_size if r or c is <= 0.
      */
-    Matrix(int row, int col, const double values[]);
+    BasicMatrix(int row, int col, const T values[]);
 
     /**
      * @brief Constructs a matrix from an initializer list of values.
@@ -53,18 +72,44 @@ class Matrix {
      * @param values An initializer list of values to initialize the matrix.
      * @throws astra::internals::exceptions::invalid_size if r or c is <= 0.
      */
-    Matrix(int row, int col, std::initializer_list<double> values);
+    BasicMatrix(int row, int col, std::initializer_list<T> values);
 
     /**
      * @brief Copy constructor for deep copying another matrix.
      * @param other The matrix to copy from.
      */
-    Matrix(const Matrix& other);
+    BasicMatrix(const BasicMatrix& other);
+
+    /**
+     * @brief Move constructor, takes over the storage of another matrix.
+     * @param other The matrix to move from. It is left empty (0 x 0) and may
+     * only be assigned to or destroyed.
+     */
+    BasicMatrix(BasicMatrix&& other) noexcept;
+
+    /**
+     * @brief Constructs a matrix by copying the block seen by a view.
+     * @param view The view to copy from.
+     */
+    explicit BasicMatrix(const BasicMatrixView<T>& view);
+
+    /**
+     * @brief Constructs a matrix by evaluating an element-wise expression in a
+     * single pass.
+     * @param expr The expression to evaluate, e.g. `A + B * 2.0`.
+     */
+    template <typename E>
+    BasicMatrix(const MatrixExpr<E>& expr)
+        : rows(expr.derived().num_row()), cols(expr.derived().num_col()),
+          current_index(0),
+          values(internals::memory::allocate<T>(rows * cols)) {
+        internals::expr::assign(values, expr.derived(), rows * cols);
+    }
 
     /**
      * @brief Destructor to free dynamically allocated memory.
      */
-    ~Matrix();
+    ~BasicMatrix();
 
     /**
      * @brief Overloaded operator to insert a value into the matrix.
@@ -73,14 +118,14 @@ class Matrix {
      * @throws astra::internals::exceptions::init_out_of_range if current index
      * is >= row or col.
      */
-    Matrix& operator<<(double val);
+    BasicMatrix& operator<<(T val);
 
     /**
      * @brief Overloaded operator to insert a value into the matrix.
      * @param val The value to insert.
      * @return A reference to the matrix object.
      */
-    Matrix& operator,(double val);
+    BasicMatrix& operator,(T val);
 
     /**
      * @brief Overloaded operator to access a value in the matrix.
@@ -88,10 +133,17 @@ class Matrix {
      * @param j The column index.
      * @return A reference to the value at the specified row and column.
      * @throws astra::internals::exceptions::index_out_of_range if i or j is
-     * out of bounds.
+     * out of bounds and ASTRA_BOUNDS_CHECK is on.
      */
-    double& operator()(int i, int j);
-    
+    T& operator()(int i, int j) {
+#if ASTRA_BOUNDS_CHECK
+        if (i >= rows || i < 0 || j >= cols || j < 0) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return values[i * cols + j];
+    }
+
     /**
      * @brief Gives read-only access to a matrix entry at row i and column j
      *
@@ -100,27 +152,42 @@ class Matrix {
      * @return A constant reference to the matrix element at the specified
      * position.
      * @throws astra::internals::exceptions::index_out_of_range if the indices
-     * `i` or `j` are outside the valid range of rows or columns.
+     * `i` or `j` are outside the valid range of rows or columns and
+     * ASTRA_BOUNDS_CHECK is on.
+     */
+    const T& operator()(int i, int j) const {
+#if ASTRA_BOUNDS_CHECK
+        if (i >= rows || i < 0 || j >= cols || j < 0) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return values[i * cols + j];
+    }
+
+    /**
+     * @brief Gives access to an element without bounds checking, whatever
+     * ASTRA_BOUNDS_CHECK is set to.
+     * @param i The row index, which must be in [0, num_row()).
+     * @param j The column index, which must be in [0, num_col()).
+     * @return A reference to the element.
      */
-    const double& operator()(int i, int j) const;
+    T& unchecked(int i, int j) { return values[i * cols + j]; }
+    const T& unchecked(int i, int j) const { return values[i * cols + j]; }
 
     /**
-     * @brief Overloaded operator to add two matrices.
-     * @param other The matrix to add.
-     * @return The sum of the two matrices.
-     * @throws astra::internals::exceptions::matrix_size_mismatch if the
-     * matrices are not of the same size.
+     * @brief Returns a pointer to the row-major storage, `num_row() *
+     * num_col()` elements with a leading dimension of `num_col()`.
      */
-    Matrix operator+(const Matrix& other) const;
+    T* data() { return values; }
+    const T* data() const { return values; }
 
     /**
-     * @brief Overloaded operator to subtract two matrices.
-     * @param other The matrix to subtract.
-     * @return The difference of the two matrices.
-     * @throws astra::internals::exceptions::matrix_size_mismatch if the
-     * matrices are not of the same size.
+     * @brief Gives unchecked read access to an element by its row-major
+     * linear index. Used when evaluating expressions.
+     * @param i The linear index, `row * num_col() + col`.
+     * @return The value at that index.
      */
-    Matrix operator-(const Matrix& other) const;
+    T coeff(int i) const { return values[i]; }
 
     /**
      * @brief Overloaded operator to multiply two matrices.
@@ -130,49 +197,56 @@ class Matrix {
      * if the number of columns in the current matrix does not match the number
      * of rows in the `other` matrix.
      */
-    Matrix operator*(const Matrix& other) const;
+    BasicMatrix operator*(const BasicMatrix& other) const;
 
     /**
      * @brief Assign another matrix to this matrix (deep copy).
      * @param other The matrix to assign from.
      * @return Reference to this matrix after assignment.
      */
-    Matrix& operator=(const Matrix& other);
+    BasicMatrix& operator=(const BasicMatrix& other);
 
     /**
-     * @brief Checkes if two matrices are equal.
-     * @param other The matrix to compare with.
-     * @return True if the matrices are equal, false otherwise.
+     * @brief Move-assigns another matrix to this matrix without copying its
+     * elements.
+     * @param other The matrix to move from. It is left empty (0 x 0).
+     * @return Reference to this matrix after assignment.
      */
-    bool operator==(const Matrix& other) const;
+    BasicMatrix& operator=(BasicMatrix&& other) noexcept;
 
     /**
-     * @brief Checkes if two matrices are not equal.
-     * @param other The matrix to compare with.
-     * @return True if the matrices are not equal, false otherwise.
+     * @brief Evaluates an element-wise expression into this matrix in a
+     * single pass, reusing the current storage when the size matches.
+     * @param expr The expression to evaluate. It may refer to this matrix.
+     * @return Reference to this matrix after assignment.
      */
-    bool operator!=(const Matrix& other) const;
+    template <typename E>
+    BasicMatrix& operator=(const MatrixExpr<E>& expr) {
+        const E& e = expr.derived();
+        if (rows != e.num_row() || cols != e.num_col()) {
+            // a differently sized result cannot alias this matrix
+            internals::memory::deallocate(values);
+            rows = e.num_row();
+            cols = e.num_col();
+            values = internals::memory::allocate<T>(rows * cols);
+        }
+        internals::expr::assign(values, e, rows * cols);
+        return *this;
+    }
 
     /**
-     * @brief Multiplies each element of the matrix by a scalar.
-     * @param mat The matrix to multiply.
-     * @param scalar The scalar value to multiply with each element of the
-     * matrix.
-     * @return A new matrix that is the result of multiplication of the original
-     * matrix by the scalar.
+     * @brief Checkes if two matrices are equal.
+     * @param other The matrix to compare with.
+     * @return True if the matrices are equal, false otherwise.
      */
-    friend Matrix operator*(const Matrix& mat, double scalar);
-    friend Matrix operator*(double scalar, const Matrix& mat);
+    bool operator==(const BasicMatrix& other) const;
 
     /**
-     * @brief Divides each element of the matrix by a scalar.
-     * @param mat The matrix to divide.
-     * @param scalar The scalar value to divide each element of the matrix by.
-     * @return A new matrix that is the result of division of the original
-     * matrix by the scalar.
-     * @throws astra::internals::exceptions::zero_division if scalar is zero.
+     * @brief Checkes if two matrices are not equal.
+     * @param other The matrix to compare with.
+     * @return True if the matrices are not equal, false otherwise.
      */
-    friend Matrix operator/(const Matrix& mat, double scalar);
+    bool operator!=(const BasicMatrix& other) const;
 
     /**
      * @brief Outputs the matrix to an output stream.
@@ -183,7 +257,9 @@ class Matrix {
      * @return A reference to the output stream, allowing chaining of output
      * operations.
      */
-    friend std::ostream& operator<<(std::ostream& os, const Matrix& mat);
+    template <typename U>
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const BasicMatrix<U>& mat);
 
     /**
      * @brief Reads matrix values from an input stream.
@@ -194,7 +270,8 @@ class Matrix {
      * @return A reference to the input stream, allowing chaining of input
      * operations.
      */
-    friend std::istream& operator>>(std::istream& in, Matrix& mat);
+    template <typename U>
+    friend std::istream& operator>>(std::istream& in, BasicMatrix<U>& mat);
 
 
     /**
@@ -215,20 +292,20 @@ class Matrix {
      * @param new_val The value to replace with
      * @note does nothing if the the value is not in the matrix
     */
-    void replace(double old_val, double new_val);
+    void replace(T old_val, T new_val);
 
 
     /**
      * @brief Returns the sum of all elements in the matrix.
      * @return The sum of all elements in the matrix.
      */
-    double sum() const;
+    T sum() const;
 
     /**
      * @brief Returns the product of all elements in the matrix.
      * @return The product of all elements in the matrix.
      */
-    double prod() const;
+    T prod() const;
 
     /**
      * @brief Returns the sum of the principle diagonal elements of the matrix.
@@ -236,7 +313,7 @@ class Matrix {
      * @throws astra::internals::exceptions::non_sqauare_matrix if the rows and
      * cols are not equal.
      */
-    double trace() const;
+    T trace() const;
 
     /**
      * @brief Computes the product of the principal diagonal elements of the
@@ -245,7 +322,7 @@ class Matrix {
      *
      * @return The product of the diagonal elements.
      */
-    double principal_prod() const;
+    T principal_prod() const;
 
     /**
      * @brief Returns the average of all elements in the matrix.
@@ -253,20 +330,22 @@ class Matrix {
      * @throws astra::internals::exceptions::invalid_size if the matrix has zero 
      * row or column.
      */
-    double avg() const;
+    T avg() const;
 
 
     /**
-     * @brief Returns the minimum value in the matrix.
+     * @brief Returns the minimum value in the matrix. Complex elements are
+     * ordered by real part, then by imaginary part.
      * @return The minimum value in the matrix.
      */
-    double min() const;
+    T min() const;
 
     /**
-     * @brief Returns the maximum value in the matrix.
+     * @brief Returns the maximum value in the matrix. Complex elements are
+     * ordered by real part, then by imaginary part.
      * @return The maximum value in the matrix.
      */
-    double max() const;
+    T max() const;
 
 
     /**
@@ -336,7 +415,7 @@ class Matrix {
      * @return The identity matrix.
      * @throws astra::internals::exceptions::invalid_size if n is <= 0.
     */
-    static Matrix identity(int n);
+    static BasicMatrix identity(int n);
 
 
     /**
@@ -389,7 +468,7 @@ class Matrix {
      * @brief Fills the matrix with a specified value.
      * @param val The value to fill the matrix with.
      */
-    void fill(double val);
+    void fill(T val);
 
 
     /**
@@ -411,7 +490,7 @@ class Matrix {
      *
      * @note This operation modifies the current matrix in-place.
      */
-    void join(const Matrix& other);
+    void join(const BasicMatrix& other);
 
     /**
      * @brief Extracts a submatrix from the matrix.
@@ -425,7 +504,40 @@ class Matrix {
      * @throws astra::internals::exceptions::index_out_of_range if the specified indices are out of bounds or
      * astra::internals::exceptions::invalid_argument if the specified indices are invalid.
      */
-    Matrix submatrix(int r1, int c1, int r2, int c2) const;
+    BasicMatrix submatrix(int r1, int c1, int r2, int c2) const;
+
+    /**
+     * @brief Returns a non-owning view of a block of the matrix, without
+     * copying.
+     *
+     * @param r1 The starting row index of the block. (inclusive)
+     * @param c1 The starting column index of the block. (inclusive)
+     * @param r2 The ending row index of the block. (inclusive)
+     * @param c2 The ending column index of the block. (inclusive)
+     * @return MatrixView A view of the block, valid while this matrix is
+     * alive and not resized.
+     * @throws astra::internals::exceptions::index_out_of_range if the specified indices are out of bounds or
+     * astra::internals::exceptions::invalid_argument if the specified indices are invalid.
+     */
+    BasicMatrixView<T> block(int r1, int c1, int r2, int c2) const;
+
+    /**
+     * @brief Returns a non-owning view of the ith row, without copying.
+     * @param i The index of the row.
+     * @return VectorView A view of the row.
+     * @throws astra::internals::exceptions::index_out_of_range if i is out of
+     * bounds.
+     */
+    BasicVectorView<T> row_view(int i) const;
+
+    /**
+     * @brief Returns a non-owning view of the jth column, without copying.
+     * @param j The index of the column.
+     * @return VectorView A strided view of the column.
+     * @throws astra::internals::exceptions::index_out_of_range if j is out of
+     * bounds.
+     */
+    BasicVectorView<T> col_view(int j) const;
 
 
     /**
@@ -434,7 +546,7 @@ class Matrix {
      * @param tol (optional) The tolerance value for floating point comparison. Default is 1e-6.
      * @return Matrix The row reduced echelon form of the matrix.
      */
-    Matrix rref(double tol = 1e-6) const;
+    BasicMatrix rref(double tol = 1e-6) const;
 
 
     /**
@@ -445,7 +557,7 @@ class Matrix {
      * @throws astra::internals::exceptions::index_out_of_range if i is out of
      * bounds.
     */
-    Vector get_row(int i) const;
+    BasicVector<T> get_row(int i) const;
 
 
     /**
@@ -456,7 +568,7 @@ class Matrix {
      * @throws astra::internals::exceptions::index_out_of_range if j is out of
      * bounds.
      */
-    Vector get_col(int j) const;
+    BasicVector<T> get_col(int j) const;
 
     /**
      * @brief Checks if the jth column is a pivot column.
@@ -493,6 +605,10 @@ class Matrix {
     /**
      * @brief Computes the rank of the matrix from its rref.
      * @return The rank of the matrix.
+     *
+     * @note Pivots are compared against an absolute 1e-6. For badly scaled
+     * or nearly rank deficient matrices count the entries of
+     * Decomposer::singular_values above a relative tolerance instead.
      */
     int rank() const;
 
@@ -502,9 +618,9 @@ class Matrix {
      *
      * @throws astra::internals::exceptions::non_sqauare_matrix If the matrix is
      * not square.
-     * @return double The determinant of the matrix.
+     * @return The determinant of the matrix.
      */
-    double det() const;
+    T det() const;
 
     /**
      * @brief Computes the inverse of the matrix by Gauss-Jordan method.
@@ -514,7 +630,7 @@ class Matrix {
      * @throws astra::internals::exceptions::singular_matrix if the matrix is
      * singular.
      */
-    Matrix inv() const;
+    BasicMatrix inv() const;
 
     /**
      * @brief Calculates the nullspace of a matrix from its RREF form
@@ -527,8 +643,11 @@ class Matrix {
      *
      * @note If there are no free columns (i.e., the nullspace is trivial), the
      * returned matrix will have zero columns.
+     *
+     * @note The last rows of V^T from Decomposer::svd give an orthonormal
+     * basis that does not depend on the pivot tolerance of the RREF.
      */
-    Matrix nullspace() const;
+    BasicMatrix nullspace() const;
 
     /**
      * @brief Prints the matrix to the standard output with specified column
@@ -539,5 +658,101 @@ class Matrix {
      */
     void print(int width = 7) const;
 };
+
+// matrices of each supported element type
+using Matrix = BasicMatrix<double>;
+using MatrixF = BasicMatrix<float>;
+using MatrixC = BasicMatrix<std::complex<double>>;
+using MatrixCF = BasicMatrix<std::complex<float>>;
+
+namespace internals::expr {
+
+    // Matrix operands are used in place, other expressions are evaluated
+    // into a temporary once
+    template <typename T>
+    inline const BasicMatrix<T>& evaluate(const BasicMatrix<T>& mat) {
+        return mat;
+    }
+
+    template <typename T>
+    inline const T* data_of(const BasicMatrix<T>& mat) {
+        return mat.data();
+    }
+
+    template <typename E>
+    BasicMatrix<typename E::value_type> evaluate(const MatrixExpr<E>& expr) {
+        return BasicMatrix<typename E::value_type>(expr);
+    }
+
+} // namespace internals::expr
+
+/**
+ * @brief Multiplies two matrix expressions, evaluating each operand once.
+ * @throws astra::internals::exceptions::matrix_multiplication_size_mismatch
+ * if the inner dimensions don't match.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_matrix_expr<L> &&
+                               internals::expr::is_matrix_expr<R>,
+                           int> = 0,
+          typename T = internals::expr::common_value_t<L, R>>
+BasicMatrix<T> operator*(const L& lhs, const R& rhs) {
+    const BasicMatrix<T>& a = internals::expr::evaluate(lhs);
+    const BasicMatrix<T>& b = internals::expr::evaluate(rhs);
+    return a * b;
+}
+
+/**
+ * @brief Multiplies a matrix expression with a vector expression. A plain
+ * Matrix and Vector use the overload in Vector.h.
+ * @throws astra::internals::exceptions::matrix_size_mismatch if the number of
+ * columns does not equal the size of the vector.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_matrix_expr<L> &&
+                               internals::expr::is_vector_expr<R> &&
+                               !(internals::expr::is_dense<L>::value &&
+                                 internals::expr::is_dense<R>::value),
+                           int> = 0,
+          typename T = internals::expr::common_value_t<L, R>>
+BasicVector<T> operator*(const L& lhs, const R& rhs) {
+    const BasicMatrix<T>& mat = internals::expr::evaluate(lhs);
+    const BasicVector<T>& vec = internals::expr::evaluate(rhs);
+    return mat * vec;
+}
+
+/**
+ * @brief Compares matrix expressions element by element after evaluating
+ * them.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_matrix_expr<L> &&
+                               internals::expr::is_matrix_expr<R>,
+                           int> = 0,
+          typename = internals::expr::common_value_t<L, R>>
+bool operator==(const L& lhs, const R& rhs) {
+    return internals::expr::evaluate(lhs) == internals::expr::evaluate(rhs);
+}
+
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_matrix_expr<L> &&
+                               internals::expr::is_matrix_expr<R>,
+                           int> = 0,
+          typename = internals::expr::common_value_t<L, R>>
+bool operator!=(const L& lhs, const R& rhs) {
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Outputs an unevaluated matrix expression by evaluating it first.
+ */
+template <typename E,
+          std::enable_if_t<internals::expr::is_matrix_expr<E> &&
+                               !internals::expr::is_dense<E>::value,
+                           int> = 0>
+std::ostream& operator<<(std::ostream& os, const E& expr) {
+    return os << BasicMatrix<typename E::value_type>(expr);
+}
+
 } // namespace astra
 #endif // !__MATRIX_H__
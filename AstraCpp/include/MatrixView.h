@@ -0,0 +1,228 @@
+/**
+ * @file MatrixView.h
+ * @brief Declaration of the BasicMatrixView class template, a non-owning
+ * read-only view of a rectangular block of a Matrix, and of its MatrixView
+ * aliases.
+ */
+
+#ifndef __MATRIXVIEW_H__
+#define __MATRIXVIEW_H__
+
+#include "../internals/Config.h"
+#include "../internals/Exceptions.h"
+#include "VectorView.h"
+
+#include <iostream>
+
+namespace astra {
+
+template <typename T>
+class BasicMatrix;
+
+template <typename T>
+class BasicMatrixView;
+
+/**
+ * @class BasicMatrixView
+ * @brief A lightweight, non-owning, read-only view of a row-major block of
+ * values.
+ *
+ * A view is a pointer to the top-left element, a size and a leading
+ * dimension (the distance between the starts of two consecutive rows), so
+ * blocks, rows and columns of a Matrix can be passed to read-only algorithms
+ * without copying. The viewed matrix must outlive the view and must not be
+ * resized while the view is in use.
+ *
+ * @tparam T The element type: float, double, std::complex<float> or
+ * std::complex<double>.
+ */
+template <typename T>
+class BasicMatrixView {
+  private:
+    const T* data;
+    int rows;
+    int cols;
+    int ld;
+
+    static BasicMatrix<T> multiply(const BasicMatrixView& lhs,
+                                   const BasicMatrixView& rhs);
+
+    static BasicVector<T> multiply(const BasicMatrixView& mat,
+                                   const BasicVectorView<T>& vec);
+
+  public:
+    using value_type = T;
+
+    /**
+     * @brief Constructs a view over raw row-major memory.
+     * @param data Pointer to the top-left element.
+     * @param row The number of rows in the view.
+     * @param col The number of columns in the view.
+     * @param ld The leading dimension, i.e. the distance between the first
+     * elements of two consecutive rows.
+     * @throws astra::internals::exceptions::invalid_size if row or col is
+     * <= 0.
+     * @throws astra::internals::exceptions::invalid_argument if ld < col.
+     */
+    BasicMatrixView(const T* data, int row, int col, int ld);
+
+    /**
+     * @brief Constructs a view of a whole matrix.
+     * @param mat The matrix to view.
+     */
+    BasicMatrixView(const BasicMatrix<T>& mat);
+
+    /**
+     * @brief Returns the number of rows in the view.
+     */
+    int num_row() const;
+
+    /**
+     * @brief Returns the number of columns in the view.
+     */
+    int num_col() const;
+
+    /**
+     * @brief Returns the leading dimension of the view.
+     */
+    int leading_dim() const;
+
+    /**
+     * @brief Gives read-only access to an element of the view.
+     * @param i The row index.
+     * @param j The column index.
+     * @return A constant reference to the element.
+     * @throws astra::internals::exceptions::index_out_of_range if i or j is
+     * out of bounds and ASTRA_BOUNDS_CHECK is on.
+     */
+    const T& operator()(int i, int j) const {
+#if ASTRA_BOUNDS_CHECK
+        if (i >= rows || i < 0 || j >= cols || j < 0) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return data[static_cast<long long>(i) * ld + j];
+    }
+
+    /**
+     * @brief Gives read-only access to an element without bounds checking,
+     * whatever ASTRA_BOUNDS_CHECK is set to.
+     * @param i The row index, which must be in [0, num_row()).
+     * @param j The column index, which must be in [0, num_col()).
+     * @return A constant reference to the element.
+     */
+    const T& unchecked(int i, int j) const {
+        return data[static_cast<long long>(i) * ld + j];
+    }
+
+    /**
+     * @brief Returns a view of a block of this view.
+     * @param r1 The starting row index. (inclusive)
+     * @param c1 The starting column index. (inclusive)
+     * @param r2 The ending row index. (inclusive)
+     * @param c2 The ending column index. (inclusive)
+     * @return BasicMatrixView The block, sharing the same storage.
+     * @throws astra::internals::exceptions::index_out_of_range if the indices
+     * are out of bounds.
+     * @throws astra::internals::exceptions::invalid_argument if r1 > r2 or
+     * c1 > c2.
+     */
+    BasicMatrixView block(int r1, int c1, int r2, int c2) const;
+
+    /**
+     * @brief Returns a view of the ith row.
+     * @throws astra::internals::exceptions::index_out_of_range if i is out of
+     * bounds.
+     */
+    BasicVectorView<T> row(int i) const;
+
+    /**
+     * @brief Returns a view of the jth column.
+     * @throws astra::internals::exceptions::index_out_of_range if j is out of
+     * bounds.
+     */
+    BasicVectorView<T> col(int j) const;
+
+    /**
+     * @brief Returns the sum of all elements in the view.
+     */
+    T sum() const;
+
+    /**
+     * @brief Returns the sum of the principal diagonal elements.
+     * @throws astra::internals::exceptions::non_square_matrix if the view is
+     * not square.
+     */
+    T trace() const;
+
+    /**
+     * @brief Checks if the view is square.
+     */
+    bool is_square() const;
+
+    /**
+     * @brief Checks if the view is symmetric.
+     */
+    bool is_symmetric() const;
+
+    /**
+     * @brief Checks if the view is upper triangular.
+     */
+    bool is_upper_triangular() const;
+
+    /**
+     * @brief Checks if the view is lower triangular.
+     */
+    bool is_lower_triangular() const;
+
+    /**
+     * @brief Computes the row reduced echelon form of the viewed block.
+     * @param tol (optional) The tolerance for floating point comparison.
+     * @return Matrix The row reduced echelon form, as a new matrix.
+     */
+    BasicMatrix<T> rref(double tol = 1e-6) const;
+
+    /**
+     * @brief Computes the rank of the viewed block from its rref.
+     */
+    int rank() const;
+
+    /**
+     * @brief Outputs the viewed block to an output stream.
+     */
+    template <typename U>
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const BasicMatrixView<U>& view);
+
+    /**
+     * @brief Multiplies two matrix views with the blocked GEMM kernel,
+     * without copying the operands.
+     * @return BasicMatrix The product.
+     * @throws astra::internals::exceptions::matrix_multiplication_size_mismatch
+     * if the inner dimensions don't match.
+     */
+    friend BasicMatrix<T> operator*(const BasicMatrixView& lhs,
+                                    const BasicMatrixView& rhs) {
+        return multiply(lhs, rhs);
+    }
+
+    /**
+     * @brief Multiplies a matrix view with a vector view.
+     * @return BasicVector The product.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the
+     * number of columns does not equal the size of the vector.
+     */
+    friend BasicVector<T> operator*(const BasicMatrixView& mat,
+                                    const BasicVectorView<T>& vec) {
+        return multiply(mat, vec);
+    }
+};
+
+// views of each supported element type
+using MatrixView = BasicMatrixView<double>;
+using MatrixViewF = BasicMatrixView<float>;
+using MatrixViewC = BasicMatrixView<std::complex<double>>;
+using MatrixViewCF = BasicMatrixView<std::complex<float>>;
+
+} // namespace astra
+#endif // !__MATRIXVIEW_H__
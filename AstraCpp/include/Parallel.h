@@ -0,0 +1,37 @@
+/**
+ * @file Parallel.h
+ * @brief Declaration of the functions that control the library-owned thread
+ * pool used by the multithreaded matrix operations.
+ */
+
+#ifndef __PARALLEL_H__
+#define __PARALLEL_H__
+
+namespace astra {
+
+/**
+ * @brief Sets the number of threads used by the parallel operations.
+ *
+ * The calling thread always takes part in the work, so `n` threads means the
+ * pool keeps `n - 1` worker threads. Passing 1 makes every operation run
+ * serially on the calling thread.
+ *
+ * @param n The total number of threads to use.
+ * @throws astra::internals::exceptions::invalid_argument if n is <= 0.
+ * @note Must not be called while another thread is running a library
+ * operation.
+ */
+void set_num_threads(int n);
+
+/**
+ * @brief Returns the number of threads used by the parallel operations.
+ *
+ * Defaults to the number of hardware threads reported by the system.
+ *
+ * @return The total number of threads, including the calling thread.
+ */
+int get_num_threads();
+
+} // namespace astra
+
+#endif // !__PARALLEL_H__
@@ -0,0 +1,272 @@
+/**
+ * @file Preconditioner.h
+ * @brief Declaration of the Preconditioner interface used by the iterative
+ * solvers and of the Jacobi, block Jacobi, SSOR, ILU(0) and IC(0)
+ * preconditioners.
+ */
+
+#ifndef __PRECONDITIONER_H__
+#define __PRECONDITIONER_H__
+
+#include "Matrix.h"
+#include "SparseMatrix.h"
+#include "Vector.h"
+
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class Preconditioner
+ * @brief Interface for an approximation M of a matrix A whose inverse is
+ * cheap to apply.
+ *
+ * The iterative solvers of Solver take a preconditioner by reference and
+ * only call apply, so one preconditioner is set up once and reused by any
+ * number of solves with the same A. apply does not change the object, so a
+ * preconditioner may also be shared by solves running on several threads.
+ */
+class Preconditioner {
+  public:
+    virtual ~Preconditioner() = default;
+
+    /**
+     * @brief Returns the order n of the approximated n x n matrix.
+     */
+    virtual int size() const = 0;
+
+    /**
+     * @brief Computes z = M^{-1} r.
+     * @param r The vector to precondition, with n entries.
+     * @param z Receives the result, a vector with n entries distinct from r.
+     */
+    virtual void apply(const Vector& r, Vector& z) const = 0;
+};
+
+/**
+ * @class JacobiPreconditioner
+ * @brief The diagonal of A, M = diag(A).
+ */
+class JacobiPreconditioner : public Preconditioner {
+  private:
+    std::vector<double> inv_diag;
+
+  public:
+    /**
+     * @brief Takes the inverse of the diagonal of a square matrix.
+     * @param A The matrix to approximate.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::singular_matrix if a diagonal
+     * entry is zero.
+     */
+    explicit JacobiPreconditioner(const Matrix& A);
+
+    /**
+     * @brief Takes the inverse of the diagonal of a square sparse matrix.
+     * @param A The matrix to approximate.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::singular_matrix if a diagonal
+     * entry is zero or not stored.
+     */
+    explicit JacobiPreconditioner(const SparseMatrix& A);
+
+    int size() const override;
+
+    void apply(const Vector& r, Vector& z) const override;
+};
+
+/**
+ * @class BlockJacobiPreconditioner
+ * @brief The diagonal blocks of A, M = diag(A_11, A_22, ...).
+ *
+ * The rows are split into consecutive blocks of block_size, the last one
+ * possibly smaller, and the inverse of each diagonal block is stored, so
+ * apply costs n * block_size multiply-adds.
+ */
+class BlockJacobiPreconditioner : public Preconditioner {
+  private:
+    int n;
+    int block_size;
+    std::vector<double> inverses;
+
+  public:
+    /**
+     * @brief Inverts the diagonal blocks of a square matrix.
+     * @param A The matrix to approximate.
+     * @param block_size The order of the diagonal blocks.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::invalid_argument if block_size
+     * is not positive.
+     * @throws astra::internals::exceptions::singular_matrix if a diagonal
+     * block is singular.
+     */
+    BlockJacobiPreconditioner(const Matrix& A, int block_size);
+
+    /**
+     * @brief Inverts the diagonal blocks of a square sparse matrix, each
+     * gathered into a dense block_size x block_size matrix.
+     * @param A The matrix to approximate.
+     * @param block_size The order of the diagonal blocks.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::invalid_argument if block_size
+     * is not positive.
+     * @throws astra::internals::exceptions::singular_matrix if a diagonal
+     * block is singular.
+     */
+    BlockJacobiPreconditioner(const SparseMatrix& A, int block_size);
+
+    int size() const override;
+
+    void apply(const Vector& r, Vector& z) const override;
+};
+
+/**
+ * @class SSORPreconditioner
+ * @brief The symmetric successive over-relaxation of A = L + D + U,
+ * M = (D + omega L) D^{-1} (D + omega U) / (omega (2 - omega)).
+ *
+ * M is symmetric positive definite for a symmetric positive definite A, so
+ * it may be used with cg. The nonzero entries of A are kept in compressed
+ * rows and apply is one forward and one backward sweep over them.
+ */
+class SSORPreconditioner : public Preconditioner {
+  private:
+    int n;
+    double omega;
+    std::vector<int> row_ptr;
+    std::vector<int> cols;
+    std::vector<double> vals;
+    std::vector<int> diag;
+
+  public:
+    /**
+     * @brief Keeps the nonzero entries of a square matrix.
+     * @param A The matrix to approximate.
+     * @param omega The relaxation factor in (0, 2), 1 gives symmetric
+     * Gauss-Seidel.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::invalid_argument if omega is
+     * not in (0, 2).
+     * @throws astra::internals::exceptions::singular_matrix if a diagonal
+     * entry is zero.
+     */
+    explicit SSORPreconditioner(const Matrix& A, double omega = 1.0);
+
+    /**
+     * @brief Keeps the entries of a square sparse matrix.
+     * @param A The matrix to approximate.
+     * @param omega The relaxation factor in (0, 2).
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::invalid_argument if omega is
+     * not in (0, 2).
+     * @throws astra::internals::exceptions::singular_matrix if a diagonal
+     * entry is zero or not stored.
+     */
+    explicit SSORPreconditioner(const SparseMatrix& A, double omega = 1.0);
+
+    int size() const override;
+
+    void apply(const Vector& r, Vector& z) const override;
+};
+
+/**
+ * @class ILU0Preconditioner
+ * @brief The incomplete LU factorization without fill, M = L U.
+ *
+ * Gaussian elimination is carried out on the nonzero pattern of A only,
+ * every update that would create an entry outside it is dropped, so L and
+ * U together have the pattern of A. L has a unit diagonal and both factors
+ * are stored in compressed rows.
+ */
+class ILU0Preconditioner : public Preconditioner {
+  private:
+    int n;
+    std::vector<int> row_ptr;
+    std::vector<int> cols;
+    std::vector<double> vals;
+    std::vector<int> diag;
+
+  public:
+    /**
+     * @brief Computes the incomplete factors of a square matrix.
+     * @param A The matrix to approximate.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::singular_matrix if a pivot is
+     * zero.
+     */
+    explicit ILU0Preconditioner(const Matrix& A);
+
+    /**
+     * @brief Computes the incomplete factors of a square sparse matrix on
+     * its stored pattern, with the diagonal added where it is missing.
+     * @param A The matrix to approximate.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::singular_matrix if a pivot is
+     * zero.
+     */
+    explicit ILU0Preconditioner(const SparseMatrix& A);
+
+    int size() const override;
+
+    void apply(const Vector& r, Vector& z) const override;
+};
+
+/**
+ * @class IC0Preconditioner
+ * @brief The incomplete Cholesky factorization without fill, M = L L^T.
+ *
+ * L has the pattern of the lower triangle of A and is stored in compressed
+ * rows with the diagonal entry last. M is symmetric positive definite, for
+ * use with cg. The factorization can break down even for a positive
+ * definite A, it always exists for an M-matrix such as the discrete
+ * Laplacian or for a diagonally dominant A with a positive diagonal.
+ */
+class IC0Preconditioner : public Preconditioner {
+  private:
+    int n;
+    std::vector<int> row_ptr;
+    std::vector<int> cols;
+    std::vector<double> vals;
+
+  public:
+    /**
+     * @brief Computes the incomplete factor of a symmetric matrix.
+     * @param A The symmetric matrix to approximate.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is
+     * not symmetric.
+     * @throws astra::internals::exceptions::not_positive_definite if a
+     * pivot is not positive.
+     */
+    explicit IC0Preconditioner(const Matrix& A);
+
+    /**
+     * @brief Computes the incomplete factor of a symmetric sparse matrix on
+     * the stored pattern of its lower triangle.
+     * @param A The symmetric matrix to approximate.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is
+     * not symmetric.
+     * @throws astra::internals::exceptions::not_positive_definite if a
+     * pivot is not positive.
+     */
+    explicit IC0Preconditioner(const SparseMatrix& A);
+
+    int size() const override;
+
+    void apply(const Vector& r, Vector& z) const override;
+};
+
+} // namespace astra
+
+#endif // !__PRECONDITIONER_H__
@@ -7,10 +7,22 @@
 #ifndef __SOLVER_H__
 #define __SOLVER_H__
 
+#include "BandedMatrix.h"
+#include "CirculantMatrix.h"
 #include "Decomposer.h"
 #include "Matrix.h"
+#include "Preconditioner.h"
+#include "SparseMatrix.h"
+#include "SymmetricMatrix.h"
+#include "ToeplitzMatrix.h"
+#include "TriangularMatrix.h"
+#include "TridiagonalMatrix.h"
 #include "Vector.h"
 
+#include <functional>
+#include <utility>
+#include <vector>
+
 // Ax = b
 // A = LU
 // LUx = b
@@ -26,9 +38,48 @@ namespace astra {
  *
  * The Solver class provides static methods for solving systems of equations
  * of the form Ax = b using LU decomposition and forward/backward substitution.
+ * Large systems can instead be solved by the Krylov methods cg, gmres and
+ * bicgstab, which only need products of A with vectors and optionally take
+ * a Preconditioner.
  */
 class Solver {
   public:
+    /**
+     * @brief A linear operator given by its action y = A x, for the
+     * iterative solvers. y has the size of x and its previous contents may
+     * be overwritten freely.
+     */
+    using LinearOperator = std::function<void(const Vector& x, Vector& y)>;
+
+    /**
+     * @struct IterativeResult
+     * @brief Stores the outcome of an iterative solver.
+     *
+     * residuals[0] is the relative residual ||b - A x0|| / ||b|| of the
+     * zero initial guess, i.e. 1, and residuals[k] the one after iteration
+     * k. GMRES reports the residual of its least-squares problem, which
+     * equals the true one in exact arithmetic, the other methods the norm
+     * of their updated residual vector.
+     */
+    struct IterativeResult {
+        Vector x;                      ///< The last iterate.
+        int iterations;                ///< Number of iterations taken.
+        bool converged;                ///< Whether tol was reached.
+        std::vector<double> residuals; ///< Relative residual history.
+
+        /**
+         * @brief Constructs an IterativeResult.
+         * @param solution The last iterate.
+         * @param its The number of iterations taken.
+         * @param conv Whether the tolerance was reached.
+         * @param history The relative residual after each iteration.
+         */
+        IterativeResult(Vector solution, int its, bool conv,
+                        std::vector<double> history)
+            : x(std::move(solution)), iterations(its), converged(conv),
+              residuals(std::move(history)) {}
+    };
+
     /**
      * @brief Solves a lower triangular system using forward substitution.
      *
@@ -43,7 +94,35 @@ class Solver {
      * @throws astra::internals::exceptions::matrix_not_lower_triangular
      * if L is not a lower triangular matrix.
      */
-    static Vector forward_sub(Matrix L, Vector b);
+    static Vector forward_sub(const Matrix& L, const Vector& b);
+
+    /**
+     * @brief Solves a lower triangular system given as views, e.g. a block of
+     * a larger matrix, without copying it.
+     *
+     * @param L A view of a lower triangular matrix.
+     * @param b A view of the right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of L and b do not match.
+     * @throws astra::internals::exceptions::matrix_not_lower_triangular
+     * if L is not a lower triangular matrix.
+     */
+    static Vector forward_sub(const MatrixView& L, const VectorView& b);
+
+    /**
+     * @brief Solves a lower triangular system in packed storage, reading
+     * each row as one contiguous dot product.
+     *
+     * @param L A lower triangular matrix.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of L and b do not match.
+     * @throws astra::internals::exceptions::matrix_not_lower_triangular
+     * if L holds the upper triangle.
+     */
+    static Vector forward_sub(const TriangularMatrix& L, const Vector& b);
 
     /**
      * @brief Solves an upper triangular system using backward substitution.
@@ -59,14 +138,47 @@ class Solver {
      * @throws astra::internals::exceptions::matrix_not_upper_triangular
      * if U is not an upper triangular matrix.
      */
-    static Vector backward_sub(Matrix U, Vector b);
+    static Vector backward_sub(const Matrix& U, const Vector& b);
+
+    /**
+     * @brief Solves a upper triangular system given as views, e.g. a block of
+     * a larger matrix, without copying it.
+     *
+     * @param U A view of a upper triangular matrix.
+     * @param b A view of the right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of U and b do not match.
+     * @throws astra::internals::exceptions::matrix_not_upper_triangular
+     * if U is not a upper triangular matrix.
+     */
+    static Vector backward_sub(const MatrixView& U, const VectorView& b);
+
+    /**
+     * @brief Solves an upper triangular system in packed storage, reading
+     * each row as one contiguous dot product.
+     *
+     * @param U An upper triangular matrix.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of U and b do not match.
+     * @throws astra::internals::exceptions::matrix_not_upper_triangular
+     * if U holds the lower triangle.
+     */
+    static Vector backward_sub(const TriangularMatrix& U, const Vector& b);
 
     /**
      * @brief Solves a linear system Ax = b using LU decomposition.
      *
      * The function first decomposes A into PA = LU using PLU decomposition,
      * then solves for x by performing forward substitution on L and backward
-     * substitution on U.
+     * substitution on U. Only when the factorization is singular are the
+     * ranks of A and [A | b] computed to tell which error applies. To solve
+     * many systems with the same A, factor it once with LUFactorization.
+     * A symmetric A is solved with Decomposer::cholesky when it is positive
+     * definite and with Decomposer::ldlt otherwise, LU is only used when
+     * those factors are singular.
      *
      * @param A A square matrix representing the coefficients of the system.
      * @param b The right-hand side vector.
@@ -76,7 +188,606 @@ class Solver {
      * @throws astra::internals::exceptions::variable_and_value_number_mismatch
      * if the dimensions of A and b do not match.
      */
-    static Vector solve(Matrix A, Vector b);
+    static Vector solve(const Matrix& A, const Vector& b);
+
+    /**
+     * @brief Solves a linear system Ax = b given as views, e.g. a block of a
+     * larger matrix, without copying the operands.
+     *
+     * @param A A view of the coefficient matrix.
+     * @param b A view of the right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     */
+    static Vector solve(const MatrixView& A, const VectorView& b);
+
+    /**
+     * @brief Solves a sparse linear system Ax = b with a direct sparse
+     * factorization.
+     *
+     * A symmetric A is factored by SparseCholesky and any other, or a
+     * symmetric A that is not positive definite, by SparseLU, both after a
+     * fill-reducing ordering. To solve many systems with the same A, or
+     * with matrices of the same pattern, keep the factorization and use its
+     * solve and refactor.
+     *
+     * @param A A sparse square matrix of coefficients.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::singular_matrix if A is singular.
+     */
+    static Vector solve(const SparseMatrix& A, const Vector& b);
+
+    /**
+     * @brief Solves a symmetric linear system Ax = b in packed storage.
+     *
+     * A is factored by the packed Decomposer::cholesky, which needs no
+     * more memory than A. An indefinite A is expanded and solved as in
+     * solve(const Matrix&, const Vector&).
+     *
+     * @param A A symmetric matrix of coefficients.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     */
+    static Vector solve(const SymmetricMatrix& A, const Vector& b);
+
+    /**
+     * @brief Solves a Toeplitz linear system Ax = b in O(n^2) time and O(n)
+     * memory by the Levinson recursion.
+     *
+     * The recursion solves the leading k x k systems for k = 1 .. n, each
+     * from the previous one. A symmetric A, e.g. the Yule-Walker equations
+     * of an autoregressive model, takes the Levinson-Durbin form with half
+     * the work. No pivoting is done, so when a leading block is singular or
+     * nearly so, which cannot happen for positive definite A, the system is
+     * solved by the dense solve(const Matrix&, const Vector&) instead.
+     *
+     * @param A A Toeplitz matrix of coefficients.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::no_solution if A is singular and
+     * the system is inconsistent.
+     * @throws astra::internals::exceptions::infinite_solutions if A is
+     * singular and the system has infinitely many solutions.
+     */
+    static Vector solve(const ToeplitzMatrix& A, const Vector& b);
+
+    /**
+     * @brief Solves a circulant linear system Ax = b in O(n log n) by
+     * dividing the Fourier transform of b by the eigenvalues of A.
+     *
+     * @param A A circulant matrix of coefficients.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::singular_matrix if an
+     * eigenvalue is zero relative to the largest one.
+     */
+    static Vector solve(const CirculantMatrix& A, const Vector& b);
+
+    /**
+     * @brief Solves a banded linear system Ax = b with a BandedLU, in
+     * O(n * lower * (lower + upper)) time and O(n * (2 * lower + upper))
+     * memory. To solve many systems with the same A, keep the BandedLU.
+     * When a pivot is zero or nearly so (within 1e-6), the system is solved
+     * by the dense solve(const Matrix&, const Vector&) instead.
+     *
+     * @param A A banded matrix of coefficients.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::no_solution if A is singular and
+     * the system is inconsistent.
+     * @throws astra::internals::exceptions::infinite_solutions if A is
+     * singular and the system has infinitely many solutions.
+     */
+    static Vector solve(const BandedMatrix& A, const Vector& b);
+
+    /**
+     * @brief Solves a tridiagonal linear system Ax = b in O(n).
+     *
+     * A diagonally dominant A is solved by the Thomas algorithm, any other
+     * by a BandedLU with partial pivoting, which keeps the O(n) cost. A
+     * nearly singular A falls back to the dense solver as in
+     * solve(const BandedMatrix&, const Vector&).
+     *
+     * @param A A tridiagonal matrix of coefficients.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::no_solution if A is singular and
+     * the system is inconsistent.
+     * @throws astra::internals::exceptions::infinite_solutions if A is
+     * singular and the system has infinitely many solutions.
+     */
+    static Vector solve(const TridiagonalMatrix& A, const Vector& b);
+
+    /**
+     * @brief Solves a tridiagonal linear system Ax = b by the Thomas
+     * algorithm, Gaussian elimination without pivoting in one forward and
+     * one backward sweep.
+     *
+     * It takes 8n flops and is stable for diagonally dominant or symmetric
+     * positive definite A. For other matrices a pivot may be zero or tiny,
+     * use solve instead.
+     *
+     * @param A A tridiagonal matrix of coefficients.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::singular_matrix if a pivot is
+     * nearly zero (within 1e-6).
+     */
+    static Vector thomas(const TridiagonalMatrix& A, const Vector& b);
+
+    /**
+     * @brief Solves Ax = b in the least-squares sense with a Householder QR
+     * decomposition.
+     *
+     * For m >= n the x minimising ||Ax - b|| is returned. [A | b] is factored
+     * together, so Q^T b comes out of the factorization without applying
+     * the reflectors again, and x solves R x = (Q^T b)[0:n]. For m < n the
+     * solution of minimum norm is returned, computed from the QR
+     * decomposition of A^T.
+     *
+     * @param A The m x n coefficient matrix with full rank min(m, n).
+     * @param b The right-hand side vector with m entries.
+     * @return Vector The least-squares solution x with n entries.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the size of b is not m.
+     * @throws astra::internals::exceptions::rank_deficient_matrix if a
+     * diagonal entry of R is nearly zero (within 1e-6).
+     */
+    static Vector least_squares(const Matrix& A, const Vector& b);
+
+    /**
+     * @brief Solves Ax = b in the least-squares sense for operands given as
+     * views. See least_squares(const Matrix&, const Vector&).
+     *
+     * @param A A view of the m x n coefficient matrix.
+     * @param b A view of the right-hand side vector.
+     * @return Vector The least-squares solution x with n entries.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the size of b is not m.
+     * @throws astra::internals::exceptions::rank_deficient_matrix if a
+     * diagonal entry of R is nearly zero (within 1e-6).
+     */
+    static Vector least_squares(const MatrixView& A, const VectorView& b);
+
+    /**
+     * @brief Computes the Moore-Penrose pseudo-inverse of A from its thin
+     * singular value decomposition.
+     *
+     * A^+ = V S^+ U^T, where S^+ inverts the singular values above
+     * max(m, n) * eps * s_max and zeroes the rest. Unlike least_squares the
+     * matrix may be rank deficient, A^+ b is then the least-squares
+     * solution of minimum norm.
+     *
+     * @param A The m x n matrix.
+     * @return Matrix The n x m pseudo-inverse.
+     * @throws astra::internals::exceptions::no_convergence if the singular
+     * value decomposition does not converge.
+     */
+    static Matrix pinv(const Matrix& A);
+
+    /**
+     * @brief Computes the pseudo-inverse of a matrix given as a view. See
+     * pinv(const Matrix&).
+     *
+     * @param A A view of the m x n matrix.
+     * @return Matrix The n x m pseudo-inverse.
+     * @throws astra::internals::exceptions::no_convergence if the singular
+     * value decomposition does not converge.
+     */
+    static Matrix pinv(const MatrixView& A);
+
+    /**
+     * @brief Solves Ax = b for a symmetric positive definite A by the
+     * conjugate gradient method.
+     *
+     * Starting from x = 0, each iteration takes one product with A and
+     * minimises the A-norm of the error over the growing Krylov space. The
+     * iteration stops once ||b - A x|| <= tol * ||b||, after max_iter
+     * iterations or when the search direction has no positive curvature,
+     * which shows A is not positive definite. The result then has
+     * converged set to false, no exception is thrown.
+     *
+     * @param A The n x n symmetric positive definite matrix.
+     * @param b The right-hand side vector.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult cg(const Matrix& A, const Vector& b,
+                              double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by the conjugate gradient method for an A given
+     * as an operator. See cg(const Matrix&, const Vector&, double, int).
+     *
+     * @param A The symmetric positive definite operator on vectors of the
+     * size of b.
+     * @param b The right-hand side vector.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult cg(const LinearOperator& A, const Vector& b,
+                              double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by the conjugate gradient method for a sparse A,
+     * one SpMV per iteration. See
+     * cg(const Matrix&, const Vector&, double, int).
+     *
+     * @param A The n x n symmetric positive definite sparse matrix.
+     * @param b The right-hand side vector.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult cg(const SparseMatrix& A, const Vector& b,
+                              double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by the conjugate gradient method preconditioned
+     * by M, which must be symmetric positive definite like A.
+     *
+     * Each iteration applies M^{-1} once to the residual, so the iteration
+     * count follows the condition of M^{-1} A instead of that of A. The
+     * residual history is that of b - A x. See
+     * cg(const Matrix&, const Vector&, double, int).
+     *
+     * @param A The n x n symmetric positive definite matrix.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of order n, set up once for A.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A, M and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult cg(const Matrix& A, const Vector& b,
+                              const Preconditioner& M, double tol = 1e-10,
+                              int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by preconditioned conjugate gradients for an A
+     * given as an operator. See
+     * cg(const Matrix&, const Vector&, const Preconditioner&, double, int).
+     *
+     * @param A The symmetric positive definite operator on vectors of the
+     * size of b.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of the order of b.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the order of M is not the size of b.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult cg(const LinearOperator& A, const Vector& b,
+                              const Preconditioner& M, double tol = 1e-10,
+                              int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by preconditioned conjugate gradients for a
+     * sparse A. See
+     * cg(const Matrix&, const Vector&, const Preconditioner&, double, int).
+     *
+     * @param A The n x n symmetric positive definite sparse matrix.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of order n, set up once for A.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A, M and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult cg(const SparseMatrix& A, const Vector& b,
+                              const Preconditioner& M, double tol = 1e-10,
+                              int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b for a general square A by the restarted GMRES
+     * method.
+     *
+     * Each cycle builds an orthonormal basis of up to restart Krylov
+     * vectors by modified Gram-Schmidt and minimises the residual over it,
+     * with the least-squares problem kept triangular by Givens rotations so
+     * its residual is known at every step. The cycle's correction is then
+     * added to x and the next cycle starts from the true residual. Each
+     * iteration takes one product with A and max_iter bounds their total
+     * over all cycles. Not reaching tol sets converged to false.
+     *
+     * @param A The n x n matrix.
+     * @param b The right-hand side vector.
+     * @param restart The number of basis vectors per cycle.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest total number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if restart is
+     * not positive or tol or max_iter is negative.
+     */
+    static IterativeResult gmres(const Matrix& A, const Vector& b,
+                                 int restart = 30, double tol = 1e-10,
+                                 int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by restarted GMRES for an A given as an
+     * operator. See gmres(const Matrix&, const Vector&, int, double, int).
+     *
+     * @param A The operator on vectors of the size of b.
+     * @param b The right-hand side vector.
+     * @param restart The number of basis vectors per cycle.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest total number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::invalid_argument if restart is
+     * not positive or tol or max_iter is negative.
+     */
+    static IterativeResult gmres(const LinearOperator& A, const Vector& b,
+                                 int restart = 30, double tol = 1e-10,
+                                 int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by restarted GMRES for a sparse A. See
+     * gmres(const Matrix&, const Vector&, int, double, int).
+     *
+     * @param A The n x n sparse matrix.
+     * @param b The right-hand side vector.
+     * @param restart The number of basis vectors per cycle.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest total number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if restart is
+     * not positive or tol or max_iter is negative.
+     */
+    static IterativeResult gmres(const SparseMatrix& A, const Vector& b,
+                                 int restart = 30, double tol = 1e-10,
+                                 int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by restarted GMRES preconditioned by M from the
+     * right.
+     *
+     * The Krylov space is built for A M^{-1} and the correction of a cycle
+     * is mapped back through M^{-1}, so the residual that is minimised and
+     * reported is still that of b - A x. See
+     * gmres(const Matrix&, const Vector&, int, double, int).
+     *
+     * @param A The n x n matrix.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of order n, set up once for A.
+     * @param restart The number of basis vectors per cycle.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest total number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A, M and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if restart is
+     * not positive or tol or max_iter is negative.
+     */
+    static IterativeResult gmres(const Matrix& A, const Vector& b,
+                                 const Preconditioner& M, int restart = 30,
+                                 double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by right preconditioned GMRES for an A given as
+     * an operator. See gmres(const Matrix&, const Vector&,
+     * const Preconditioner&, int, double, int).
+     *
+     * @param A The operator on vectors of the size of b.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of the order of b.
+     * @param restart The number of basis vectors per cycle.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest total number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the order of M is not the size of b.
+     * @throws astra::internals::exceptions::invalid_argument if restart is
+     * not positive or tol or max_iter is negative.
+     */
+    static IterativeResult gmres(const LinearOperator& A, const Vector& b,
+                                 const Preconditioner& M, int restart = 30,
+                                 double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by right preconditioned GMRES for a sparse A.
+     * See gmres(const Matrix&, const Vector&, const Preconditioner&, int,
+     * double, int).
+     *
+     * @param A The n x n sparse matrix.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of order n, set up once for A.
+     * @param restart The number of basis vectors per cycle.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest total number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A, M and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if restart is
+     * not positive or tol or max_iter is negative.
+     */
+    static IterativeResult gmres(const SparseMatrix& A, const Vector& b,
+                                 const Preconditioner& M, int restart = 30,
+                                 double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b for a general square A by the BiCGSTAB method.
+     *
+     * Each iteration takes two products with A and keeps a fixed amount of
+     * memory, unlike GMRES, at the price of an irregular convergence. The
+     * iteration stops at ||b - A x|| <= tol * ||b||, after max_iter
+     * iterations or on a breakdown, where an inner product the method
+     * divides by vanishes. Not reaching tol sets converged to false.
+     *
+     * @param A The n x n matrix.
+     * @param b The right-hand side vector.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult bicgstab(const Matrix& A, const Vector& b,
+                                    double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by BiCGSTAB for an A given as an operator. See
+     * bicgstab(const Matrix&, const Vector&, double, int).
+     *
+     * @param A The operator on vectors of the size of b.
+     * @param b The right-hand side vector.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult bicgstab(const LinearOperator& A, const Vector& b,
+                                    double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by BiCGSTAB for a sparse A. See
+     * bicgstab(const Matrix&, const Vector&, double, int).
+     *
+     * @param A The n x n sparse matrix.
+     * @param b The right-hand side vector.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult bicgstab(const SparseMatrix& A, const Vector& b,
+                                    double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by BiCGSTAB preconditioned by M from the right.
+     *
+     * M^{-1} is applied twice per iteration, before each product with A,
+     * and the residual history is that of b - A x. See
+     * bicgstab(const Matrix&, const Vector&, double, int).
+     *
+     * @param A The n x n matrix.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of order n, set up once for A.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A, M and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult bicgstab(const Matrix& A, const Vector& b,
+                                    const Preconditioner& M,
+                                    double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by right preconditioned BiCGSTAB for an A given
+     * as an operator. See bicgstab(const Matrix&, const Vector&,
+     * const Preconditioner&, double, int).
+     *
+     * @param A The operator on vectors of the size of b.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of the order of b.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the order of M is not the size of b.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult bicgstab(const LinearOperator& A, const Vector& b,
+                                    const Preconditioner& M,
+                                    double tol = 1e-10, int max_iter = 1000);
+
+    /**
+     * @brief Solves Ax = b by right preconditioned BiCGSTAB for a sparse
+     * A. See bicgstab(const Matrix&, const Vector&, const Preconditioner&,
+     * double, int).
+     *
+     * @param A The n x n sparse matrix.
+     * @param b The right-hand side vector.
+     * @param M The preconditioner of order n, set up once for A.
+     * @param tol The relative residual to reach.
+     * @param max_iter The largest number of iterations.
+     * @return IterativeResult The solution with its residual history.
+     * @throws astra::internals::exceptions::non_square_matrix
+     * if A is not square.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the dimensions of A, M and b do not match.
+     * @throws astra::internals::exceptions::invalid_argument if tol or
+     * max_iter is negative.
+     */
+    static IterativeResult bicgstab(const SparseMatrix& A, const Vector& b,
+                                    const Preconditioner& M,
+                                    double tol = 1e-10, int max_iter = 1000);
 };
 
 } // namespace astra
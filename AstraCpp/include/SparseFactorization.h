@@ -0,0 +1,196 @@
+/**
+ * @file SparseFactorization.h
+ * @brief Declaration of the SparseCholesky and SparseLU classes, direct
+ * factorizations of sparse matrices that keep the symbolic analysis for
+ * refactoring matrices with the same pattern.
+ */
+
+#ifndef __SPARSE_FACTORIZATION_H__
+#define __SPARSE_FACTORIZATION_H__
+
+#include "SparseMatrix.h"
+#include "Vector.h"
+
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class SparseCholesky
+ * @brief The Cholesky factorization P A P^T = L L^T of a sparse symmetric
+ * positive definite matrix.
+ *
+ * Construction first analyses the pattern: it orders the rows and columns
+ * by approximate minimum degree to limit the fill of L, builds the
+ * elimination tree and counts the entries of every column of L. The
+ * numeric factorization then fills L row by row (up-looking), each row
+ * pattern found by walking the elimination tree. refactor repeats only the
+ * numeric part for a matrix with the same pattern, e.g. the next time step
+ * of a simulation, and costs a fraction of the first factorization.
+ */
+class SparseCholesky {
+  private:
+    int n;
+    std::vector<int> perm;
+    std::vector<int> a_ptr;
+    std::vector<int> a_idx;
+
+    // the lower triangle of P A P^T in compressed rows, with the position
+    // of each entry's value in the values of A
+    std::vector<int> c_ptr;
+    std::vector<int> c_idx;
+    std::vector<int> c_src;
+
+    // elimination tree and L in compressed columns, diagonal entry first
+    std::vector<int> parent;
+    std::vector<int> l_ptr;
+    std::vector<int> l_idx;
+    std::vector<double> l_val;
+
+    void factor(const std::vector<double>& values);
+
+  public:
+    /**
+     * @brief Analyses and factors a sparse matrix.
+     * @param A The symmetric positive definite matrix.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is
+     * not symmetric.
+     * @throws astra::internals::exceptions::not_positive_definite if a
+     * pivot is not positive.
+     */
+    explicit SparseCholesky(const SparseMatrix& A);
+
+    /**
+     * @brief Factors a matrix with the pattern of the analysed one again,
+     * reusing the ordering, the elimination tree and the structure of L.
+     * @param A The new symmetric positive definite matrix.
+     * @throws astra::internals::exceptions::invalid_argument if the pattern
+     * of A differs from the analysed one.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is
+     * not symmetric.
+     * @throws astra::internals::exceptions::not_positive_definite if a
+     * pivot is not positive.
+     */
+    void refactor(const SparseMatrix& A);
+
+    /**
+     * @brief Returns the order n of the factored matrix.
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the number of entries of L, diagonal included.
+     */
+    int factor_nnz() const;
+
+    /**
+     * @brief Returns the fill-reducing order, entry k is the row and column
+     * of A that comes k-th in P A P^T.
+     */
+    const std::vector<int>& permutation() const;
+
+    /**
+     * @brief Solves Ax = b for the factored A by one forward and one
+     * backward substitution with L.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the size of b is not n.
+     */
+    Vector solve(const Vector& b) const;
+};
+
+/**
+ * @class SparseLU
+ * @brief The LU factorization P A Q = L U of a sparse square matrix with
+ * partial pivoting.
+ *
+ * The columns are ordered by approximate minimum degree on the pattern of
+ * A + A^T, and the rows are chosen during the factorization: column k of
+ * L and U comes from a sparse triangular solve with the columns of L found
+ * so far, whose pattern is the set reached in the graph of L from the
+ * entries of the column of A (Gilbert and Peierls), so the work is
+ * proportional to the flops. The diagonal entry is kept as pivot while it
+ * is at least 0.1 times the largest candidate, which preserves the
+ * ordering for matrices that are close to symmetric.
+ *
+ * refactor reuses the row order and the patterns of L and U for a matrix
+ * with the pattern of the factored one, and only falls back to a full
+ * factorization when a kept pivot has become too small.
+ */
+class SparseLU {
+  private:
+    int n;
+    std::vector<int> col_perm;
+    std::vector<int> row_of_step;
+    std::vector<int> step_of_row;
+    std::vector<int> a_ptr;
+    std::vector<int> a_idx;
+
+    // L without its unit diagonal, rows in the numbering of A, and U with
+    // rows in step numbering and the diagonal entry last, both in
+    // compressed columns
+    std::vector<int> l_ptr;
+    std::vector<int> l_idx;
+    std::vector<double> l_val;
+    std::vector<int> u_ptr;
+    std::vector<int> u_idx;
+    std::vector<double> u_val;
+
+    void factor(const SparseMatrix::CSC& csc);
+
+  public:
+    /**
+     * @brief Analyses and factors a sparse matrix.
+     * @param A The square matrix.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::singular_matrix if a column
+     * has no nonzero pivot candidate.
+     */
+    explicit SparseLU(const SparseMatrix& A);
+
+    /**
+     * @brief Factors a matrix with the pattern of the factored one again,
+     * keeping its pivot order and the patterns of L and U when the pivots
+     * stay acceptable.
+     * @param A The new square matrix.
+     * @throws astra::internals::exceptions::invalid_argument if the pattern
+     * of A differs from the factored one.
+     * @throws astra::internals::exceptions::singular_matrix if a column
+     * has no nonzero pivot candidate.
+     */
+    void refactor(const SparseMatrix& A);
+
+    /**
+     * @brief Returns the order n of the factored matrix.
+     */
+    int size() const;
+
+    /**
+     * @brief Returns the number of entries of L and U, with the diagonal
+     * of U and without the unit diagonal of L.
+     */
+    int factor_nnz() const;
+
+    /**
+     * @brief Returns the column order, entry k is the column of A that
+     * comes k-th in A Q.
+     */
+    const std::vector<int>& permutation() const;
+
+    /**
+     * @brief Solves Ax = b for the factored A.
+     * @param b The right-hand side vector.
+     * @return Vector The solution vector x.
+     * @throws astra::internals::exceptions::variable_and_value_number_mismatch
+     * if the size of b is not n.
+     */
+    Vector solve(const Vector& b) const;
+};
+
+} // namespace astra
+
+#endif // !__SPARSE_FACTORIZATION_H__
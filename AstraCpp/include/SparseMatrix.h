@@ -0,0 +1,279 @@
+/**
+ * @file SparseMatrix.h
+ * @brief Declaration of the SparseMatrix class, a matrix stored in
+ * compressed sparse row (CSR) form with multithreaded products.
+ */
+
+#ifndef __SPARSE_MATRIX_H__
+#define __SPARSE_MATRIX_H__
+
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <iostream>
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class SparseMatrix
+ * @brief A real matrix that stores only its nonzero entries, in compressed
+ * sparse row (CSR) form.
+ *
+ * The entries of row i are at positions row_ptr[i] .. row_ptr[i + 1] - 1
+ * of the column index and value arrays, sorted by column without
+ * duplicates. The storage is O(rows + nnz), so matrices far too large to
+ * hold densely fit as long as they are sparse. The compressed sparse column
+ * (CSC) form is available through to_csc and from_csc, the transpose is
+ * the CSC form read as CSR.
+ *
+ * A stored entry may hold an explicit zero, it still belongs to the
+ * pattern, which matters e.g. to ILU0Preconditioner.
+ */
+class SparseMatrix {
+  private:
+    int rows;
+    int cols;
+    std::vector<int> row_ptr;
+    std::vector<int> col_idx;
+    std::vector<double> values;
+
+  public:
+    /**
+     * @struct CSC
+     * @brief The compressed sparse column form: the entries of column j are
+     * at positions col_ptr[j] .. col_ptr[j + 1] - 1, sorted by row.
+     */
+    struct CSC {
+        std::vector<int> col_ptr;   ///< Start of each column, cols + 1.
+        std::vector<int> row_idx;   ///< Row of each entry.
+        std::vector<double> values; ///< Value of each entry.
+    };
+
+    /**
+     * @brief Constructs a matrix of a specified size without entries, i.e.
+     * all zero.
+     * @param row The number of rows in the matrix.
+     * @param col The number of columns in the matrix.
+     * @throws astra::internals::exceptions::invalid_size if row or col is
+     * <= 0.
+     */
+    SparseMatrix(int row, int col);
+
+    /**
+     * @brief Constructs a matrix from coordinate (COO) triplets.
+     *
+     * Entry k is values[k] at (row_idx[k], col_idx[k]). The triplets may
+     * come in any order and entries given more than once are summed, as
+     * when assembling finite element matrices. Sorting is done by two
+     * counting passes in O(row + col + nnz).
+     *
+     * @param row The number of rows in the matrix.
+     * @param col The number of columns in the matrix.
+     * @param row_idx The row of each entry.
+     * @param col_idx The column of each entry.
+     * @param values The value of each entry.
+     * @throws astra::internals::exceptions::invalid_size if row or col is
+     * <= 0.
+     * @throws astra::internals::exceptions::invalid_argument if the three
+     * arrays differ in length.
+     * @throws astra::internals::exceptions::index_out_of_range if an index
+     * is outside the matrix.
+     */
+    SparseMatrix(int row, int col, const std::vector<int>& row_idx,
+                 const std::vector<int>& col_idx,
+                 const std::vector<double>& values);
+
+    /**
+     * @brief Constructs a matrix from the nonzero entries of a dense one.
+     * @param dense The matrix to convert.
+     */
+    explicit SparseMatrix(const Matrix& dense);
+
+    /**
+     * @brief Constructs a matrix from the nonzero entries of the block
+     * seen by a view.
+     * @param dense A view of the matrix to convert.
+     */
+    explicit SparseMatrix(const MatrixView& dense);
+
+    /**
+     * @brief Constructs a matrix from CSR arrays, taking them over.
+     * @param row The number of rows in the matrix.
+     * @param col The number of columns in the matrix.
+     * @param row_ptr The start of each row, row + 1 entries from 0 to nnz.
+     * @param col_idx The column of each entry, increasing within a row.
+     * @param values The value of each entry.
+     * @return SparseMatrix The matrix.
+     * @throws astra::internals::exceptions::invalid_size if row or col is
+     * <= 0.
+     * @throws astra::internals::exceptions::invalid_argument if the arrays
+     * are not a valid CSR form with sorted, unique columns in each row.
+     */
+    static SparseMatrix from_csr(int row, int col, std::vector<int> row_ptr,
+                                 std::vector<int> col_idx,
+                                 std::vector<double> values);
+
+    /**
+     * @brief Constructs a matrix from its CSC form.
+     * @param row The number of rows in the matrix.
+     * @param col The number of columns in the matrix.
+     * @param csc The CSC arrays, rows increasing within a column.
+     * @return SparseMatrix The matrix.
+     * @throws astra::internals::exceptions::invalid_size if row or col is
+     * <= 0.
+     * @throws astra::internals::exceptions::invalid_argument if the arrays
+     * are not a valid CSC form with sorted, unique rows in each column.
+     */
+    static SparseMatrix from_csc(int row, int col, const CSC& csc);
+
+    /**
+     * @brief Constructs the n x n identity matrix.
+     * @param n The order of the matrix.
+     * @return SparseMatrix The identity with n stored entries.
+     * @throws astra::internals::exceptions::invalid_size if n is <= 0.
+     */
+    static SparseMatrix identity(int n);
+
+    /**
+     * @brief Returns the number of rows.
+     */
+    int num_row() const;
+
+    /**
+     * @brief Returns the number of columns.
+     */
+    int num_col() const;
+
+    /**
+     * @brief Returns the number of stored entries.
+     */
+    int nnz() const;
+
+    /**
+     * @brief Returns the start of each row in the entry arrays.
+     */
+    const std::vector<int>& row_pointers() const;
+
+    /**
+     * @brief Returns the column of each stored entry.
+     */
+    const std::vector<int>& column_indices() const;
+
+    /**
+     * @brief Returns the value of each stored entry.
+     */
+    const std::vector<double>& get_values() const;
+
+    /**
+     * @brief Returns the entry at (i, j), found by binary search in row i,
+     * or zero when it is not stored.
+     * @param i The row index.
+     * @param j The column index.
+     * @return The value of the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix.
+     */
+    double operator()(int i, int j) const;
+
+    /**
+     * @brief Returns the diagonal, zero where no entry is stored.
+     * @return Vector The min(row, col) diagonal entries.
+     */
+    Vector diagonal() const;
+
+    /**
+     * @brief Converts to a dense matrix.
+     * @return Matrix The dense matrix with the same entries.
+     */
+    Matrix to_dense() const;
+
+    /**
+     * @brief Converts to the compressed sparse column form.
+     * @return CSC The CSC arrays of this matrix.
+     */
+    CSC to_csc() const;
+
+    /**
+     * @brief Returns the transpose, whose CSR form is the CSC form of this
+     * matrix.
+     * @return SparseMatrix The col x row transpose.
+     */
+    SparseMatrix transpose() const;
+
+    /**
+     * @brief Checks if the matrix is square and equal to its transpose, up
+     * to an absolute tolerance. An entry stored on one side only must be
+     * within the tolerance of zero.
+     * @param tol The largest difference between A(i, j) and A(j, i), by
+     * default the tolerance of Matrix::is_symmetric. 0 requires the two
+     * triangles to be exactly equal.
+     * @return True if the matrix is symmetric, false otherwise.
+     */
+    bool is_symmetric(double tol = 1e-6) const;
+
+    /**
+     * @brief Computes y = A x without allocating, the form a
+     * Solver::LinearOperator takes.
+     *
+     * The rows are split among the threads of the library pool once the
+     * matrix has enough entries, see set_num_threads.
+     *
+     * @param x The vector to multiply, with col entries.
+     * @param y Receives the product, a vector with row entries distinct
+     * from x.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if x or y
+     * does not have the matching size.
+     */
+    void multiply(const Vector& x, Vector& y) const;
+
+    /**
+     * @brief Multiplies the matrix with a vector (SpMV).
+     * @param x The vector to multiply, with col entries.
+     * @return Vector The product with row entries.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the size
+     * of x is not col.
+     */
+    Vector operator*(const Vector& x) const;
+
+    /**
+     * @brief Multiplies the matrix with a dense matrix (SpMM).
+     *
+     * Each stored entry scales a whole row of B, so B and the result are
+     * read and written along their rows. The rows of the result are split
+     * among the threads of the library pool.
+     *
+     * @param B The dense col x k matrix.
+     * @return Matrix The dense row x k product.
+     * @throws astra::internals::exceptions::matrix_multiplication_size_mismatch
+     * if B does not have col rows.
+     */
+    Matrix operator*(const Matrix& B) const;
+
+    /**
+     * @brief Checks if two matrices have the same size, pattern and values.
+     * @param other The matrix to compare with.
+     * @return True if they are equal, false otherwise.
+     */
+    bool operator==(const SparseMatrix& other) const;
+
+    /**
+     * @brief Checks if two matrices differ in size, pattern or values.
+     * @param other The matrix to compare with.
+     * @return True if they differ, false otherwise.
+     */
+    bool operator!=(const SparseMatrix& other) const;
+
+    /**
+     * @brief Prints the stored entries, one (i, j) value triplet per line.
+     * @param os The output stream.
+     * @param mat The matrix to print.
+     * @return The output stream.
+     */
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const SparseMatrix& mat);
+};
+
+} // namespace astra
+
+#endif // !__SPARSE_MATRIX_H__
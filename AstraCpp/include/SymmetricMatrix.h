@@ -0,0 +1,146 @@
+/**
+ * @file SymmetricMatrix.h
+ * @brief Declaration of the SymmetricMatrix class, a symmetric matrix that
+ * stores one triangle in packed form.
+ */
+
+#ifndef __SYMMETRIC_MATRIX_H__
+#define __SYMMETRIC_MATRIX_H__
+
+#include "Matrix.h"
+#include "MatrixView.h"
+#include "Vector.h"
+
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class SymmetricMatrix
+ * @brief A real symmetric matrix that stores only its lower triangle,
+ * n * (n + 1) / 2 entries instead of n^2.
+ *
+ * The lower triangle is packed row by row as in a lower TriangularMatrix,
+ * and entry (i, j) above the diagonal is read from (j, i), so writing one
+ * of them sets both. Decomposer::cholesky factors it in the same storage
+ * and Solver::solve solves with it.
+ */
+class SymmetricMatrix {
+  private:
+    int n;
+    std::vector<double> packed;
+
+    // position of (i, j) or (j, i), whichever is in the lower triangle
+    long long offset(int i, int j) const;
+
+  public:
+    /**
+     * @brief Constructs a zero symmetric matrix.
+     * @param n The order of the matrix.
+     * @throws astra::internals::exceptions::invalid_size if n is <= 0.
+     */
+    explicit SymmetricMatrix(int n);
+
+    /**
+     * @brief Constructs a symmetric matrix from a dense one.
+     * @param A The matrix to copy.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is
+     * not symmetric, see Matrix::is_symmetric.
+     */
+    explicit SymmetricMatrix(const Matrix& A);
+
+    /**
+     * @brief Constructs a symmetric matrix from the block seen by a view.
+     * @param A A view of the matrix to copy.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     * @throws astra::internals::exceptions::non_symmetric_matrix if A is
+     * not symmetric.
+     */
+    explicit SymmetricMatrix(const MatrixView& A);
+
+    /**
+     * @brief Returns the number of rows, n.
+     */
+    int num_row() const;
+
+    /**
+     * @brief Returns the number of columns, n.
+     */
+    int num_col() const;
+
+    /**
+     * @brief Returns the packed rows of the lower triangle,
+     * n * (n + 1) / 2 entries.
+     */
+    const double* data() const;
+
+    /**
+     * @brief Gives access to the entry at (i, j), which is also the entry
+     * at (j, i).
+     * @param i The row index.
+     * @param j The column index.
+     * @return A reference to the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix.
+     */
+    double& operator()(int i, int j);
+
+    /**
+     * @brief Returns the entry at row i and column j.
+     * @param i The row index.
+     * @param j The column index.
+     * @return The value of the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix.
+     */
+    double operator()(int i, int j) const;
+
+    /**
+     * @brief Converts to a dense matrix.
+     * @return Matrix The dense n x n matrix with both triangles filled.
+     */
+    Matrix to_dense() const;
+
+    /**
+     * @brief Computes y = A x without allocating, the form a
+     * Solver::LinearOperator takes. Each stored row is read once: its dot
+     * product with x gives the part of y[i] left of the diagonal and it
+     * scatters x[i] into the y[j] above.
+     * @param x The vector to multiply, with n entries.
+     * @param y Receives the product, a vector with n entries distinct from
+     * x.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if x or y
+     * does not have n entries.
+     */
+    void multiply(const Vector& x, Vector& y) const;
+
+    /**
+     * @brief Multiplies the matrix with a vector.
+     * @param x The vector to multiply, with n entries.
+     * @return Vector The product with n entries.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the size
+     * of x is not n.
+     */
+    Vector operator*(const Vector& x) const;
+
+    /**
+     * @brief Checks if two matrices have the same order and entries.
+     * @param other The matrix to compare with.
+     * @return True if they are equal, false otherwise.
+     */
+    bool operator==(const SymmetricMatrix& other) const;
+
+    /**
+     * @brief Checks if two matrices differ in order or entries.
+     * @param other The matrix to compare with.
+     * @return True if they differ, false otherwise.
+     */
+    bool operator!=(const SymmetricMatrix& other) const;
+};
+
+} // namespace astra
+
+#endif // !__SYMMETRIC_MATRIX_H__
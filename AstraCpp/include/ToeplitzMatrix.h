@@ -0,0 +1,141 @@
+/**
+ * @file ToeplitzMatrix.h
+ * @brief Declaration of the ToeplitzMatrix class, a square matrix that is
+ * constant along each diagonal and stored as its first column and row.
+ */
+
+#ifndef __TOEPLITZ_MATRIX_H__
+#define __TOEPLITZ_MATRIX_H__
+
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <complex>
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class ToeplitzMatrix
+ * @brief A square matrix with A(i, j) = t[i - j], e.g. the autocovariance
+ * matrix of a stationary process, defined by its first column and first
+ * row.
+ *
+ * Only the 2n - 1 distinct entries are kept. The product with a vector is
+ * computed in O(n log n) by embedding the matrix in a circulant one of
+ * power of two order m >= 2n - 1, whose spectrum is computed once on
+ * construction unless n is small enough for the direct product.
+ * Solver::solve solves a system in O(n^2) by the Levinson recursion,
+ * without ever forming the n^2 entries.
+ */
+class ToeplitzMatrix {
+  private:
+    std::vector<double> column;
+    std::vector<double> row;
+    // spectrum of the circulant embedding used by multiply
+    std::vector<std::complex<double>> spectrum;
+
+    void embed();
+
+  public:
+    /**
+     * @brief Constructs a symmetric Toeplitz matrix from its first column,
+     * which is also its first row.
+     * @param column The n entries t[0], t[1], ..., t[n - 1].
+     * @throws astra::internals::exceptions::invalid_size if column is
+     * empty.
+     */
+    explicit ToeplitzMatrix(std::vector<double> column);
+
+    /**
+     * @brief Constructs a Toeplitz matrix from its first column and row.
+     * @param column The n entries of the first column, A(i, 0) = column[i].
+     * @param row The n entries of the first row, A(0, j) = row[j].
+     * @throws astra::internals::exceptions::invalid_size if column is
+     * empty.
+     * @throws astra::internals::exceptions::invalid_argument if row and
+     * column differ in length or in their first entry.
+     */
+    ToeplitzMatrix(std::vector<double> column, std::vector<double> row);
+
+    /**
+     * @brief Returns the number of rows, n.
+     */
+    int num_row() const;
+
+    /**
+     * @brief Returns the number of columns, n.
+     */
+    int num_col() const;
+
+    /**
+     * @brief Returns the n entries of the first column.
+     */
+    const std::vector<double>& first_column() const;
+
+    /**
+     * @brief Returns the n entries of the first row.
+     */
+    const std::vector<double>& first_row() const;
+
+    /**
+     * @brief Returns the entry at row i and column j.
+     * @param i The row index.
+     * @param j The column index.
+     * @return The value of the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix.
+     */
+    double operator()(int i, int j) const;
+
+    /**
+     * @brief Checks if the first row equals the first column.
+     * @return True if the matrix is symmetric, false otherwise.
+     */
+    bool is_symmetric() const;
+
+    /**
+     * @brief Converts to a dense matrix.
+     * @return Matrix The dense n x n matrix with the same entries.
+     */
+    Matrix to_dense() const;
+
+    /**
+     * @brief Computes y = A x without allocating the matrix, the form a
+     * Solver::LinearOperator takes. Small matrices are multiplied directly,
+     * larger ones through the circulant embedding in O(n log n).
+     * @param x The vector to multiply, with n entries.
+     * @param y Receives the product, a vector with n entries distinct from
+     * x.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if x or y
+     * does not have n entries.
+     */
+    void multiply(const Vector& x, Vector& y) const;
+
+    /**
+     * @brief Multiplies the matrix with a vector.
+     * @param x The vector to multiply, with n entries.
+     * @return Vector The product with n entries.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the size
+     * of x is not n.
+     */
+    Vector operator*(const Vector& x) const;
+
+    /**
+     * @brief Checks if two matrices have the same first column and row.
+     * @param other The matrix to compare with.
+     * @return True if they are equal, false otherwise.
+     */
+    bool operator==(const ToeplitzMatrix& other) const;
+
+    /**
+     * @brief Checks if two matrices differ in order or entries.
+     * @param other The matrix to compare with.
+     * @return True if they differ, false otherwise.
+     */
+    bool operator!=(const ToeplitzMatrix& other) const;
+};
+
+} // namespace astra
+
+#endif // !__TOEPLITZ_MATRIX_H__
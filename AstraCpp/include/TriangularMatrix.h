@@ -0,0 +1,183 @@
+/**
+ * @file TriangularMatrix.h
+ * @brief Declaration of the TriangularMatrix class, a lower or upper
+ * triangular matrix in packed storage.
+ */
+
+#ifndef __TRIANGULAR_MATRIX_H__
+#define __TRIANGULAR_MATRIX_H__
+
+#include "Matrix.h"
+#include "MatrixView.h"
+#include "Vector.h"
+
+#include <vector>
+
+namespace astra {
+
+/**
+ * @brief Selects the triangle of a matrix that holds its entries.
+ */
+enum class Triangle { lower, upper };
+
+/**
+ * @class TriangularMatrix
+ * @brief A square lower or upper triangular matrix that stores only its
+ * triangle, n * (n + 1) / 2 entries instead of n^2.
+ *
+ * The triangle is packed row by row: row i of a lower matrix keeps the
+ * columns 0 .. i, row i of an upper one the columns i .. n - 1, so every
+ * row is contiguous and the products and substitutions run over whole rows.
+ * Decomposer returns its triangular factors in this form, e.g. the L of
+ * Decomposer::cholesky for a SymmetricMatrix, and Solver::forward_sub and
+ * Solver::backward_sub take it directly.
+ */
+class TriangularMatrix {
+  private:
+    int n;
+    Triangle part;
+    std::vector<double> packed;
+
+    // position of (i, j), which must lie in the triangle
+    long long offset(int i, int j) const;
+
+  public:
+    /**
+     * @brief Constructs a zero triangular matrix.
+     * @param n The order of the matrix.
+     * @param part The triangle that holds the entries.
+     * @throws astra::internals::exceptions::invalid_size if n is <= 0.
+     */
+    TriangularMatrix(int n, Triangle part);
+
+    /**
+     * @brief Constructs a triangular matrix from a triangle of a dense one,
+     * the entries on the other side of the diagonal are not read.
+     * @param A The square matrix to copy.
+     * @param part The triangle to copy.
+     * @param unit_diagonal True to store ones on the diagonal instead of
+     * the diagonal of A, as for the L of Decomposer::LUResult.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    TriangularMatrix(const Matrix& A, Triangle part,
+                     bool unit_diagonal = false);
+
+    /**
+     * @brief Constructs a triangular matrix from a triangle of the square
+     * block seen by a view.
+     * @param A A view of the square matrix to copy.
+     * @param part The triangle to copy.
+     * @param unit_diagonal True to store ones on the diagonal instead of
+     * the diagonal of A.
+     * @throws astra::internals::exceptions::non_square_matrix if A is not
+     * square.
+     */
+    TriangularMatrix(const MatrixView& A, Triangle part,
+                     bool unit_diagonal = false);
+
+    /**
+     * @brief Returns the number of rows, n.
+     */
+    int num_row() const;
+
+    /**
+     * @brief Returns the number of columns, n.
+     */
+    int num_col() const;
+
+    /**
+     * @brief Returns the triangle that holds the entries.
+     */
+    Triangle triangle() const;
+
+    /**
+     * @brief Returns the packed rows, n * (n + 1) / 2 entries.
+     */
+    double* data();
+
+    /**
+     * @brief Returns the packed rows, n * (n + 1) / 2 entries.
+     */
+    const double* data() const;
+
+    /**
+     * @brief Gives access to an entry of the triangle.
+     * @param i The row index.
+     * @param j The column index.
+     * @return A reference to the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix or the triangle.
+     */
+    double& operator()(int i, int j);
+
+    /**
+     * @brief Returns the entry at row i and column j, zero outside the
+     * triangle.
+     * @param i The row index.
+     * @param j The column index.
+     * @return The value of the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix.
+     */
+    double operator()(int i, int j) const;
+
+    /**
+     * @brief Converts to a dense matrix.
+     * @return Matrix The dense n x n matrix with the same entries.
+     */
+    Matrix to_dense() const;
+
+    /**
+     * @brief Returns the transpose, which holds its entries in the other
+     * triangle.
+     * @return TriangularMatrix The transposed matrix.
+     */
+    TriangularMatrix transpose() const;
+
+    /**
+     * @brief Computes the determinant, the product of the diagonal.
+     * @return The determinant of the matrix.
+     */
+    double det() const;
+
+    /**
+     * @brief Computes y = A x without allocating, the form a
+     * Solver::LinearOperator takes. Each row is one dot product over its
+     * stored part only, n^2 flops instead of 2 n^2 for the dense matrix.
+     * @param x The vector to multiply, with n entries.
+     * @param y Receives the product, a vector with n entries distinct from
+     * x.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if x or y
+     * does not have n entries.
+     */
+    void multiply(const Vector& x, Vector& y) const;
+
+    /**
+     * @brief Multiplies the matrix with a vector.
+     * @param x The vector to multiply, with n entries.
+     * @return Vector The product with n entries.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the size
+     * of x is not n.
+     */
+    Vector operator*(const Vector& x) const;
+
+    /**
+     * @brief Checks if two matrices have the same order, triangle and
+     * entries.
+     * @param other The matrix to compare with.
+     * @return True if they are equal, false otherwise.
+     */
+    bool operator==(const TriangularMatrix& other) const;
+
+    /**
+     * @brief Checks if two matrices differ in order, triangle or entries.
+     * @param other The matrix to compare with.
+     * @return True if they differ, false otherwise.
+     */
+    bool operator!=(const TriangularMatrix& other) const;
+};
+
+} // namespace astra
+
+#endif // !__TRIANGULAR_MATRIX_H__
@@ -0,0 +1,158 @@
+/**
+ * @file TridiagonalMatrix.h
+ * @brief Declaration of the TridiagonalMatrix class, a square matrix stored
+ * as its three diagonals.
+ */
+
+#ifndef __TRIDIAGONAL_MATRIX_H__
+#define __TRIDIAGONAL_MATRIX_H__
+
+#include "BandedMatrix.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+#include <vector>
+
+namespace astra {
+
+/**
+ * @class TridiagonalMatrix
+ * @brief A square matrix whose only nonzero entries are on the main
+ * diagonal and the diagonals right below and above it, as in cubic spline
+ * fitting and implicit finite difference steps in one dimension.
+ *
+ * The three diagonals are kept as separate arrays: sub[i] is entry
+ * (i + 1, i), diag[i] is entry (i, i) and super[i] is entry (i, i + 1).
+ * Solver::thomas solves a system in O(n), Solver::solve picks it when the
+ * matrix is diagonally dominant and a BandedLU with pivoting otherwise.
+ */
+class TridiagonalMatrix {
+  private:
+    std::vector<double> sub;
+    std::vector<double> diag;
+    std::vector<double> super;
+
+  public:
+    /**
+     * @brief Constructs a zero matrix of order n.
+     * @param n The order of the matrix.
+     * @throws astra::internals::exceptions::invalid_size if n is <= 0.
+     */
+    explicit TridiagonalMatrix(int n);
+
+    /**
+     * @brief Constructs a matrix from its three diagonals.
+     * @param sub The n - 1 entries below the main diagonal.
+     * @param diag The n entries of the main diagonal.
+     * @param super The n - 1 entries above the main diagonal.
+     * @throws astra::internals::exceptions::invalid_size if diag is empty.
+     * @throws astra::internals::exceptions::invalid_argument if sub or
+     * super does not have n - 1 entries.
+     */
+    TridiagonalMatrix(std::vector<double> sub, std::vector<double> diag,
+                      std::vector<double> super);
+
+    /**
+     * @brief Returns the number of rows, n.
+     */
+    int num_row() const;
+
+    /**
+     * @brief Returns the number of columns, n.
+     */
+    int num_col() const;
+
+    /**
+     * @brief Returns the n - 1 entries below the main diagonal.
+     */
+    const std::vector<double>& sub_diagonal() const;
+
+    /**
+     * @brief Returns the n entries of the main diagonal.
+     */
+    const std::vector<double>& main_diagonal() const;
+
+    /**
+     * @brief Returns the n - 1 entries above the main diagonal.
+     */
+    const std::vector<double>& super_diagonal() const;
+
+    /**
+     * @brief Gives access to an entry of the three diagonals.
+     * @param i The row index.
+     * @param j The column index.
+     * @return A reference to the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix or the three diagonals.
+     */
+    double& operator()(int i, int j);
+
+    /**
+     * @brief Returns the entry at row i and column j, zero outside the three
+     * diagonals.
+     * @param i The row index.
+     * @param j The column index.
+     * @return The value of the entry.
+     * @throws astra::internals::exceptions::index_out_of_range if (i, j) is
+     * outside the matrix.
+     */
+    double operator()(int i, int j) const;
+
+    /**
+     * @brief Checks if every row is diagonally dominant, |diag[i]| at least
+     * the sum of the other two entries of row i, which keeps the Thomas
+     * algorithm stable without pivoting.
+     * @return True if the matrix is diagonally dominant, false otherwise.
+     */
+    bool is_diagonally_dominant() const;
+
+    /**
+     * @brief Converts to a dense matrix.
+     * @return Matrix The dense n x n matrix with the same entries.
+     */
+    Matrix to_dense() const;
+
+    /**
+     * @brief Converts to a banded matrix with one diagonal on each side.
+     * @return BandedMatrix The same matrix in band storage.
+     */
+    BandedMatrix to_banded() const;
+
+    /**
+     * @brief Computes y = A x without allocating, the form a
+     * Solver::LinearOperator takes.
+     * @param x The vector to multiply, with n entries.
+     * @param y Receives the product, a vector with n entries distinct from
+     * x.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if x or y
+     * does not have n entries.
+     */
+    void multiply(const Vector& x, Vector& y) const;
+
+    /**
+     * @brief Multiplies the matrix with a vector.
+     * @param x The vector to multiply, with n entries.
+     * @return Vector The product with n entries.
+     * @throws astra::internals::exceptions::matrix_size_mismatch if the size
+     * of x is not n.
+     */
+    Vector operator*(const Vector& x) const;
+
+    /**
+     * @brief Checks if two matrices have the same diagonals.
+     * @param other The matrix to compare with.
+     * @return True if they are equal, false otherwise.
+     */
+    bool operator==(const TridiagonalMatrix& other) const;
+
+    /**
+     * @brief Checks if two matrices differ in order or diagonals.
+     * @param other The matrix to compare with.
+     * @return True if they differ, false otherwise.
+     */
+    bool operator!=(const TridiagonalMatrix& other) const;
+};
+
+} // namespace astra
+
+#endif // !__TRIDIAGONAL_MATRIX_H__
@@ -1,39 +1,60 @@
 /**
  * @file Vector.h
- * @brief Declaration of the Vector class, which provides some basic vector
- * operations for linear algebra.
+ * @brief Declaration of the BasicVector class template, which provides some
+ * basic vector operations for linear algebra, and of its Vector aliases.
  */
 
 #ifndef __VECTOR_H__
 #define __VECTOR_H__
 
+#include "../internals/Config.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Memory.h"
+#include "Expression.h"
+#include "VectorView.h"
+
+#include <complex>
 #include <iostream>
 
 namespace astra {
 
-class Matrix;
+template <typename T>
+class BasicMatrix;
+
+template <typename T>
+class BasicVector;
 
 /**
- * @class Vector
+ * @class BasicVector
  * @brief A class for representing mathematical vectors with various operations.
  *
  * This class supports basic vector operations such as addition, subtraction,
  * scalar multiplication, dot product, cross product, and more.
+ * Element-wise operations are lazy, see Expression.h.
+ *
+ * @tparam T The element type: float, double, std::complex<float> or
+ * std::complex<double>. Vector is the double instantiation.
  */
-class Vector {
+template <typename T>
+class BasicVector : public VectorExpr<BasicVector<T>> {
   private:
     int size;
     int current_index;
-    double* values;
+    T* values;
+
+    friend class BasicVectorView<T>;
 
   public:
+    using value_type = T;
+    using real_type = internals::mathutils::real_t<T>;
+
     /**
      * @brief Constructs a vector of a specified size, initializing all elements
      * to zero.
      * @param size The size of the vector.
      * @throws astra::internals::exceptions::invalid_size if size is <= 0.
      */
-    Vector(int size);
+    BasicVector(int size);
 
     /**
      * @brief Constructs a vector from an array of values.
@@ -41,20 +62,45 @@ class Vector {
      * @param values An array of values to initialize the vector.
      * @throws astra::internals::exceptions::invalid_size if size is <= 0.
      */
-    Vector(int size, const double values[]);
+    BasicVector(int size, const T values[]);
 
     /**
      * @brief Copy constructor for deep copying another vector.
      * @param other The vector to copy from.
      */
-    Vector(const Vector& other);
+    BasicVector(const BasicVector& other);
+
+    /**
+     * @brief Move constructor, takes over the storage of another vector.
+     * @param other The vector to move from. It is left empty (size 0) and may
+     * only be assigned to or destroyed.
+     */
+    BasicVector(BasicVector&& other) noexcept;
+
+    /**
+     * @brief Constructs a vector by copying the elements seen by a view.
+     * @param view The view to copy from.
+     */
+    explicit BasicVector(const BasicVectorView<T>& view);
+
+    /**
+     * @brief Constructs a vector by evaluating an element-wise expression in a
+     * single pass.
+     * @param expr The expression to evaluate, e.g. `u + v * 2.0`.
+     */
+    template <typename E>
+    BasicVector(const VectorExpr<E>& expr)
+        : size(expr.derived().get_size()), current_index(size),
+          values(internals::memory::allocate<T>(size)) {
+        internals::expr::assign(values, expr.derived(), size);
+    }
 
-    Vector(std::initializer_list<double> values);
+    BasicVector(std::initializer_list<T> values);
 
     /**
      * @brief Destructor to free dynamically allocated memory.
      */
-    ~Vector();
+    ~BasicVector();
 
     /**
      * @brief Returns the size of the vector.
@@ -69,59 +115,73 @@ class Vector {
      * @throws astra::internals::exceptions::init_out_of_range if insertion
      * exceeds vector size.
      */
-    Vector& operator<<(double val);
+    BasicVector& operator<<(T val);
 
     /**
      * @brief Adds a value to the vector using comma operator by chaining.
      * @param val The value to add.
      * @return Reference to the updated vector.
      */
-    Vector& operator,(double val);
+    BasicVector& operator,(T val);
 
     /**
-     * @brief Calculates the dot product with another vector.
+     * @brief Calculates the dot product with another vector. For complex
+     * vectors this vector is conjugated, so v * v is the squared magnitude.
      * @param other The vector to calculate the dot product with.
      * @return The dot product result.
      * @throws astra::internals::exceptions::vector_size_mismatch if sizes don't
      * match.
      */
-    double operator*(const Vector& other) const;
+    T operator*(const BasicVector& other) const;
 
     /**
-     * @brief Adds this vector to another vector.
-     * @param other The vector to add.
-     * @return A new vector resulting from the addition.
-     * @throws astra::internals::exceptions::vector_size_mismatch if sizes don't
-     * match.
+     * @brief Gives unchecked read access to an element. Used when evaluating
+     * expressions.
+     * @param i The index of the element.
+     * @return The value at that index.
      */
-    Vector operator+(const Vector& other) const;
+    T coeff(int i) const { return values[i]; }
 
     /**
-     * @brief Subtracts another vector from this vector.
-     * @param other The vector to subtract.
-     * @return A new vector resulting from the subtraction.
-     * @throws astra::internals::exceptions::vector_size_mismatch if sizes don't
-     * match.
+     * @brief Accesses an element at a specified index.
+     * @param index The index of the element.
+     * @return The value at the specified index.
+     * @throws astra::internals::exceptions::index_out_of_range if index is out
+     * of bounds and ASTRA_BOUNDS_CHECK is on.
      */
-    Vector operator-(const Vector& other) const;
+    T& operator[](int i) {
+#if ASTRA_BOUNDS_CHECK
+        if (i < 0 || i >= size) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return values[i];
+    }
+
+    const T& operator[](int i) const {
+#if ASTRA_BOUNDS_CHECK
+        if (i < 0 || i >= size) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return values[i];
+    }
 
     /**
-     * @brief Divides the vector by a scalar value.
-     * @param scalar The scalar divisor.
-     * @return A new vector divided by the scalar.
-     * @throws astra::internals::exceptions::zero_division if scalar is zero.
+     * @brief Gives access to an element without bounds checking, whatever
+     * ASTRA_BOUNDS_CHECK is set to.
+     * @param i The index, which must be in [0, get_size()).
+     * @return A reference to the element.
      */
-    Vector operator/(double scalar) const;
+    T& unchecked(int i) { return values[i]; }
+    const T& unchecked(int i) const { return values[i]; }
 
     /**
-     * @brief Accesses an element at a specified index.
-     * @param index The index of the element.
-     * @return The value at the specified index.
-     * @throws astra::internals::exceptions::index_out_of_range if index is out
-     * of bounds.
+     * @brief Returns a pointer to the contiguous storage of `get_size()`
+     * elements.
      */
-    double& operator[](int i);
-    const double& operator[](int i) const;
+    T* data() { return values; }
+    const T* data() const { return values; }
 
     /**
      * @brief Calculates the cross product of a 3d vector with another 3d
@@ -130,39 +190,55 @@ class Vector {
      * @return A new vector as the cross product result.
      * @throws std::invalid_argument if either vector is not 3-dimensional.
      */
-    Vector operator^(const Vector& other) const;
+    BasicVector operator^(const BasicVector& other) const;
 
     /**
      * @brief Assigns another vector to this vector (deep copy).
      * @param other The vector to assign from.
      * @return Reference to this vector after assignment.
      */
-    Vector& operator=(const Vector& other);
+    BasicVector& operator=(const BasicVector& other);
+
+    /**
+     * @brief Move-assigns another vector to this vector without copying its
+     * elements.
+     * @param other The vector to move from. It is left empty (size 0).
+     * @return Reference to this vector after assignment.
+     */
+    BasicVector& operator=(BasicVector&& other) noexcept;
+
+    /**
+     * @brief Evaluates an element-wise expression into this vector in a
+     * single pass, reusing the current storage when the size matches.
+     * @param expr The expression to evaluate. It may refer to this vector.
+     * @return Reference to this vector after assignment.
+     */
+    template <typename E>
+    BasicVector& operator=(const VectorExpr<E>& expr) {
+        const E& e = expr.derived();
+        if (size != e.get_size()) {
+            // a differently sized result cannot alias this vector
+            internals::memory::deallocate(values);
+            size = e.get_size();
+            values = internals::memory::allocate<T>(size);
+        }
+        internals::expr::assign(values, e, size);
+        return *this;
+    }
 
     /**
      * @brief Checks if this vector is equal to another vector.
      * @param other The vector to compare with.
      * @return True if vectors are equal, false otherwise.
      */
-    bool operator==(const Vector& other) const;
+    bool operator==(const BasicVector& other) const;
 
     /**
      * @brief Checks if this vector is not equal to another vector.
      * @param other The vector to compare with.
      * @return True if vectors are not equal, false otherwise.
      */
-    bool operator!=(const Vector& other) const;
-
-    /**
-     * @brief Multiplies each element of the vector by a scalar.
-     * @param vec The vector to be scaled.
-     * @param scalar The scalar value to multiply with each element of the
-     * vector.
-     * @return A new vector that is the result of scaling the original vector by
-     * the scalar.
-     */
-    friend Vector operator*(const Vector& vec, double scalar);
-    friend Vector operator*(double scalar, const Vector& vec);
+    bool operator!=(const BasicVector& other) const;
 
     /**
      * @brief Overloads the stream insertion operator for printing the vector.
@@ -170,8 +246,11 @@ class Vector {
      * @param vec The vector to output.
      * @return The output stream with the vector representation.
      */
-    friend std::ostream& operator<<(std::ostream& os, const Vector& vec);
-    friend std::istream& operator>>(std::istream& in, Vector& vec);
+    template <typename U>
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const BasicVector<U>& vec);
+    template <typename U>
+    friend std::istream& operator>>(std::istream& in, BasicVector<U>& vec);
 
     /**
      * @brief Computes the magnitude (length) of the vector.
@@ -182,9 +261,10 @@ class Vector {
      *
      *     magnitude = sqrt(v1^2 + v2^2 + ... + vn^2)
      *
-     * @return The magnitude (length) of the vector as a double.
+     * @return The magnitude (length) of the vector, a real number also for
+     * complex vectors.
      */
-    double mag() const;
+    real_type mag() const;
 
     /**
      * @brief Calculates the angle between two vectors in radians.
@@ -196,7 +276,7 @@ class Vector {
      * @throws astra::internals::exceptions::invalid_argument if any of the
      * vectors has zero magnitude.
      */
-    static double angle(const Vector& v1, const Vector& v2);
+    static real_type angle(const BasicVector& v1, const BasicVector& v2);
 
     /**
      * @brief Calculates the angle between two vectors in degrees.
@@ -208,31 +288,33 @@ class Vector {
      * @throws astra::internals::exceptions::invalid_argument if any of the
      * vectors has zero magnitude.
      */
-    static double angle_deg(const Vector& v1, const Vector& v2);
+    static real_type angle_deg(const BasicVector& v1, const BasicVector& v2);
 
     /**
      * @brief Computes the sum of all elements in the vector.
      * @return The sum of all elements in the vector.
      */
-    double sum() const;
+    T sum() const;
 
     /**
      * @brief Computes the avg of all elements in the vector.
      * @return The mean of all elements in the vector.
      */
-    double avg() const;
+    T avg() const;
 
     /**
-     * @brief Computes the min of all elements in the vector.
+     * @brief Computes the min of all elements in the vector. Complex
+     * elements are ordered by real part, then by imaginary part.
      * @return The min of all elements in the vector.
      */
-    double min() const;
+    T min() const;
 
     /**
-     * @brief Computes the max of all elements in the vector.
+     * @brief Computes the max of all elements in the vector. Complex
+     * elements are ordered by real part, then by imaginary part.
      * @return The max of all elements in the vector.
      */
-    double max() const;
+    T max() const;
 
     /**
      * @brief Normalizes the vector.
@@ -240,7 +322,19 @@ class Vector {
      * @throws astra::internals::exceptions::zero_division if the vector has
      * zero magnitude.
      */
-    Vector normalize() const;
+    BasicVector normalize() const;
+
+    /**
+     * @brief Returns a non-owning view of the elements from `start` to `end`,
+     * without copying.
+     * @param start The index of the first element. (inclusive)
+     * @param end The index of the last element. (inclusive)
+     * @return BasicVectorView A view valid while this vector is alive.
+     * @throws astra::internals::exceptions::index_out_of_range if the indices
+     * are out of bounds.
+     * @throws astra::internals::exceptions::invalid_argument if start > end.
+     */
+    BasicVectorView<T> segment(int start, int end) const;
 };
 
 /**
@@ -252,7 +346,68 @@ class Vector {
  * @throws astra::internals::exceptions::matrix_size_mismatch if the number of
  * columns in the matrix does not equal the size of the vector.
  */
-Vector operator*(const Matrix& mat, const Vector& vec);
+template <typename T>
+BasicVector<T> operator*(const BasicMatrix<T>& mat, const BasicVector<T>& vec);
+
+// vectors of each supported element type
+using Vector = BasicVector<double>;
+using VectorF = BasicVector<float>;
+using VectorC = BasicVector<std::complex<double>>;
+using VectorCF = BasicVector<std::complex<float>>;
+
+namespace internals::expr {
+
+    // Vector operands are used in place, other expressions are evaluated
+    // into a temporary once
+    template <typename T>
+    inline const BasicVector<T>& evaluate(const BasicVector<T>& vec) {
+        return vec;
+    }
+
+    template <typename T>
+    inline const T* data_of(const BasicVector<T>& vec) {
+        return vec.data();
+    }
+
+    template <typename E>
+    BasicVector<typename E::value_type> evaluate(const VectorExpr<E>& expr) {
+        return BasicVector<typename E::value_type>(expr);
+    }
+
+} // namespace internals::expr
+
+/**
+ * @brief Compares vector expressions element by element after evaluating
+ * them.
+ */
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_vector_expr<L> &&
+                               internals::expr::is_vector_expr<R>,
+                           int> = 0,
+          typename = internals::expr::common_value_t<L, R>>
+bool operator==(const L& lhs, const R& rhs) {
+    return internals::expr::evaluate(lhs) == internals::expr::evaluate(rhs);
+}
+
+template <typename L, typename R,
+          std::enable_if_t<internals::expr::is_vector_expr<L> &&
+                               internals::expr::is_vector_expr<R>,
+                           int> = 0,
+          typename = internals::expr::common_value_t<L, R>>
+bool operator!=(const L& lhs, const R& rhs) {
+    return !(lhs == rhs);
+}
+
+/**
+ * @brief Outputs an unevaluated vector expression by evaluating it first.
+ */
+template <typename E,
+          std::enable_if_t<internals::expr::is_vector_expr<E> &&
+                               !internals::expr::is_dense<E>::value,
+                           int> = 0>
+std::ostream& operator<<(std::ostream& os, const E& expr) {
+    return os << BasicVector<typename E::value_type>(expr);
+}
 
 } // namespace astra
 #endif // !__VECTOR_H__
@@ -0,0 +1,172 @@
+/**
+ * @file VectorView.h
+ * @brief Declaration of the BasicVectorView class template, a non-owning
+ * read-only view of evenly spaced elements of a Vector or a Matrix, and of
+ * its VectorView aliases.
+ */
+
+#ifndef __VECTORVIEW_H__
+#define __VECTORVIEW_H__
+
+#include "../internals/Config.h"
+#include "../internals/Exceptions.h"
+#include "../internals/MathUtils.h"
+
+#include <complex>
+#include <iostream>
+
+namespace astra {
+
+template <typename T>
+class BasicVector;
+
+template <typename T>
+class BasicVectorView;
+
+/**
+ * @class BasicVectorView
+ * @brief A lightweight, non-owning, read-only view of a sequence of values
+ * with a fixed stride.
+ *
+ * A view is a pointer, a size and a stride, so it can describe a whole
+ * Vector, a slice of it, or a row or column of a Matrix without copying.
+ * The viewed object must outlive the view and must not be resized while the
+ * view is in use.
+ *
+ * @tparam T The element type: float, double, std::complex<float> or
+ * std::complex<double>.
+ */
+template <typename T>
+class BasicVectorView {
+  private:
+    const T* data;
+    int size;
+    int stride;
+
+    static T dot(const BasicVectorView& lhs, const BasicVectorView& rhs);
+
+  public:
+    using value_type = T;
+    using real_type = internals::mathutils::real_t<T>;
+
+    /**
+     * @brief Constructs a view over raw memory.
+     * @param data Pointer to the first element.
+     * @param size The number of elements in the view.
+     * @param stride The distance between consecutive elements. (optional)
+     * @throws astra::internals::exceptions::invalid_size if size is <= 0.
+     * @throws astra::internals::exceptions::invalid_argument if stride is
+     * <= 0.
+     */
+    BasicVectorView(const T* data, int size, int stride = 1);
+
+    /**
+     * @brief Constructs a view of a whole vector.
+     * @param vec The vector to view.
+     */
+    BasicVectorView(const BasicVector<T>& vec);
+
+    /**
+     * @brief Returns the number of elements in the view.
+     */
+    int get_size() const;
+
+    /**
+     * @brief Returns the distance between consecutive elements in memory.
+     */
+    int get_stride() const;
+
+    /**
+     * @brief Gives read-only access to an element of the view.
+     * @param i The index of the element.
+     * @return The value at the specified index.
+     * @throws astra::internals::exceptions::index_out_of_range if i is out of
+     * bounds and ASTRA_BOUNDS_CHECK is on.
+     */
+    const T& operator[](int i) const {
+#if ASTRA_BOUNDS_CHECK
+        if (i < 0 || i >= size) {
+            throw astra::internals::exceptions::index_out_of_range();
+        }
+#endif
+        return data[static_cast<long long>(i) * stride];
+    }
+
+    /**
+     * @brief Gives read-only access to an element without bounds checking,
+     * whatever ASTRA_BOUNDS_CHECK is set to.
+     * @param i The index, which must be in [0, get_size()).
+     * @return A constant reference to the element.
+     */
+    const T& unchecked(int i) const {
+        return data[static_cast<long long>(i) * stride];
+    }
+
+    /**
+     * @brief Returns a view of the elements from `start` to `end`.
+     * @param start The index of the first element. (inclusive)
+     * @param end The index of the last element. (inclusive)
+     * @return BasicVectorView The sub-view, sharing the same storage.
+     * @throws astra::internals::exceptions::index_out_of_range if the indices
+     * are out of bounds.
+     * @throws astra::internals::exceptions::invalid_argument if start > end.
+     */
+    BasicVectorView segment(int start, int end) const;
+
+    /**
+     * @brief Computes the sum of all elements in the view.
+     */
+    T sum() const;
+
+    /**
+     * @brief Computes the average of all elements in the view.
+     */
+    T avg() const;
+
+    /**
+     * @brief Computes the minimum of all elements in the view. Complex
+     * elements are ordered by real part, then by imaginary part.
+     */
+    T min() const;
+
+    /**
+     * @brief Computes the maximum of all elements in the view. Complex
+     * elements are ordered by real part, then by imaginary part.
+     */
+    T max() const;
+
+    /**
+     * @brief Computes the magnitude (Euclidean length) of the view.
+     */
+    real_type mag() const;
+
+    /**
+     * @brief Outputs the viewed elements to an output stream.
+     */
+    template <typename U>
+    friend std::ostream& operator<<(std::ostream& os,
+                                    const BasicVectorView<U>& view);
+
+    /**
+     * @brief Calculates the dot product of two vector views. For complex
+     * elements the left operand is conjugated.
+     * @param lhs The first view.
+     * @param rhs The second view.
+     * @return The dot product result.
+     * @throws astra::internals::exceptions::vector_size_mismatch if sizes
+     * don't match.
+     */
+    friend T operator*(const BasicVectorView& lhs,
+                       const BasicVectorView& rhs) {
+        return dot(lhs, rhs);
+    }
+};
+
+// views of each supported element type
+using VectorView = BasicVectorView<double>;
+using VectorViewF = BasicVectorView<float>;
+using VectorViewC = BasicVectorView<std::complex<double>>;
+using VectorViewCF = BasicVectorView<std::complex<float>>;
+
+} // namespace astra
+#endif // !__VECTORVIEW_H__
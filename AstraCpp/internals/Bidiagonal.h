@@ -0,0 +1,59 @@
+#pragma once
+
+namespace astra::internals::bidiagonal {
+
+    /**
+     * @brief Computes the singular value decomposition B = Q * S * P^T of an
+     * n x n upper bidiagonal matrix by implicitly shifted QR iteration
+     * (Golub and Reinsch).
+     *
+     * d holds the diagonal and e the n - 1 superdiagonal entries. On return
+     * d holds the singular values in descending order. The rotations are
+     * applied to rows, which are contiguous: vt becomes P^T * vt and ut
+     * becomes Q^T * ut, so with identities on entry the rows of vt and ut
+     * are the right and left singular vectors. Either may be null when the
+     * vectors are not needed.
+     *
+     * @param d The diagonal, overwritten by the singular values.
+     * @param e The superdiagonal, destroyed.
+     * @param n The order of B.
+     * @param vt An n x ncvt block updated with the right rotations, or null.
+     * @param ldvt Leading dimension of vt.
+     * @param ncvt Number of columns of vt.
+     * @param ut An n x ncut block updated with the left rotations, or null.
+     * @param ldut Leading dimension of ut.
+     * @param ncut Number of columns of ut.
+     * @throws astra::internals::exceptions::no_convergence if a singular
+     * value takes more than 75 iterations.
+     */
+    void svd(double* d, double* e, int n, double* vt, int ldvt, int ncvt,
+             double* ut, int ldut, int ncut);
+
+    /**
+     * @brief Computes the singular value decomposition B = U * S * V^T of an
+     * n x n upper bidiagonal matrix by divide and conquer.
+     *
+     * B is split around its middle row and the halves are solved
+     * recursively, down to blocks of 32 solved by QR iteration. Each merge
+     * is an SVD of a diagonal matrix bordered by one row, found from a
+     * secular equation with the deflation and the recomputed border of Gu
+     * and Eisenstat, so the vectors stay orthogonal. The new vectors are
+     * products of the old ones, which is where most of the work is.
+     *
+     * @param d The diagonal, overwritten by the singular values in
+     * descending order.
+     * @param e The n - 1 superdiagonal entries.
+     * @param n The order of B.
+     * @param u An n x n block receiving the left singular vectors as
+     * columns.
+     * @param ldu Leading dimension of u.
+     * @param v An n x n block receiving the right singular vectors as
+     * columns.
+     * @param ldv Leading dimension of v.
+     * @throws astra::internals::exceptions::no_convergence if the QR
+     * iteration of a block does not converge.
+     */
+    void divide_and_conquer(double* d, const double* e, int n, double* u,
+                            int ldu, double* v, int ldv);
+
+} // namespace astra::internals::bidiagonal
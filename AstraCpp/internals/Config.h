@@ -0,0 +1,14 @@
+#pragma once
+
+// Bounds checking of the element accessors, operator() of the matrices and
+// operator[] of the vectors. It is on in debug builds and off in release
+// builds (NDEBUG defined), and can be forced either way by defining
+// ASTRA_BOUNDS_CHECK to 1 or 0 before including any library header. The
+// unchecked() accessors never check.
+#ifndef ASTRA_BOUNDS_CHECK
+#ifdef NDEBUG
+#define ASTRA_BOUNDS_CHECK 0
+#else
+#define ASTRA_BOUNDS_CHECK 1
+#endif
+#endif
@@ -101,6 +101,34 @@ class singular_matrix : public std::exception {
     }
 };
 
+class non_symmetric_matrix : public std::exception {
+  public:
+    const char* what() const noexcept override {
+        return "[ASTRA]  given matrix is not symmetric for the operation";
+    }
+};
+
+class not_positive_definite : public std::exception {
+  public:
+    const char* what() const noexcept override {
+        return "[ASTRA]  given matrix is not positive definite for the operation";
+    }
+};
+
+class rank_deficient_matrix : public std::exception {
+  public:
+    const char* what() const noexcept override {
+        return "[ASTRA]  given matrix does not have full rank for the operation";
+    }
+};
+
+class no_convergence : public std::exception {
+  public:
+    const char* what() const noexcept override {
+        return "[ASTRA]  iterative method did not converge";
+    }
+};
+
 class matrix_not_lower_triangular : public std::exception {
   public:
     const char* what() const noexcept override {
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <complex>
+
+namespace astra::internals::fft {
+
+    /**
+     * @brief Computes the discrete Fourier transform of n complex values in
+     * place, a[k] = sum_j a[j] * exp(-2 pi i j k / n), or the inverse
+     * transform with the opposite sign and the 1 / n scale.
+     *
+     * A power of two n is done by the iterative radix-2 algorithm with a
+     * table of twiddle factors. Any other n is turned into a circular
+     * convolution of power of two length m >= 2n - 1 (Bluestein), so the
+     * cost is O(n log n) for every n.
+     *
+     * @param a The n values, overwritten by their transform.
+     * @param n The number of values.
+     * @param inverse True for the inverse transform.
+     */
+    void transform(std::complex<double>* a, int n, bool inverse);
+
+    /**
+     * @brief Returns the smallest power of two that is at least n.
+     */
+    int next_power_of_two(int n);
+
+} // namespace astra::internals::fft
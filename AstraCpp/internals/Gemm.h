@@ -0,0 +1,40 @@
+#pragma once
+
+namespace astra::internals::gemm {
+
+    // register tile of the portable micro-kernel used for complex types
+    // (MR rows x NR cols of C), float and double use the SIMD micro-kernel
+    // of simd::gemm_kernel, whose tile depends on the instruction set
+    const int MR = 8;
+    const int NR = 4;
+
+    // cache blocking parameters
+    // KC x NR panel of B stays in L1, MC x KC block of A stays in L2,
+    // KC x NC block of B stays in L3, MC is a multiple of every SIMD tile
+    // height
+    const int MC = 96;
+    const int KC = 256;
+    const int NC = 4080;
+
+    // below this many multiply-adds packing costs more than it saves
+    const long long SMALL_GEMM_FLOPS = 32 * 32 * 32;
+
+    /**
+     * @brief Computes C = alpha * A * B + beta * C on row-major buffers.
+     *
+     * A is m x k with leading dimension lda, B is k x n with leading
+     * dimension ldb and C is m x n with leading dimension ldc. Large
+     * products are packed into cache-sized blocks and computed by a
+     * register-tiled micro-kernel, vectorized with FMA for float and double
+     * on the instruction set picked by simd::detected_isa.
+     *
+     * Instantiated for float, double, std::complex<float> and
+     * std::complex<double>.
+     *
+     * @note When beta is zero, C is not read, so it may be uninitialized.
+     */
+    template <typename T>
+    void gemm(int m, int n, int k, T alpha, const T* A, int lda, const T* B,
+              int ldb, T beta, T* C, int ldc);
+
+} // namespace astra::internals::gemm
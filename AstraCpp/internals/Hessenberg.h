@@ -0,0 +1,73 @@
+#pragma once
+
+namespace astra::internals::hessenberg {
+
+    // active blocks of at least this order look for converged eigenvalues
+    // in a deflation window before each sweep
+    const int AED_MIN = 48;
+
+    /**
+     * @brief Reduces an n x n matrix to upper Hessenberg form
+     * H = Q^T * A * Q by Householder reflectors.
+     *
+     * Reflector k has its unit at row k + 1 and the rest stored below that
+     * in column k, the layout tridiagonalize uses, and tau receives the
+     * n - 1 scales. Everything on and above the first subdiagonal is H.
+     *
+     * @param a The row-major matrix, overwritten by H and the reflectors.
+     * @param n The order of the matrix.
+     * @param tau Receives the n - 1 scales of the reflectors.
+     */
+    void reduce(double* a, int n, double* tau);
+
+    /**
+     * @brief Computes the eigenvalues of an upper Hessenberg matrix, and
+     * optionally its real Schur form, by the implicit double-shift QR
+     * algorithm of Francis.
+     *
+     * Each sweep chases a bulge of two shifts, a complex conjugate pair or
+     * two real ones, down the active block. Before a sweep the trailing
+     * window of a large active block is brought to Schur form and
+     * eigenvalues whose coupling to the rest, the spike, is negligible are
+     * deflated from the bottom (aggressive early deflation), which finds
+     * converged eigenvalues long before a subdiagonal entry gets small.
+     *
+     * When z is given the whole of H is updated into the quasi upper
+     * triangular T = Z^T * H * Z, whose 2 x 2 diagonal blocks hold complex
+     * pairs in the standard form with equal diagonal entries, and the
+     * transformations are accumulated into the columns of z. Without z only
+     * the active blocks are updated, which is enough for the eigenvalues.
+     *
+     * @param h The n x n Hessenberg matrix, zero below the subdiagonal.
+     * @param n The order of the matrix.
+     * @param ldh Leading dimension of h.
+     * @param z An n x n block multiplied by the transformations, or null.
+     * @param ldz Leading dimension of z.
+     * @param wr Receives the real parts of the eigenvalues.
+     * @param wi Receives the imaginary parts, a complex pair occupies two
+     * consecutive entries with the positive imaginary part first.
+     * @throws astra::internals::exceptions::no_convergence if an active
+     * block takes more than 100 sweeps without a deflation.
+     */
+    void schur(double* h, int n, int ldh, double* z, int ldz, double* wr,
+               double* wi);
+
+    /**
+     * @brief Computes the right eigenvectors of a quasi upper triangular
+     * matrix in the real Schur form left by schur.
+     *
+     * The eigenvector of each eigenvalue is found by back substitution on
+     * T - lambda * I. Column j of y holds the vector of a real eigenvalue at
+     * position j. A complex pair at j, j + 1 stores the real part of the
+     * vector of the first eigenvalue in column j and its imaginary part in
+     * column j + 1, the second eigenvalue has the conjugate vector.
+     *
+     * @param t The n x n quasi upper triangular matrix.
+     * @param n The order of the matrix.
+     * @param ldt Leading dimension of t.
+     * @param y The n x n block that receives the vectors.
+     * @param ldy Leading dimension of y.
+     */
+    void eigenvectors(const double* t, int n, int ldt, double* y, int ldy);
+
+} // namespace astra::internals::hessenberg
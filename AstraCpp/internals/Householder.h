@@ -0,0 +1,54 @@
+#pragma once
+
+namespace astra::internals::householder {
+
+    // rows per block streamed through the products of a block update
+    const int ROW_BLOCK = 256;
+
+    /**
+     * @brief Computes the Householder reflector H = I - tau * v * v^T that
+     * maps the count entries x[0], x[stride], ... onto a multiple of the
+     * first.
+     *
+     * The tail of v, below its implicit unit, overwrites x[stride], ...
+     * and the new first entry is returned, x[0] is left to the caller. The
+     * norm is taken of the entries scaled by the largest, since the trailing
+     * entries of a nearly rank deficient matrix can get small enough for
+     * their squares to underflow. tau is zero when the tail is already zero.
+     *
+     * @param x The entries, overwritten by the tail of v.
+     * @param stride Distance between consecutive entries.
+     * @param count Number of entries.
+     * @param tau Receives the scale of the reflector.
+     * @return double The first entry of H * x.
+     */
+    double make_reflector(double* x, long long stride, int count,
+                          double& tau);
+
+    /**
+     * @brief Applies the product of nb Householder reflectors, in the
+     * compact WY form I - V * T * V^T, to the rows row0 .. m - 1 of C.
+     *
+     * Reflector i is I - tau[i] * v * v^T, where v is zero above row
+     * row0 + i, one at that row and v[r * ldv + i] below it, so the vectors
+     * are the columns of V stored below a shifted diagonal. The reflectors
+     * are applied as H_0 * ... * H_{nb-1} (or its transpose) with one pass
+     * over the rows gathering V^T V and V^T C and one pass subtracting the
+     * update, each a GEMM per block of ROW_BLOCK rows.
+     *
+     * @param v The reflector storage, indexed by the rows of C.
+     * @param ldv Leading dimension of v.
+     * @param row0 Row of the unit entry of the first reflector.
+     * @param m Number of rows of v and C.
+     * @param nb Number of reflectors.
+     * @param tau The scales of the reflectors.
+     * @param transpose Applies Q^T instead of Q when true.
+     * @param c The matrix to update, indexed by the same rows as v.
+     * @param ldc Leading dimension of c.
+     * @param width Number of columns of c.
+     */
+    void apply_block(const double* v, int ldv, int row0, int m, int nb,
+                     const double* tau, bool transpose, double* c, int ldc,
+                     int width);
+
+} // namespace astra::internals::householder
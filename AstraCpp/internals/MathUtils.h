@@ -2,17 +2,103 @@
 
 #include "Exceptions.h"
 
+#include <complex>
+#include <type_traits>
+
 namespace astra::internals::mathutils {
     
     const double PI = 3.14159265358979323846;
     const double EPSILON = 1e-6; 
 
+    // element type traits for the templated containers
+    template <typename T>
+    struct is_complex : std::false_type {};
+
+    template <typename T>
+    struct is_complex<std::complex<T>> : std::true_type {};
+
+    template <typename T>
+    constexpr bool is_complex_v = is_complex<T>::value;
+
+    // the type of |x|, float for std::complex<float> and so on
+    template <typename T>
+    struct real_type {
+        using type = T;
+    };
+
+    template <typename T>
+    struct real_type<std::complex<T>> {
+        using type = T;
+    };
+
+    template <typename T>
+    using real_t = typename real_type<T>::type;
+
 	inline double abs(double x) { return (x < 0.0) ? -x : x; }
 
+    inline float abs(float x) { return (x < 0.0f) ? -x : x; }
+
+    template <typename T>
+    inline T abs(const std::complex<T>& z) {
+        return std::abs(z);
+    }
+
     inline bool nearly_equal(double a, double b, double eps = 1e-6) {
         return abs(a - b) <= eps;
     }
 
+    template <typename T>
+    inline bool nearly_equal(const std::complex<T>& a,
+                             const std::complex<T>& b, double eps = 1e-6) {
+        return std::abs(a - b) <= eps;
+    }
+
+    // complex conjugate, the identity for real numbers
+    template <typename T>
+    inline T conj(const T& x) {
+        return x;
+    }
+
+    template <typename T>
+    inline std::complex<T> conj(const std::complex<T>& z) {
+        return std::conj(z);
+    }
+
+    // squared magnitude, std::norm for complex numbers
+    template <typename T>
+    inline real_t<T> abs_sq(const T& x) {
+        if constexpr (is_complex_v<T>) {
+            return std::norm(x);
+        }
+        else {
+            return x * x;
+        }
+    }
+
+    // real part, the identity for real numbers
+    template <typename T>
+    inline real_t<T> real(const T& x) {
+        if constexpr (is_complex_v<T>) {
+            return x.real();
+        }
+        else {
+            return x;
+        }
+    }
+
+    // ordering used by min and max, complex numbers compare by real part
+    // and then by imaginary part
+    template <typename T>
+    inline bool less(const T& a, const T& b) {
+        return a < b;
+    }
+
+    template <typename T>
+    inline bool less(const std::complex<T>& a, const std::complex<T>& b) {
+        return a.real() < b.real() ||
+               (a.real() == b.real() && a.imag() < b.imag());
+    }
+
     inline double fmax(double a, double b) { return (a > b) ? a : b; }
 
     inline double fmin(double a, double b) { return (a < b) ? a : b; }
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+namespace astra::internals::memory {
+
+    // alignment of every element buffer, one cache line / one AVX-512 register
+    const std::size_t ALIGNMENT = 64;
+
+    // number of elements of type T that fill one ALIGNMENT-sized block
+    template <typename T>
+    constexpr int simd_width = static_cast<int>(ALIGNMENT / sizeof(T));
+
+    const int SIMD_WIDTH = simd_width<double>;
+
+    /**
+     * @brief Rounds n up to a multiple of simd_width<T>.
+     */
+    template <typename T = double>
+    inline int padded_size(int n) {
+        return (n + simd_width<T> - 1) / simd_width<T> * simd_width<T>;
+    }
+
+    /**
+     * @brief Allocates an ALIGNMENT-aligned block of at least `bytes` bytes
+     * from the current allocator.
+     * @throws std::bad_alloc if the allocator fails.
+     */
+    void* allocate_bytes(std::size_t bytes);
+
+    /**
+     * @brief Returns a block from allocate_bytes to the allocator it came
+     * from. Does nothing for nullptr.
+     */
+    void deallocate_bytes(void* ptr) noexcept;
+
+    /**
+     * @brief Allocates an ALIGNMENT-aligned buffer for n elements of type T
+     * from the current allocator.
+     *
+     * The buffer holds padded_size<T>(n) elements. For trivial types the
+     * first n are left uninitialized, and the padding after them is zeroed,
+     * so kernels may read whole SIMD blocks past the end.
+     *
+     * @throws std::bad_alloc if the allocator fails.
+     */
+    template <typename T = double>
+    T* allocate(int n) {
+        static_assert(std::is_trivially_destructible<T>::value,
+                      "element buffers are released without destructors");
+        int padded = padded_size<T>(n);
+        T* data = static_cast<T*>(
+            allocate_bytes(static_cast<std::size_t>(padded) * sizeof(T)));
+
+        int first = std::is_trivially_default_constructible<T>::value ? n : 0;
+        for (int i = first; i < padded; ++i) {
+            new (data + i) T();
+        }
+        return data;
+    }
+
+    /**
+     * @brief Returns a buffer from allocate to the allocator it came from.
+     * Does nothing for nullptr.
+     */
+    template <typename T>
+    void deallocate(T* ptr) noexcept {
+        deallocate_bytes(ptr);
+    }
+
+} // namespace astra::internals::memory
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <vector>
+
+namespace astra::internals::ordering {
+
+    /**
+     * @brief Computes a fill-reducing elimination order for the symmetric
+     * pattern of A + A^T by approximate minimum degree.
+     *
+     * The elimination is simulated on the quotient graph: an eliminated
+     * node becomes an element standing for the clique it leaves behind, so
+     * the graph never grows. Each step eliminates a node of least
+     * approximate degree, the bound |A_i| + |L_p \ i| + sum |L_e \ L_p| of
+     * Amestoy, Davis and Duff, which is cheap to update and close to the
+     * true degree. Elements covered by the new one are absorbed.
+     *
+     * @param n The order of A.
+     * @param ptr The n + 1 row pointers of A in compressed rows.
+     * @param idx The column indices of A, the diagonal may be present.
+     * @return The order, entry k is the node eliminated at step k.
+     */
+    std::vector<int> minimum_degree(int n, const std::vector<int>& ptr,
+                                    const std::vector<int>& idx);
+
+} // namespace astra::internals::ordering
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "MathUtils.h"
+
+namespace astra::internals::simd {
+
+    // instruction sets the kernels are compiled for, in increasing order,
+    // avx2 also requires FMA
+    enum class Isa { scalar, sse2, avx2, avx512 };
+
+    /**
+     * @brief Returns the best instruction set supported by the CPU and the
+     * operating system, detected once with CPUID.
+     */
+    Isa detected_isa();
+
+    /**
+     * @brief Returns the instruction set the kernels currently dispatch to.
+     */
+    Isa active_isa();
+
+    /**
+     * @brief Forces the kernels onto an instruction set, clamped to the
+     * detected one. Used to test and benchmark every code path.
+     * @return The instruction set that is now active.
+     */
+    Isa set_isa(Isa isa);
+
+    // The double and float overloads dispatch to vectorized kernels. Other
+    // element types (complex numbers) use the generic loops at the end of
+    // this file.
+
+    // reductions over a[0..n), n may be 0
+
+    double sum(const double* a, int n);
+    double prod(const double* a, int n);
+    double sum_sq(const double* a, int n);
+    double dot(const double* a, const double* b, int n);
+
+    float sum(const float* a, int n);
+    float prod(const float* a, int n);
+    float sum_sq(const float* a, int n);
+    float dot(const float* a, const float* b, int n);
+
+    // min and max require n >= 1
+    double min(const double* a, int n);
+    double max(const double* a, int n);
+
+    float min(const float* a, int n);
+    float max(const float* a, int n);
+
+    // in-place updates of a[0..n)
+
+    void fill(double* a, int n, double val);
+    void replace(double* a, int n, double old_val, double new_val);
+
+    void fill(float* a, int n, float val);
+    void replace(float* a, int n, float old_val, float new_val);
+
+    // dst[i] = a[i] op b[i], dst may alias a or b
+
+    void add(const double* a, const double* b, double* dst, int n);
+    void sub(const double* a, const double* b, double* dst, int n);
+    void mul(const double* a, const double* b, double* dst, int n);
+    void div(const double* a, const double* b, double* dst, int n);
+
+    void add(const float* a, const float* b, float* dst, int n);
+    void sub(const float* a, const float* b, float* dst, int n);
+    void mul(const float* a, const float* b, float* dst, int n);
+    void div(const float* a, const float* b, float* dst, int n);
+
+    // dst[i] = a[i] op s, dst may alias a
+
+    void mul_scalar(const double* a, double s, double* dst, int n);
+    void div_scalar(const double* a, double s, double* dst, int n);
+
+    void mul_scalar(const float* a, float s, float* dst, int n);
+    void div_scalar(const float* a, float s, float* dst, int n);
+
+    /**
+     * @brief Register-tiled GEMM micro-kernel of an instruction set.
+     *
+     * run(kc, alpha, a, b, C, ldc, rows, cols) adds alpha * A_p * B_p to the
+     * top-left rows x cols part of an mr x nr tile of C, where a holds the
+     * kc columns of an mr-row panel of A, column by column, and b the kc
+     * rows of an nr-column panel of B, row by row.
+     */
+    template <typename S>
+    struct GemmKernel {
+        int mr;
+        int nr;
+        void (*run)(int kc, S alpha, const S* a, const S* b, S* C, int ldc,
+                    int rows, int cols);
+    };
+
+    /**
+     * @brief Returns the GEMM micro-kernel of the active instruction set,
+     * for double and float. The tile size depends on the register file.
+     */
+    template <typename S>
+    GemmKernel<S> gemm_kernel();
+
+    template <>
+    GemmKernel<double> gemm_kernel<double>();
+    template <>
+    GemmKernel<float> gemm_kernel<float>();
+
+    // generic versions of the kernels above
+
+    template <typename T>
+    T sum(const T* a, int n) {
+        T total = T(0);
+        for (int i = 0; i < n; ++i) {
+            total += a[i];
+        }
+        return total;
+    }
+
+    template <typename T>
+    T prod(const T* a, int n) {
+        T total = T(1);
+        for (int i = 0; i < n; ++i) {
+            total *= a[i];
+        }
+        return total;
+    }
+
+    // plain sum of a[i] * b[i], without conjugation
+    template <typename T>
+    T dot(const T* a, const T* b, int n) {
+        T total = T(0);
+        for (int i = 0; i < n; ++i) {
+            total += a[i] * b[i];
+        }
+        return total;
+    }
+
+    template <typename T>
+    T min(const T* a, int n) {
+        T result = a[0];
+        for (int i = 1; i < n; ++i) {
+            result = mathutils::less(a[i], result) ? a[i] : result;
+        }
+        return result;
+    }
+
+    template <typename T>
+    T max(const T* a, int n) {
+        T result = a[0];
+        for (int i = 1; i < n; ++i) {
+            result = mathutils::less(result, a[i]) ? a[i] : result;
+        }
+        return result;
+    }
+
+    template <typename T>
+    void fill(T* a, int n, const T& val) {
+        for (int i = 0; i < n; ++i) {
+            a[i] = val;
+        }
+    }
+
+    template <typename T>
+    void replace(T* a, int n, const T& old_val, const T& new_val) {
+        for (int i = 0; i < n; ++i) {
+            if (a[i] == old_val) {
+                a[i] = new_val;
+            }
+        }
+    }
+
+    template <typename T>
+    void add(const T* a, const T* b, T* dst, int n) {
+        for (int i = 0; i < n; ++i) {
+            dst[i] = a[i] + b[i];
+        }
+    }
+
+    template <typename T>
+    void sub(const T* a, const T* b, T* dst, int n) {
+        for (int i = 0; i < n; ++i) {
+            dst[i] = a[i] - b[i];
+        }
+    }
+
+    template <typename T>
+    void mul(const T* a, const T* b, T* dst, int n) {
+        for (int i = 0; i < n; ++i) {
+            dst[i] = a[i] * b[i];
+        }
+    }
+
+    template <typename T>
+    void div(const T* a, const T* b, T* dst, int n) {
+        for (int i = 0; i < n; ++i) {
+            dst[i] = a[i] / b[i];
+        }
+    }
+
+    template <typename T>
+    void mul_scalar(const T* a, const T& s, T* dst, int n) {
+        for (int i = 0; i < n; ++i) {
+            dst[i] = a[i] * s;
+        }
+    }
+
+    template <typename T>
+    void div_scalar(const T* a, const T& s, T* dst, int n) {
+        for (int i = 0; i < n; ++i) {
+            dst[i] = a[i] / s;
+        }
+    }
+
+} // namespace astra::internals::simd
@@ -0,0 +1,276 @@
+// Kernel bodies shared by every instruction set and element type. Simd.cpp
+// includes this file once per instruction set and element type, inside a
+// namespace that defines the element type S, the register type V, its width W
+// in elements, the GEMM tile of GEMM_MR x GEMM_NV registers, and the
+// primitives used below. Loads and stores are unaligned, so the kernels also
+// work on blocks and chunks that start inside a buffer, and the last n % W
+// elements are handled one at a time.
+
+S sum(const S* a, int n) {
+    // four independent accumulators hide the latency of the adds
+    V acc0 = set1(S(0));
+    V acc1 = set1(S(0));
+    V acc2 = set1(S(0));
+    V acc3 = set1(S(0));
+    int i = 0;
+    for (; i + 4 * W <= n; i += 4 * W) {
+        acc0 = vadd(acc0, loadu(a + i));
+        acc1 = vadd(acc1, loadu(a + i + W));
+        acc2 = vadd(acc2, loadu(a + i + 2 * W));
+        acc3 = vadd(acc3, loadu(a + i + 3 * W));
+    }
+    for (; i + W <= n; i += W) {
+        acc0 = vadd(acc0, loadu(a + i));
+    }
+    S total = hsum(vadd(vadd(acc0, acc1), vadd(acc2, acc3)));
+    for (; i < n; ++i) {
+        total += a[i];
+    }
+    return total;
+}
+
+S prod(const S* a, int n) {
+    V acc0 = set1(S(1));
+    V acc1 = set1(S(1));
+    int i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        acc0 = vmul(acc0, loadu(a + i));
+        acc1 = vmul(acc1, loadu(a + i + W));
+    }
+    for (; i + W <= n; i += W) {
+        acc0 = vmul(acc0, loadu(a + i));
+    }
+    S total = hprod(vmul(acc0, acc1));
+    for (; i < n; ++i) {
+        total *= a[i];
+    }
+    return total;
+}
+
+S sum_sq(const S* a, int n) {
+    V acc0 = set1(S(0));
+    V acc1 = set1(S(0));
+    int i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        V x0 = loadu(a + i);
+        V x1 = loadu(a + i + W);
+        acc0 = vadd(acc0, vmul(x0, x0));
+        acc1 = vadd(acc1, vmul(x1, x1));
+    }
+    for (; i + W <= n; i += W) {
+        V x = loadu(a + i);
+        acc0 = vadd(acc0, vmul(x, x));
+    }
+    S total = hsum(vadd(acc0, acc1));
+    for (; i < n; ++i) {
+        total += a[i] * a[i];
+    }
+    return total;
+}
+
+S dot(const S* a, const S* b, int n) {
+    V acc0 = set1(S(0));
+    V acc1 = set1(S(0));
+    int i = 0;
+    for (; i + 2 * W <= n; i += 2 * W) {
+        acc0 = vadd(acc0, vmul(loadu(a + i), loadu(b + i)));
+        acc1 = vadd(acc1, vmul(loadu(a + i + W), loadu(b + i + W)));
+    }
+    for (; i + W <= n; i += W) {
+        acc0 = vadd(acc0, vmul(loadu(a + i), loadu(b + i)));
+    }
+    S total = hsum(vadd(acc0, acc1));
+    for (; i < n; ++i) {
+        total += a[i] * b[i];
+    }
+    return total;
+}
+
+S min(const S* a, int n) {
+    S result = a[0];
+    int i = 0;
+    if (n >= W) {
+        // branch-free, compares whole registers
+        V acc = loadu(a);
+        for (i = W; i + W <= n; i += W) {
+            acc = vmin(acc, loadu(a + i));
+        }
+        result = hmin(acc);
+    }
+    for (; i < n; ++i) {
+        result = a[i] < result ? a[i] : result;
+    }
+    return result;
+}
+
+S max(const S* a, int n) {
+    S result = a[0];
+    int i = 0;
+    if (n >= W) {
+        V acc = loadu(a);
+        for (i = W; i + W <= n; i += W) {
+            acc = vmax(acc, loadu(a + i));
+        }
+        result = hmax(acc);
+    }
+    for (; i < n; ++i) {
+        result = a[i] > result ? a[i] : result;
+    }
+    return result;
+}
+
+void fill(S* a, int n, S val) {
+    V v = set1(val);
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        storeu(a + i, v);
+    }
+    for (; i < n; ++i) {
+        a[i] = val;
+    }
+}
+
+void replace(S* a, int n, S old_val, S new_val) {
+    V old_v = set1(old_val);
+    V new_v = set1(new_val);
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        storeu(a + i, vreplace(loadu(a + i), old_v, new_v));
+    }
+    for (; i < n; ++i) {
+        if (a[i] == old_val) {
+            a[i] = new_val;
+        }
+    }
+}
+
+void add(const S* a, const S* b, S* dst, int n) {
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        storeu(dst + i, vadd(loadu(a + i), loadu(b + i)));
+    }
+    for (; i < n; ++i) {
+        dst[i] = a[i] + b[i];
+    }
+}
+
+void sub(const S* a, const S* b, S* dst, int n) {
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        storeu(dst + i, vsub(loadu(a + i), loadu(b + i)));
+    }
+    for (; i < n; ++i) {
+        dst[i] = a[i] - b[i];
+    }
+}
+
+void mul(const S* a, const S* b, S* dst, int n) {
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        storeu(dst + i, vmul(loadu(a + i), loadu(b + i)));
+    }
+    for (; i < n; ++i) {
+        dst[i] = a[i] * b[i];
+    }
+}
+
+void div(const S* a, const S* b, S* dst, int n) {
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        storeu(dst + i, vdiv(loadu(a + i), loadu(b + i)));
+    }
+    for (; i < n; ++i) {
+        dst[i] = a[i] / b[i];
+    }
+}
+
+void mul_scalar(const S* a, S s, S* dst, int n) {
+    V sv = set1(s);
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        storeu(dst + i, vmul(loadu(a + i), sv));
+    }
+    for (; i < n; ++i) {
+        dst[i] = a[i] * s;
+    }
+}
+
+void div_scalar(const S* a, S s, S* dst, int n) {
+    V sv = set1(s);
+    int i = 0;
+    for (; i + W <= n; i += W) {
+        storeu(dst + i, vdiv(loadu(a + i), sv));
+    }
+    for (; i < n; ++i) {
+        dst[i] = a[i] / s;
+    }
+}
+
+// GEMM micro-kernel over the packed panels of gemm::gemm, a holds kc columns
+// of GEMM_MR rows of A and b kc rows of GEMM_NV * W columns of B. The tile
+// is accumulated in GEMM_MR * GEMM_NV registers, and alpha times it is added
+// to the top-left rows x cols part of C.
+void gemm_kernel(int kc, S alpha, const S* a, const S* b, S* C, int ldc,
+                 int rows, int cols) {
+    const int NR = GEMM_NV * W;
+    V acc[GEMM_MR][GEMM_NV];
+    ASTRA_UNROLL
+    for (int i = 0; i < GEMM_MR; ++i) {
+        ASTRA_UNROLL
+        for (int v = 0; v < GEMM_NV; ++v) {
+            acc[i][v] = set1(S(0));
+        }
+    }
+
+    for (int p = 0; p < kc; ++p) {
+        V bv[GEMM_NV];
+        ASTRA_UNROLL
+        for (int v = 0; v < GEMM_NV; ++v) {
+            bv[v] = loadu(b + v * W);
+        }
+        ASTRA_UNROLL
+        for (int i = 0; i < GEMM_MR; ++i) {
+            V ai = set1(a[i]);
+            ASTRA_UNROLL
+            for (int v = 0; v < GEMM_NV; ++v) {
+                acc[i][v] = vfmadd(ai, bv[v], acc[i][v]);
+            }
+        }
+        a += GEMM_MR;
+        b += NR;
+    }
+
+    if (rows == GEMM_MR && cols == NR) {
+        V av = set1(alpha);
+        ASTRA_UNROLL
+        for (int i = 0; i < GEMM_MR; ++i) {
+            S* c_row = C + static_cast<long long>(i) * ldc;
+            ASTRA_UNROLL
+            for (int v = 0; v < GEMM_NV; ++v) {
+                storeu(c_row + v * W,
+                       vfmadd(av, acc[i][v], loadu(c_row + v * W)));
+            }
+        }
+        return;
+    }
+
+    // edge tile, spill the registers and add the part inside C
+    S tile[GEMM_MR * NR];
+    for (int i = 0; i < GEMM_MR; ++i) {
+        for (int v = 0; v < GEMM_NV; ++v) {
+            storeu(tile + i * NR + v * W, acc[i][v]);
+        }
+    }
+    for (int i = 0; i < rows; ++i) {
+        S* c_row = C + static_cast<long long>(i) * ldc;
+        for (int j = 0; j < cols; ++j) {
+            c_row[j] += alpha * tile[i * NR + j];
+        }
+    }
+}
+
+const Kernels<S> kernels = {sum,        prod,       sum_sq,  dot,
+                            min,        max,        fill,    replace,
+                            add,        sub,        mul,     div,
+                            mul_scalar, div_scalar, GEMM_MR, GEMM_NV * W,
+                            gemm_kernel};
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace astra::internals::threading {
+
+    // operations smaller than this many elements are not worth splitting
+    const long long MIN_PARALLEL_WORK = 1 << 16;
+
+    /**
+     * @brief Fixed-size pool of worker threads shared by the whole library.
+     *
+     * Work is submitted with parallel_for, which splits an index range into
+     * chunks, runs them on the workers and the calling thread, and returns
+     * once every chunk is done.
+     */
+    class ThreadPool {
+      public:
+        /**
+         * @brief Returns the pool used by the library.
+         */
+        static ThreadPool& instance();
+
+        /**
+         * @brief Restarts the pool with a new total number of threads.
+         * @param num_threads Total threads including the calling thread.
+         */
+        void resize(int num_threads);
+
+        /**
+         * @brief Returns the total number of threads, including the caller.
+         */
+        int size() const;
+
+        /**
+         * @brief Runs body over [begin, end) split into contiguous chunks.
+         *
+         * Each call body(lo, hi) handles the indices lo..hi-1. Chunks hold at
+         * least `grain` indices, so small ranges run inline on the caller.
+         * Calls made from inside a running chunk also run inline. The first
+         * exception thrown by a chunk is rethrown on the calling thread.
+         */
+        void parallel_for(int begin, int end, int grain,
+                          const std::function<void(int, int)>& body);
+
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+      private:
+        explicit ThreadPool(int num_threads);
+
+        void start(int num_threads);
+        void stop();
+        void worker_loop();
+
+        std::vector<std::thread> workers;
+        std::deque<std::function<void()>> tasks;
+        mutable std::mutex mtx;
+        std::condition_variable task_ready;
+        bool stopping;
+        int num_threads;
+    };
+
+    /**
+     * @brief Shorthand for ThreadPool::instance().parallel_for.
+     */
+    inline void parallel_for(int begin, int end, int grain,
+                             const std::function<void(int, int)>& body) {
+        ThreadPool::instance().parallel_for(begin, end, grain, body);
+    }
+
+} // namespace astra::internals::threading
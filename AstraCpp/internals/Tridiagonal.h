@@ -0,0 +1,74 @@
+#pragma once
+
+namespace astra::internals::tridiagonal {
+
+    // subproblems up to this order are solved by QL iteration instead of
+    // being divided further
+    const int DC_LEAF = 32;
+
+    /**
+     * @brief Computes the eigenvalues, and optionally the eigenvectors, of a
+     * symmetric tridiagonal matrix by the implicit QL method.
+     *
+     * d holds the diagonal and e the n - 1 off-diagonal entries, e[i]
+     * coupling i and i + 1. On return d holds the eigenvalues in ascending
+     * order. When z is not null, the rotations are accumulated into the
+     * columns of the n x n block z, so z must hold the identity (or the
+     * orthogonal matrix that reduced a full matrix to this one) on entry.
+     *
+     * @throws astra::internals::exceptions::no_convergence if an eigenvalue
+     * takes more than 60 iterations.
+     */
+    void ql(double* d, const double* e, int n, double* z, int ldz);
+
+    /**
+     * @brief Computes all the eigenvalues and eigenvectors of a symmetric
+     * tridiagonal matrix by divide and conquer.
+     *
+     * The matrix is torn into two halves by a rank-one modification, the
+     * halves are solved recursively and their eigensystems are merged by
+     * solving the secular equation. Eigenvectors are formed from the
+     * recomputed z of Gu and Eisenstat, which keeps them orthogonal, and
+     * multiplied into the halves with GEMM. Nearly equal poles and small
+     * components of z deflate, which usually removes much of the work.
+     *
+     * @param d The diagonal, overwritten by the ascending eigenvalues.
+     * @param e The n - 1 off-diagonal entries.
+     * @param n The order of the matrix.
+     * @param q The n x n block that receives the eigenvectors as columns.
+     * @param ldq Leading dimension of q.
+     */
+    void divide_and_conquer(double* d, const double* e, int n, double* q,
+                            int ldq);
+
+    /**
+     * @brief Computes the eigenvalues with indices lo .. hi - 1, counted in
+     * ascending order, by bisection on the Sturm sequence.
+     *
+     * @param d The diagonal.
+     * @param e The n - 1 off-diagonal entries.
+     * @param n The order of the matrix.
+     * @param lo The index of the first wanted eigenvalue.
+     * @param hi One past the index of the last wanted eigenvalue.
+     * @param w Receives the hi - lo eigenvalues in ascending order.
+     */
+    void bisect(const double* d, const double* e, int n, int lo, int hi,
+                double* w);
+
+    /**
+     * @brief Computes the eigenvectors for given ascending eigenvalues by
+     * inverse iteration, orthogonalizing the vectors of close eigenvalues
+     * against each other.
+     *
+     * @param d The diagonal.
+     * @param e The n - 1 off-diagonal entries.
+     * @param n The order of the matrix.
+     * @param w The k eigenvalues.
+     * @param k The number of eigenvalues.
+     * @param z The n x k block that receives the eigenvectors as columns.
+     * @param ldz Leading dimension of z.
+     */
+    void inverse_iteration(const double* d, const double* e, int n,
+                           const double* w, int k, double* z, int ldz);
+
+} // namespace astra::internals::tridiagonal
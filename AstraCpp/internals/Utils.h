@@ -1,9 +1,24 @@
 #pragma once
 
+#include <utility>
+
 namespace astra::internals::utils {
-    inline void swap(double& a, double& b) {
-        double temp = a;
+    template <typename T>
+    inline void swap(T& a, T& b) {
+        T temp = a;
         a = b;
         b = temp;
     }
+
+    template <typename F, std::size_t... I>
+    constexpr void unroll(F&& f, std::index_sequence<I...>) {
+        (f(static_cast<int>(I)), ...);
+    }
+
+    // calls f(0), f(1), ..., f(N - 1) as straight-line code, used by the
+    // fixed-size kernels
+    template <int N, typename F>
+    constexpr void unroll(F&& f) {
+        unroll(f, std::make_index_sequence<N>{});
+    }
 }
@@ -0,0 +1,250 @@
+#include "pch.h"
+
+#include "../include/BandedMatrix.h"
+#include "../internals/Exceptions.h"
+#include "../internals/MathUtils.h"
+#include "../internals/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace astra {
+
+namespace {
+
+void check_bandwidths(int n, int lower, int upper) {
+    if (n <= 0) {
+        throw internals::exceptions::invalid_size();
+    }
+    if (lower < 0 || upper < 0 || lower >= n || upper >= n) {
+        throw internals::exceptions::invalid_argument();
+    }
+}
+
+} // namespace
+
+BandedMatrix::BandedMatrix(int n, int lower, int upper)
+    : n(n), lower(lower), upper(upper) {
+    check_bandwidths(n, lower, upper);
+    band.assign(static_cast<size_t>(n) * (lower + upper + 1), 0.0);
+}
+
+BandedMatrix::BandedMatrix(const Matrix& A, int lower, int upper)
+    : n(A.num_row()), lower(lower), upper(upper) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+    check_bandwidths(n, lower, upper);
+    int width = lower + upper + 1;
+    band.assign(static_cast<size_t>(n) * width, 0.0);
+    const double* a = A.data();
+    for (int i = 0; i < n; i++) {
+        const double* row = a + static_cast<long long>(i) * n;
+        for (int j = 0; j < n; j++) {
+            if (j - i >= -lower && j - i <= upper) {
+                band[static_cast<long long>(i) * width + j - i + lower] =
+                    row[j];
+            }
+            else if (row[j] != 0) {
+                throw internals::exceptions::invalid_argument();
+            }
+        }
+    }
+}
+
+int BandedMatrix::num_row() const { return n; }
+
+int BandedMatrix::num_col() const { return n; }
+
+int BandedMatrix::lower_bandwidth() const { return lower; }
+
+int BandedMatrix::upper_bandwidth() const { return upper; }
+
+const double* BandedMatrix::data() const { return band.data(); }
+
+double& BandedMatrix::operator()(int i, int j) {
+    if (i < 0 || i >= n || j < 0 || j >= n || j - i < -lower ||
+        j - i > upper) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    return band[static_cast<long long>(i) * (lower + upper + 1) + j - i +
+                lower];
+}
+
+double BandedMatrix::operator()(int i, int j) const {
+    if (i < 0 || i >= n || j < 0 || j >= n) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    if (j - i < -lower || j - i > upper) {
+        return 0;
+    }
+    return band[static_cast<long long>(i) * (lower + upper + 1) + j - i +
+                lower];
+}
+
+Matrix BandedMatrix::to_dense() const {
+    Matrix result(n, n);
+    double* out = result.data();
+    int width = lower + upper + 1;
+    for (int i = 0; i < n; i++) {
+        int first = std::max(0, i - lower);
+        int last = std::min(n - 1, i + upper);
+        for (int j = first; j <= last; j++) {
+            out[static_cast<long long>(i) * n + j] =
+                band[static_cast<long long>(i) * width + j - i + lower];
+        }
+    }
+    return result;
+}
+
+void BandedMatrix::multiply(const Vector& x, Vector& y) const {
+    if (x.get_size() != n || y.get_size() != n) {
+        throw internals::exceptions::matrix_size_mismatch();
+    }
+    const double* xv = x.data();
+    double* yv = y.data();
+    int width = lower + upper + 1;
+    int grain = static_cast<int>(
+        std::max(1LL, internals::threading::MIN_PARALLEL_WORK / width));
+
+    internals::threading::parallel_for(0, n, grain, [&](int lo, int hi) {
+        for (int i = lo; i < hi; i++) {
+            int first = std::max(0, i - lower);
+            int last = std::min(n - 1, i + upper);
+            const double* row =
+                band.data() + static_cast<long long>(i) * width - i + lower;
+            double sum = 0;
+            for (int j = first; j <= last; j++) {
+                sum += row[j] * xv[j];
+            }
+            yv[i] = sum;
+        }
+    });
+}
+
+Vector BandedMatrix::operator*(const Vector& x) const {
+    Vector y(n);
+    multiply(x, y);
+    return y;
+}
+
+bool BandedMatrix::operator==(const BandedMatrix& other) const {
+    return n == other.n && lower == other.lower && upper == other.upper &&
+           band == other.band;
+}
+
+bool BandedMatrix::operator!=(const BandedMatrix& other) const {
+    return !(*this == other);
+}
+
+BandedLU::BandedLU(const BandedMatrix& A)
+    : n(A.num_row()), lower(A.lower_bandwidth()),
+      upper(A.upper_bandwidth()), pivots(n), swaps(0), singular(false) {
+    // row i of lu holds the columns i - lower .. i + lower + upper, the
+    // last lower of them start at zero and take the fill of the exchanges
+    int width = 2 * lower + upper + 1;
+    int a_width = lower + upper + 1;
+    lu.assign(static_cast<size_t>(n) * width, 0.0);
+    const double* a = A.data();
+    for (int i = 0; i < n; i++) {
+        std::copy(a + static_cast<long long>(i) * a_width,
+                  a + static_cast<long long>(i + 1) * a_width,
+                  lu.begin() + static_cast<long long>(i) * width);
+    }
+    auto at = [&](int i, int j) -> double& {
+        return lu[static_cast<long long>(i) * width + j - i + lower];
+    };
+
+    for (int k = 0; k < n; k++) {
+        int last_row = std::min(n - 1, k + lower);
+        int last_col = std::min(n - 1, k + lower + upper);
+
+        int p = k;
+        for (int i = k + 1; i <= last_row; i++) {
+            if (std::abs(at(i, k)) > std::abs(at(p, k))) {
+                p = i;
+            }
+        }
+        pivots[k] = p;
+        if (at(p, k) == 0) {
+            // nothing to eliminate in this column, U(k, k) stays zero
+            singular = true;
+            continue;
+        }
+        if (internals::mathutils::nearly_equal(at(p, k), 0.0)) {
+            // within LUFactorization's pivot tolerance, the factors are
+            // kept for det but the solve would not be accurate
+            singular = true;
+        }
+        if (p != k) {
+            swaps++;
+            for (int j = k; j <= last_col; j++) {
+                std::swap(at(k, j), at(p, j));
+            }
+        }
+
+        double pivot = at(k, k);
+        for (int i = k + 1; i <= last_row; i++) {
+            double m = at(i, k) / pivot;
+            at(i, k) = m;
+            if (m == 0) {
+                continue;
+            }
+            for (int j = k + 1; j <= last_col; j++) {
+                at(i, j) -= m * at(k, j);
+            }
+        }
+    }
+}
+
+int BandedLU::size() const { return n; }
+
+bool BandedLU::is_singular() const { return singular; }
+
+const std::vector<int>& BandedLU::get_pivots() const { return pivots; }
+
+Vector BandedLU::solve(const Vector& b) const {
+    if (b.get_size() != n) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    if (singular) {
+        throw internals::exceptions::singular_matrix();
+    }
+    int width = 2 * lower + upper + 1;
+    auto at = [&](int i, int j) {
+        return lu[static_cast<long long>(i) * width + j - i + lower];
+    };
+
+    Vector x = b;
+    for (int k = 0; k < n; k++) {
+        if (pivots[k] != k) {
+            std::swap(x[k], x[pivots[k]]);
+        }
+        double xk = x[k];
+        int last_row = std::min(n - 1, k + lower);
+        for (int i = k + 1; i <= last_row; i++) {
+            x[i] -= at(i, k) * xk;
+        }
+    }
+    for (int k = n - 1; k >= 0; k--) {
+        int last_col = std::min(n - 1, k + lower + upper);
+        double sum = x[k];
+        for (int j = k + 1; j <= last_col; j++) {
+            sum -= at(k, j) * x[j];
+        }
+        x[k] = sum / at(k, k);
+    }
+    return x;
+}
+
+double BandedLU::det() const {
+    int width = 2 * lower + upper + 1;
+    double det = (swaps % 2 == 0) ? 1 : -1;
+    for (int k = 0; k < n; k++) {
+        det *= lu[static_cast<long long>(k) * width + lower];
+    }
+    return det;
+}
+
+} // namespace astra
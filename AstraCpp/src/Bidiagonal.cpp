@@ -0,0 +1,701 @@
+#include "pch.h"
+
+#include "../internals/Bidiagonal.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Gemm.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace astra::internals::bidiagonal {
+
+namespace {
+
+// rows i and j of the block a become c * a_i + s * a_j and c * a_j - s * a_i
+inline void rotate_rows(double* a, int ld, int cols, int i, int j, double c,
+                        double s) {
+    if (a == nullptr) {
+        return;
+    }
+    double* x = a + static_cast<long long>(i) * ld;
+    double* y = a + static_cast<long long>(j) * ld;
+    for (int col = 0; col < cols; col++) {
+        double xv = x[col];
+        double yv = y[col];
+        x[col] = xv * c + yv * s;
+        y[col] = yv * c - xv * s;
+    }
+}
+
+inline void swap_rows(double* a, int ld, int cols, int i, int j) {
+    if (a == nullptr) {
+        return;
+    }
+    std::swap_ranges(a + static_cast<long long>(i) * ld,
+                     a + static_cast<long long>(i) * ld + cols,
+                     a + static_cast<long long>(j) * ld);
+}
+
+// order of the blocks solved directly by divide_and_conquer
+const int DC_LEAF = 32;
+
+const double EPS = std::numeric_limits<double>::epsilon();
+
+inline double* row_of(double* a, int ld, int i) {
+    return a + static_cast<long long>(i) * ld;
+}
+
+// finds root j of 1 + sum(z_i^2 / (p_i^2 - x)) for ascending poles p with
+// p_0 = 0, which is the square of singular value j. As for the tridiagonal
+// secular equation the root is found as an offset tau from the square of
+// the nearer pole, and the differences of squares are formed as
+// (p_i - p_o)(p_i + p_o), so delta[i] = p_i^2 - sigma^2 keeps its relative
+// accuracy even for the small singular values. Returns sigma.
+double secular_root(int k, const double* p, const double* z, int j,
+                    double* delta, double* shift) {
+    int origin;
+    double lo;
+    double hi;
+    if (j < k - 1) {
+        double mid = (p[j + 1] - p[j]) * (p[j + 1] + p[j]) / 2;
+        double f = 1;
+        for (int i = 0; i < k; i++) {
+            f += z[i] * z[i] / ((p[i] - p[j]) * (p[i] + p[j]) - mid);
+        }
+        if (f >= 0) {
+            origin = j;
+            lo = 0;
+            hi = mid;
+        }
+        else {
+            origin = j + 1;
+            lo = -mid;
+            hi = 0;
+        }
+    }
+    else {
+        origin = k - 1;
+        lo = 0;
+        hi = 0;
+        for (int i = 0; i < k; i++) {
+            hi += z[i] * z[i];
+        }
+    }
+
+    for (int i = 0; i < k; i++) {
+        shift[i] = (p[i] - p[origin]) * (p[i] + p[origin]);
+    }
+
+    double tau = (lo + hi) / 2;
+    for (int iter = 0; iter < 100; iter++) {
+        double psi = 0;
+        double dpsi = 0;
+        double phi = 0;
+        double dphi = 0;
+        for (int i = 0; i <= j; i++) {
+            double t = z[i] / (shift[i] - tau);
+            psi += z[i] * t;
+            dpsi += t * t;
+        }
+        for (int i = j + 1; i < k; i++) {
+            double t = z[i] / (shift[i] - tau);
+            phi += z[i] * t;
+            dphi += t * t;
+        }
+
+        double f = 1 + psi + phi;
+        if (f == 0) {
+            break;
+        }
+        if (f < 0) {
+            lo = tau;
+        }
+        else {
+            hi = tau;
+        }
+        if (std::abs(f) <= 8 * k * EPS * (1 + phi - psi) ||
+            hi - lo <= 2 * EPS * std::max(std::abs(lo), std::abs(hi))) {
+            break;
+        }
+
+        double step;
+        double left = shift[j] - tau;
+        if (j < k - 1) {
+            double right = shift[j + 1] - tau;
+            double b = dpsi * left * left;
+            double e = dphi * right * right;
+            double a0 = 1 + (psi - b / left) + (phi - e / right);
+            double qb = a0 * (left + right) + b + e;
+            double qc = left * right * f;
+            double disc = qb * qb - 4 * a0 * qc;
+            double den = qb + std::copysign(std::sqrt(std::max(disc, 0.0)),
+                                            qb);
+            step = (den != 0) ? 2 * qc / den : 0;
+        }
+        else {
+            double b = dpsi * left * left;
+            double a0 = 1 + psi - b / left;
+            step = (a0 > 0) ? left + b / a0 : 0;
+        }
+
+        double next = tau + step;
+        if (step == 0 || !(next > lo && next < hi)) {
+            next = (lo + hi) / 2;
+        }
+        if (next == tau) {
+            break;
+        }
+        tau = next;
+    }
+
+    for (int i = 0; i < k; i++) {
+        delta[i] = shift[i] - tau;
+    }
+    return std::sqrt(p[origin] * p[origin] + tau);
+}
+
+// columns i and j of the rows x cols block a become c * a_i + s * a_j and
+// c * a_j - s * a_i
+void rotate_columns(double* a, int ld, int rows, int i, int j, double c,
+                    double s) {
+    for (int r = 0; r < rows; r++) {
+        double* values = row_of(a, ld, r);
+        double x = values[i];
+        double y = values[j];
+        values[i] = c * x + s * y;
+        values[j] = c * y - s * x;
+    }
+}
+
+void negate_column(double* a, int ld, int rows, int i) {
+    for (int r = 0; r < rows; r++) {
+        row_of(a, ld, r)[i] = -row_of(a, ld, r)[i];
+    }
+}
+
+// SVD of a block of the divide and conquer, n x (n + sqre) with sqre 0 or
+// 1, by QR iteration. An extra column is first chased out by rotations
+// from the right, which leaves it zero and its right vector the null
+// vector of the block.
+void solve_leaf(double* d, double* e, int n, int sqre, double* u, int ldu,
+                double* v, int ldv) {
+    int cols = n + sqre;
+    for (int r = 0; r < cols; r++) {
+        double* row = row_of(v, ldv, r);
+        for (int c = 0; c < cols; c++) {
+            row[c] = (r == c) ? 1.0 : 0.0;
+        }
+    }
+    if (sqre == 1) {
+        double fill = e[n - 1];
+        for (int j = n - 1; j >= 0; j--) {
+            double r = std::hypot(d[j], fill);
+            double c = 1;
+            double s = 0;
+            if (r != 0) {
+                c = d[j] / r;
+                s = fill / r;
+            }
+            d[j] = r;
+            if (j > 0) {
+                fill = -s * e[j - 1];
+                e[j - 1] *= c;
+            }
+            rotate_columns(v, ldv, cols, j, n, c, s);
+        }
+    }
+
+    std::vector<double> ut(static_cast<size_t>(n) * n, 0.0);
+    std::vector<double> vt(static_cast<size_t>(n) * n, 0.0);
+    for (int i = 0; i < n; i++) {
+        ut[static_cast<size_t>(i) * n + i] = 1;
+        vt[static_cast<size_t>(i) * n + i] = 1;
+    }
+    svd(d, e, n, vt.data(), n, n, ut.data(), n, n);
+
+    for (int r = 0; r < n; r++) {
+        double* row = row_of(u, ldu, r);
+        for (int c = 0; c < n; c++) {
+            row[c] = ut[static_cast<size_t>(c) * n + r];
+        }
+    }
+    std::vector<double> row_copy(n);
+    for (int r = 0; r < cols; r++) {
+        double* row = row_of(v, ldv, r);
+        std::copy(row, row + n, row_copy.begin());
+        for (int c = 0; c < n; c++) {
+            const double* vc = vt.data() + static_cast<size_t>(c) * n;
+            double sum = 0;
+            for (int j = 0; j < n; j++) {
+                sum += row_copy[j] * vc[j];
+            }
+            row[c] = sum;
+        }
+    }
+}
+
+// merges the SVDs of the upper block, rows 0 .. k - 1 and columns
+// 0 .. k, and the lower block, rows and columns from k + 1, held in d and
+// the diagonal blocks of u and v, with the middle row alpha * e_k +
+// beta * e_{k+1}. In the basis of the halves' vectors B is diag(p) with
+// the row z = (alpha * last row of V1, beta * first row of V2) put in at
+// row k, where column k holds the null vector of the upper block and so
+// p_k = 0. The null vector of a lower block with sqre = 1 is first rotated
+// into column k, leaving column n as the null vector of B.
+void merge_scaled(double* d, int n, int k, int sqre, double alpha,
+                  double beta, double* u, int ldu, double* v, int ldv) {
+    int vn = n + sqre;
+    std::vector<double> z(n);
+    std::vector<double> p(n);
+    for (int c = 0; c <= k; c++) {
+        z[c] = alpha * row_of(v, ldv, k)[c];
+    }
+    for (int c = k + 1; c < n; c++) {
+        z[c] = beta * row_of(v, ldv, k + 1)[c];
+    }
+    if (sqre == 1) {
+        double zn = beta * row_of(v, ldv, k + 1)[n];
+        double r = std::hypot(z[k], zn);
+        if (r != 0) {
+            rotate_columns(v, ldv, vn, k, n, z[k] / r, zn / r);
+            z[k] = r;
+        }
+    }
+    double pmax = 0;
+    for (int c = 0; c < n; c++) {
+        p[c] = (c == k) ? 0.0 : d[c];
+        pmax = std::max(pmax, std::abs(p[c]));
+    }
+    double tol =
+        8 * EPS * std::max(pmax, std::max(std::abs(alpha), std::abs(beta)));
+    if (std::abs(z[k]) <= tol) {
+        z[k] = tol;
+    }
+
+    // rows 0 .. k of u and v are the upper half, column k of u only has
+    // its unit in row k
+    std::vector<char> top(n);
+    std::vector<char> bottom(n);
+    std::vector<char> vtop(n);
+    std::vector<char> vbottom(n);
+    for (int c = 0; c < n; c++) {
+        top[c] = c <= k;
+        bottom[c] = c > k;
+        vtop[c] = c <= k;
+        vbottom[c] = c > k || (c == k && sqre == 1);
+    }
+
+    std::vector<int> order;
+    for (int c = 0; c < n; c++) {
+        if (c != k) {
+            order.push_back(c);
+        }
+    }
+    std::sort(order.begin(), order.end(),
+              [&](int a, int b) { return p[a] < p[b]; });
+
+    // deflate small components of z, poles that are numerically zero after
+    // rotating their component into z_k, and one of every two nearly equal
+    // poles after rotating its component into the other
+    std::vector<int> kept(1, k);
+    std::vector<int> deflated;
+    int prev = -1;
+    for (int c : order) {
+        if (std::abs(z[c]) <= tol) {
+            deflated.push_back(c);
+            continue;
+        }
+        if (p[c] <= tol) {
+            double r = std::hypot(z[k], z[c]);
+            double cs = z[k] / r;
+            double sn = z[c] / r;
+            rotate_columns(v, ldv, vn, k, c, cs, sn);
+            p[c] *= cs;
+            z[k] = r;
+            z[c] = 0;
+            vtop[k] = vtop[c] = vtop[k] || vtop[c];
+            vbottom[k] = vbottom[c] = vbottom[k] || vbottom[c];
+            deflated.push_back(c);
+            continue;
+        }
+        if (prev < 0) {
+            prev = c;
+            continue;
+        }
+
+        double s = z[prev];
+        double cs = z[c];
+        double r = std::hypot(cs, s);
+        cs /= r;
+        s = -s / r;
+        if (std::abs((p[c] - p[prev]) * cs * s) <= tol) {
+            z[c] = r;
+            z[prev] = 0;
+            rotate_columns(u, ldu, n, prev, c, cs, s);
+            rotate_columns(v, ldv, vn, prev, c, cs, s);
+            double t = p[prev] * cs * cs + p[c] * s * s;
+            p[c] = p[prev] * s * s + p[c] * cs * cs;
+            p[prev] = t;
+            top[c] = top[prev] = top[c] || top[prev];
+            bottom[c] = bottom[prev] = bottom[c] || bottom[prev];
+            vtop[c] = vtop[prev] = vtop[c] || vtop[prev];
+            vbottom[c] = vbottom[prev] = vbottom[c] || vbottom[prev];
+            deflated.push_back(prev);
+        }
+        else {
+            kept.push_back(prev);
+        }
+        prev = c;
+    }
+    if (prev >= 0) {
+        kept.push_back(prev);
+    }
+
+    // singular values of deflated columns are their poles
+    for (int c : deflated) {
+        d[c] = std::abs(p[c]);
+        if (p[c] < 0) {
+            negate_column(v, ldv, vn, c);
+        }
+    }
+
+    int nk = static_cast<int>(kept.size());
+    if (nk == 1) {
+        d[k] = std::abs(z[k]);
+        if (z[k] < 0) {
+            negate_column(v, ldv, vn, k);
+        }
+        return;
+    }
+
+    std::vector<double> pl(nk);
+    std::vector<double> zl(nk);
+    for (int i = 0; i < nk; i++) {
+        pl[i] = p[kept[i]];
+        zl[i] = z[kept[i]];
+    }
+
+    // roots of the secular equation, del(i, j) = p_i^2 - sigma_j^2
+    std::vector<double> sigma(nk);
+    std::vector<double> del(static_cast<size_t>(nk) * nk);
+    std::vector<double> delta(nk);
+    std::vector<double> shift(nk);
+    for (int j = 0; j < nk; j++) {
+        sigma[j] = secular_root(nk, pl.data(), zl.data(), j, delta.data(),
+                                shift.data());
+        for (int i = 0; i < nk; i++) {
+            del[static_cast<size_t>(i) * nk + j] = delta[i];
+        }
+    }
+
+    // z recomputed from the roots (Gu and Eisenstat), then the vectors of
+    // the bordered diagonal: v_j = zhat / del(., j) and u_j = M v_j, whose
+    // entry in the border row is -1 by the secular equation
+    std::vector<double> um(static_cast<size_t>(nk) * nk);
+    std::vector<double> vm(static_cast<size_t>(nk) * nk);
+    for (int i = 0; i < nk; i++) {
+        const double* row = del.data() + static_cast<size_t>(i) * nk;
+        double w = row[i];
+        for (int j = 0; j < nk; j++) {
+            if (j != i) {
+                w *= row[j] / ((pl[i] - pl[j]) * (pl[i] + pl[j]));
+            }
+        }
+        double zhat = std::copysign(std::sqrt(std::max(-w, 0.0)), zl[i]);
+        double* urow = um.data() + static_cast<size_t>(i) * nk;
+        double* vrow = vm.data() + static_cast<size_t>(i) * nk;
+        for (int j = 0; j < nk; j++) {
+            vrow[j] = zhat / row[j];
+            urow[j] = (i == 0) ? -1.0 : pl[i] * vrow[j];
+        }
+    }
+    for (double* m : {um.data(), vm.data()}) {
+        std::vector<double> norms(nk, 0.0);
+        for (int i = 0; i < nk; i++) {
+            const double* row = m + static_cast<size_t>(i) * nk;
+            for (int j = 0; j < nk; j++) {
+                norms[j] += row[j] * row[j];
+            }
+        }
+        for (int j = 0; j < nk; j++) {
+            norms[j] = 1 / std::sqrt(norms[j]);
+        }
+        for (int i = 0; i < nk; i++) {
+            double* row = m + static_cast<size_t>(i) * nk;
+            for (int j = 0; j < nk; j++) {
+                row[j] *= norms[j];
+            }
+        }
+    }
+
+    // the new vectors are the kept columns times um or vm, the upper and
+    // the lower rows each one product over the columns with entries there
+    std::vector<double> product(static_cast<size_t>(vn) * nk);
+    auto multiply = [&](double* q, int ldq, const std::vector<double>& mat,
+                        const std::vector<char>& has, int r0, int rows) {
+        std::vector<int> cols;
+        for (int i = 0; i < nk; i++) {
+            if (has[kept[i]]) {
+                cols.push_back(i);
+            }
+        }
+        int width = static_cast<int>(cols.size());
+        double* out = product.data() + static_cast<size_t>(r0) * nk;
+        if (width == 0 || rows == 0) {
+            std::fill(out, out + static_cast<size_t>(rows) * nk, 0.0);
+            return;
+        }
+        std::vector<double> qs(static_cast<size_t>(rows) * width);
+        std::vector<double> ms(static_cast<size_t>(width) * nk);
+        for (int r = 0; r < rows; r++) {
+            const double* src = row_of(q, ldq, r0 + r);
+            for (int c = 0; c < width; c++) {
+                qs[static_cast<size_t>(r) * width + c] = src[kept[cols[c]]];
+            }
+        }
+        for (int c = 0; c < width; c++) {
+            std::copy(mat.begin() + static_cast<size_t>(cols[c]) * nk,
+                      mat.begin() + static_cast<size_t>(cols[c] + 1) * nk,
+                      ms.begin() + static_cast<size_t>(c) * nk);
+        }
+        gemm::gemm(rows, nk, width, 1.0, qs.data(), width, ms.data(), nk,
+                   0.0, out, nk);
+    };
+    auto store = [&](double* q, int ldq, int rows) {
+        for (int r = 0; r < rows; r++) {
+            double* dst = row_of(q, ldq, r);
+            const double* src = product.data() + static_cast<size_t>(r) * nk;
+            for (int j = 0; j < nk; j++) {
+                dst[kept[j]] = src[j];
+            }
+        }
+    };
+    multiply(u, ldu, um, top, 0, k + 1);
+    multiply(u, ldu, um, bottom, k + 1, n - k - 1);
+    store(u, ldu, n);
+    multiply(v, ldv, vm, vtop, 0, k + 1);
+    multiply(v, ldv, vm, vbottom, k + 1, vn - k - 1);
+    store(v, ldv, vn);
+
+    for (int j = 0; j < nk; j++) {
+        d[kept[j]] = sigma[j];
+    }
+}
+
+// merge_scaled for a problem of any scale, which is first scaled to norm
+// about one so that the squares of the entries of a tiny block do not
+// underflow
+void merge(double* d, int n, int k, int sqre, double alpha, double beta,
+           double* u, int ldu, double* v, int ldv) {
+    double scale = std::max(std::abs(alpha), std::abs(beta));
+    for (int c = 0; c < n; c++) {
+        if (c != k) {
+            scale = std::max(scale, std::abs(d[c]));
+        }
+    }
+    if (scale == 0) {
+        return;
+    }
+    alpha /= scale;
+    beta /= scale;
+    for (int c = 0; c < n; c++) {
+        d[c] /= scale;
+    }
+    merge_scaled(d, n, k, sqre, alpha, beta, u, ldu, v, ldv);
+    for (int c = 0; c < n; c++) {
+        d[c] *= scale;
+    }
+}
+
+// SVD of the n x (n + sqre) upper bidiagonal block with diagonal d and
+// superdiagonal e, split at the middle row k into a k x (k + 1) upper
+// block and the lower block of the same shape as this one
+void solve_block(double* d, double* e, int n, int sqre, double* u, int ldu,
+                 double* v, int ldv) {
+    if (n <= DC_LEAF) {
+        solve_leaf(d, e, n, sqre, u, ldu, v, ldv);
+        return;
+    }
+    int k = n / 2;
+    double alpha = d[k];
+    double beta = e[k];
+    solve_block(d, e, k, 1, u, ldu, v, ldv);
+    solve_block(d + k + 1, e + k + 1, n - k - 1, sqre,
+                row_of(u, ldu, k + 1) + k + 1, ldu,
+                row_of(v, ldv, k + 1) + k + 1, ldv);
+    row_of(u, ldu, k)[k] = 1;
+    merge(d, n, k, sqre, alpha, beta, u, ldu, v, ldv);
+}
+
+} // namespace
+
+void svd(double* d, double* e_in, int n, double* vt, int ldvt, int ncvt,
+         double* ut, int ldut, int ncut) {
+    if (n == 0) {
+        return;
+    }
+    const double eps = std::numeric_limits<double>::epsilon();
+
+    // f[i] couples i - 1 and i, f[0] is unused
+    std::vector<double> f(n, 0.0);
+    for (int i = 1; i < n; i++) {
+        f[i] = e_in[i - 1];
+    }
+    double anorm = 0;
+    for (int i = 0; i < n; i++) {
+        anorm = std::max(anorm, std::abs(d[i]) + std::abs(f[i]));
+    }
+    double tol = eps * anorm;
+
+    for (int k = n - 1; k >= 0; k--) {
+        for (int iter = 0;; iter++) {
+            // find the top l of the unreduced block ending at k
+            int l;
+            bool cancel = true;
+            for (l = k; l >= 0; l--) {
+                if (l == 0 || std::abs(f[l]) <= tol) {
+                    cancel = false;
+                    break;
+                }
+                if (std::abs(d[l - 1]) <= tol) {
+                    break;
+                }
+            }
+
+            if (cancel) {
+                // d[l - 1] is zero, rotate f[l] away from the left so that
+                // the block splits there
+                double c = 0;
+                double s = 1;
+                for (int i = l; i <= k; i++) {
+                    double g = s * f[i];
+                    f[i] = c * f[i];
+                    if (std::abs(g) <= tol) {
+                        break;
+                    }
+                    double h = std::hypot(g, d[i]);
+                    c = d[i] / h;
+                    s = -g / h;
+                    d[i] = h;
+                    rotate_rows(ut, ldut, ncut, l - 1, i, c, s);
+                }
+            }
+
+            double z = d[k];
+            if (l == k) {
+                // converged, singular values are kept nonnegative
+                if (z < 0) {
+                    d[k] = -z;
+                    if (vt != nullptr) {
+                        double* row = vt + static_cast<long long>(k) * ldvt;
+                        for (int col = 0; col < ncvt; col++) {
+                            row[col] = -row[col];
+                        }
+                    }
+                }
+                break;
+            }
+            if (iter == 75) {
+                throw exceptions::no_convergence();
+            }
+
+            // shift from the trailing 2x2 block of B^T B
+            double x = d[l];
+            double y = d[k - 1];
+            double g = f[k - 1];
+            double h = f[k];
+            double shift = ((y - z) * (y + z) + (g - h) * (g + h)) /
+                           (2 * h * y);
+            g = std::hypot(shift, 1.0);
+            shift = ((x - z) * (x + z) +
+                     h * ((y / (shift + std::copysign(g, shift))) - h)) /
+                    x;
+
+            // chase the bulge down the block
+            double c = 1;
+            double s = 1;
+            for (int j = l; j < k; j++) {
+                int i = j + 1;
+                g = f[i];
+                y = d[i];
+                h = s * g;
+                g = c * g;
+                z = std::hypot(shift, h);
+                f[j] = z;
+                c = shift / z;
+                s = h / z;
+                shift = x * c + g * s;
+                g = g * c - x * s;
+                h = y * s;
+                y *= c;
+                rotate_rows(vt, ldvt, ncvt, j, i, c, s);
+
+                z = std::hypot(shift, h);
+                d[j] = z;
+                if (z != 0) {
+                    c = shift / z;
+                    s = h / z;
+                }
+                shift = c * g + s * y;
+                x = c * y - s * g;
+                rotate_rows(ut, ldut, ncut, j, i, c, s);
+            }
+            f[l] = 0;
+            f[k] = shift;
+            d[k] = x;
+        }
+    }
+
+    // descending order, moving the singular vectors along
+    for (int i = 0; i < n - 1; i++) {
+        int largest = i;
+        for (int j = i + 1; j < n; j++) {
+            if (d[j] > d[largest]) {
+                largest = j;
+            }
+        }
+        if (largest != i) {
+            std::swap(d[i], d[largest]);
+            swap_rows(vt, ldvt, ncvt, i, largest);
+            swap_rows(ut, ldut, ncut, i, largest);
+        }
+    }
+}
+
+void divide_and_conquer(double* d, const double* e, int n, double* u,
+                        int ldu, double* v, int ldv) {
+    for (int r = 0; r < n; r++) {
+        std::fill(row_of(u, ldu, r), row_of(u, ldu, r) + n, 0.0);
+        std::fill(row_of(v, ldv, r), row_of(v, ldv, r) + n, 0.0);
+    }
+    std::vector<double> work(e, e + std::max(n - 1, 0));
+    work.push_back(0);
+    solve_block(d, work.data(), n, 0, u, ldu, v, ldv);
+
+    // descending order, moving the columns of u and v along
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](int a, int b) { return d[a] > d[b]; });
+    std::vector<double> values(d, d + n);
+    for (int i = 0; i < n; i++) {
+        d[i] = values[order[i]];
+    }
+    std::vector<double> row_copy(n);
+    auto permute = [&](double* q, int ld) {
+        for (int r = 0; r < n; r++) {
+            double* row = row_of(q, ld, r);
+            std::copy(row, row + n, row_copy.begin());
+            for (int c = 0; c < n; c++) {
+                row[c] = row_copy[order[c]];
+            }
+        }
+    };
+    permute(u, ldu);
+    permute(v, ldv);
+}
+
+} // namespace astra::internals::bidiagonal
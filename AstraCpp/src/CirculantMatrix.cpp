@@ -0,0 +1,112 @@
+#include "pch.h"
+
+#include "../include/CirculantMatrix.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Fft.h"
+
+#include <utility>
+
+namespace astra {
+
+CirculantMatrix::CirculantMatrix(std::vector<double> column)
+    : column(std::move(column)) {
+    if (this->column.empty()) {
+        throw internals::exceptions::invalid_size();
+    }
+    eigen.assign(this->column.begin(), this->column.end());
+    internals::fft::transform(eigen.data(), num_row(), false);
+}
+
+CirculantMatrix
+CirculantMatrix::from_first_row(const std::vector<double>& row) {
+    if (row.empty()) {
+        throw internals::exceptions::invalid_size();
+    }
+    // c[k] = A(k, 0) = A(0, n - k)
+    int n = static_cast<int>(row.size());
+    std::vector<double> column(n);
+    column[0] = row[0];
+    for (int k = 1; k < n; k++) {
+        column[k] = row[n - k];
+    }
+    return CirculantMatrix(std::move(column));
+}
+
+int CirculantMatrix::num_row() const {
+    return static_cast<int>(column.size());
+}
+
+int CirculantMatrix::num_col() const {
+    return static_cast<int>(column.size());
+}
+
+const std::vector<double>& CirculantMatrix::first_column() const {
+    return column;
+}
+
+std::vector<double> CirculantMatrix::first_row() const {
+    int n = num_row();
+    std::vector<double> row(n);
+    row[0] = column[0];
+    for (int k = 1; k < n; k++) {
+        row[k] = column[n - k];
+    }
+    return row;
+}
+
+const std::vector<std::complex<double>>&
+CirculantMatrix::eigenvalues() const {
+    return eigen;
+}
+
+double CirculantMatrix::operator()(int i, int j) const {
+    int n = num_row();
+    if (i < 0 || i >= n || j < 0 || j >= n) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    return column[(i - j + n) % n];
+}
+
+Matrix CirculantMatrix::to_dense() const {
+    int n = num_row();
+    Matrix result(n, n);
+    double* out = result.data();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            out[static_cast<long long>(i) * n + j] = column[(i - j + n) % n];
+        }
+    }
+    return result;
+}
+
+void CirculantMatrix::multiply(const Vector& x, Vector& y) const {
+    int n = num_row();
+    if (x.get_size() != n || y.get_size() != n) {
+        throw internals::exceptions::matrix_size_mismatch();
+    }
+    std::vector<std::complex<double>> work(x.data(), x.data() + n);
+    internals::fft::transform(work.data(), n, false);
+    for (int k = 0; k < n; k++) {
+        work[k] *= eigen[k];
+    }
+    internals::fft::transform(work.data(), n, true);
+    for (int i = 0; i < n; i++) {
+        y[i] = work[i].real();
+    }
+}
+
+Vector CirculantMatrix::operator*(const Vector& x) const {
+    Vector y(num_row());
+    multiply(x, y);
+    return y;
+}
+
+bool CirculantMatrix::operator==(const CirculantMatrix& other) const {
+    return column == other.column;
+}
+
+bool CirculantMatrix::operator!=(const CirculantMatrix& other) const {
+    return !(*this == other);
+}
+
+} // namespace astra
@@ -3,77 +3,1541 @@
 #include "../include/Matrix.h"
 #include "../internals/Exceptions.h"
 #include "../include/Decomposer.h"
+#include "../internals/Bidiagonal.h"
+#include "../internals/Gemm.h"
+#include "../internals/Hessenberg.h"
+#include "../internals/Householder.h"
+#include "../internals/Simd.h"
 #include "../internals/MathUtils.h"
+#include "../internals/Tridiagonal.h"
+#include "../internals/Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
 
 namespace astra {
 
-Decomposer::PLUResult Decomposer::palu(Matrix A) {
-    int m = A.num_row();
+namespace {
 
-    // matrix is not square
-    if (m != A.num_col()) {
-        throw astra::internals::exceptions::non_square_matrix();
-    }
+// number of columns factored per panel of the blocked LU, the trailing
+// update is a GEMM with this inner dimension
+const int LU_BLOCK = 64;
 
-    Matrix P = Matrix::identity(m);
-    Matrix L = Matrix::identity(m);
-    Matrix U = A;
+inline double* row_of(double* a, int n, int i) {
+    return a + static_cast<long long>(i) * n;
+}
+
+// factors the columns j0 .. j0 + nb - 1 of the n x n row-major matrix a,
+// from row j0 down, with partial pivoting. Only the panel columns are
+// eliminated, but whole rows are swapped so that the multipliers already
+// stored to the left and the columns to the right stay consistent.
+// Returns the number of swaps.
+int factor_panel(double* a, int n, int j0, int nb, int* pivots) {
     int swaps = 0;
 
-    for (int x = 0; x < m; x++) {
-        int pivot_row = x;
+    for (int k = j0; k < j0 + nb; k++) {
+        double* pivot_row_values = row_of(a, n, k);
+        int pivot_row = k;
 
         // finding the largest value in the column and selecting it as the pivot
-        for (int y = x + 1; y < m; y++) {
-            if (internals::mathutils::abs(U(y, x)) >
-                internals::mathutils::abs(U(pivot_row, x))) {
+        for (int y = k + 1; y < n; y++) {
+            if (internals::mathutils::abs(row_of(a, n, y)[k]) >
+                internals::mathutils::abs(row_of(a, n, pivot_row)[k])) {
                 pivot_row = y;
             }
         }
 
-        if (internals::mathutils::nearly_equal(U(pivot_row, x), 0.0)) {
-            // all values in the column are zero so we need to skip this column
+        if (internals::mathutils::nearly_equal(row_of(a, n, pivot_row)[k],
+                                               0.0)) {
+            // all values in the column are zero so we need to skip this
+            // column, which also leaves zero multipliers in L
+            pivots[k] = k;
+            for (int y = k; y < n; y++) {
+                row_of(a, n, y)[k] = 0;
+            }
             continue;
         }
 
-        if (pivot_row != x) {
-            // pivot is not in the diagonal so we need to
-            // swap rows
-            U.row_swap(x, pivot_row); // swaping U
-            P.row_swap(x, pivot_row); // swaping P
-            L.partial_row_swap(x, pivot_row, x); // partial swapping L till diagonal
+        pivots[k] = pivot_row;
+        if (pivot_row != k) {
+            double* other = row_of(a, n, pivot_row);
+            for (int i = 0; i < n; i++) {
+                internals::utils::swap(pivot_row_values[i], other[i]);
+            }
             swaps++;
         }
 
-        // eliminate entries below the pivot
-        for (int y = x + 1; y < m; y++) {
-            double current_val = U(y, x);
+        // eliminate entries below the pivot within the panel, storing the
+        // pivot factors in place of the eliminated entries
+        double pivot = pivot_row_values[k];
+        for (int y = k + 1; y < n; y++) {
+            double* row = row_of(a, n, y);
+            double pivot_factor = row[k] / pivot;
+            row[k] = pivot_factor;
+
+            if (pivot_factor == 0) {
+                continue;
+            }
+            for (int i = k + 1; i < j0 + nb; i++) {
+                row[i] -= pivot_factor * pivot_row_values[i];
+            }
+        }
+    }
+    return swaps;
+}
+
+// overwrites the rows j0 .. j0 + nb - 1 right of the panel with
+// L11^-1 * A12, where L11 is the unit lower triangle of the factored panel
+void solve_panel_rows(double* a, int n, int j0, int nb) {
+    int c0 = j0 + nb;
+    for (int i = j0 + 1; i < j0 + nb; i++) {
+        double* row = row_of(a, n, i);
+        for (int p = j0; p < i; p++) {
+            double factor = row[p];
+            if (factor == 0) {
+                continue;
+            }
+            const double* upper = row_of(a, n, p);
+            for (int c = c0; c < n; c++) {
+                row[c] -= factor * upper[c];
+            }
+        }
+    }
+}
+
+// columns per block of the blocked Cholesky factorization
+const int CHOLESKY_BLOCK = 64;
+
+// Bunch-Kaufman threshold (1 + sqrt(17)) / 8, it balances the element growth
+// of 1x1 and 2x2 pivots
+const double BK_ALPHA = 0.6403882032022076;
+
+// factors the diagonal block j0 .. j0 + nb - 1 of the lower triangle in
+// place, the block has already received the updates of the columns before it
+void factor_diagonal_block(double* a, int n, int j0, int nb) {
+    int j1 = j0 + nb;
+    for (int k = j0; k < j1; k++) {
+        double* pivot_row = row_of(a, n, k);
+        if (!(pivot_row[k] > 0)) {
+            throw internals::exceptions::not_positive_definite();
+        }
+        double pivot = std::sqrt(pivot_row[k]);
+        pivot_row[k] = pivot;
+
+        for (int i = k + 1; i < j1; i++) {
+            row_of(a, n, i)[k] /= pivot;
+        }
+        for (int i = k + 1; i < j1; i++) {
+            double* row = row_of(a, n, i);
+            double factor = row[k];
+            for (int j = k + 1; j <= i; j++) {
+                row[j] -= factor * row_of(a, n, j)[k];
+            }
+        }
+    }
+}
+
+// overwrites the rows below the diagonal block with A21 * L11^-T, one row
+// at a time so that every inner loop runs along a row
+void solve_below_block(double* a, int n, int j0, int nb) {
+    int j1 = j0 + nb;
+    for (int i = j1; i < n; i++) {
+        double* row = row_of(a, n, i);
+        for (int k = j0; k < j1; k++) {
+            const double* l = row_of(a, n, k);
+            double value = row[k];
+            for (int p = j0; p < k; p++) {
+                value -= row[p] * l[p];
+            }
+            row[k] = value / l[k];
+        }
+    }
+}
+
+// swaps rows and columns p < q of the symmetric matrix whose lower triangle
+// is stored in a. The multipliers already stored left of the current column
+// are swapped as parts of whole rows.
+void symmetric_swap(double* a, int n, int p, int q) {
+    double* rp = row_of(a, n, p);
+    double* rq = row_of(a, n, q);
+    for (int j = 0; j < p; j++) {
+        internals::utils::swap(rp[j], rq[j]);
+    }
+    internals::utils::swap(rp[p], rq[q]);
+    for (int j = p + 1; j < q; j++) {
+        internals::utils::swap(row_of(a, n, j)[p], rq[j]);
+    }
+    for (int i = q + 1; i < n; i++) {
+        double* row = row_of(a, n, i);
+        internals::utils::swap(row[p], row[q]);
+    }
+}
+
+// columns per panel of the blocked QR, and the width below which a panel is
+// factored column by column
+const int QR_BLOCK = 32;
+const int QR_LEAF = 8;
+
+// sum of squares of column k below row k
+double column_norm_sq(const double* a, int m, int n, int k) {
+    double norm_sq = 0;
+    for (int i = k + 1; i < m; i++) {
+        double value = a[static_cast<long long>(i) * n + k];
+        norm_sq += value * value;
+    }
+    return norm_sq;
+}
+
+// factors the columns j0 .. j0 + nb - 1 of the m x n row-major matrix a with
+// Householder reflectors, applying each one to the rest of these columns
+// only. Each column takes two passes down the rows: one scales the
+// reflector and gathers w = A^T v, the other subtracts tau v w^T and sums
+// the norm of the next column on the way.
+void factor_qr_columns(double* a, int m, int n, int j0, int nb,
+                       double* tau) {
+    int c0 = j0 + nb;
+    std::vector<double> w(nb);
+    double norm_sq = column_norm_sq(a, m, n, j0);
+
+    for (int k = j0; k < c0; k++) {
+        double* pivot_row = row_of(a, n, k);
+        int width = c0 - k - 1;
+
+        if (norm_sq == 0) {
+            // already zero below the diagonal
+            tau[k] = 0;
+            if (width > 0) {
+                norm_sq = column_norm_sq(a, m, n, k + 1);
+            }
+            continue;
+        }
+
+        double alpha = pivot_row[k];
+        double beta = std::sqrt(alpha * alpha + norm_sq);
+        if (alpha > 0) {
+            beta = -beta;
+        }
+        tau[k] = (beta - alpha) / beta;
+        double scale = 1 / (alpha - beta);
+        pivot_row[k] = beta;
+
+        for (int j = 0; j < width; j++) {
+            w[j] = pivot_row[k + 1 + j];
+        }
+        for (int i = k + 1; i < m; i++) {
+            double* row = row_of(a, n, i);
+            double v = row[k] * scale;
+            row[k] = v;
+            for (int j = 0; j < width; j++) {
+                w[j] += v * row[k + 1 + j];
+            }
+        }
+        if (width == 0) {
+            continue;
+        }
+
+        for (int j = 0; j < width; j++) {
+            w[j] *= tau[k];
+            pivot_row[k + 1 + j] -= w[j];
+        }
+        norm_sq = 0;
+        for (int i = k + 1; i < m; i++) {
+            double* row = row_of(a, n, i);
+            double v = row[k];
+            for (int j = 0; j < width; j++) {
+                row[k + 1 + j] -= v * w[j];
+            }
+            if (i > k + 1) {
+                norm_sq += row[k + 1] * row[k + 1];
+            }
+        }
+    }
+}
+
+// factors the panel j0 .. j0 + nb - 1 by halves: the left half is factored
+// and applied to the right half as one block reflector before the right
+// half is factored. A tall panel is then read a few times per level instead
+// of twice per column.
+void factor_qr_panel(double* a, int m, int n, int j0, int nb, double* tau) {
+    if (nb <= QR_LEAF) {
+        factor_qr_columns(a, m, n, j0, nb, tau);
+        return;
+    }
+    int half = nb / 2;
+    factor_qr_panel(a, m, n, j0, half, tau);
+    internals::householder::apply_block(a + j0, n, j0, m, half, tau + j0,
+                                        true, a + j0 + half, n, nb - half);
+    factor_qr_panel(a, m, n, j0 + half, nb - half, tau);
+}
+
+// columns per panel of the tridiagonal reduction, and reflectors per block
+// of its back transformation
+const int TRD_BLOCK = 32;
+
+// y[s:n) = A[s:n, s:n] * x[s:n) from the lower triangle of a, each entry
+// used for both its own row and its mirror. Four rows are taken at a time so
+// that every pass over y serves four of them.
+void symmetric_product(const double* a, int n, int s, const double* x,
+                       double* y) {
+    for (int r = s; r < n; r++) {
+        y[r] = 0;
+    }
+
+    int r = s;
+    for (; r + 4 <= n; r += 4) {
+        const double* row0 = a + static_cast<long long>(r) * n;
+        const double* row1 = row0 + n;
+        const double* row2 = row1 + n;
+        const double* row3 = row2 + n;
+        double x0 = x[r];
+        double x1 = x[r + 1];
+        double x2 = x[r + 2];
+        double x3 = x[r + 3];
+        double sum0 = 0;
+        double sum1 = 0;
+        double sum2 = 0;
+        double sum3 = 0;
+        for (int c = s; c < r; c++) {
+            double xc = x[c];
+            sum0 += row0[c] * xc;
+            sum1 += row1[c] * xc;
+            sum2 += row2[c] * xc;
+            sum3 += row3[c] * xc;
+            y[c] += row0[c] * x0 + row1[c] * x1 + row2[c] * x2 +
+                    row3[c] * x3;
+        }
+
+        // the 4 x 4 diagonal block
+        y[r] += sum0 + row0[r] * x0 + row1[r] * x1 + row2[r] * x2 +
+                row3[r] * x3;
+        y[r + 1] += sum1 + row1[r] * x0 + row1[r + 1] * x1 +
+                    row2[r + 1] * x2 + row3[r + 1] * x3;
+        y[r + 2] += sum2 + row2[r] * x0 + row2[r + 1] * x1 +
+                    row2[r + 2] * x2 + row3[r + 2] * x3;
+        y[r + 3] += sum3 + row3[r] * x0 + row3[r + 1] * x1 +
+                    row3[r + 2] * x2 + row3[r + 3] * x3;
+    }
+    for (; r < n; r++) {
+        const double* row = a + static_cast<long long>(r) * n;
+        double xr = x[r];
+        double sum = 0;
+        for (int c = s; c < r; c++) {
+            sum += row[c] * x[c];
+            y[c] += row[c] * xr;
+        }
+        y[r] += sum + row[r] * xr;
+    }
+}
+
+// reduces the symmetric n x n matrix a, of which only the lower triangle is
+// read, to the tridiagonal T = Q^T A Q with diagonal d and off-diagonal e.
+// Reflector k has its unit at row k + 1 and the rest stored below that in
+// column k. A panel of columns is reduced with the trailing matrix left
+// as it was, its reflectors collected in V and the matching W, then
+// A22 = A22 - V W^T - W V^T is applied as one product per block of rows.
+void tridiagonalize(double* a, int n, double* d, double* e, double* tau) {
+    std::vector<double> v(static_cast<size_t>(n) * TRD_BLOCK);
+    std::vector<double> w(static_cast<size_t>(n) * TRD_BLOCK);
+    std::vector<double> x(n);
+    std::vector<double> y(n);
+    std::vector<double> vtw(TRD_BLOCK);
+    std::vector<double> vtv(TRD_BLOCK);
+
+    for (int j0 = 0; j0 < n; j0 += TRD_BLOCK) {
+        int nb = (n - j0 < TRD_BLOCK) ? n - j0 : TRD_BLOCK;
+        int c0 = j0 + nb;
+        std::fill(v.begin(), v.end(), 0.0);
+        std::fill(w.begin(), w.end(), 0.0);
+
+        for (int i = 0; i < nb; i++) {
+            int k = j0 + i;
+            const double* vk = v.data() + static_cast<size_t>(k) * TRD_BLOCK;
+            const double* wk = w.data() + static_cast<size_t>(k) * TRD_BLOCK;
+
+            // bring column k up to date with the reflectors of this panel
+            for (int r = k; r < n; r++) {
+                const double* vr =
+                    v.data() + static_cast<size_t>(r) * TRD_BLOCK;
+                const double* wr =
+                    w.data() + static_cast<size_t>(r) * TRD_BLOCK;
+                double update = 0;
+                for (int p = 0; p < i; p++) {
+                    update += vr[p] * wk[p] + wr[p] * vk[p];
+                }
+                row_of(a, n, r)[k] -= update;
+            }
+            d[k] = row_of(a, n, k)[k];
+            if (k == n - 1) {
+                break;
+            }
+
+            // reflector zeroing column k below row k + 1
+            double alpha = row_of(a, n, k + 1)[k];
+            double norm_sq = 0;
+            for (int r = k + 2; r < n; r++) {
+                double value = row_of(a, n, r)[k];
+                norm_sq += value * value;
+            }
+            std::fill(x.begin(), x.end(), 0.0);
+            x[k + 1] = 1;
+            if (norm_sq == 0) {
+                tau[k] = 0;
+                e[k] = alpha;
+            }
+            else {
+                double beta = std::sqrt(alpha * alpha + norm_sq);
+                if (alpha > 0) {
+                    beta = -beta;
+                }
+                tau[k] = (beta - alpha) / beta;
+                double scale = 1 / (alpha - beta);
+                for (int r = k + 2; r < n; r++) {
+                    double* value = row_of(a, n, r) + k;
+                    *value *= scale;
+                    x[r] = *value;
+                }
+                e[k] = beta;
+            }
+            row_of(a, n, k + 1)[k] = e[k];
+            for (int r = k + 1; r < n; r++) {
+                v[static_cast<size_t>(r) * TRD_BLOCK + i] = x[r];
+            }
+            if (tau[k] == 0) {
+                continue;
+            }
+
+            symmetric_product(a, n, k + 1, x.data(), y.data());
+
+            // minus the panel updates not yet applied to A22
+            for (int p = 0; p < i; p++) {
+                vtw[p] = 0;
+                vtv[p] = 0;
+            }
+            for (int r = k + 1; r < n; r++) {
+                const double* vr =
+                    v.data() + static_cast<size_t>(r) * TRD_BLOCK;
+                const double* wr =
+                    w.data() + static_cast<size_t>(r) * TRD_BLOCK;
+                for (int p = 0; p < i; p++) {
+                    vtw[p] += wr[p] * x[r];
+                    vtv[p] += vr[p] * x[r];
+                }
+            }
+            double dot = 0;
+            for (int r = k + 1; r < n; r++) {
+                const double* vr =
+                    v.data() + static_cast<size_t>(r) * TRD_BLOCK;
+                const double* wr =
+                    w.data() + static_cast<size_t>(r) * TRD_BLOCK;
+                double value = y[r];
+                for (int p = 0; p < i; p++) {
+                    value -= vr[p] * vtw[p] + wr[p] * vtv[p];
+                }
+                y[r] = tau[k] * value;
+                dot += y[r] * x[r];
+            }
+
+            // w = y - (tau / 2) (y^T x) x
+            double correction = -0.5 * tau[k] * dot;
+            for (int r = k + 1; r < n; r++) {
+                w[static_cast<size_t>(r) * TRD_BLOCK + i] =
+                    y[r] + correction * x[r];
+            }
+        }
+
+        if (c0 >= n) {
+            break;
+        }
+
+        // A22 = A22 - [V W] [W V]^T on the lower triangle, the products
+        // above the diagonal of each diagonal block are never read
+        int len = n - c0;
+        std::vector<double> left(static_cast<size_t>(len) * 2 * nb);
+        std::vector<double> right(static_cast<size_t>(2) * nb * len);
+        for (int r = 0; r < len; r++) {
+            const double* vr =
+                v.data() + static_cast<size_t>(c0 + r) * TRD_BLOCK;
+            const double* wr =
+                w.data() + static_cast<size_t>(c0 + r) * TRD_BLOCK;
+            double* out = left.data() + static_cast<size_t>(r) * 2 * nb;
+            for (int p = 0; p < nb; p++) {
+                out[p] = vr[p];
+                out[nb + p] = wr[p];
+                right[static_cast<size_t>(p) * len + r] = wr[p];
+                right[static_cast<size_t>(nb + p) * len + r] = vr[p];
+            }
+        }
+        for (int i0 = 0; i0 < len; i0 += TRD_BLOCK) {
+            int i1 = (len - i0 < TRD_BLOCK) ? len : i0 + TRD_BLOCK;
+            internals::gemm::gemm(
+                i1 - i0, i1, 2 * nb, -1.0,
+                left.data() + static_cast<size_t>(i0) * 2 * nb, 2 * nb,
+                right.data(), len, 1.0, row_of(a, n, c0 + i0) + c0, n);
+        }
+    }
+}
+
+// z = Q z for the n x width block z and the Q of tridiagonalize or of
+// hessenberg::reduce, which store their reflectors alike, applying
+// the blocks of reflectors from the last one back
+void apply_tridiagonal_q(const double* a, int n, const double* tau,
+                         double* z, int width) {
+    int count = n - 1;
+    if (count <= 0) {
+        return;
+    }
+    int last = ((count - 1) / TRD_BLOCK) * TRD_BLOCK;
+    for (int j0 = last; j0 >= 0; j0 -= TRD_BLOCK) {
+        int nb = (count - j0 < TRD_BLOCK) ? count - j0 : TRD_BLOCK;
+        internals::householder::apply_block(a + j0, n, j0 + 1, n, nb,
+                                            tau + j0, false, z, width, width);
+    }
+}
+
+// copies a symmetric matrix and reduces it to tridiagonal form
+Matrix reduce_symmetric(const MatrixView& A, std::vector<double>& d,
+                        std::vector<double>& e, std::vector<double>& tau) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+    if (!A.is_symmetric()) {
+        throw internals::exceptions::non_symmetric_matrix();
+    }
+
+    int n = A.num_row();
+    Matrix W(A);
+    d.assign(n, 0.0);
+    e.assign(n, 0.0);
+    tau.assign(n, 0.0);
+    tridiagonalize(W.data(), n, d.data(), e.data(), tau.data());
+    return W;
+}
+
+// columns per panel of the bidiagonal reduction
+const int BRD_BLOCK = 32;
+
+// reduces the m x n row-major matrix a, m >= n, to the upper bidiagonal
+// B = Q^T A P with diagonal d and superdiagonal e. Left reflector k has its
+// unit at row k and the rest below it in column k, right reflector k has
+// its unit at column k + 1 and the rest to its right in row k. A panel of
+// rows and columns is reduced with the trailing matrix left as it was,
+// the updates collected in X and Y, and A22 = A22 - V Y^T - X U^T is then
+// one product.
+void bidiagonalize(double* a, int m, int n, double* d, double* e,
+                   double* tauq, double* taup) {
+    const int ld = BRD_BLOCK;
+    std::vector<double> x(static_cast<size_t>(m) * ld);
+    std::vector<double> y(static_cast<size_t>(n) * ld);
+    std::vector<double> v(m);
+    std::vector<double> u(n);
+    std::vector<double> t(n);
+    std::vector<double> s1(ld);
+    std::vector<double> s2(ld);
+    std::vector<double> left;
+    std::vector<double> right;
+
+    for (int j0 = 0; j0 < n; j0 += BRD_BLOCK) {
+        int nb = (n - j0 < BRD_BLOCK) ? n - j0 : BRD_BLOCK;
+        int c0 = j0 + nb;
+        std::fill(x.begin(), x.end(), 0.0);
+        std::fill(y.begin(), y.end(), 0.0);
+
+        for (int i = 0; i < nb; i++) {
+            int k = j0 + i;
+
+            // bring column k up to date with the panel so far, the right
+            // reflector of the previous step has its unit in this column
+            const double* yk = y.data() + static_cast<size_t>(k) * ld;
+            for (int p = 0; p < i; p++) {
+                s2[p] = (p == i - 1) ? 1.0 : row_of(a, n, j0 + p)[k];
+            }
+            for (int r = k; r < m; r++) {
+                double* ar = row_of(a, n, r);
+                const double* xr = x.data() + static_cast<size_t>(r) * ld;
+                double update = 0;
+                for (int p = 0; p < i; p++) {
+                    update += ar[j0 + p] * yk[p] + xr[p] * s2[p];
+                }
+                ar[k] -= update;
+            }
+
+            d[k] = internals::householder::make_reflector(
+                row_of(a, n, k) + k, n, m - k, tauq[k]);
+            v[k] = 1;
+            for (int r = k + 1; r < m; r++) {
+                v[r] = row_of(a, n, r)[k];
+            }
+            if (k == n - 1) {
+                taup[k] = 0;
+                break;
+            }
+
+            // column i of Y from A(k:m, k+1:n)^T v and the panel so far
+            std::fill(t.begin() + k + 1, t.end(), 0.0);
+            std::fill(s1.begin(), s1.begin() + i, 0.0);
+            std::fill(s2.begin(), s2.begin() + i, 0.0);
+            for (int r = k; r < m; r++) {
+                double vr = v[r];
+                if (vr == 0) {
+                    continue;
+                }
+                const double* ar = row_of(a, n, r);
+                const double* xr = x.data() + static_cast<size_t>(r) * ld;
+                for (int c = k + 1; c < n; c++) {
+                    t[c] += ar[c] * vr;
+                }
+                for (int p = 0; p < i; p++) {
+                    s1[p] += ar[j0 + p] * vr;
+                    s2[p] += xr[p] * vr;
+                }
+            }
+            for (int p = 0; p < i; p++) {
+                const double* up = row_of(a, n, j0 + p);
+                for (int c = k + 1; c < n; c++) {
+                    t[c] -= up[c] * s2[p];
+                }
+            }
+            for (int c = k + 1; c < n; c++) {
+                double* yc = y.data() + static_cast<size_t>(c) * ld;
+                double value = t[c];
+                for (int p = 0; p < i; p++) {
+                    value -= yc[p] * s1[p];
+                }
+                yc[i] = tauq[k] * value;
+            }
+
+            // bring row k up to date, including the reflector just made
+            double* ak = row_of(a, n, k);
+            const double* xk = x.data() + static_cast<size_t>(k) * ld;
+            for (int c = k + 1; c < n; c++) {
+                const double* yc = y.data() + static_cast<size_t>(c) * ld;
+                double update = yc[i];
+                for (int p = 0; p < i; p++) {
+                    update += yc[p] * ak[j0 + p];
+                }
+                ak[c] -= update;
+            }
+            for (int p = 0; p < i; p++) {
+                const double* up = row_of(a, n, j0 + p);
+                for (int c = k + 1; c < n; c++) {
+                    ak[c] -= up[c] * xk[p];
+                }
+            }
+
+            e[k] = internals::householder::make_reflector(
+                ak + k + 1, 1, n - k - 1, taup[k]);
+            u[k + 1] = 1;
+            for (int c = k + 2; c < n; c++) {
+                u[c] = ak[c];
+            }
+
+            // column i of X from A(k+1:m, k+1:n) u and the panel so far
+            for (int p = 0; p <= i; p++) {
+                double sum = 0;
+                for (int c = k + 1; c < n; c++) {
+                    sum += y[static_cast<size_t>(c) * ld + p] * u[c];
+                }
+                s1[p] = sum;
+            }
+            for (int p = 0; p < i; p++) {
+                const double* up = row_of(a, n, j0 + p);
+                double sum = 0;
+                for (int c = k + 1; c < n; c++) {
+                    sum += up[c] * u[c];
+                }
+                s2[p] = sum;
+            }
+            for (int r = k + 1; r < m; r++) {
+                const double* ar = row_of(a, n, r);
+                double* xr = x.data() + static_cast<size_t>(r) * ld;
+                double value = 0;
+                for (int c = k + 1; c < n; c++) {
+                    value += ar[c] * u[c];
+                }
+                for (int p = 0; p <= i; p++) {
+                    value -= ar[j0 + p] * s1[p];
+                }
+                for (int p = 0; p < i; p++) {
+                    value -= xr[p] * s2[p];
+                }
+                xr[i] = taup[k] * value;
+            }
+        }
+
+        if (c0 >= n) {
+            continue;
+        }
+
+        // A22 = A22 - [V X] [Y U]^T
+        int rows = m - c0;
+        int cols = n - c0;
+        int width = 2 * nb;
+        left.assign(static_cast<size_t>(rows) * width, 0.0);
+        right.assign(static_cast<size_t>(width) * cols, 0.0);
+        for (int r = c0; r < m; r++) {
+            const double* ar = row_of(a, n, r);
+            const double* xr = x.data() + static_cast<size_t>(r) * ld;
+            double* out = left.data() + static_cast<size_t>(r - c0) * width;
+            for (int p = 0; p < nb; p++) {
+                out[p] = ar[j0 + p];
+                out[nb + p] = xr[p];
+            }
+        }
+        for (int c = c0; c < n; c++) {
+            const double* yc = y.data() + static_cast<size_t>(c) * ld;
+            for (int p = 0; p < nb; p++) {
+                right[static_cast<size_t>(p) * cols + c - c0] = yc[p];
+            }
+        }
+        for (int p = 0; p < nb; p++) {
+            const double* up = row_of(a, n, j0 + p);
+            double* out = right.data() + static_cast<size_t>(nb + p) * cols;
+            for (int c = c0; c < n; c++) {
+                out[c - c0] = (c == j0 + p + 1) ? 1.0 : up[c];
+            }
+        }
+        internals::gemm::gemm(rows, cols, width, -1.0, left.data(), width,
+                              right.data(), cols, 1.0,
+                              row_of(a, n, c0) + c0, n);
+    }
+}
+
+// c = Q c for the Q of count reflectors stored below the diagonal of the
+// m x n matrix a, as qr and bidiagonalize leave them, applying the blocks
+// of reflectors from the last one back
+void apply_left_q(const double* a, int m, int n, int count,
+                  const double* tau, double* c, int ldc, int width) {
+    if (count <= 0) {
+        return;
+    }
+    int last = ((count - 1) / BRD_BLOCK) * BRD_BLOCK;
+    for (int j0 = last; j0 >= 0; j0 -= BRD_BLOCK) {
+        int nb = (count - j0 < BRD_BLOCK) ? count - j0 : BRD_BLOCK;
+        internals::householder::apply_block(a + j0, n, j0, m, nb, tau + j0,
+                                            false, c, ldc, width);
+    }
+}
+
+// the SVD W = U S VT of an m x n matrix with m >= n. s receives the n
+// singular values. When u is given it receives the first ucols columns of
+// U, n or m, and vt the n x n VT. A matrix at least 1.6 times as tall as it
+// is wide is factored by QR first and only its R is bidiagonalized.
+void tall_svd(Matrix W, double* s, double* u, int ucols, double* vt) {
+    int m = W.num_row();
+    int n = W.num_col();
+    bool use_qr = 5LL * m >= 8LL * n;
+
+    std::vector<double> qr_tau;
+    if (use_qr) {
+        auto res = Decomposer::qr(std::move(W));
+        W = std::move(res.QR);
+        qr_tau = std::move(res.tau);
+    }
+    Matrix B = use_qr ? Matrix(n, n) : std::move(W);
+    if (use_qr) {
+        const double* q = W.data();
+        double* r = B.data();
+        for (int i = 0; i < n; i++) {
+            for (int j = i; j < n; j++) {
+                r[i * n + j] = q[static_cast<long long>(i) * n + j];
+            }
+        }
+    }
+    int rows = B.num_row();
+
+    std::vector<double> d(n);
+    std::vector<double> e(n);
+    std::vector<double> tauq(n);
+    std::vector<double> taup(n);
+    bidiagonalize(B.data(), rows, n, d.data(), e.data(), tauq.data(),
+                  taup.data());
+
+    if (u == nullptr) {
+        internals::bidiagonal::svd(d.data(), e.data(), n, nullptr, 0, 0,
+                                   nullptr, 0, 0);
+        std::copy(d.begin(), d.end(), s);
+        return;
+    }
+
+    // the columns of ub and V become the singular vectors of the bidiagonal
+    Matrix ub(n, n);
+    Matrix V(n, n);
+    internals::bidiagonal::divide_and_conquer(d.data(), e.data(), n,
+                                              ub.data(), n, V.data(), n);
+    std::copy(d.begin(), d.end(), s);
+
+    // U = Q [U_B 0; 0 I]
+    std::fill(u, u + static_cast<long long>(m) * ucols, 0.0);
+    const double* ubv = ub.data();
+    for (int i = 0; i < n; i++) {
+        std::copy(ubv + i * n, ubv + (i + 1) * n,
+                  u + static_cast<long long>(i) * ucols);
+    }
+    for (int i = n; i < ucols; i++) {
+        u[static_cast<long long>(i) * ucols + i] = 1;
+    }
+    apply_left_q(B.data(), rows, n, n, tauq.data(), u, ucols,
+                 use_qr ? n : ucols);
+    if (use_qr) {
+        apply_left_q(W.data(), m, n, n, qr_tau.data(), u, ucols, ucols);
+    }
+
+    // V = P V_B, the right reflectors are gathered into columns first
+    Matrix pt(n, n);
+    const double* b = B.data();
+    double* p = pt.data();
+    double* vv = V.data();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            p[j * n + i] = b[i * n + j];
+        }
+    }
+    int count = n - 1;
+    if (count > 0) {
+        int last = ((count - 1) / BRD_BLOCK) * BRD_BLOCK;
+        for (int j0 = last; j0 >= 0; j0 -= BRD_BLOCK) {
+            int nb = (count - j0 < BRD_BLOCK) ? count - j0 : BRD_BLOCK;
+            internals::householder::apply_block(p + j0, n, j0 + 1, n, nb,
+                                                taup.data() + j0, false, vv,
+                                                n, n);
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            vt[i * n + j] = vv[j * n + i];
+        }
+    }
+}
+
+// n x l matrix of independent standard normal entries, drawn by Box-Muller
+// from a 64-bit linear congruential generator so that a seed gives the same
+// matrix on every platform
+Matrix gaussian_matrix(int n, int l, unsigned long long seed) {
+    Matrix G(n, l);
+    double* g = G.data();
+    long long count = static_cast<long long>(n) * l;
+    unsigned long long state = seed ^ 0x9e3779b97f4a7c15ULL;
+    auto uniform = [&state]() {
+        state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+        // in (0, 1], so that the logarithm below is finite
+        return static_cast<double>((state >> 11) + 1) * 0x1.0p-53;
+    };
+    const double two_pi = 6.283185307179586476925286766559;
+    for (long long i = 0; i < count; i += 2) {
+        double radius = std::sqrt(-2.0 * std::log(uniform()));
+        double angle = two_pi * uniform();
+        g[i] = radius * std::cos(angle);
+        if (i + 1 < count) {
+            g[i + 1] = radius * std::sin(angle);
+        }
+    }
+    return G;
+}
+
+// replaces the m x l matrix Y, m >= l, by the first l columns of the Q of
+// its QR decomposition, an orthonormal basis of its range
+Matrix orthonormal_basis(Matrix Y) {
+    int m = Y.num_row();
+    int l = Y.num_col();
+    auto res = Decomposer::qr(std::move(Y));
+    Matrix Q(m, l);
+    double* q = Q.data();
+    for (int i = 0; i < l; i++) {
+        q[static_cast<long long>(i) * l + i] = 1;
+    }
+    apply_left_q(res.QR.data(), m, l, l, res.tau.data(), q, l, l);
+    return Q;
+}
+
+// the l x n product Q^T A of the m x l matrix Q and the block seen by A
+Matrix project_rows(const Matrix& Q, const MatrixView& A) {
+    int m = Q.num_row();
+    int l = Q.num_col();
+    int n = A.num_col();
+    Matrix qt(Q);
+    qt.transpose();
+    Matrix B(l, n);
+    internals::gemm::gemm(l, n, m, 1.0, qt.data(), m, &A.unchecked(0, 0),
+                          A.leading_dim(), 0.0, B.data(), n);
+    return B;
+}
+
+// the m x l product A X of the block seen by A and the n x l matrix X
+Matrix multiply_right(const MatrixView& A, const Matrix& X) {
+    int m = A.num_row();
+    int n = A.num_col();
+    int l = X.num_col();
+    Matrix Y(m, l);
+    internals::gemm::gemm(m, l, n, 1.0, &A.unchecked(0, 0), A.leading_dim(),
+                          X.data(), l, 0.0, Y.data(), l);
+    return Y;
+}
+
+// scales the rows and columns of the n x n matrix a by powers of two,
+// a = D^-1 a D, until every row has about the norm of the matching column
+// (Parlett and Reinsch). Eigenvalues are unchanged and computed more
+// accurately afterwards, an eigenvector y of the result gives D y of a.
+void balance(double* a, int n, double* scale) {
+    std::fill(scale, scale + n, 1.0);
+    bool converged = false;
+    while (!converged) {
+        converged = true;
+        for (int i = 0; i < n; i++) {
+            double* row = row_of(a, n, i);
+            double c = 0;
+            double r = 0;
+            for (int j = 0; j < n; j++) {
+                if (j != i) {
+                    c += std::abs(a[static_cast<long long>(j) * n + i]);
+                    r += std::abs(row[j]);
+                }
+            }
+            if (c == 0 || r == 0) {
+                continue;
+            }
 
-            if (internals::mathutils::nearly_equal(current_val, 0.0)) {
-                continue; // it is already eliminated
+            double sum = c + r;
+            double f = 1;
+            while (c < r / 2) {
+                f *= 2;
+                c *= 4;
+            }
+            while (c > r * 2) {
+                f /= 2;
+                c /= 4;
+            }
+            if ((c + r) / f >= 0.95 * sum) {
+                continue;
+            }
+            converged = false;
+            scale[i] *= f;
+            for (int j = 0; j < n; j++) {
+                row[j] /= f;
+                a[static_cast<long long>(j) * n + i] *= f;
             }
+        }
+    }
+}
 
-            double pivot = U(x, x);
-            double pivot_factor = current_val / pivot;
+// copies a square matrix, balances it and reduces it to upper Hessenberg
+// form with everything below the subdiagonal cleared. When q is given it
+// receives the Q of the reduction.
+Matrix reduce_general(const MatrixView& A, std::vector<double>& scale,
+                      Matrix* q) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+
+    int n = A.num_row();
+    Matrix H(A);
+    double* h = H.data();
+    scale.assign(n, 1.0);
+    balance(h, n, scale.data());
 
-            U(y, x) = 0; // eliminated
+    std::vector<double> tau(n, 0.0);
+    internals::hessenberg::reduce(h, n, tau.data());
+    if (q != nullptr) {
+        double* z = q->data();
+        for (int i = 0; i < n; i++) {
+            z[static_cast<long long>(i) * n + i] = 1;
+        }
+        apply_tridiagonal_q(h, n, tau.data(), z, n);
+    }
+    for (int i = 2; i < n; i++) {
+        std::fill(row_of(h, n, i), row_of(h, n, i) + i - 1, 0.0);
+    }
+    return H;
+}
 
-            // update rest of the values in the row
-            for (int i = x + 1; i < m; i++) {
-                // r2 = r2 - f * r1  (where f = current_val / pivot )
+} // namespace
 
-                U(y, i) = U(y, i) - pivot_factor * U(x, i);
+TriangularMatrix Decomposer::LUResult::lower() const {
+    return TriangularMatrix(LU, Triangle::lower, true);
+}
+
+TriangularMatrix Decomposer::LUResult::upper() const {
+    return TriangularMatrix(LU, Triangle::upper);
+}
+
+TriangularMatrix Decomposer::QRResult::upper() const {
+    int n = QR.num_col();
+    if (QR.num_row() < n) {
+        throw astra::internals::exceptions::invalid_argument();
+    }
+    return TriangularMatrix(QR.block(0, 0, n - 1, n - 1), Triangle::upper);
+}
+
+Decomposer::PLUResult Decomposer::palu(const Matrix& A) {
+    return palu(MatrixView(A));
+}
+
+Decomposer::PLUResult Decomposer::palu(const MatrixView& A) {
+    LUResult lu_res = lu(A);
+    int m = lu_res.LU.num_row();
+
+    // expand the compact result into the explicit P, L and U
+    Matrix P = Matrix::identity(m);
+    Matrix L = Matrix::identity(m);
+    Matrix U(m, m);
+
+    for (int x = 0; x < m; x++) {
+        if (lu_res.pivots[x] != x) {
+            P.row_swap(x, lu_res.pivots[x]);
+        }
+    }
+
+    const double* lu_values = lu_res.LU.data();
+    double* l = L.data();
+    double* u = U.data();
+    for (int y = 0; y < m; y++) {
+        for (int x = 0; x < m; x++) {
+            double value = lu_values[y * m + x];
+            if (x < y) {
+                l[y * m + x] = value;
+            }
+            else {
+                u[y * m + x] = value;
+            }
+        }
+    }
+
+    return PLUResult(std::move(P), std::move(L), std::move(U),
+                     lu_res.swaps);
+}
+
+Decomposer::LUResult Decomposer::lu(const Matrix& A) {
+    return lu(MatrixView(A));
+}
 
-                if (internals::mathutils::nearly_equal(U(y, i), 0.0)) {
-                    U(y, i) = 0;
+Decomposer::LUResult Decomposer::lu(const MatrixView& A) {
+    // matrix is not square
+    if (A.num_row() != A.num_col()) {
+        throw astra::internals::exceptions::non_square_matrix();
+    }
+    return lu(Matrix(A));
+}
+
+Decomposer::LUResult Decomposer::lu(Matrix&& A) {
+    int n = A.num_row();
+
+    // matrix is not square
+    if (n != A.num_col()) {
+        throw astra::internals::exceptions::non_square_matrix();
+    }
+
+    std::vector<int> pivots(n);
+    double* a = A.data();
+    int swaps = 0;
+
+    for (int j0 = 0; j0 < n; j0 += LU_BLOCK) {
+        int nb = (n - j0 < LU_BLOCK) ? n - j0 : LU_BLOCK;
+        swaps += factor_panel(a, n, j0, nb, pivots.data());
+
+        int c0 = j0 + nb;
+        if (c0 < n) {
+            // U12 = L11^-1 * A12, then A22 = A22 - L21 * U12
+            solve_panel_rows(a, n, j0, nb);
+            internals::gemm::gemm(n - c0, n - c0, nb, -1.0,
+                                  row_of(a, n, c0) + j0, n,
+                                  row_of(a, n, j0) + c0, n, 1.0,
+                                  row_of(a, n, c0) + c0, n);
+        }
+    }
+
+    return LUResult(std::move(A), std::move(pivots), swaps);
+}
+
+Matrix Decomposer::cholesky(const Matrix& A) {
+    return cholesky(MatrixView(A));
+}
+
+Matrix Decomposer::cholesky(const MatrixView& A) {
+    if (A.num_row() != A.num_col()) {
+        throw astra::internals::exceptions::non_square_matrix();
+    }
+    if (!A.is_symmetric()) {
+        throw astra::internals::exceptions::non_symmetric_matrix();
+    }
+
+    int n = A.num_row();
+    Matrix L(A);
+    double* a = L.data();
+
+    for (int j0 = 0; j0 < n; j0 += CHOLESKY_BLOCK) {
+        int nb = (n - j0 < CHOLESKY_BLOCK) ? n - j0 : CHOLESKY_BLOCK;
+        int c0 = j0 + nb;
+        factor_diagonal_block(a, n, j0, nb);
+        if (c0 == n) {
+            break;
+        }
+
+        // L21 = A21 * L11^-T, then A22 = A22 - L21 * L21^T on the lower
+        // triangle. L21^T is packed once so that each block of rows of A22
+        // is a single product, the few products above the diagonal in the
+        // diagonal blocks land in the upper triangle, which is cleared below
+        solve_below_block(a, n, j0, nb);
+
+        int m = n - c0;
+        std::vector<double> l21t(static_cast<size_t>(nb) * m);
+        for (int i = 0; i < m; i++) {
+            const double* row = row_of(a, n, c0 + i) + j0;
+            for (int k = 0; k < nb; k++) {
+                l21t[static_cast<size_t>(k) * m + i] = row[k];
+            }
+        }
+        for (int i0 = c0; i0 < n; i0 += CHOLESKY_BLOCK) {
+            int i1 = (n - i0 < CHOLESKY_BLOCK) ? n : i0 + CHOLESKY_BLOCK;
+            internals::gemm::gemm(i1 - i0, i1 - c0, nb, -1.0,
+                                  row_of(a, n, i0) + j0, n, l21t.data(), m,
+                                  1.0, row_of(a, n, i0) + c0, n);
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        double* row = row_of(a, n, i);
+        for (int j = i + 1; j < n; j++) {
+            row[j] = 0;
+        }
+    }
+    return L;
+}
+
+TriangularMatrix Decomposer::cholesky(const SymmetricMatrix& A) {
+    int n = A.num_row();
+    TriangularMatrix L(n, Triangle::lower);
+    double* l = L.data();
+    std::copy(A.data(), A.data() + static_cast<size_t>(n) * (n + 1) / 2, l);
+
+    // row i starts at i * (i + 1) / 2, rows 0 .. i - 1 are already final
+    for (int i = 0; i < n; i++) {
+        double* row_i = l + static_cast<long long>(i) * (i + 1) / 2;
+        for (int j = 0; j < i; j++) {
+            const double* row_j = l + static_cast<long long>(j) * (j + 1) / 2;
+            row_i[j] = (row_i[j] - internals::simd::dot(row_i, row_j, j)) /
+                       row_j[j];
+        }
+        double d = row_i[i] - internals::simd::dot(row_i, row_i, i);
+        if (!(d > 0)) {
+            throw astra::internals::exceptions::not_positive_definite();
+        }
+        row_i[i] = std::sqrt(d);
+    }
+    return L;
+}
+
+Decomposer::LDLTResult Decomposer::ldlt(const Matrix& A) {
+    return ldlt(MatrixView(A));
+}
+
+Decomposer::LDLTResult Decomposer::ldlt(const MatrixView& A) {
+    if (A.num_row() != A.num_col()) {
+        throw astra::internals::exceptions::non_square_matrix();
+    }
+    if (!A.is_symmetric()) {
+        throw astra::internals::exceptions::non_symmetric_matrix();
+    }
+
+    int n = A.num_row();
+    // the lower triangle of the working copy holds the trailing matrix and,
+    // left of the current column, the multipliers of L
+    Matrix W(A);
+    double* a = W.data();
+    Matrix D(n, n);
+    double* d = D.data();
+    std::vector<int> perm(n);
+    for (int i = 0; i < n; i++) {
+        perm[i] = i;
+    }
+
+    // the pivot columns before they are overwritten by the multipliers
+    std::vector<double> w0(n), w1(n);
+
+    int k = 0;
+    while (k < n) {
+        double diag = internals::mathutils::abs(row_of(a, n, k)[k]);
+        int r = k;
+        double colmax = 0;
+        for (int i = k + 1; i < n; i++) {
+            double value = internals::mathutils::abs(row_of(a, n, i)[k]);
+            if (value > colmax) {
+                colmax = value;
+                r = i;
+            }
+        }
+
+        if (internals::mathutils::nearly_equal(
+                internals::mathutils::fmax(diag, colmax), 0.0)) {
+            // nothing left to eliminate in this column
+            for (int i = k; i < n; i++) {
+                row_of(a, n, i)[k] = 0;
+            }
+            k++;
+            continue;
+        }
+
+        int step = 1;
+        if (diag < BK_ALPHA * colmax) {
+            // largest off-diagonal value in row and column r
+            double rowmax = 0;
+            const double* rr = row_of(a, n, r);
+            for (int j = k; j < r; j++) {
+                rowmax = internals::mathutils::fmax(
+                    rowmax, internals::mathutils::abs(rr[j]));
+            }
+            for (int i = r + 1; i < n; i++) {
+                rowmax = internals::mathutils::fmax(
+                    rowmax, internals::mathutils::abs(row_of(a, n, i)[r]));
+            }
+
+            if (diag * rowmax >= BK_ALPHA * colmax * colmax) {
+                // the diagonal is still a safe 1x1 pivot
+            }
+            else if (internals::mathutils::abs(rr[r]) >= BK_ALPHA * rowmax) {
+                symmetric_swap(a, n, k, r);
+                internals::utils::swap(perm[k], perm[r]);
+            }
+            else {
+                step = 2;
+                if (r != k + 1) {
+                    symmetric_swap(a, n, k + 1, r);
+                    internals::utils::swap(perm[k + 1], perm[r]);
+                }
+            }
+        }
+
+        if (step == 1) {
+            double pivot = row_of(a, n, k)[k];
+            d[k * n + k] = pivot;
+            for (int i = k + 1; i < n; i++) {
+                double* row = row_of(a, n, i);
+                w0[i] = row[k];
+                row[k] /= pivot;
+            }
+
+            // A22 = A22 - w * w^T / pivot on the lower triangle
+            for (int i = k + 1; i < n; i++) {
+                double* row = row_of(a, n, i);
+                double factor = row[k];
+                if (factor == 0) {
+                    continue;
+                }
+                for (int j = k + 1; j <= i; j++) {
+                    row[j] -= factor * w0[j];
+                }
+            }
+        }
+        else {
+            double d11 = row_of(a, n, k)[k];
+            double d21 = row_of(a, n, k + 1)[k];
+            double d22 = row_of(a, n, k + 1)[k + 1];
+            double det = d11 * d22 - d21 * d21;
+            d[k * n + k] = d11;
+            d[k * n + k + 1] = d21;
+            d[(k + 1) * n + k] = d21;
+            d[(k + 1) * n + k + 1] = d22;
+            row_of(a, n, k + 1)[k] = 0;
+
+            // [l0 l1] = [w0 w1] * D^-1 for every row below the block
+            for (int i = k + 2; i < n; i++) {
+                double* row = row_of(a, n, i);
+                w0[i] = row[k];
+                w1[i] = row[k + 1];
+                row[k] = (w0[i] * d22 - w1[i] * d21) / det;
+                row[k + 1] = (w1[i] * d11 - w0[i] * d21) / det;
+            }
+
+            // A22 = A22 - L2 * [w0 w1]^T on the lower triangle
+            for (int i = k + 2; i < n; i++) {
+                double* row = row_of(a, n, i);
+                double l0 = row[k];
+                double l1 = row[k + 1];
+                for (int j = k + 2; j <= i; j++) {
+                    row[j] -= l0 * w0[j] + l1 * w1[j];
                 }
             }
+        }
+        k += step;
+    }
+
+    // the unit lower triangle of L is what remains left of the diagonal
+    for (int i = 0; i < n; i++) {
+        double* row = row_of(a, n, i);
+        row[i] = 1;
+        for (int j = i + 1; j < n; j++) {
+            row[j] = 0;
+        }
+    }
+    return LDLTResult(std::move(W), std::move(D), std::move(perm));
+}
+
+Decomposer::QRResult Decomposer::qr(const Matrix& A) {
+    return qr(MatrixView(A));
+}
+
+Decomposer::QRResult Decomposer::qr(const MatrixView& A) {
+    return qr(Matrix(A));
+}
+
+Decomposer::QRResult Decomposer::qr(Matrix&& A) {
+    int m = A.num_row();
+    int n = A.num_col();
+    int p = (m < n) ? m : n;
+    std::vector<double> tau(p);
+    double* a = A.data();
+
+    for (int j0 = 0; j0 < p; j0 += QR_BLOCK) {
+        int nb = (p - j0 < QR_BLOCK) ? p - j0 : QR_BLOCK;
+        factor_qr_panel(a, m, n, j0, nb, tau.data());
+        if (j0 + nb < n) {
+            // Q_panel^T applied to the trailing columns
+            internals::householder::apply_block(a + j0, n, j0, m, nb,
+                                                tau.data() + j0, true,
+                                                a + j0 + nb, n, n - j0 - nb);
+        }
+    }
+
+    return QRResult(std::move(A), std::move(tau));
+}
+
+Decomposer::EighResult Decomposer::eigh(const Matrix& A) {
+    return eigh(MatrixView(A));
+}
+
+Decomposer::EighResult Decomposer::eigh(const MatrixView& A) {
+    std::vector<double> d;
+    std::vector<double> e;
+    std::vector<double> tau;
+    Matrix reduced = reduce_symmetric(A, d, e, tau);
+    int n = A.num_row();
+
+    Matrix vectors(n, n);
+    internals::tridiagonal::divide_and_conquer(d.data(), e.data(), n,
+                                               vectors.data(), n);
+    apply_tridiagonal_q(reduced.data(), n, tau.data(), vectors.data(), n);
+
+    Vector values(n);
+    std::copy(d.begin(), d.end(), values.data());
+    return EighResult(std::move(values), std::move(vectors));
+}
+
+Decomposer::EighResult Decomposer::eigh(const Matrix& A, int k) {
+    return eigh(MatrixView(A), k);
+}
+
+Decomposer::EighResult Decomposer::eigh(const MatrixView& A, int k) {
+    if (k < 1 || k > A.num_row()) {
+        throw internals::exceptions::invalid_argument();
+    }
+    if (k == A.num_row()) {
+        return eigh(A);
+    }
+
+    std::vector<double> d;
+    std::vector<double> e;
+    std::vector<double> tau;
+    Matrix reduced = reduce_symmetric(A, d, e, tau);
+    int n = A.num_row();
+
+    Vector values(k);
+    internals::tridiagonal::bisect(d.data(), e.data(), n, n - k, n,
+                                   values.data());
+    Matrix vectors(n, k);
+    internals::tridiagonal::inverse_iteration(d.data(), e.data(), n,
+                                              values.data(), k,
+                                              vectors.data(), k);
+    apply_tridiagonal_q(reduced.data(), n, tau.data(), vectors.data(), k);
+    return EighResult(std::move(values), std::move(vectors));
+}
+
+Vector Decomposer::eigvalsh(const Matrix& A) {
+    return eigvalsh(MatrixView(A));
+}
+
+Vector Decomposer::eigvalsh(const MatrixView& A) {
+    std::vector<double> d;
+    std::vector<double> e;
+    std::vector<double> tau;
+    reduce_symmetric(A, d, e, tau);
+    int n = A.num_row();
+
+    internals::tridiagonal::ql(d.data(), e.data(), n, nullptr, 0);
+    Vector values(n);
+    std::copy(d.begin(), d.end(), values.data());
+    return values;
+}
+
+Decomposer::SVDResult Decomposer::svd(const Matrix& A, bool full_matrices) {
+    return svd(MatrixView(A), full_matrices);
+}
+
+Decomposer::SVDResult Decomposer::svd(const MatrixView& A,
+                                      bool full_matrices) {
+    // a wide A is handled through A^T = V S U^T
+    bool wide = A.num_row() < A.num_col();
+    Matrix W(A);
+    if (wide) {
+        W.transpose();
+    }
+    int m = W.num_row();
+    int n = W.num_col();
+    int ucols = full_matrices ? m : n;
+
+    Matrix U(m, ucols);
+    Vector S(n);
+    Matrix VT(n, n);
+    tall_svd(std::move(W), S.data(), U.data(), ucols, VT.data());
+    if (!wide) {
+        return SVDResult(std::move(U), std::move(S), std::move(VT));
+    }
+    U.transpose();
+    VT.transpose();
+    return SVDResult(std::move(VT), std::move(S), std::move(U));
+}
+
+Vector Decomposer::singular_values(const Matrix& A) {
+    return singular_values(MatrixView(A));
+}
+
+Vector Decomposer::singular_values(const MatrixView& A) {
+    Matrix W(A);
+    if (W.num_row() < W.num_col()) {
+        W.transpose();
+    }
+    Vector S(W.num_col());
+    tall_svd(std::move(W), S.data(), nullptr, 0, nullptr);
+    return S;
+}
+
+Decomposer::SVDResult Decomposer::randomized_svd(const Matrix& A, int k,
+                                                 int oversample,
+                                                 int power_iters,
+                                                 unsigned long long seed) {
+    return randomized_svd(MatrixView(A), k, oversample, power_iters, seed);
+}
+
+Decomposer::SVDResult Decomposer::randomized_svd(const MatrixView& A, int k,
+                                                 int oversample,
+                                                 int power_iters,
+                                                 unsigned long long seed) {
+    int m = A.num_row();
+    int n = A.num_col();
+    int p = (m < n) ? m : n;
+    if (k < 1 || k > p || oversample < 0 || power_iters < 0) {
+        throw internals::exceptions::invalid_argument();
+    }
+    int l = (oversample > p - k) ? p : k + oversample;
+
+    // Q spans the range of A Omega, each power iteration replaces it by
+    // the range of (A A^T) Q, re-orthonormalized at both half steps so that
+    // the small singular values are not lost to rounding
+    Matrix omega = gaussian_matrix(n, l, seed);
+    Matrix Q = orthonormal_basis(multiply_right(A, omega));
+    for (int it = 0; it < power_iters; it++) {
+        Matrix Z = project_rows(Q, A);
+        Z.transpose();
+        Matrix basis = orthonormal_basis(std::move(Z));
+        Q = orthonormal_basis(multiply_right(A, basis));
+    }
+
+    // A ~ Q Q^T A = (Q U_B) S V^T with the l x n B = Q^T A
+    auto small = svd(project_rows(Q, A));
+    Matrix U(m, k);
+    internals::gemm::gemm(m, k, l, 1.0, Q.data(), l, small.U.data(), l, 0.0,
+                          U.data(), k);
+    Vector S(k);
+    std::copy(small.S.data(), small.S.data() + k, S.data());
+    Matrix VT(k, n);
+    std::copy(small.VT.data(), small.VT.data() + static_cast<long long>(k) * n,
+              VT.data());
+    return SVDResult(std::move(U), std::move(S), std::move(VT));
+}
+Decomposer::EigResult Decomposer::eig(const Matrix& A) {
+    return eig(MatrixView(A));
+}
+
+Decomposer::EigResult Decomposer::eig(const MatrixView& A) {
+    int n = A.num_row();
+    std::vector<double> scale;
+    Matrix Z(n, n);
+    Matrix T = reduce_general(A, scale, &Z);
+
+    std::vector<double> wr(n);
+    std::vector<double> wi(n);
+    internals::hessenberg::schur(T.data(), n, n, Z.data(), n, wr.data(),
+                                 wi.data());
+
+    // the vectors of T mapped back by Z and the balancing
+    Matrix Y(n, n);
+    internals::hessenberg::eigenvectors(T.data(), n, n, Y.data(), n);
+    Matrix X(n, n);
+    internals::gemm::gemm(n, n, n, 1.0, Z.data(), n, Y.data(), n, 0.0,
+                          X.data(), n);
+    double* x = X.data();
+    for (int i = 0; i < n; i++) {
+        double* row = row_of(x, n, i);
+        for (int j = 0; j < n; j++) {
+            row[j] *= scale[i];
+        }
+    }
+
+    VectorC values(n);
+    MatrixC vectors(n, n);
+    std::complex<double>* vec = vectors.data();
+    for (int j = 0; j < n; j++) {
+        if (wi[j] == 0) {
+            values[j] = wr[j];
+            double norm = 0;
+            for (int i = 0; i < n; i++) {
+                double value = x[static_cast<long long>(i) * n + j];
+                norm += value * value;
+            }
+            norm = std::sqrt(norm);
+            for (int i = 0; i < n; i++) {
+                vec[static_cast<long long>(i) * n + j] =
+                    x[static_cast<long long>(i) * n + j] / norm;
+            }
+            continue;
+        }
 
-            // put the pivot factor in appropriate position of L
-            L(y, x) = pivot_factor;
+        // columns j and j + 1 hold the real and imaginary parts of the
+        // vector of wr + i wi, its conjugate belongs to wr - i wi
+        values[j] = std::complex<double>(wr[j], wi[j]);
+        values[j + 1] = std::complex<double>(wr[j + 1], wi[j + 1]);
+        double norm = 0;
+        for (int i = 0; i < n; i++) {
+            const double* row = row_of(x, n, i);
+            norm += row[j] * row[j] + row[j + 1] * row[j + 1];
+        }
+        norm = std::sqrt(norm);
+        for (int i = 0; i < n; i++) {
+            const double* row = row_of(x, n, i);
+            std::complex<double> value(row[j] / norm, row[j + 1] / norm);
+            vec[static_cast<long long>(i) * n + j] = value;
+            vec[static_cast<long long>(i) * n + j + 1] = std::conj(value);
         }
+        j++;
     }
+    return EigResult(std::move(values), std::move(vectors));
+}
 
-    return PLUResult(P, L, U, swaps);
+VectorC Decomposer::eigvals(const Matrix& A) { return eigvals(MatrixView(A)); }
+
+VectorC Decomposer::eigvals(const MatrixView& A) {
+    int n = A.num_row();
+    std::vector<double> scale;
+    Matrix H = reduce_general(A, scale, nullptr);
+
+    std::vector<double> wr(n);
+    std::vector<double> wi(n);
+    internals::hessenberg::schur(H.data(), n, n, nullptr, 0, wr.data(),
+                                 wi.data());
+    VectorC values(n);
+    for (int i = 0; i < n; i++) {
+        values[i] = std::complex<double>(wr[i], wi[i]);
+    }
+    return values;
 }
 } // namespace astra
@@ -0,0 +1,116 @@
+#include "pch.h"
+
+#include "../internals/Fft.h"
+
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace astra::internals::fft {
+
+namespace {
+
+const double PI = 3.14159265358979323846;
+
+// forward radix-2 transform of a power of two n, the twiddle factors are
+// computed once as exp(-2 pi i j / n) and strided for the shorter stages
+void radix2(std::complex<double>* a, int n) {
+    for (int i = 1, j = 0; i < n; i++) {
+        int bit = n >> 1;
+        for (; j & bit; bit >>= 1) {
+            j ^= bit;
+        }
+        j ^= bit;
+        if (i < j) {
+            std::swap(a[i], a[j]);
+        }
+    }
+
+    std::vector<std::complex<double>> twiddle(n / 2);
+    for (int j = 0; j < n / 2; j++) {
+        twiddle[j] = std::polar(1.0, -2 * PI * j / n);
+    }
+    for (int len = 2; len <= n; len <<= 1) {
+        int half = len / 2;
+        int stride = n / len;
+        for (int start = 0; start < n; start += len) {
+            for (int j = 0; j < half; j++) {
+                std::complex<double> u = a[start + j];
+                std::complex<double> v = a[start + j + half] *
+                                         twiddle[static_cast<size_t>(j) *
+                                                 stride];
+                a[start + j] = u + v;
+                a[start + j + half] = u - v;
+            }
+        }
+    }
+}
+
+// forward transform of any n: with jk = (j^2 + k^2 - (k - j)^2) / 2 the
+// sum becomes the convolution of a[j] w[j] with conj(w), w[j] =
+// exp(-pi i j^2 / n), done by power of two transforms
+void bluestein(std::complex<double>* a, int n) {
+    int m = next_power_of_two(2 * n - 1);
+    std::vector<std::complex<double>> w(n);
+    for (int j = 0; j < n; j++) {
+        // j^2 mod 2n keeps the angle small and exact
+        long long sq = static_cast<long long>(j) * j % (2LL * n);
+        w[j] = std::polar(1.0, -PI * static_cast<double>(sq) / n);
+    }
+
+    std::vector<std::complex<double>> x(m, 0.0);
+    std::vector<std::complex<double>> y(m, 0.0);
+    for (int j = 0; j < n; j++) {
+        x[j] = a[j] * w[j];
+    }
+    y[0] = std::conj(w[0]);
+    for (int j = 1; j < n; j++) {
+        y[j] = std::conj(w[j]);
+        y[m - j] = y[j];
+    }
+    radix2(x.data(), m);
+    radix2(y.data(), m);
+    for (int k = 0; k < m; k++) {
+        // the inverse transform of the product, as conj(F(conj(.))) / m
+        x[k] = std::conj(x[k] * y[k]);
+    }
+    radix2(x.data(), m);
+    for (int k = 0; k < n; k++) {
+        a[k] = w[k] * std::conj(x[k]) / static_cast<double>(m);
+    }
+}
+
+} // namespace
+
+int next_power_of_two(int n) {
+    int m = 1;
+    while (m < n) {
+        m <<= 1;
+    }
+    return m;
+}
+
+void transform(std::complex<double>* a, int n, bool inverse) {
+    if (n <= 1) {
+        return;
+    }
+    // the inverse is conj(F(conj(a))) / n
+    if (inverse) {
+        for (int k = 0; k < n; k++) {
+            a[k] = std::conj(a[k]);
+        }
+    }
+    if ((n & (n - 1)) == 0) {
+        radix2(a, n);
+    }
+    else {
+        bluestein(a, n);
+    }
+    if (inverse) {
+        for (int k = 0; k < n; k++) {
+            a[k] = std::conj(a[k]) / static_cast<double>(n);
+        }
+    }
+}
+
+} // namespace astra::internals::fft
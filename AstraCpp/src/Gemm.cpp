@@ -0,0 +1,253 @@
+#include "pch.h"
+
+#include "../internals/Gemm.h"
+#include "../internals/Memory.h"
+#include "../internals/Simd.h"
+#include "../internals/ThreadPool.h"
+
+#include <complex>
+#include <type_traits>
+
+namespace astra::internals::gemm {
+
+namespace {
+
+inline int min_int(int a, int b) { return (a < b) ? a : b; }
+
+// scales C by beta; beta == 0 overwrites C so that garbage is never read
+template <typename T>
+void scale_c(int m, int n, T beta, T* C, int ldc) {
+    if (beta == T(1)) {
+        return;
+    }
+    for (int i = 0; i < m; ++i) {
+        T* c_row = C + static_cast<long long>(i) * ldc;
+        if (beta == T(0)) {
+            for (int j = 0; j < n; ++j) {
+                c_row[j] = T(0);
+            }
+        }
+        else {
+            for (int j = 0; j < n; ++j) {
+                c_row[j] *= beta;
+            }
+        }
+    }
+}
+
+// straightforward i-k-j product for small sizes, the inner loop walks
+// both B and C with unit stride
+template <typename T>
+void small_gemm(int m, int n, int k, T alpha, const T* A, int lda,
+                const T* B, int ldb, T* C, int ldc) {
+    for (int i = 0; i < m; ++i) {
+        T* c_row = C + static_cast<long long>(i) * ldc;
+        const T* a_row = A + static_cast<long long>(i) * lda;
+        for (int p = 0; p < k; ++p) {
+            T a_ip = alpha * a_row[p];
+            const T* b_row = B + static_cast<long long>(p) * ldb;
+            for (int j = 0; j < n; ++j) {
+                c_row[j] += a_ip * b_row[j];
+            }
+        }
+    }
+}
+
+// copies an mc x kc block of A into row panels of height mr, each panel
+// stored column by column so the micro-kernel reads it sequentially
+// rows past mc are zero padded
+template <typename T>
+void pack_a(int mc, int kc, const T* A, int lda, T* dst, int mr) {
+    for (int ir = 0; ir < mc; ir += mr) {
+        int rows = min_int(mr, mc - ir);
+        const T* a_panel = A + static_cast<long long>(ir) * lda;
+
+        for (int p = 0; p < kc; ++p) {
+            for (int i = 0; i < rows; ++i) {
+                dst[i] = a_panel[static_cast<long long>(i) * lda + p];
+            }
+            for (int i = rows; i < mr; ++i) {
+                dst[i] = T(0);
+            }
+            dst += mr;
+        }
+    }
+}
+
+// copies a kc x nc block of B into column panels of width nr, each panel
+// stored row by row, columns past nc are zero padded
+template <typename T>
+void pack_b(int kc, int nc, const T* B, int ldb, T* dst, int nr) {
+    for (int jr = 0; jr < nc; jr += nr) {
+        int cols = min_int(nr, nc - jr);
+
+        for (int p = 0; p < kc; ++p) {
+            const T* b_row = B + static_cast<long long>(p) * ldb + jr;
+            for (int j = 0; j < cols; ++j) {
+                dst[j] = b_row[j];
+            }
+            for (int j = cols; j < nr; ++j) {
+                dst[j] = T(0);
+            }
+            dst += nr;
+        }
+    }
+}
+
+// portable micro-kernel for the complex types, computes an MR x NR tile of
+// alpha * A_panel * B_panel and adds it into C
+// only the top-left mr x nr part is written back for edge tiles
+template <typename T>
+void micro_kernel(int kc, T alpha, const T* a, const T* b,
+                  T* C, int ldc, int mr, int nr) {
+    T acc[MR][NR] = {};
+
+    for (int p = 0; p < kc; ++p) {
+        for (int i = 0; i < MR; ++i) {
+            T a_ip = a[i];
+            for (int j = 0; j < NR; ++j) {
+                acc[i][j] += a_ip * b[j];
+            }
+        }
+        a += MR;
+        b += NR;
+    }
+
+    if (mr == MR && nr == NR) {
+        for (int i = 0; i < MR; ++i) {
+            T* c_row = C + static_cast<long long>(i) * ldc;
+            for (int j = 0; j < NR; ++j) {
+                c_row[j] += alpha * acc[i][j];
+            }
+        }
+    }
+    else {
+        for (int i = 0; i < mr; ++i) {
+            T* c_row = C + static_cast<long long>(i) * ldc;
+            for (int j = 0; j < nr; ++j) {
+                c_row[j] += alpha * acc[i][j];
+            }
+        }
+    }
+}
+
+// float and double use the SIMD micro-kernel of the active instruction set,
+// whose tile size depends on its register file
+template <typename T>
+simd::GemmKernel<T> kernel_for() {
+    if constexpr (std::is_same_v<T, double> || std::is_same_v<T, float>) {
+        return simd::gemm_kernel<T>();
+    }
+    else {
+        return {MR, NR, micro_kernel<T>};
+    }
+}
+
+// runs the micro-kernel over every tile of an mc x nc block of C
+template <typename T>
+void macro_kernel(const simd::GemmKernel<T>& kernel, int mc, int nc, int kc,
+                  T alpha, const T* a_pack, const T* b_pack, T* C, int ldc) {
+    for (int jr = 0; jr < nc; jr += kernel.nr) {
+        int nr = min_int(kernel.nr, nc - jr);
+        const T* b_panel = b_pack + static_cast<long long>(jr) * kc;
+
+        for (int ir = 0; ir < mc; ir += kernel.mr) {
+            int mr = min_int(kernel.mr, mc - ir);
+            const T* a_panel = a_pack + static_cast<long long>(ir) * kc;
+
+            kernel.run(kc, alpha, a_panel, b_panel,
+                       C + static_cast<long long>(ir) * ldc + jr, ldc, mr,
+                       nr);
+        }
+    }
+}
+} // namespace
+
+template <typename T>
+void gemm(int m, int n, int k, T alpha, const T* A, int lda, const T* B,
+          int ldb, T beta, T* C, int ldc) {
+    if (m <= 0 || n <= 0) {
+        return;
+    }
+
+    scale_c(m, n, beta, C, ldc);
+
+    if (k <= 0 || alpha == T(0)) {
+        return;
+    }
+
+    if (static_cast<long long>(m) * n * k <= SMALL_GEMM_FLOPS) {
+        small_gemm(m, n, k, alpha, A, lda, B, ldb, C, ldc);
+        return;
+    }
+
+    // read once, so the tile size stays fixed even if the instruction set
+    // is switched while the product runs
+    const simd::GemmKernel<T> kernel = kernel_for<T>();
+    const int mr = kernel.mr;
+    const int nr = kernel.nr;
+
+    // the A block holds whole panels
+    const int mc_max = MC / mr * mr;
+
+    // packed panels are padded to full mr / nr tiles
+    int nc_max = min_int(NC, n);
+    int kc_max = min_int(KC, k);
+    int b_pack_size = (nc_max + nr - 1) / nr * nr * kc_max;
+
+    T* b_pack = memory::allocate<T>(b_pack_size);
+
+    // rows are handed out to threads in whole mr panels, at least one MC
+    // block per thread
+    int row_panels = (m + mr - 1) / mr;
+
+    for (int jc = 0; jc < n; jc += NC) {
+        int nc = min_int(NC, n - jc);
+
+        for (int pc = 0; pc < k; pc += KC) {
+            int kc = min_int(KC, k - pc);
+
+            pack_b(kc, nc, B + static_cast<long long>(pc) * ldb + jc, ldb,
+                   b_pack, nr);
+
+            threading::parallel_for(
+                0, row_panels, mc_max / mr, [&](int lo, int hi) {
+                    int row_begin = lo * mr;
+                    int row_end = min_int(hi * mr, m);
+                    T* a_pack = memory::allocate<T>(mc_max * kc);
+
+                    for (int ic = row_begin; ic < row_end; ic += mc_max) {
+                        int mc = min_int(mc_max, row_end - ic);
+
+                        pack_a(mc, kc,
+                               A + static_cast<long long>(ic) * lda + pc, lda,
+                               a_pack, mr);
+
+                        macro_kernel(kernel, mc, nc, kc, alpha, a_pack,
+                                     b_pack,
+                                     C + static_cast<long long>(ic) * ldc +
+                                         jc,
+                                     ldc);
+                    }
+
+                    memory::deallocate(a_pack);
+                });
+        }
+    }
+
+    memory::deallocate(b_pack);
+}
+
+template void gemm<float>(int, int, int, float, const float*, int,
+                          const float*, int, float, float*, int);
+template void gemm<double>(int, int, int, double, const double*, int,
+                           const double*, int, double, double*, int);
+template void gemm<std::complex<float>>(
+    int, int, int, std::complex<float>, const std::complex<float>*, int,
+    const std::complex<float>*, int, std::complex<float>, std::complex<float>*,
+    int);
+template void gemm<std::complex<double>>(
+    int, int, int, std::complex<double>, const std::complex<double>*, int,
+    const std::complex<double>*, int, std::complex<double>,
+    std::complex<double>*, int);
+} // namespace astra::internals::gemm
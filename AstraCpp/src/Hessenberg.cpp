@@ -0,0 +1,791 @@
+#include "pch.h"
+
+#include "../internals/Exceptions.h"
+#include "../internals/Gemm.h"
+#include "../internals/Hessenberg.h"
+#include "../internals/Householder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <vector>
+
+namespace astra::internals::hessenberg {
+
+namespace {
+
+const double EPS = std::numeric_limits<double>::epsilon();
+
+// sweeps on an active block without a deflation before giving up
+const int MAX_SWEEPS = 100;
+
+// order of the deflation window is an eighth of the active block, within
+// these bounds
+const int AED_WINDOW_MIN = 16;
+const int AED_WINDOW_MAX = 96;
+
+// vector entries beyond this are scaled back during back substitution
+const double BIG = 1e100;
+
+inline double* row_of(double* a, int ld, int i) {
+    return a + static_cast<long long>(i) * ld;
+}
+
+inline const double* row_of(const double* a, int ld, int i) {
+    return a + static_cast<long long>(i) * ld;
+}
+
+// rows i and j of the columns c0 .. c1 - 1 of a become c * a_i + s * a_j
+// and c * a_j - s * a_i
+void rotate_rows(double* a, int ld, int i, int j, int c0, int c1, double c,
+                 double s) {
+    double* x = row_of(a, ld, i);
+    double* y = row_of(a, ld, j);
+    for (int col = c0; col < c1; col++) {
+        double xv = x[col];
+        double yv = y[col];
+        x[col] = c * xv + s * yv;
+        y[col] = c * yv - s * xv;
+    }
+}
+
+// columns i and j of the rows r0 .. r1 - 1 of a, as rotate_rows
+void rotate_columns(double* a, int ld, int i, int j, int r0, int r1,
+                    double c, double s) {
+    for (int r = r0; r < r1; r++) {
+        double* row = row_of(a, ld, r);
+        double xv = row[i];
+        double yv = row[j];
+        row[i] = c * xv + s * yv;
+        row[j] = c * yv - s * xv;
+    }
+}
+
+// applies I - tau * v * v^T from the left to the rows row0 .. row0 + count
+// - 1 of the columns c0 .. c1 - 1 of a, w is scratch for c1 - c0 entries
+void reflect_rows(double* a, int ld, int row0, int count, int c0, int c1,
+                  const double* v, double tau, double* w) {
+    int width = c1 - c0;
+    std::fill(w, w + width, 0.0);
+    for (int i = 0; i < count; i++) {
+        const double* row = row_of(a, ld, row0 + i) + c0;
+        for (int col = 0; col < width; col++) {
+            w[col] += v[i] * row[col];
+        }
+    }
+    for (int i = 0; i < count; i++) {
+        double* row = row_of(a, ld, row0 + i) + c0;
+        double factor = tau * v[i];
+        for (int col = 0; col < width; col++) {
+            row[col] -= factor * w[col];
+        }
+    }
+}
+
+// applies I - tau * v * v^T from the right to the columns col0 .. col0 +
+// count - 1 of the rows r0 .. r1 - 1 of a
+void reflect_columns(double* a, int ld, int col0, int count, int r0, int r1,
+                     const double* v, double tau) {
+    for (int r = r0; r < r1; r++) {
+        double* row = row_of(a, ld, r) + col0;
+        double dot = 0;
+        for (int i = 0; i < count; i++) {
+            dot += row[i] * v[i];
+        }
+        dot *= tau;
+        for (int i = 0; i < count; i++) {
+            row[i] -= dot * v[i];
+        }
+    }
+}
+
+// reduces the leading r x r block of the r x width block a to Hessenberg
+// form, the columns r .. width - 1 only take the left reflectors since the
+// rows below r are zero in the first r columns. Without q the reflectors
+// are left below the subdiagonal and their scales in tau, with q they are
+// accumulated into its first qrows rows instead and cleared.
+void reduce_block(double* a, int lda, int r, int width, double* tau,
+                  double* q, int ldq, int qrows) {
+    std::vector<double> v(r);
+    std::vector<double> w(width);
+    for (int k = 0; k + 2 < r; k++) {
+        int count = r - k - 1;
+        double* x = row_of(a, lda, k + 1) + k;
+        double scale;
+        double beta = householder::make_reflector(x, lda, count, scale);
+        if (tau != nullptr) {
+            tau[k] = scale;
+        }
+        if (scale == 0) {
+            continue;
+        }
+        x[0] = beta;
+        v[0] = 1;
+        for (int i = 1; i < count; i++) {
+            v[i] = x[static_cast<long long>(i) * lda];
+            if (q != nullptr) {
+                x[static_cast<long long>(i) * lda] = 0;
+            }
+        }
+
+        reflect_rows(a, lda, k + 1, count, k + 1, width, v.data(), scale,
+                     w.data());
+        reflect_columns(a, lda, k + 1, count, 0, r, v.data(), scale);
+        if (q != nullptr) {
+            reflect_columns(q, ldq, k + 1, count, 0, qrows, v.data(), scale);
+        }
+    }
+    if (tau != nullptr && r >= 2) {
+        tau[r - 2] = 0;
+    }
+}
+
+// Schur factorization of the 2 x 2 block [a b; c d] = G * [a' b'; c' d']
+// * G^T with the rotation G = [cs -sn; sn cs], the LAPACK dlanv2 scheme.
+// Real eigenvalues leave c' = 0, a complex pair leaves a' = d' and
+// b' * c' < 0. The block is overwritten by the standard form.
+void standardize(double& a, double& b, double& c, double& d, double& cs,
+                 double& sn) {
+    cs = 1;
+    sn = 0;
+    if (c == 0) {
+        return;
+    }
+    if (b == 0) {
+        // swap the rows and columns
+        cs = 0;
+        sn = 1;
+        std::swap(a, d);
+        b = -c;
+        c = 0;
+        return;
+    }
+    if (a - d == 0 && std::copysign(1.0, b) != std::copysign(1.0, c)) {
+        return;
+    }
+
+    double temp = a - d;
+    double p = temp / 2;
+    double bcmax = std::max(std::abs(b), std::abs(c));
+    double bcmis = std::min(std::abs(b), std::abs(c)) *
+                   std::copysign(1.0, b) * std::copysign(1.0, c);
+    double scale = std::max(std::abs(p), bcmax);
+    double z = (p / scale) * p + (bcmax / scale) * bcmis;
+
+    if (z >= 4 * EPS) {
+        // real eigenvalues
+        z = p + std::copysign(std::sqrt(scale) * std::sqrt(z), p);
+        a = d + z;
+        d = d - (bcmax / z) * bcmis;
+        double tau = std::hypot(c, z);
+        cs = z / tau;
+        sn = c / tau;
+        b = b - c;
+        c = 0;
+        return;
+    }
+
+    // complex or nearly equal real eigenvalues, make the diagonal equal
+    double sigma = b + c;
+    double tau = std::hypot(sigma, temp);
+    cs = std::sqrt((1 + std::abs(sigma) / tau) / 2);
+    sn = -(p / (tau * cs)) * std::copysign(1.0, sigma);
+
+    double aa = a * cs + b * sn;
+    double bb = -a * sn + b * cs;
+    double cc = c * cs + d * sn;
+    double dd = -c * sn + d * cs;
+    a = aa * cs + cc * sn;
+    b = bb * cs + dd * sn;
+    c = -aa * sn + cc * cs;
+    d = -bb * sn + dd * cs;
+
+    temp = (a + d) / 2;
+    a = temp;
+    d = temp;
+    if (c == 0) {
+        return;
+    }
+    if (b == 0) {
+        b = -c;
+        c = 0;
+        temp = cs;
+        cs = -sn;
+        sn = temp;
+        return;
+    }
+    if (std::copysign(1.0, b) == std::copysign(1.0, c)) {
+        // real after all, split the block
+        double sab = std::sqrt(std::abs(b));
+        double sac = std::sqrt(std::abs(c));
+        p = std::copysign(sab * sac, c);
+        tau = 1 / std::sqrt(std::abs(b + c));
+        a = temp + p;
+        d = temp - p;
+        b = b - c;
+        c = 0;
+        double cs1 = sab * tau;
+        double sn1 = sac * tau;
+        temp = cs * cs1 - sn * sn1;
+        sn = cs * sn1 + sn * cs1;
+        cs = temp;
+    }
+}
+
+// eigenvalues of the standardized 2 x 2 block at rows i, i + 1
+void block_eigenvalues(const double* h, int ldh, int i, double* wr,
+                       double* wi) {
+    double a = row_of(h, ldh, i)[i];
+    double b = row_of(h, ldh, i)[i + 1];
+    double c = row_of(h, ldh, i + 1)[i];
+    double d = row_of(h, ldh, i + 1)[i + 1];
+    wr[i] = a;
+    wr[i + 1] = d;
+    if (c == 0) {
+        wi[i] = 0;
+        wi[i + 1] = 0;
+    }
+    else {
+        wi[i] = std::sqrt(std::abs(b)) * std::sqrt(std::abs(c));
+        wi[i + 1] = -wi[i];
+    }
+}
+
+// whether h(k, k - 1) can be set to zero, the criterion of Ahues and
+// Kressner, which also compares the entry against its neighbours
+bool negligible(const double* h, int ldh, int n, int k, double smlnum) {
+    const double* row = row_of(h, ldh, k);
+    const double* above = row_of(h, ldh, k - 1);
+    double sub = std::abs(row[k - 1]);
+    if (sub <= smlnum) {
+        return true;
+    }
+    double tst = std::abs(above[k - 1]) + std::abs(row[k]);
+    if (tst == 0) {
+        if (k >= 2) {
+            tst += std::abs(above[k - 2]);
+        }
+        if (k + 1 < n) {
+            tst += std::abs(row_of(h, ldh, k + 1)[k]);
+        }
+    }
+    if (sub > EPS * tst) {
+        return false;
+    }
+    double ab = std::max(sub, std::abs(above[k]));
+    double ba = std::min(sub, std::abs(above[k]));
+    double diff = std::abs(above[k - 1] - row[k]);
+    double aa = std::max(std::abs(row[k]), diff);
+    double bb = std::min(std::abs(row[k]), diff);
+    double s = aa + ab;
+    return ba * (ab / s) <= std::max(smlnum, EPS * (bb * (aa / s)));
+}
+
+// step k of a double-shift sweep started at row m: the reflector that
+// moves the bulge from column k - 1 down one row, made from v when k = m.
+// It is applied to the rows k .. k + 2 of the columns up to c_end - 1 and
+// to the columns k .. k + 2 of the rows from r_first and of the first qrows
+// rows of q.
+void bulge_step(double* h, int ldh, int lo, int hi, int m, int k, double* v,
+                int r_first, int c_end, double* q, int ldq, int qrows) {
+    auto at = [h, ldh](int i, int j) -> double& {
+        return row_of(h, ldh, i)[j];
+    };
+
+    int nr = std::min(3, hi - k + 1);
+    if (k > m) {
+        for (int i = 0; i < nr; i++) {
+            v[i] = at(k + i, k - 1);
+        }
+    }
+    double t1;
+    double beta = householder::make_reflector(v, 1, nr, t1);
+    if (k > m) {
+        at(k, k - 1) = beta;
+        at(k + 1, k - 1) = 0;
+        if (k < hi - 1) {
+            at(k + 2, k - 1) = 0;
+        }
+    }
+    else if (m > lo) {
+        // rather than negating, which misbehaves when v underflows
+        at(k, k - 1) *= 1 - t1;
+    }
+    double v2 = v[1];
+    double t2 = t1 * v2;
+    int last = std::min(k + 3, hi);
+
+    if (nr == 3) {
+        double v3 = v[2];
+        double t3 = t1 * v3;
+        double* x = row_of(h, ldh, k);
+        double* y = row_of(h, ldh, k + 1);
+        double* w = row_of(h, ldh, k + 2);
+        for (int j = k; j < c_end; j++) {
+            double sum = x[j] + v2 * y[j] + v3 * w[j];
+            x[j] -= sum * t1;
+            y[j] -= sum * t2;
+            w[j] -= sum * t3;
+        }
+        for (int j = r_first; j <= last; j++) {
+            double* row = row_of(h, ldh, j) + k;
+            double sum = row[0] + v2 * row[1] + v3 * row[2];
+            row[0] -= sum * t1;
+            row[1] -= sum * t2;
+            row[2] -= sum * t3;
+        }
+        for (int j = 0; j < qrows; j++) {
+            double* row = row_of(q, ldq, j) + k;
+            double sum = row[0] + v2 * row[1] + v3 * row[2];
+            row[0] -= sum * t1;
+            row[1] -= sum * t2;
+            row[2] -= sum * t3;
+        }
+        return;
+    }
+
+    double* x = row_of(h, ldh, k);
+    double* y = row_of(h, ldh, k + 1);
+    for (int j = k; j < c_end; j++) {
+        double sum = x[j] + v2 * y[j];
+        x[j] -= sum * t1;
+        y[j] -= sum * t2;
+    }
+    for (int j = r_first; j <= last; j++) {
+        double* row = row_of(h, ldh, j) + k;
+        double sum = row[0] + v2 * row[1];
+        row[0] -= sum * t1;
+        row[1] -= sum * t2;
+    }
+    for (int j = 0; j < qrows; j++) {
+        double* row = row_of(q, ldq, j) + k;
+        double sum = row[0] + v2 * row[1];
+        row[0] -= sum * t1;
+        row[1] -= sum * t2;
+    }
+}
+
+// applies the orthogonal nw x nw matrix u, which transformed the diagonal
+// block of h at rows and columns w0 .. w0 + nw - 1, to the rest: u^T to
+// those rows in the columns up to c1 - 1, u to those columns in the rows
+// from r0 and to the same columns of the n x n block z if given
+void apply_window(double* h, int ldh, int n, int w0, int nw, int r0, int c1,
+                  double* z, int ldz, const double* u) {
+    int right = c1 - w0 - nw;
+    if (right > 0) {
+        std::vector<double> ut(static_cast<size_t>(nw) * nw);
+        for (int i = 0; i < nw; i++) {
+            for (int j = 0; j < nw; j++) {
+                ut[static_cast<size_t>(j) * nw + i] =
+                    u[static_cast<size_t>(i) * nw + j];
+            }
+        }
+        std::vector<double> out(static_cast<size_t>(nw) * right);
+        double* block = row_of(h, ldh, w0) + w0 + nw;
+        gemm::gemm(nw, right, nw, 1.0, ut.data(), nw, block, ldh, 0.0,
+                   out.data(), right);
+        for (int i = 0; i < nw; i++) {
+            std::copy(out.data() + static_cast<size_t>(i) * right,
+                      out.data() + static_cast<size_t>(i + 1) * right,
+                      row_of(h, ldh, w0 + i) + w0 + nw);
+        }
+    }
+
+    auto multiply_columns = [u, nw, w0](double* a, int lda, int rows) {
+        if (rows <= 0) {
+            return;
+        }
+        std::vector<double> out(static_cast<size_t>(rows) * nw);
+        gemm::gemm(rows, nw, nw, 1.0, a + w0, lda, u, nw, 0.0, out.data(),
+                   nw);
+        for (int i = 0; i < rows; i++) {
+            std::copy(out.data() + static_cast<size_t>(i) * nw,
+                      out.data() + static_cast<size_t>(i + 1) * nw,
+                      row_of(a, lda, i) + w0);
+        }
+    };
+    multiply_columns(row_of(h, ldh, r0), ldh, w0 - r0);
+    if (z != nullptr) {
+        multiply_columns(z, ldz, n);
+    }
+}
+
+// one implicit double-shift sweep over the active block lo .. hi, which has
+// at least three rows. Reflectors applied to rows reach the columns up to
+// c1 - 1, those applied to columns the rows from r0 and the n rows of z.
+void sweep(double* h, int ldh, int n, int lo, int hi, int r0, int c1,
+           double* z, int ldz, int its) {
+    auto at = [h, ldh](int i, int j) -> double& {
+        return row_of(h, ldh, i)[j];
+    };
+
+    // the shifts are the eigenvalues of the trailing 2 x 2 block, with an
+    // exceptional pair every tenth sweep to break cycles
+    double h11;
+    double h12;
+    double h21;
+    double h22;
+    if (its % 20 == 10) {
+        double s = std::abs(at(lo + 1, lo)) + std::abs(at(lo + 2, lo + 1));
+        h11 = 0.75 * s + at(lo, lo);
+        h12 = -0.4375 * s;
+        h21 = s;
+        h22 = h11;
+    }
+    else if (its % 20 == 0) {
+        double s = std::abs(at(hi, hi - 1)) + std::abs(at(hi - 1, hi - 2));
+        h11 = 0.75 * s + at(hi, hi);
+        h12 = -0.4375 * s;
+        h21 = s;
+        h22 = h11;
+    }
+    else {
+        h11 = at(hi - 1, hi - 1);
+        h12 = at(hi - 1, hi);
+        h21 = at(hi, hi - 1);
+        h22 = at(hi, hi);
+    }
+
+    double rt1r = 0;
+    double rt1i = 0;
+    double rt2r = 0;
+    double rt2i = 0;
+    double s = std::abs(h11) + std::abs(h12) + std::abs(h21) + std::abs(h22);
+    if (s != 0) {
+        h11 /= s;
+        h12 /= s;
+        h21 /= s;
+        h22 /= s;
+        double tr = (h11 + h22) / 2;
+        double det = (h11 - tr) * (h22 - tr) - h12 * h21;
+        double disc = std::sqrt(std::abs(det));
+        if (det >= 0) {
+            rt1r = tr * s;
+            rt2r = rt1r;
+            rt1i = disc * s;
+            rt2i = -rt1i;
+        }
+        else {
+            // two real shifts, both taken as the one nearer h22
+            double first = tr + disc;
+            double second = tr - disc;
+            double shift = (std::abs(first - h22) <= std::abs(second - h22))
+                               ? first
+                               : second;
+            rt1r = shift * s;
+            rt2r = rt1r;
+        }
+    }
+
+    // start the bulge at the lowest row m where two consecutive small
+    // subdiagonal entries make h(m, m - 1) negligible after the sweep
+    double v[3];
+    int m = hi - 2;
+    for (;; m--) {
+        double h21s = at(m + 1, m);
+        double scale = std::abs(at(m, m) - rt2r) + std::abs(rt2i) +
+                       std::abs(h21s);
+        h21s /= scale;
+        v[0] = h21s * at(m, m + 1) +
+               (at(m, m) - rt1r) * ((at(m, m) - rt2r) / scale) -
+               rt1i * (rt2i / scale);
+        v[1] = h21s * (at(m, m) + at(m + 1, m + 1) - rt1r - rt2r);
+        v[2] = h21s * at(m + 2, m + 1);
+        scale = std::abs(v[0]) + std::abs(v[1]) + std::abs(v[2]);
+        v[0] /= scale;
+        v[1] /= scale;
+        v[2] /= scale;
+        if (m == lo) {
+            break;
+        }
+        double h00 = std::abs(at(m, m - 1)) * (std::abs(v[1]) +
+                                               std::abs(v[2]));
+        double h01 = std::abs(v[0]) * (std::abs(at(m - 1, m - 1)) +
+                                       std::abs(at(m, m)) +
+                                       std::abs(at(m + 1, m + 1)));
+        if (h00 <= EPS * h01) {
+            break;
+        }
+    }
+
+    for (int k = m; k < hi; k++) {
+        bulge_step(h, ldh, lo, hi, m, k, v, r0, c1, z, ldz,
+                   (z != nullptr) ? n : 0);
+    }
+}
+
+// aggressive early deflation on the trailing window of nw rows of the
+// active block lo .. hi. The window is brought to Schur form, which turns
+// its coupling h(k0, k0 - 1) to the rest into the spike s * V(0, :), and
+// the trailing eigenvalues whose spike entries are negligible are
+// deflated. The rest of the window is returned to Hessenberg form, with a
+// reflector folding the remaining spike into its first entry, and the
+// window transformation is applied to the rest of h and to z. Returns the
+// number of deflated eigenvalues, whose values are stored.
+int deflate_window(double* h, int ldh, int n, int lo, int hi, int nw,
+                   int r0, int c1, double* z, int ldz, double smlnum,
+                   double* wr, double* wi) {
+    int k0 = hi - nw + 1;
+    double spike = (k0 > lo) ? row_of(h, ldh, k0)[k0 - 1] : 0.0;
+
+    std::vector<double> t(static_cast<size_t>(nw) * nw, 0.0);
+    std::vector<double> v(static_cast<size_t>(nw) * nw, 0.0);
+    std::vector<double> twr(nw);
+    std::vector<double> twi(nw);
+    for (int i = 0; i < nw; i++) {
+        const double* src = row_of(h, ldh, k0 + i) + k0;
+        double* dst = row_of(t.data(), nw, i);
+        for (int j = std::max(i - 1, 0); j < nw; j++) {
+            dst[j] = src[j];
+        }
+        v[static_cast<size_t>(i) * nw + i] = 1;
+    }
+    schur(t.data(), nw, nw, v.data(), nw, twr.data(), twi.data());
+
+    auto tt = [&t, nw](int i, int j) { return t[i * nw + j]; };
+    int deflated = 0;
+    int j = nw - 1;
+    while (j >= 0) {
+        bool pair = j > 0 && tt(j, j - 1) != 0;
+        double size;
+        double coupling = std::abs(spike * v[j]);
+        if (pair) {
+            size = std::abs(tt(j, j)) +
+                   std::sqrt(std::abs(tt(j, j - 1))) *
+                       std::sqrt(std::abs(tt(j - 1, j)));
+            coupling = std::max(coupling, std::abs(spike * v[j - 1]));
+        }
+        else {
+            size = std::abs(tt(j, j));
+        }
+        if (size == 0) {
+            size = std::abs(spike);
+        }
+        if (coupling > std::max(smlnum, EPS * size)) {
+            break;
+        }
+        deflated += pair ? 2 : 1;
+        j -= pair ? 2 : 1;
+    }
+    if (deflated == 0) {
+        return 0;
+    }
+
+    // the spike over the undeflated rows is folded into its first entry
+    // and the undeflated block, full after that, is reduced again
+    int r = nw - deflated;
+    double new_spike = 0;
+    if (r > 0) {
+        std::vector<double> sv(r);
+        for (int i = 0; i < r; i++) {
+            sv[i] = spike * v[i];
+        }
+        new_spike = sv[0];
+        if (r > 1) {
+            double scale;
+            new_spike = householder::make_reflector(sv.data(), 1, r, scale);
+            if (scale != 0) {
+                std::vector<double> w(nw);
+                sv[0] = 1;
+                reflect_rows(t.data(), nw, 0, r, 0, nw, sv.data(), scale,
+                             w.data());
+                reflect_columns(t.data(), nw, 0, r, 0, r, sv.data(), scale);
+                reflect_columns(v.data(), nw, 0, r, 0, nw, sv.data(), scale);
+            }
+            reduce_block(t.data(), nw, r, nw, nullptr, v.data(), nw, nw);
+        }
+    }
+
+    for (int i = 0; i < nw; i++) {
+        double* dst = row_of(h, ldh, k0 + i) + k0;
+        const double* src = row_of(t.data(), nw, i);
+        for (int col = 0; col < nw; col++) {
+            dst[col] = (col + 1 >= i) ? src[col] : 0.0;
+        }
+    }
+    if (k0 > lo) {
+        row_of(h, ldh, k0)[k0 - 1] = new_spike;
+    }
+
+    apply_window(h, ldh, n, k0, nw, r0, c1, z, ldz, v.data());
+
+    for (int i = r; i < nw; i++) {
+        wr[k0 + i] = twr[i];
+        wi[k0 + i] = twi[i];
+    }
+    return deflated;
+}
+
+// solves (T - lambda I) x = 0 upwards from the known entries x[top ..
+// last], the entries above top are found by back substitution over the
+// 1 x 1 and 2 x 2 diagonal blocks of T
+void back_substitute(const double* t, int ldt, int top, int last,
+                     std::complex<double> lambda, double smin,
+                     std::complex<double>* x) {
+    auto rescale = [x, last](int from) {
+        double largest = 0;
+        for (int i = from; i <= last; i++) {
+            largest = std::max(largest, std::max(std::abs(x[i].real()),
+                                                 std::abs(x[i].imag())));
+        }
+        if (largest > BIG) {
+            for (int i = from; i <= last; i++) {
+                x[i] /= largest;
+            }
+        }
+    };
+
+    int i = top - 1;
+    while (i >= 0) {
+        bool pair = i > 0 && row_of(t, ldt, i)[i - 1] != 0;
+        if (!pair) {
+            const double* row = row_of(t, ldt, i);
+            std::complex<double> rhs = 0;
+            for (int j = i + 1; j <= last; j++) {
+                rhs -= row[j] * x[j];
+            }
+            std::complex<double> diag = row[i] - lambda;
+            if (std::abs(diag) < smin) {
+                diag = smin;
+            }
+            x[i] = rhs / diag;
+            rescale(i);
+            i--;
+            continue;
+        }
+
+        const double* up = row_of(t, ldt, i - 1);
+        const double* row = row_of(t, ldt, i);
+        std::complex<double> rhs1 = 0;
+        std::complex<double> rhs2 = 0;
+        for (int j = i + 1; j <= last; j++) {
+            rhs1 -= up[j] * x[j];
+            rhs2 -= row[j] * x[j];
+        }
+        std::complex<double> a11 = up[i - 1] - lambda;
+        std::complex<double> a12 = up[i];
+        std::complex<double> a21 = row[i - 1];
+        std::complex<double> a22 = row[i] - lambda;
+        std::complex<double> det = a11 * a22 - a12 * a21;
+        if (std::abs(det) < smin) {
+            det = smin;
+        }
+        x[i - 1] = (rhs1 * a22 - a12 * rhs2) / det;
+        x[i] = (a11 * rhs2 - a21 * rhs1) / det;
+        rescale(i - 1);
+        i -= 2;
+    }
+}
+
+} // namespace
+
+void reduce(double* a, int n, double* tau) {
+    reduce_block(a, n, n, n, tau, nullptr, 0, 0);
+}
+
+void schur(double* h, int n, int ldh, double* z, int ldz, double* wr,
+           double* wi) {
+    bool full = z != nullptr;
+    double smlnum = std::numeric_limits<double>::min() * (n / EPS);
+
+    int hi = n - 1;
+    int its = 0;
+    while (hi >= 0) {
+        int lo = hi;
+        while (lo > 0 && !negligible(h, ldh, n, lo, smlnum)) {
+            lo--;
+        }
+        if (lo > 0) {
+            row_of(h, ldh, lo)[lo - 1] = 0;
+        }
+
+        if (lo == hi) {
+            wr[hi] = row_of(h, ldh, hi)[hi];
+            wi[hi] = 0;
+            hi--;
+            its = 0;
+            continue;
+        }
+        if (lo == hi - 1) {
+            double* up = row_of(h, ldh, lo);
+            double* row = row_of(h, ldh, hi);
+            double cs;
+            double sn;
+            standardize(up[lo], up[hi], row[lo], row[hi], cs, sn);
+            if (full) {
+                rotate_rows(h, ldh, lo, hi, hi + 1, n, cs, sn);
+                rotate_columns(h, ldh, lo, hi, 0, lo, cs, sn);
+                rotate_columns(z, ldz, lo, hi, 0, n, cs, sn);
+            }
+            block_eigenvalues(h, ldh, lo, wr, wi);
+            hi -= 2;
+            its = 0;
+            continue;
+        }
+
+        int r0 = full ? 0 : lo;
+        int c1 = full ? n : hi + 1;
+        int size = hi - lo + 1;
+        if (size >= AED_MIN) {
+            int nw = std::min(size, std::max(AED_WINDOW_MIN,
+                                             std::min(AED_WINDOW_MAX,
+                                                      size / 8)));
+            int deflated = deflate_window(h, ldh, n, lo, hi, nw, r0, c1, z,
+                                          ldz, smlnum, wr, wi);
+            if (deflated > 0) {
+                hi -= deflated;
+                its = 0;
+                continue;
+            }
+        }
+
+        if (++its > MAX_SWEEPS) {
+            throw exceptions::no_convergence();
+        }
+        sweep(h, ldh, n, lo, hi, r0, c1, z, ldz, its);
+    }
+}
+
+void eigenvectors(const double* t, int n, int ldt, double* y, int ldy) {
+    double smlnum = std::numeric_limits<double>::min() * (n / EPS);
+    std::vector<std::complex<double>> x(n);
+    for (int i = 0; i < n; i++) {
+        std::fill(row_of(y, ldy, i), row_of(y, ldy, i) + n, 0.0);
+    }
+
+    int k = n - 1;
+    while (k >= 0) {
+        bool pair = k > 0 && row_of(t, ldt, k)[k - 1] != 0;
+        if (!pair) {
+            double lambda = row_of(t, ldt, k)[k];
+            double smin = std::max(EPS * std::abs(lambda), smlnum);
+            x[k] = 1;
+            back_substitute(t, ldt, k, k, lambda, smin, x.data());
+            for (int i = 0; i <= k; i++) {
+                row_of(y, ldy, i)[k] = x[i].real();
+            }
+            k--;
+            continue;
+        }
+
+        // in the standard form the block [a b; c a] has the eigenvalue
+        // a + i sqrt(-b c) with the vector (b, i sqrt(-b c))
+        const double* up = row_of(t, ldt, k - 1);
+        const double* row = row_of(t, ldt, k);
+        double imag = std::sqrt(std::abs(up[k])) *
+                      std::sqrt(std::abs(row[k - 1]));
+        std::complex<double> lambda(up[k - 1], imag);
+        double smin = std::max(EPS * (std::abs(up[k - 1]) + imag), smlnum);
+        x[k - 1] = up[k];
+        x[k] = std::complex<double>(0, imag);
+        back_substitute(t, ldt, k - 1, k, lambda, smin, x.data());
+        for (int i = 0; i <= k; i++) {
+            row_of(y, ldy, i)[k - 1] = x[i].real();
+            row_of(y, ldy, i)[k] = x[i].imag();
+        }
+        k -= 2;
+    }
+}
+
+} // namespace astra::internals::hessenberg
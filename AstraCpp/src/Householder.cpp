@@ -0,0 +1,152 @@
+#include "pch.h"
+
+#include "../internals/Gemm.h"
+#include "../internals/Householder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace astra::internals::householder {
+
+namespace {
+
+// copies the rows r0 .. r0 + rb - 1 of V into the rb x nb buffer v and its
+// transpose vt, writing out the implicit ones and zeros
+void pack_reflectors(const double* src, int ldv, int row0, int nb, int r0,
+                     int rb, double* v, double* vt) {
+    for (int r = 0; r < rb; r++) {
+        const double* row = src + static_cast<long long>(r0 + r) * ldv;
+        int diag = r0 + r - row0;
+        for (int i = 0; i < nb; i++) {
+            double value = (i < diag) ? row[i] : (i == diag) ? 1.0 : 0.0;
+            v[static_cast<long long>(r) * nb + i] = value;
+            vt[static_cast<long long>(i) * rb + r] = value;
+        }
+    }
+}
+
+} // namespace
+
+double make_reflector(double* x, long long stride, int count, double& tau) {
+    double alpha = x[0];
+    double largest = 0;
+    for (int i = 1; i < count; i++) {
+        largest = std::max(largest, std::abs(x[i * stride]));
+    }
+    if (largest == 0) {
+        tau = 0;
+        return alpha;
+    }
+    largest = std::max(largest, std::abs(alpha));
+    double norm_sq = 0;
+    for (int i = 1; i < count; i++) {
+        double value = x[i * stride] / largest;
+        norm_sq += value * value;
+    }
+    double scaled = alpha / largest;
+    double scaled_beta = std::sqrt(scaled * scaled + norm_sq);
+    if (alpha > 0) {
+        scaled_beta = -scaled_beta;
+    }
+    tau = (scaled_beta - scaled) / scaled_beta;
+
+    // the tail is divided by alpha - beta in the scaled units, where it is
+    // at least one, as 1 / (alpha - beta) overflows for subnormal entries
+    double scale = 1 / (scaled - scaled_beta);
+    for (int i = 1; i < count; i++) {
+        x[i * stride] = (x[i * stride] / largest) * scale;
+    }
+    return largest * scaled_beta;
+}
+
+void apply_block(const double* v, int ldv, int row0, int m, int nb,
+                 const double* tau, bool transpose, double* c, int ldc,
+                 int width) {
+    if (nb == 0 || width == 0 || row0 >= m) {
+        return;
+    }
+
+    std::vector<double> vb(static_cast<size_t>(ROW_BLOCK) * nb);
+    std::vector<double> vt(static_cast<size_t>(nb) * ROW_BLOCK);
+    std::vector<double> g(static_cast<size_t>(nb) * nb, 0.0);
+    std::vector<double> w(static_cast<size_t>(nb) * width, 0.0);
+
+    // G = V^T V and W = V^T C in one pass
+    for (int r0 = row0; r0 < m; r0 += ROW_BLOCK) {
+        int rb = (m - r0 < ROW_BLOCK) ? m - r0 : ROW_BLOCK;
+        pack_reflectors(v, ldv, row0, nb, r0, rb, vb.data(), vt.data());
+        gemm::gemm(nb, nb, rb, 1.0, vt.data(), rb, vb.data(), nb, 1.0,
+                   g.data(), nb);
+        gemm::gemm(nb, width, rb, 1.0, vt.data(), rb,
+                   c + static_cast<long long>(r0) * ldc, ldc, 1.0, w.data(),
+                   width);
+    }
+
+    // upper triangular T with H_0 * ... * H_{nb-1} = I - V * T * V^T,
+    // column i is -tau_i * T(0:i, 0:i) * (V^T v_i)
+    std::vector<double> t(static_cast<size_t>(nb) * nb, 0.0);
+    for (int i = 0; i < nb; i++) {
+        t[i * nb + i] = tau[i];
+        for (int j = 0; j < i; j++) {
+            double value = 0;
+            for (int p = j; p < i; p++) {
+                value += t[j * nb + p] * g[p * nb + i];
+            }
+            t[j * nb + i] = -tau[i] * value;
+        }
+    }
+
+    if (transpose) {
+        // W = T^T * W in place, row i only needs the rows above it
+        for (int i = nb - 1; i >= 0; i--) {
+            double* row = w.data() + static_cast<long long>(i) * width;
+            double diag = t[i * nb + i];
+            for (int col = 0; col < width; col++) {
+                row[col] *= diag;
+            }
+            for (int p = 0; p < i; p++) {
+                double factor = t[p * nb + i];
+                if (factor == 0) {
+                    continue;
+                }
+                const double* other =
+                    w.data() + static_cast<long long>(p) * width;
+                for (int col = 0; col < width; col++) {
+                    row[col] += factor * other[col];
+                }
+            }
+        }
+    }
+    else {
+        // W = T * W in place, row i only needs the rows below it
+        for (int i = 0; i < nb; i++) {
+            double* row = w.data() + static_cast<long long>(i) * width;
+            double diag = t[i * nb + i];
+            for (int col = 0; col < width; col++) {
+                row[col] *= diag;
+            }
+            for (int p = i + 1; p < nb; p++) {
+                double factor = t[i * nb + p];
+                if (factor == 0) {
+                    continue;
+                }
+                const double* other =
+                    w.data() + static_cast<long long>(p) * width;
+                for (int col = 0; col < width; col++) {
+                    row[col] += factor * other[col];
+                }
+            }
+        }
+    }
+
+    // C = C - V * W
+    for (int r0 = row0; r0 < m; r0 += ROW_BLOCK) {
+        int rb = (m - r0 < ROW_BLOCK) ? m - r0 : ROW_BLOCK;
+        pack_reflectors(v, ldv, row0, nb, r0, rb, vb.data(), vt.data());
+        gemm::gemm(rb, width, nb, -1.0, vb.data(), nb, w.data(), width, 1.0,
+                   c + static_cast<long long>(r0) * ldc, ldc);
+    }
+}
+
+} // namespace astra::internals::householder
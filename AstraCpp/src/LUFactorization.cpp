@@ -0,0 +1,157 @@
+#include "pch.h"
+
+#include "../include/LUFactorization.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Gemm.h"
+#include "../internals/Utils.h"
+
+#include <utility>
+
+namespace astra {
+
+namespace {
+
+// rows per block of the triangular solves, the updates between blocks are
+// GEMM calls
+const int SOLVE_BLOCK = 64;
+
+} // namespace
+
+LUFactorization::LUFactorization(const Matrix& A)
+    : LUFactorization(Decomposer::lu(A)) {}
+
+LUFactorization::LUFactorization(const MatrixView& A)
+    : LUFactorization(Decomposer::lu(A)) {}
+
+LUFactorization::LUFactorization(Matrix&& A)
+    : LUFactorization(Decomposer::lu(std::move(A))) {}
+
+LUFactorization::LUFactorization(Decomposer::LUResult res)
+    : lu(std::move(res.LU)), pivots(std::move(res.pivots)), swaps(res.swaps),
+      singular(false) {
+    // lu zeroes the pivot of every column it skips
+    int n = lu.num_row();
+    const double* a = lu.data();
+    for (int i = 0; i < n; i++) {
+        if (a[i * n + i] == 0) {
+            singular = true;
+            break;
+        }
+    }
+}
+
+int LUFactorization::size() const { return lu.num_row(); }
+
+bool LUFactorization::is_singular() const { return singular; }
+
+const Matrix& LUFactorization::packed() const { return lu; }
+
+const std::vector<int>& LUFactorization::get_pivots() const { return pivots; }
+
+void LUFactorization::solve_in_place(double* x, int k) const {
+    int n = lu.num_row();
+    const double* a = lu.data();
+
+    // apply the row swaps in the order they were made
+    for (int i = 0; i < n; i++) {
+        if (pivots[i] != i) {
+            double* row = x + static_cast<long long>(i) * k;
+            double* other = x + static_cast<long long>(pivots[i]) * k;
+            for (int c = 0; c < k; c++) {
+                internals::utils::swap(row[c], other[c]);
+            }
+        }
+    }
+
+    // Ly = Pb, a block of rows at a time: the rows above the block are
+    // already solved, so they are subtracted with one product and the block
+    // is finished by forward substitution
+    for (int i0 = 0; i0 < n; i0 += SOLVE_BLOCK) {
+        int i1 = (n - i0 < SOLVE_BLOCK) ? n : i0 + SOLVE_BLOCK;
+        double* block = x + static_cast<long long>(i0) * k;
+        if (i0 > 0) {
+            internals::gemm::gemm(i1 - i0, k, i0, -1.0,
+                                  a + static_cast<long long>(i0) * n, n, x,
+                                  k, 1.0, block, k);
+        }
+        for (int i = i0 + 1; i < i1; i++) {
+            double* row = x + static_cast<long long>(i) * k;
+            const double* l = a + static_cast<long long>(i) * n;
+            for (int p = i0; p < i; p++) {
+                const double* solved = x + static_cast<long long>(p) * k;
+                for (int c = 0; c < k; c++) {
+                    row[c] -= l[p] * solved[c];
+                }
+            }
+        }
+    }
+
+    // Ux = y, the same way from the bottom block up
+    int last = ((n - 1) / SOLVE_BLOCK) * SOLVE_BLOCK;
+    for (int i0 = last; i0 >= 0; i0 -= SOLVE_BLOCK) {
+        int i1 = (n - i0 < SOLVE_BLOCK) ? n : i0 + SOLVE_BLOCK;
+        double* block = x + static_cast<long long>(i0) * k;
+        if (i1 < n) {
+            internals::gemm::gemm(i1 - i0, k, n - i1, -1.0,
+                                  a + static_cast<long long>(i0) * n + i1, n,
+                                  x + static_cast<long long>(i1) * k, k, 1.0,
+                                  block, k);
+        }
+        for (int i = i1 - 1; i >= i0; i--) {
+            double* row = x + static_cast<long long>(i) * k;
+            const double* u = a + static_cast<long long>(i) * n;
+            for (int p = i + 1; p < i1; p++) {
+                const double* solved = x + static_cast<long long>(p) * k;
+                for (int c = 0; c < k; c++) {
+                    row[c] -= u[p] * solved[c];
+                }
+            }
+            for (int c = 0; c < k; c++) {
+                row[c] /= u[i];
+            }
+        }
+    }
+}
+
+Vector LUFactorization::solve(const VectorView& b) const {
+    if (b.get_size() != size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    if (singular) {
+        throw internals::exceptions::singular_matrix();
+    }
+    Vector x(b);
+    solve_in_place(x.data(), 1);
+    return x;
+}
+
+Matrix LUFactorization::solve(const MatrixView& B) const {
+    if (B.num_row() != size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    if (singular) {
+        throw internals::exceptions::singular_matrix();
+    }
+    Matrix X(B);
+    solve_in_place(X.data(), X.num_col());
+    return X;
+}
+
+double LUFactorization::det() const {
+    int n = lu.num_row();
+    const double* a = lu.data();
+    double det = 1;
+    for (int i = 0; i < n; i++) {
+        det *= a[i * n + i];
+    }
+
+    // for even no. of swaps determinant is +ve,
+    // for odd swaps it is -ve
+    return (swaps % 2 == 0) ? det : -det;
+}
+
+Matrix LUFactorization::inverse() const {
+    return solve(Matrix::identity(size()));
+}
+
+} // namespace astra
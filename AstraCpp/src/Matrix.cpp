@@ -6,66 +6,101 @@
 #include "../internals/Utils.h"
 #include "../include/Decomposer.h"
 #include "../internals/MathUtils.h"
+#include "../internals/Gemm.h"
+#include "../internals/Memory.h"
+#include "../internals/Simd.h"
 
+#include <complex>
 #include <iostream>
 #include <iomanip>
+#include <type_traits>
 
 namespace astra {
 
-Matrix::Matrix(int row, int col)
+template <typename T>
+BasicMatrix<T>::BasicMatrix(int row, int col)
     : rows(row), cols(col), current_index(0), values(nullptr) {
 
     if (rows <= 0 || cols <= 0) {
         throw astra::internals::exceptions::invalid_size();
     }
-    this->values = new double[rows * cols];
+    this->values = internals::memory::allocate<T>(rows * cols);
 
     for (int i = 0; i < (rows * cols); ++i) {
         this->values[i] = 0;
     }
 }
 
-Matrix::Matrix(int row, int col, const double values[])
+template <typename T>
+BasicMatrix<T>::BasicMatrix(int row, int col, const T values[])
     : rows(row), cols(col), current_index(0) {
 
     if (rows <= 0 || cols <= 0) {
         throw astra::internals::exceptions::invalid_size();
     }
-    this->values = new double[rows * cols];
+    this->values = internals::memory::allocate<T>(rows * cols);
 
     for (int i = 0; i < (rows * cols); ++i) {
         this->values[i] = values[i];
     }
 }
 
-Matrix::Matrix(int row, int col, std::initializer_list<double> values)
-    : rows(row), cols(col), current_index(0), values(new double[row * col]) {
+template <typename T>
+BasicMatrix<T>::BasicMatrix(int row, int col, std::initializer_list<T> values)
+    : rows(row), cols(col), current_index(0),
+      values(internals::memory::allocate<T>(row * col)) {
 
     if (values.size() != static_cast<size_t>(row * col)) {
         throw astra::internals::exceptions::invalid_size();
     }
 
     int i = 0;
-    for (double val : values) {
+    for (T val : values) {
         if (i < row * col)
             this->values[i++] = val;
     }
 }
 
-Matrix::Matrix(const Matrix& other)
+template <typename T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrix<T>& other)
     : rows(other.rows), cols(other.cols), current_index(other.current_index),
-      values(new double[other.rows * other.cols]) {
+      values(internals::memory::allocate<T>(other.rows * other.cols)) {
     for (int i = 0; i < rows * cols; ++i) {
         values[i] = other.values[i];
     }
 }
 
-Matrix::~Matrix() {
-    delete[] values;
+template <typename T>
+BasicMatrix<T>::BasicMatrix(BasicMatrix<T>&& other) noexcept
+    : rows(other.rows), cols(other.cols), current_index(other.current_index),
+      values(other.values) {
+    other.rows = 0;
+    other.cols = 0;
+    other.current_index = 0;
+    other.values = nullptr;
+}
+
+template <typename T>
+BasicMatrix<T>::BasicMatrix(const BasicMatrixView<T>& view)
+    : rows(view.num_row()), cols(view.num_col()), current_index(0),
+      values(
+          internals::memory::allocate<T>(view.num_row() * view.num_col())) {
+    for (int i = 0; i < rows; ++i) {
+        const T* row = &view(i, 0);
+        for (int j = 0; j < cols; ++j) {
+            values[i * cols + j] = row[j];
+        }
+    }
+}
+
+template <typename T>
+BasicMatrix<T>::~BasicMatrix() {
+    internals::memory::deallocate(values);
     values = nullptr;
 }
 
-Matrix& Matrix::operator<<(double val) {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator<<(T val) {
     if (current_index < (rows * cols)) {
         values[current_index++] = val;
     }
@@ -75,75 +110,37 @@ Matrix& Matrix::operator<<(double val) {
     return *this;
 }
 
-Matrix &Matrix::operator,(double val) { return (*this << val); }
-
-double& Matrix::operator()(int i, int j) {
-    if (i >= rows || i < 0 || j >= cols || j < 0) {
-        throw astra::internals::exceptions::index_out_of_range();
-    }
-    return values[i * cols + j];
-}
-
-const double& Matrix::operator()(int i, int j) const {
-    if (i >= rows || i < 0 || j >= cols || j < 0) {
-        throw astra::internals::exceptions::index_out_of_range();
-    }
-    return values[i * cols + j];
-}
-
-Matrix Matrix::operator+(const Matrix& other) const {
-    if (rows != other.rows || cols != other.cols) {
-        throw astra::internals::exceptions::matrix_size_mismatch();
-    }
-    Matrix result(rows, cols);
-    for (int i = 0; i < rows * cols; ++i) {
-        result.values[i] = values[i] + other.values[i];
-    }
-    return result;
-}
-
-Matrix Matrix::operator-(const Matrix& other) const {
-    if (rows != other.rows || cols != other.cols) {
-        throw astra::internals::exceptions::matrix_size_mismatch();
-    }
-    Matrix result(rows, cols);
-    for (int i = 0; i < rows * cols; ++i) {
-        result.values[i] = values[i] - other.values[i];
-    }
-    return result;
-}
+template <typename T>
+BasicMatrix<T> &BasicMatrix<T>::operator,(T val) { return (*this << val); }
 
-Matrix Matrix::operator*(const Matrix& other) const {
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::operator*(const BasicMatrix<T>& other) const {
     if (cols != other.rows) {
         throw astra::internals::exceptions::
             matrix_multiplication_size_mismatch();
     }
 
-    Matrix result(rows, other.cols);
+    BasicMatrix<T> result(rows, other.cols);
 
-    for (int i = 0; i < rows; ++i) {
-        for (int j = 0; j < other.cols; ++j) {
-            for (int k = 0; k < cols; ++k) {
-                result.values[i * result.cols + j] +=
-                    values[i * cols + k] * other.values[k * other.cols + j];
-            }
-        }
-    }
+    internals::gemm::gemm(rows, other.cols, cols, T(1), values, cols,
+                          other.values, other.cols, T(0), result.values,
+                          result.cols);
 
     return result;
 }
 
-Matrix& Matrix::operator=(const Matrix& other) {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(const BasicMatrix<T>& other) {
     if (this == &other) {
         return *this;
     }
 
     // resize if size dont match
     if (rows != other.rows || cols != other.cols) {
-        delete[] values;
+        internals::memory::deallocate(values);
         rows = other.rows;
         cols = other.cols;
-        values = new double[rows * cols];
+        values = internals::memory::allocate<T>(rows * cols);
     }
 
     // copy data
@@ -154,7 +151,29 @@ Matrix& Matrix::operator=(const Matrix& other) {
     return *this;
 }
 
-bool Matrix::operator==(const Matrix& other) const {
+template <typename T>
+BasicMatrix<T>& BasicMatrix<T>::operator=(BasicMatrix<T>&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    internals::memory::deallocate(values);
+
+    rows = other.rows;
+    cols = other.cols;
+    current_index = other.current_index;
+    values = other.values;
+
+    other.rows = 0;
+    other.cols = 0;
+    other.current_index = 0;
+    other.values = nullptr;
+
+    return *this;
+}
+
+template <typename T>
+bool BasicMatrix<T>::operator==(const BasicMatrix<T>& other) const {
     if (rows != other.rows || cols != other.cols) {
         return false;
     }
@@ -168,91 +187,74 @@ bool Matrix::operator==(const Matrix& other) const {
     return true;
 }
 
-bool Matrix::operator!=(const Matrix& other) const {
+template <typename T>
+bool BasicMatrix<T>::operator!=(const BasicMatrix<T>& other) const {
     return !(*this == other);
 }
 
-void Matrix::replace(double old_val, double new_val) {
-    for (int i = 0; i < rows * cols; ++i) {
-        if (values[i] == old_val) {
-            values[i] = new_val;
-        }
-    }
+template <typename T>
+void BasicMatrix<T>::replace(T old_val, T new_val) {
+    internals::simd::replace(values, rows * cols, old_val, new_val);
 }
 
-double Matrix::sum() const {
-    double total = 0.0;
-    for (int i = 0; i < rows * cols; ++i) {
-        total += values[i];
-    }
-    return total;
+template <typename T>
+T BasicMatrix<T>::sum() const {
+    return internals::simd::sum(values, rows * cols);
 }
 
-double Matrix::prod() const {
-    double total = 1.0;
-    for (int i = 0; i < rows * cols; ++i) {
-        total *= values[i];
-    }
-    return total;
+template <typename T>
+T BasicMatrix<T>::prod() const {
+    return internals::simd::prod(values, rows * cols);
 }
 
-double Matrix::trace() const {
+template <typename T>
+T BasicMatrix<T>::trace() const {
     if (!is_square()) {
         throw astra::internals::exceptions::non_square_matrix();
     }
-    double sum = 0.0;
+    T sum = T(0);
     for (int i = 0; i < rows; ++i) {
         sum += values[i * cols + i];
     }
     return sum;
 }
 
-double astra::Matrix::principal_prod() const {
+template <typename T>
+T BasicMatrix<T>::principal_prod() const {
     if (!is_square()) {
         throw astra::internals::exceptions::non_square_matrix();
     }
-    double prod = 1.0;
+    T prod = T(1);
     for (int i = 0; i < rows; ++i) {
         prod *= values[i * cols + i];
     }
     return prod;
 }
 
-double Matrix::avg() const {
+template <typename T>
+T BasicMatrix<T>::avg() const {
     if (rows == 0 || cols == 0) {
         throw astra::internals::exceptions::invalid_size();
     }
 
-    double sum = 0.0;
-    for (int i = 0; i < rows * cols; ++i) {
-        sum += values[i];
-    }
-    return sum / (rows * cols);
+    return sum() / static_cast<real_type>(rows * cols);
 }
 
-double Matrix::min() const {
-    double minVal = values[0];
-    for (int i = 0; i < rows * cols; ++i) {
-        if (values[i] < minVal) {
-            minVal = values[i];
-        }
-    }
-    return minVal;
+template <typename T>
+T BasicMatrix<T>::min() const {
+    return internals::simd::min(values, rows * cols);
 }
 
-double Matrix::max() const {
-    double maxVal = values[0];
-    for (int i = 0; i < rows * cols; ++i) {
-        if (values[i] > maxVal) {
-            maxVal = values[i];
-        }
-    }
-    return maxVal;
+template <typename T>
+T BasicMatrix<T>::max() const {
+    return internals::simd::max(values, rows * cols);
 }
 
-bool Matrix::is_square() const { return rows == cols; }
+template <typename T>
+bool BasicMatrix<T>::is_square() const { return rows == cols; }
 
-bool Matrix::is_identity() const {
+template <typename T>
+bool BasicMatrix<T>::is_identity() const {
     if (!is_square()) {
         return false;
     }
@@ -261,13 +263,13 @@ bool Matrix::is_identity() const {
         for (int j = 0; j < cols; ++j) {
             if (i == j) { // diagonal
                 if (!internals::mathutils::nearly_equal(values[i * cols + j],
-                                                        1.0)) {
+                                                        T(1))) {
                     return false;
                 }
             }
             else { // non-diagonal
                 if (!internals::mathutils::nearly_equal(values[i * cols + j],
-                                                        0.0)) {
+                                                        T(0))) {
                     return false;
                 }
             }
@@ -277,7 +279,8 @@ bool Matrix::is_identity() const {
     return true;
 }
 
-bool Matrix::is_symmetric() const {
+template <typename T>
+bool BasicMatrix<T>::is_symmetric() const {
     if (!is_square()) {
         return false;
     }
@@ -293,7 +296,8 @@ bool Matrix::is_symmetric() const {
     return true;
 }
 
-bool Matrix::is_diagonal() const {
+template <typename T>
+bool BasicMatrix<T>::is_diagonal() const {
     if (!is_square()) {
         return false;
     }
@@ -301,7 +305,7 @@ bool Matrix::is_diagonal() const {
     for (int i = 0; i < rows; ++i) {
         for (int j = 0; j < cols; ++j) {
             if (i != j && !internals::mathutils::nearly_equal(
-                              values[i * cols + j], 0.0)) {
+                              values[i * cols + j], T(0))) {
                 return false;
             }
         }
@@ -309,7 +313,8 @@ bool Matrix::is_diagonal() const {
     return true;
 }
 
-bool Matrix::is_upper_triangular() const {
+template <typename T>
+bool BasicMatrix<T>::is_upper_triangular() const {
     if (!is_square()) {
         return false;
     }
@@ -317,7 +322,7 @@ bool Matrix::is_upper_triangular() const {
     for (int i = 0; i < rows; ++i) {
         for (int j = 0; j < i; ++j) {
             if (!internals::mathutils::nearly_equal(values[i * cols + j],
-                                                    0.0)) {
+                                                    T(0))) {
                 return false;
             }
         }
@@ -325,7 +330,8 @@ bool Matrix::is_upper_triangular() const {
     return true;
 }
 
-bool Matrix::is_lower_triangular() const {
+template <typename T>
+bool BasicMatrix<T>::is_lower_triangular() const {
     if (!is_square()) {
         return false;
     }
@@ -333,7 +339,7 @@ bool Matrix::is_lower_triangular() const {
     for (int i = 0; i < rows; ++i) {
         for (int j = i + 1; j < cols; ++j) {
             if (!internals::mathutils::nearly_equal(values[i * cols + j],
-                                                    0.0)) {
+                                                    T(0))) {
                 return false;
             }
         }
@@ -342,33 +348,37 @@ bool Matrix::is_lower_triangular() const {
     return true;
 }
 
-bool Matrix::is_triangular() const {
+template <typename T>
+bool BasicMatrix<T>::is_triangular() const {
     return is_lower_triangular() || is_upper_triangular();
 }
 
-bool Matrix::is_zero() const {
+template <typename T>
+bool BasicMatrix<T>::is_zero() const {
     for (int i = 0; i < rows * cols; ++i) {
-        if (!internals::mathutils::nearly_equal(values[i], 0.0)) {
+        if (!internals::mathutils::nearly_equal(values[i], T(0))) {
             return false;
         }
     }
     return true;
 }
 
-Matrix Matrix::identity(int n) {
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::identity(int n) {
     if (n <= 0) {
         throw astra::internals::exceptions::invalid_size();
     }
 
-    Matrix identity(n, n);
+    BasicMatrix<T> identity(n, n);
     for (int i = 0; i < n; ++i) {
-        identity(i, i) = 1.0;
+        identity(i, i) = T(1);
     }
 
     return identity;
 }
 
-void Matrix::transpose() {
+template <typename T>
+void BasicMatrix<T>::transpose() {
     if (is_square()) {
         // sqaure
         for (int i = 0; i < rows; ++i) {
@@ -380,7 +390,8 @@ void Matrix::transpose() {
     }
     else {
         // rectangular
-        double* transposedValues = new double[rows * cols];
+        T* transposedValues =
+            internals::memory::allocate<T>(rows * cols);
         int newRows = cols;
         int newCols = rows;
 
@@ -390,14 +401,15 @@ void Matrix::transpose() {
             }
         }
 
-        delete[] values;
+        internals::memory::deallocate(values);
         values = transposedValues;
         rows = newRows;
         cols = newCols;
     }
 }
 
-void Matrix::row_swap(int row1, int row2) {
+template <typename T>
+void BasicMatrix<T>::row_swap(int row1, int row2) {
     if (row1 >= rows || row2 >= rows || row1 < 0 || row2 < 0) {
         throw astra::internals::exceptions::index_out_of_range();
     }
@@ -408,7 +420,8 @@ void Matrix::row_swap(int row1, int row2) {
     }
 }
 
-void Matrix::partial_row_swap(int row1, int row2, int limit_col) {
+template <typename T>
+void BasicMatrix<T>::partial_row_swap(int row1, int row2, int limit_col) {
     if (row1 >= rows || row2 >= rows || row1 < 0 || row2 < 0 ||
         limit_col >= cols || limit_col < 0) {
         throw astra::internals::exceptions::index_out_of_range();
@@ -420,7 +433,8 @@ void Matrix::partial_row_swap(int row1, int row2, int limit_col) {
     }
 }
 
-void Matrix::col_swap(int col1, int col2) {
+template <typename T>
+void BasicMatrix<T>::col_swap(int col1, int col2) {
     if (col1 >= cols || col2 >= cols || col1 < 0 || col2 < 0) {
         throw astra::internals::exceptions::index_out_of_range();
     }
@@ -431,19 +445,18 @@ void Matrix::col_swap(int col1, int col2) {
     }
 }
 
-void Matrix::clear() {
-    for (int i = 0; i < rows * cols; ++i) {
-        values[i] = 0.0;
-    }
+template <typename T>
+void BasicMatrix<T>::clear() {
+    internals::simd::fill(values, rows * cols, T(0));
 }
 
-void astra::Matrix::fill(double val) {
-    for (int i = 0; i < rows * cols; ++i) {
-        values[i] = val;
-    }
+template <typename T>
+void BasicMatrix<T>::fill(T val) {
+    internals::simd::fill(values, rows * cols, val);
 }
 
-void astra::Matrix::resize(int r, int c) {
+template <typename T>
+void BasicMatrix<T>::resize(int r, int c) {
     if (r <= 0 || c <= 0) {
         throw astra::internals::exceptions::invalid_size();
     }
@@ -452,15 +465,16 @@ void astra::Matrix::resize(int r, int c) {
         return;
     }
 
-    double* newValues = new double[r * c];
-    delete[] values;
+    T* newValues = internals::memory::allocate<T>(r * c);
+    internals::memory::deallocate(values);
     values = newValues;
     rows = r;
     cols = c;
     fill(0);
 }
 
-void Matrix::join(const Matrix& other) {
+template <typename T>
+void BasicMatrix<T>::join(const BasicMatrix<T>& other) {
     int num_row_1 = this->rows;
     int num_col_1 = this->cols;
     int num_row_2 = other.rows;
@@ -470,7 +484,8 @@ void Matrix::join(const Matrix& other) {
         throw astra::internals::exceptions::matrix_join_size_mismatch();
     }
 
-    double* join_values = new double[num_row_1 * (num_col_1 + num_col_2)];
+    T* join_values =
+        internals::memory::allocate<T>(num_row_1 * (num_col_1 + num_col_2));
 
     int linear_ind, join_linear_ind;
 
@@ -494,53 +509,45 @@ void Matrix::join(const Matrix& other) {
     this->cols = num_col_1 + num_col_2;
     this->rows = num_row_1;
 
-    double* new_val = new double[rows * cols];
-    delete[] values;
-    values = new_val;
-
-    for (int i = 0; i < rows * cols; ++i) {
-        values[i] = join_values[i];
-    }
+    internals::memory::deallocate(values);
+    values = join_values;
+}
 
-    delete[] join_values;
-    join_values = nullptr;
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::submatrix(int r1, int c1, int r2, int c2) const {
+    return BasicMatrix<T>(block(r1, c1, r2, c2));
 }
 
-Matrix Matrix::submatrix(int r1, int c1, int r2, int c2) const {
-    if (r1 < 0 || r1 >= rows || r2 < 0 || r2 >= rows || c1 < 0 || c1 >= cols ||
-        c2 < 0 || c2 >= cols) {
-        throw astra::internals::exceptions::index_out_of_range();
-    }
-    if (r1 > r2 || c1 > c2) {
-        throw astra::internals::exceptions::invalid_argument();
-    }
+template <typename T>
+BasicMatrixView<T> BasicMatrix<T>::block(int r1, int c1, int r2, int c2) const {
+    return BasicMatrixView<T>(*this).block(r1, c1, r2, c2);
+}
 
-    int new_rows = r2 - r1 + 1;
-    int new_cols = c2 - c1 + 1;
-    Matrix submat(new_rows, new_cols);
+template <typename T>
+BasicVectorView<T> BasicMatrix<T>::row_view(int i) const {
+    return BasicMatrixView<T>(*this).row(i);
+}
 
-    for (int i = 0; i < new_rows; ++i) {
-        for (int j = 0; j < new_cols; ++j) {
-            submat(i, j) = values[(r1 + i) * cols + (c1 + j)];
-        }
-    }
-    return submat;
+template <typename T>
+BasicVectorView<T> BasicMatrix<T>::col_view(int j) const {
+    return BasicMatrixView<T>(*this).col(j);
 }
 
-Matrix Matrix::rref(double tol) const {
+template <typename T>
+void BasicMatrix<T>::rref_in_place(double tol) {
     int r = 0;
     int pivot_row = -1;
     int pivot_col = -1;
-    double pivot_val = 0.0;
-    double factor = 0.0;
-
-    Matrix rref(*this);
+    T pivot_val = T(0);
+    T factor = T(0);
 
+    // rows are addressed through raw pointers, element (i, j) is
+    // values[i * cols + j]
     for (int c = 0; c < cols; c++) {
         pivot_row = -1;
 
         for (int i = r; i < rows; i++) {
-            if (internals::mathutils::abs(rref(i, c)) > tol) {
+            if (internals::mathutils::abs(values[i * cols + c]) > tol) {
                 pivot_row = i;
                 break;
             }
@@ -552,25 +559,28 @@ Matrix Matrix::rref(double tol) const {
         }
 
         // swap rows to move selected pivot to current row
-        for (int k = 0; k < cols; ++k) {
-            astra::internals::utils::swap(rref.values[r * cols + k],
-                                          rref.values[pivot_row * cols + k]);
+        T* current = values + r * cols;
+        if (pivot_row != r) {
+            T* other = values + pivot_row * cols;
+            for (int k = 0; k < cols; ++k) {
+                astra::internals::utils::swap(current[k], other[k]);
+            }
         }
 
         // normalize the pivot row
-        pivot_val = rref(r, c);
+        pivot_val = current[c];
         if (internals::mathutils::abs(pivot_val) > tol) {
             for (int i = 0; i < cols; i++) {
-                rref(r, i) = rref(r, i) / pivot_val;
+                current[i] = current[i] / pivot_val;
             }
         }
-        
 
         // eliminate entries below pivot
         for (int i = r + 1; i < rows; i++) {
-            factor = rref(i, c);
+            T* row = values + i * cols;
+            factor = row[c];
             for (int j = 0; j < cols; j++) {
-                rref(i, j) = rref(i, j) - factor * rref(r, j);
+                row[j] = row[j] - factor * current[j];
             }
         }
 
@@ -580,9 +590,10 @@ Matrix Matrix::rref(double tol) const {
     // backward elimination
     for (int i = r - 1; i >= 0; i--) {
         pivot_col = -1;
+        const T* pivot_row_values = values + i * cols;
 
         for (int c = 0; c < cols; c++) {
-            if (internals::mathutils::abs(rref(i, c)) > tol) {
+            if (internals::mathutils::abs(pivot_row_values[c]) > tol) {
                 pivot_col = c;
                 break;
             }
@@ -595,60 +606,49 @@ Matrix Matrix::rref(double tol) const {
 
         // eliminate entries above pivot
         for (int j = i - 1; j >= 0; j--) {
-            factor = rref(j, pivot_col);
+            T* row = values + j * cols;
+            factor = row[pivot_col];
             for (int k = 0; k < cols; k++) {
-                rref(j, k) = rref(j, k) - factor * rref(i, k);
+                row[k] = row[k] - factor * pivot_row_values[k];
             }
         }
     }
 
     // stabilize the near-zero entry to exactly zero
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            if (internals::mathutils::abs(rref(i, j)) < tol) {
-                rref(i, j) = 0.0;
-            }
+    for (int i = 0; i < rows * cols; i++) {
+        if (internals::mathutils::abs(values[i]) < tol) {
+            values[i] = T(0);
         }
     }
 
-    return rref;
 }
 
-Vector Matrix::get_row(int i) const {
-    if (i < 0 || i >= rows) {
-        throw astra::internals::exceptions::index_out_of_range();
-    }
-    
-    Vector row(cols);
-    for (int j = 0; j < cols; ++j) {
-        row[j] = values[i * cols + j];
-    }
-    
-    return row;
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::rref(double tol) const {
+    return BasicMatrixView<T>(*this).rref(tol);
 }
 
-Vector Matrix::get_col(int j) const {
-    if (j < 0 || j >= cols) {
-        throw astra::internals::exceptions::index_out_of_range();
-    }
+template <typename T>
+BasicVector<T> BasicMatrix<T>::get_row(int i) const {
+    return BasicVector<T>(row_view(i));
+}
 
-    Vector col(rows);
-    for (int i = 0; i < rows; ++i) {
-        col[i] = values[i * cols + j];
-    }
-    return col;
+template <typename T>
+BasicVector<T> BasicMatrix<T>::get_col(int j) const {
+    return BasicVector<T>(col_view(j));
 }
 
-bool Matrix::is_pivot_col(int j) const {
+template <typename T>
+bool BasicMatrix<T>::is_pivot_col(int j) const {
     if (j < 0 || j >= cols) {
         throw astra::internals::exceptions::index_out_of_range();
     }
-    Matrix rref_matrix = this->rref();
+    BasicMatrix<T> rref_matrix = this->rref();
     for (int i = 0; i < rows; ++i) {
-        if (internals::mathutils::nearly_equal(rref_matrix(i, j), 1.0)) {
+        if (internals::mathutils::nearly_equal(rref_matrix(i, j), T(1))) {
             // Ensuring if it's the leading entry in this row
             for (int k = 0; k < j; ++k) {
-                if (!internals::mathutils::nearly_equal(rref_matrix(i, k), 0.0)) {
+                if (!internals::mathutils::nearly_equal(rref_matrix(i, k), T(0))) {
                     return false;
                 }
             }
@@ -658,19 +658,20 @@ bool Matrix::is_pivot_col(int j) const {
     return false;
 }
 
-bool Matrix::is_pivot_row(int i) const {
+template <typename T>
+bool BasicMatrix<T>::is_pivot_row(int i) const {
     if (i < 0 || i >= rows) {
         throw astra::internals::exceptions::index_out_of_range();
     }
-    Matrix rref_matrix = this->rref();
+    BasicMatrix<T> rref_matrix = this->rref();
 
     // Checking if this row contains a pivot
     for (int j = 0; j < cols; ++j) {
-        if (internals::mathutils::nearly_equal(rref_matrix(i, j), 1.0)) {
+        if (internals::mathutils::nearly_equal(rref_matrix(i, j), T(1))) {
             // Ensuring if it's the only non-zero value in its column
             for (int k = 0; k < rows; ++k) {
                 if (k != i &&
-                    !internals::mathutils::nearly_equal(rref_matrix(k, j), 0.0)) {
+                    !internals::mathutils::nearly_equal(rref_matrix(k, j), T(0))) {
                     return false; // Another row has a non-zero in this column
                 }
             }
@@ -680,72 +681,102 @@ bool Matrix::is_pivot_row(int i) const {
     return false; // No pivot in this row
 }
 
-bool Matrix::is_zero_row(int i) const {
+template <typename T>
+bool BasicMatrix<T>::is_zero_row(int i) const {
     if (i < 0 || i >= rows) {
         throw astra::internals::exceptions::index_out_of_range();
     }
     for (int j = 0; j < cols; ++j) {
-        if (!internals::mathutils::nearly_equal(values[i * cols + j], 0.0)) {
+        if (!internals::mathutils::nearly_equal(values[i * cols + j], T(0))) {
             return false;
         }
     }
     return true;
 }
 
-bool Matrix::is_zero_col(int j) const { 
+template <typename T>
+bool BasicMatrix<T>::is_zero_col(int j) const { 
     if (j < 0 || j >= cols) {
         throw astra::internals::exceptions::index_out_of_range();
     }
     for (int i = 0; i < rows; ++i) {
-        if (!internals::mathutils::nearly_equal(values[i * cols + j], 0.0)) {
+        if (!internals::mathutils::nearly_equal(values[i * cols + j], T(0))) {
             return false;
         }
     }
     return true;
 }
 
-int Matrix::rank() const {
-    Matrix rref_matrix = this->rref(); 
-    int rank = 0;
+template <typename T>
+int BasicMatrix<T>::rank() const { return BasicMatrixView<T>(*this).rank(); }
 
-    for (int i = 0; i < rows; ++i) {
-        // Checking if the row is non-zero
-        bool non_zero_row = false;
-        for (int j = 0; j < cols; ++j) {
-            if (internals::mathutils::abs(rref_matrix(i, j)) >
-                1e-6) { // Avoiding floating-point errors
-                non_zero_row = true;
-                break;
-            }
-        }
-        if (non_zero_row) {
-            rank++;
-        }
+template <typename T>
+T BasicMatrix<T>::det() const {
+    if (!is_square()) {
+        throw astra::internals::exceptions::non_square_matrix();
     }
+    if constexpr (std::is_same<T, double>::value) {
+        auto lu = astra::Decomposer::lu(*this);
 
-    return rank;
-}
+        // the diagonal of the packed factors is the diagonal of U
+        T det = T(1);
+        const T* lu_values = lu.LU.data();
+        for (int i = 0; i < rows; ++i) {
+            det *= lu_values[i * rows + i];
+        }
 
-double Matrix::det() const {
-    if (!is_square()) {
-        throw astra::internals::exceptions::non_square_matrix();
+        // for even no. of swaps determinant is +ve,
+        // for odd swaps it is -ve
+        det *= (lu.swaps % 2 == 0) ? 1 : -1;
+
+        return det;
     }
-    auto plu = astra::Decomposer::palu(*this);
+    else {
+        // the Decomposer works on double matrices, other element types are
+        // eliminated here with the same partial pivoting
+        BasicMatrix u(*this);
+        T det = T(1);
+
+        for (int x = 0; x < rows; ++x) {
+            int pivot_row = x;
+            for (int y = x + 1; y < rows; ++y) {
+                if (internals::mathutils::abs(u(y, x)) >
+                    internals::mathutils::abs(u(pivot_row, x))) {
+                    pivot_row = y;
+                }
+            }
 
-    double det = plu.U.principal_prod();
+            if (internals::mathutils::nearly_equal(u(pivot_row, x), T(0))) {
+                return T(0);
+            }
+
+            if (pivot_row != x) {
+                u.row_swap(x, pivot_row);
+                det = -det;
+            }
 
-    // for even no. of swaps determinant is +ve,
-    // for odd swaps it is -ve
-    det *= (plu.swaps % 2 == 0) ? 1 : -1;
+            T pivot = u(x, x);
+            det *= pivot;
+
+            for (int y = x + 1; y < rows; ++y) {
+                T pivot_factor = u(y, x) / pivot;
+                for (int i = x + 1; i < cols; ++i) {
+                    u(y, i) -= pivot_factor * u(x, i);
+                }
+            }
+        }
 
-    return det;
+        return det;
+    }
 }
 
-bool Matrix::is_singular() const {
-    return internals::mathutils::nearly_equal(det(), 0.0);
+template <typename T>
+bool BasicMatrix<T>::is_singular() const {
+    return internals::mathutils::nearly_equal(det(), T(0));
 }
 
-bool Matrix::is_invertible() const { 
+template <typename T>
+bool BasicMatrix<T>::is_invertible() const { 
     if (!is_square()) {
         return false;
     }
@@ -755,68 +786,74 @@ bool Matrix::is_invertible() const {
     return true;
 }
 
-Matrix Matrix::inv() const {
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::inv() const {
     if (!is_square()) {
         throw astra::internals::exceptions::non_square_matrix();
     }
     if (is_singular()) {
         throw astra::internals::exceptions::singular_matrix();
     }
+    int n = rows;
     // taking an identity matrix
-    Matrix inverse = Matrix::identity(rows);
+    BasicMatrix<T> inverse = BasicMatrix<T>::identity(n);
     // making copy of the given matrix
-    Matrix mat_copy(*this);
+    BasicMatrix<T> mat_copy(*this);
+
+    // both are worked on through raw pointers, element (i, j) is at i * n + j
+    T* a = mat_copy.values;
+    T* inv = inverse.values;
 
     // making mat_copy to upper triangular form
-    for (int i = 0; i < rows; i++) {
+    for (int i = 0; i < n; i++) {
         // taking the diagonal elements
-        double current_val = mat_copy(i, i);
+        T current_val = a[i * n + i];
 
-        for (int j = i + 1; j < rows; j++) {
+        for (int j = i + 1; j < n; j++) {
             // to eleminate the ith element, how should we add ith row to jth
             // row
-            double mult = -mat_copy(j, i) / current_val;
+            T mult = -a[j * n + i] / current_val;
 
-            for (int k = 0; k < rows; k++) {
+            for (int k = 0; k < n; k++) {
                 // eleminating the ith element and updating the inverse
                 // accordingly
-                mat_copy(j, k) += mult * mat_copy(i, k);
-                inverse(j, k) += mult * inverse(i, k);
+                a[j * n + k] += mult * a[i * n + k];
+                inv[j * n + k] += mult * inv[i * n + k];
             }
         }
     }
 
     // making mat_copy to diagonal form
-    for (int i = rows - 1; i >= 0; i--) {
-        double current_val = mat_copy(i, i);
+    for (int i = n - 1; i >= 0; i--) {
+        T current_val = a[i * n + i];
 
         for (int j = i - 1; j >= 0; j--) {
-            double mult = -mat_copy(j, i) / current_val;
+            T mult = -a[j * n + i] / current_val;
 
-            for (int k = 0; k < rows; k++) {
-                mat_copy(j, k) += mult * mat_copy(i, k);
-                inverse(j, k) += mult * inverse(i, k);
+            for (int k = 0; k < n; k++) {
+                a[j * n + k] += mult * a[i * n + k];
+                inv[j * n + k] += mult * inv[i * n + k];
             }
         }
     }
 
     // scaling to identity
-    for (int i = 0; i < rows; i++) {
-
-        double current_val = mat_copy(i, i);
-        mat_copy(i, i) /= current_val;
+    for (int i = 0; i < n; i++) {
+        T current_val = a[i * n + i];
+        a[i * n + i] /= current_val;
 
-        for (int j = 0; j < rows; j++) {
-            inverse(i, j) /= current_val;
+        for (int j = 0; j < n; j++) {
+            inv[i * n + j] /= current_val;
         }
     }
 
     return inverse;
 }
 
-Matrix Matrix::nullspace() const { 
+template <typename T>
+BasicMatrix<T> BasicMatrix<T>::nullspace() const { 
     // get the rref form
-    Matrix rref_matrix = this->rref();
+    BasicMatrix<T> rref_matrix = this->rref();
 
     int m = num_row();
     int n = num_col();
@@ -851,17 +888,17 @@ Matrix Matrix::nullspace() const {
     if (free_count == 0) {
         delete[] is_pivot_col;
         delete[] free_col_index;
-        return Matrix(n, 1);
+        return BasicMatrix<T>(n, 1);
     }
 
-    Matrix nullspace_mat(n, free_count);
+    BasicMatrix<T> nullspace_mat(n, free_count);
     
     // create the basis vectors one by one
     for (int j = 0; j < free_count; ++j) {
         int current_free_col_pos = free_col_index[j];
 
-        double* basis_vector = new double[n](); // init zero array to hold a basis vector
-        basis_vector[current_free_col_pos] = 1.0; // mark the current free pos as '1'
+        T* basis_vector = new T[n](); // init zero array to hold a basis vector
+        basis_vector[current_free_col_pos] = T(1); // mark the current free pos as '1'
 
         // mark the pivot var positions as -rref(r, free_col_pos)
         // pivot var = -free var
@@ -876,7 +913,7 @@ Matrix Matrix::nullspace() const {
         for (int i = 0; i < n; ++i) {
             // stabilize near-zero values to just 0
             if (internals::mathutils::abs(basis_vector[i]) < 1e-6) {
-                basis_vector[i] = 0.0;
+                basis_vector[i] = T(0);
             }
 
             nullspace_mat(i, j) = basis_vector[i];
@@ -893,44 +930,13 @@ Matrix Matrix::nullspace() const {
     return nullspace_mat;
 }
 
-Matrix operator*(const Matrix& mat, double scalar) {
-
-    int rows = mat.num_row();
-    int cols = mat.num_col();
-
-    Matrix result(rows, cols);
+template <typename T>
+int BasicMatrix<T>::num_row() const { return rows; }
+template <typename T>
+int BasicMatrix<T>::num_col() const { return cols; }
 
-    for (int i = 0; i < rows * cols; ++i) {
-        result.values[i] = mat.values[i] * scalar;
-    }
-    return result;
-}
-
-Matrix operator*(double scalar, const Matrix& mat) {
-    return mat * scalar;
-}
-
-Matrix operator/(const Matrix& mat, double scalar) {
-    if (internals::mathutils::nearly_equal(scalar, 0.0)) {
-        throw astra::internals::exceptions::zero_division();
-    }
-
-    int rows = mat.num_row();
-    int cols = mat.num_col();
-
-    Matrix result(rows, cols);
-
-    for (int i = 0; i < rows * cols; ++i) {
-        result.values[i] = mat.values[i] / scalar;
-    }
-
-    return result;
-}
-
-int Matrix::num_row() const { return rows; }
-int Matrix::num_col() const { return cols; }
-
-void Matrix::print(int width) const {
+template <typename T>
+void BasicMatrix<T>::print(int width) const {
     for (int i = 0; i < rows; ++i) {
         std::cout << "[";
         for (int j = 0; j < cols; ++j) {
@@ -942,7 +948,8 @@ void Matrix::print(int width) const {
     }
 }
 
-std::ostream& operator<<(std::ostream& os, const Matrix& mat) {
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const BasicMatrix<T>& mat) {
     for (int i = 0; i < mat.rows; ++i) {
         os << "[";
         for (int j = 0; j < mat.cols; ++j) {
@@ -955,7 +962,8 @@ std::ostream& operator<<(std::ostream& os, const Matrix& mat) {
     return os;
 }
 
-std::istream& operator>>(std::istream& in, Matrix& mat) {
+template <typename T>
+std::istream& operator>>(std::istream& in, BasicMatrix<T>& mat) {
     int size = mat.rows * mat.cols;
     int i = 0;
     while (i < size && in >> mat.values[i]) {
@@ -963,8 +971,21 @@ std::istream& operator>>(std::istream& in, Matrix& mat) {
     }
 
     for (; i < size; ++i) {
-        mat.values[i] = 0.0;
+        mat.values[i] = T(0);
     }
     return in;
 }
+
+#define ASTRA_INSTANTIATE_MATRIX(T)                                            \
+    template class BasicMatrix<T>;                                             \
+    template std::ostream& operator<< <T>(std::ostream&,                       \
+                                          const BasicMatrix<T>&);              \
+    template std::istream& operator>> <T>(std::istream&, BasicMatrix<T>&);
+
+ASTRA_INSTANTIATE_MATRIX(float)
+ASTRA_INSTANTIATE_MATRIX(double)
+ASTRA_INSTANTIATE_MATRIX(std::complex<float>)
+ASTRA_INSTANTIATE_MATRIX(std::complex<double>)
+
+#undef ASTRA_INSTANTIATE_MATRIX
 } // namespace astra
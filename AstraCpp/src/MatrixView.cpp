@@ -0,0 +1,262 @@
+#include "pch.h"
+
+#include "../include/MatrixView.h"
+#include "../include/Matrix.h"
+#include "../include/Vector.h"
+#include "../internals/Exceptions.h"
+#include "../internals/MathUtils.h"
+#include "../internals/Gemm.h"
+#include "../internals/Simd.h"
+#include "../internals/ThreadPool.h"
+
+#include <algorithm>
+#include <complex>
+#include <iostream>
+#include <iomanip>
+
+namespace astra {
+
+template <typename T>
+BasicMatrixView<T>::BasicMatrixView(const T* data, int row, int col, int ld)
+    : data(data), rows(row), cols(col), ld(ld) {
+    if (rows <= 0 || cols <= 0) {
+        throw astra::internals::exceptions::invalid_size();
+    }
+    if (ld < cols) {
+        throw astra::internals::exceptions::invalid_argument();
+    }
+}
+
+template <typename T>
+BasicMatrixView<T>::BasicMatrixView(const BasicMatrix<T>& mat)
+    : data(mat.values), rows(mat.rows), cols(mat.cols), ld(mat.cols) {}
+
+template <typename T>
+int BasicMatrixView<T>::num_row() const { return rows; }
+template <typename T>
+int BasicMatrixView<T>::num_col() const { return cols; }
+template <typename T>
+int BasicMatrixView<T>::leading_dim() const { return ld; }
+
+template <typename T>
+BasicMatrixView<T> BasicMatrixView<T>::block(int r1, int c1, int r2,
+                                             int c2) const {
+    if (r1 < 0 || r1 >= rows || r2 < 0 || r2 >= rows || c1 < 0 || c1 >= cols ||
+        c2 < 0 || c2 >= cols) {
+        throw astra::internals::exceptions::index_out_of_range();
+    }
+    if (r1 > r2 || c1 > c2) {
+        throw astra::internals::exceptions::invalid_argument();
+    }
+    return BasicMatrixView(data + static_cast<long long>(r1) * ld + c1,
+                           r2 - r1 + 1, c2 - c1 + 1, ld);
+}
+
+template <typename T>
+BasicVectorView<T> BasicMatrixView<T>::row(int i) const {
+    if (i < 0 || i >= rows) {
+        throw astra::internals::exceptions::index_out_of_range();
+    }
+    return BasicVectorView<T>(data + static_cast<long long>(i) * ld, cols,
+                              1);
+}
+
+template <typename T>
+BasicVectorView<T> BasicMatrixView<T>::col(int j) const {
+    if (j < 0 || j >= cols) {
+        throw astra::internals::exceptions::index_out_of_range();
+    }
+    return BasicVectorView<T>(data + j, rows, ld);
+}
+
+template <typename T>
+T BasicMatrixView<T>::sum() const {
+    T total = T(0);
+    for (int i = 0; i < rows; ++i) {
+        total += internals::simd::sum(data + static_cast<long long>(i) * ld,
+                                      cols);
+    }
+    return total;
+}
+
+template <typename T>
+T BasicMatrixView<T>::trace() const {
+    if (!is_square()) {
+        throw astra::internals::exceptions::non_square_matrix();
+    }
+    T sum = T(0);
+    for (int i = 0; i < rows; ++i) {
+        sum += data[static_cast<long long>(i) * ld + i];
+    }
+    return sum;
+}
+
+template <typename T>
+bool BasicMatrixView<T>::is_square() const { return rows == cols; }
+
+template <typename T>
+bool BasicMatrixView<T>::is_symmetric() const {
+    if (!is_square()) {
+        return false;
+    }
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < i; ++j) {
+            if (!internals::mathutils::nearly_equal(
+                    data[static_cast<long long>(i) * ld + j],
+                    data[static_cast<long long>(j) * ld + i])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool BasicMatrixView<T>::is_upper_triangular() const {
+    if (!is_square()) {
+        return false;
+    }
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = 0; j < i; ++j) {
+            if (!internals::mathutils::nearly_equal(
+                    data[static_cast<long long>(i) * ld + j], T(0))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+bool BasicMatrixView<T>::is_lower_triangular() const {
+    if (!is_square()) {
+        return false;
+    }
+
+    for (int i = 0; i < rows; ++i) {
+        for (int j = i + 1; j < cols; ++j) {
+            if (!internals::mathutils::nearly_equal(
+                    data[static_cast<long long>(i) * ld + j], T(0))) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrixView<T>::rref(double tol) const {
+    BasicMatrix<T> rref(*this);
+    rref.rref_in_place(tol);
+    return rref;
+}
+
+template <typename T>
+int BasicMatrixView<T>::rank() const {
+    BasicMatrix<T> rref_matrix = this->rref();
+    int rank = 0;
+
+    for (int i = 0; i < rows; ++i) {
+        // Checking if the row is non-zero
+        bool non_zero_row = false;
+        for (int j = 0; j < cols; ++j) {
+            if (internals::mathutils::abs(rref_matrix(i, j)) >
+                1e-6) { // Avoiding floating-point errors
+                non_zero_row = true;
+                break;
+            }
+        }
+        if (non_zero_row) {
+            rank++;
+        }
+    }
+
+    return rank;
+}
+
+template <typename T>
+std::ostream& operator<<(std::ostream& os, const BasicMatrixView<T>& view) {
+    for (int i = 0; i < view.rows; ++i) {
+        os << "[";
+        for (int j = 0; j < view.cols; ++j) {
+            os << std::setw(8)
+               << view.data[static_cast<long long>(i) * view.ld + j];
+            if (j < view.cols - 1)
+                os << ", ";
+        }
+        os << "]" << std::endl;
+    }
+    return os;
+}
+
+template <typename T>
+BasicMatrix<T> BasicMatrixView<T>::multiply(const BasicMatrixView& lhs,
+                                            const BasicMatrixView& rhs) {
+    if (lhs.num_col() != rhs.num_row()) {
+        throw astra::internals::exceptions::
+            matrix_multiplication_size_mismatch();
+    }
+
+    BasicMatrix<T> result(lhs.num_row(), rhs.num_col());
+
+    internals::gemm::gemm(lhs.num_row(), rhs.num_col(), lhs.num_col(), T(1),
+                          &lhs(0, 0), lhs.leading_dim(), &rhs(0, 0),
+                          rhs.leading_dim(), T(0), &result(0, 0),
+                          result.num_col());
+
+    return result;
+}
+
+template <typename T>
+BasicVector<T> BasicMatrixView<T>::multiply(const BasicMatrixView& mat,
+                                            const BasicVectorView<T>& vec) {
+    if (mat.num_col() != vec.get_size()) {
+        throw astra::internals::exceptions::matrix_size_mismatch();
+    }
+    int rows = mat.num_row();
+    int cols = mat.num_col();
+    int ld = mat.leading_dim();
+    int stride = vec.get_stride();
+    BasicVector<T> result(rows);
+    const T* mat_values = &mat(0, 0);
+    const T* vec_values = &vec[0];
+    T* result_values = &result[0];
+
+    // split by rows, each thread needs at least MIN_PARALLEL_WORK entries
+    int grain = static_cast<int>(std::max(
+        1LL, internals::threading::MIN_PARALLEL_WORK / std::max(1, cols)));
+
+    internals::threading::parallel_for(0, rows, grain, [&](int lo, int hi) {
+        for (int i = lo; i < hi; ++i) {
+            const T* mat_row = mat_values + static_cast<long long>(i) * ld;
+            T sum = T(0);
+
+            if (stride == 1) {
+                sum = internals::simd::dot(mat_row, vec_values, cols);
+            }
+            else {
+                for (int j = 0; j < cols; ++j) {
+                    sum += mat_row[j] *
+                           vec_values[static_cast<long long>(j) * stride];
+                }
+            }
+            result_values[i] = sum;
+        }
+    });
+    return result;
+}
+
+#define ASTRA_INSTANTIATE_MATRIX_VIEW(T)                                       \
+    template class BasicMatrixView<T>;                                         \
+    template std::ostream& operator<< <T>(std::ostream&,                       \
+                                          const BasicMatrixView<T>&);
+
+ASTRA_INSTANTIATE_MATRIX_VIEW(float)
+ASTRA_INSTANTIATE_MATRIX_VIEW(double)
+ASTRA_INSTANTIATE_MATRIX_VIEW(std::complex<float>)
+ASTRA_INSTANTIATE_MATRIX_VIEW(std::complex<double>)
+
+#undef ASTRA_INSTANTIATE_MATRIX_VIEW
+} // namespace astra
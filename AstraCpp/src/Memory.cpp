@@ -0,0 +1,81 @@
+#include "pch.h"
+
+#include "../include/Allocator.h"
+#include "../internals/Memory.h"
+
+#include <atomic>
+#include <new>
+
+namespace astra {
+
+namespace {
+
+    // aligned operator new, available on every C++17 standard library
+    class DefaultAllocator : public Allocator {
+      public:
+        void* allocate(std::size_t bytes, std::size_t alignment) override {
+            return ::operator new(bytes, std::align_val_t(alignment),
+                                  std::nothrow);
+        }
+
+        void deallocate(void* ptr, std::size_t /*bytes*/,
+                        std::size_t alignment) override {
+            ::operator delete(ptr, std::align_val_t(alignment));
+        }
+    };
+
+    DefaultAllocator default_allocator;
+    std::atomic<Allocator*> current_allocator{&default_allocator};
+
+    // stored in the first ALIGNMENT bytes of every block, in front of the
+    // data, so a buffer is released to the allocator that created it
+    struct BlockHeader {
+        Allocator* owner;
+        std::size_t bytes;
+    };
+
+    static_assert(sizeof(BlockHeader) <= internals::memory::ALIGNMENT,
+                  "block header must fit in front of the aligned data");
+
+} // namespace
+
+namespace internals::memory {
+
+void* allocate_bytes(std::size_t bytes) {
+    std::size_t total = ALIGNMENT + bytes;
+
+    Allocator* owner = current_allocator.load(std::memory_order_acquire);
+    void* block = owner->allocate(total, ALIGNMENT);
+    if (block == nullptr) {
+        throw std::bad_alloc();
+    }
+
+    BlockHeader* header = static_cast<BlockHeader*>(block);
+    header->owner = owner;
+    header->bytes = total;
+
+    return static_cast<char*>(block) + ALIGNMENT;
+}
+
+void deallocate_bytes(void* ptr) noexcept {
+    if (ptr == nullptr) {
+        return;
+    }
+    void* block = static_cast<char*>(ptr) - ALIGNMENT;
+    BlockHeader* header = static_cast<BlockHeader*>(block);
+    header->owner->deallocate(block, header->bytes, ALIGNMENT);
+}
+
+} // namespace internals::memory
+
+void set_allocator(Allocator* allocator) {
+    if (allocator == nullptr) {
+        allocator = &default_allocator;
+    }
+    current_allocator.store(allocator, std::memory_order_release);
+}
+
+Allocator* get_allocator() {
+    return current_allocator.load(std::memory_order_acquire);
+}
+} // namespace astra
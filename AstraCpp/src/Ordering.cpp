@@ -0,0 +1,200 @@
+#include "pch.h"
+
+#include "../internals/Ordering.h"
+
+#include <algorithm>
+
+namespace astra::internals::ordering {
+
+namespace {
+
+// state of a node of the quotient graph
+const int VARIABLE = 0;
+const int ELEMENT = 1;
+const int ABSORBED = 2;
+
+// nodes of equal approximate degree in doubly linked lists
+class DegreeLists {
+  public:
+    explicit DegreeLists(int n) : head(n, -1), next(n, -1), prev(n, -1) {}
+
+    void insert(int i, int degree) {
+        next[i] = head[degree];
+        prev[i] = -1;
+        if (head[degree] >= 0) {
+            prev[head[degree]] = i;
+        }
+        head[degree] = i;
+    }
+
+    void remove(int i, int degree) {
+        if (prev[i] >= 0) {
+            next[prev[i]] = next[i];
+        }
+        else {
+            head[degree] = next[i];
+        }
+        if (next[i] >= 0) {
+            prev[next[i]] = prev[i];
+        }
+    }
+
+    int first(int degree) const { return head[degree]; }
+
+  private:
+    std::vector<int> head;
+    std::vector<int> next;
+    std::vector<int> prev;
+};
+
+} // namespace
+
+std::vector<int> minimum_degree(int n, const std::vector<int>& ptr,
+                                const std::vector<int>& idx) {
+    // adjacency of A + A^T without the diagonal, duplicates removed
+    std::vector<std::vector<int>> adj(n);
+    for (int i = 0; i < n; i++) {
+        for (int p = ptr[i]; p < ptr[i + 1]; p++) {
+            int j = idx[p];
+            if (j != i) {
+                adj[i].push_back(j);
+                adj[j].push_back(i);
+            }
+        }
+    }
+    std::vector<int> mark(n, -1);
+    for (int i = 0; i < n; i++) {
+        std::vector<int>& list = adj[i];
+        size_t kept = 0;
+        for (int j : list) {
+            if (mark[j] != i) {
+                mark[j] = i;
+                list[kept++] = j;
+            }
+        }
+        list.resize(kept);
+    }
+
+    // elems[i] lists the elements next to variable i, pattern[e] the
+    // variables of element e
+    std::vector<std::vector<int>> elems(n);
+    std::vector<std::vector<int>> pattern(n);
+    std::vector<int> state(n, VARIABLE);
+    std::vector<int> degree(n);
+    std::vector<int> external(n, 0);
+    std::vector<int> seen(n, -1);
+    DegreeLists lists(n);
+    for (int i = 0; i < n; i++) {
+        degree[i] = static_cast<int>(adj[i].size());
+        lists.insert(i, degree[i]);
+    }
+    std::fill(mark.begin(), mark.end(), -1);
+
+    std::vector<int> order;
+    order.reserve(n);
+    int min_degree = 0;
+    for (int k = 0; k < n; k++) {
+        while (lists.first(min_degree) < 0) {
+            min_degree++;
+        }
+        int p = lists.first(min_degree);
+        lists.remove(p, min_degree);
+        order.push_back(p);
+        state[p] = ELEMENT;
+
+        // L_p is the union of A_p and the patterns of the elements next to
+        // p, which are absorbed into the new element p
+        std::vector<int> lp;
+        mark[p] = k;
+        for (int j : adj[p]) {
+            if (state[j] == VARIABLE && mark[j] != k) {
+                mark[j] = k;
+                lp.push_back(j);
+            }
+        }
+        for (int e : elems[p]) {
+            if (state[e] != ELEMENT) {
+                continue;
+            }
+            for (int j : pattern[e]) {
+                if (state[j] == VARIABLE && mark[j] != k) {
+                    mark[j] = k;
+                    lp.push_back(j);
+                }
+            }
+            state[e] = ABSORBED;
+            std::vector<int>().swap(pattern[e]);
+        }
+        std::vector<int>().swap(adj[p]);
+        std::vector<int>().swap(elems[p]);
+
+        // the variables of L_p lose p and the absorbed elements, and drop
+        // the neighbours that element p now covers
+        for (int i : lp) {
+            lists.remove(i, degree[i]);
+            std::vector<int>& e_i = elems[i];
+            size_t kept = 0;
+            for (int e : e_i) {
+                if (state[e] == ELEMENT && e != p) {
+                    e_i[kept++] = e;
+                }
+            }
+            e_i.resize(kept);
+            e_i.push_back(p);
+
+            std::vector<int>& a_i = adj[i];
+            kept = 0;
+            for (int j : a_i) {
+                if (state[j] == VARIABLE && mark[j] != k) {
+                    a_i[kept++] = j;
+                }
+            }
+            a_i.resize(kept);
+        }
+
+        // external[e] = |L_e \ L_p| for the other elements next to L_p
+        for (int i : lp) {
+            for (int e : elems[i]) {
+                if (e == p) {
+                    continue;
+                }
+                if (seen[e] != k) {
+                    seen[e] = k;
+                    external[e] = static_cast<int>(pattern[e].size());
+                }
+                external[e]--;
+            }
+        }
+
+        int remaining = n - k - 1;
+        int lp_size = static_cast<int>(lp.size());
+        for (int i : lp) {
+            std::vector<int>& e_i = elems[i];
+            long long d = static_cast<long long>(adj[i].size()) + lp_size - 1;
+            size_t kept = 0;
+            for (int e : e_i) {
+                if (e != p && external[e] == 0) {
+                    // L_e lies within L_p, e is absorbed into p
+                    state[e] = ABSORBED;
+                    continue;
+                }
+                if (e != p && state[e] == ABSORBED) {
+                    continue;
+                }
+                if (e != p) {
+                    d += external[e];
+                }
+                e_i[kept++] = e;
+            }
+            e_i.resize(kept);
+            degree[i] = static_cast<int>(
+                std::min(d, static_cast<long long>(remaining - 1)));
+            lists.insert(i, degree[i]);
+            min_degree = std::min(min_degree, degree[i]);
+        }
+        pattern[p] = std::move(lp);
+    }
+    return order;
+}
+
+} // namespace astra::internals::ordering
@@ -0,0 +1,324 @@
+#include "pch.h"
+
+#include "../include/LUFactorization.h"
+#include "../include/Preconditioner.h"
+#include "../include/SparseMatrix.h"
+#include "../internals/Exceptions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+namespace astra {
+
+namespace {
+
+void check_square(const SparseMatrix& A) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+}
+
+// copies the rows of A, only the entries left of the diagonal when lower is
+// set, with a zero diagonal entry added where none is stored. diag
+// receives the position of each diagonal entry.
+void compress(const SparseMatrix& A, bool lower, std::vector<int>& row_ptr,
+              std::vector<int>& cols, std::vector<double>& vals,
+              std::vector<int>& diag) {
+    int n = A.num_row();
+    const std::vector<int>& a_ptr = A.row_pointers();
+    const std::vector<int>& a_cols = A.column_indices();
+    const std::vector<double>& a_vals = A.get_values();
+    row_ptr.assign(n + 1, 0);
+    diag.assign(n, 0);
+    cols.clear();
+    vals.clear();
+    cols.reserve(a_cols.size() + n);
+    vals.reserve(a_cols.size() + n);
+    for (int i = 0; i < n; i++) {
+        bool placed = false;
+        for (int p = a_ptr[i]; p < a_ptr[i + 1]; p++) {
+            int j = a_cols[p];
+            if (j > i && !placed) {
+                diag[i] = static_cast<int>(cols.size());
+                cols.push_back(i);
+                vals.push_back(0.0);
+                placed = true;
+            }
+            if (j > i && lower) {
+                break;
+            }
+            if (j == i) {
+                diag[i] = static_cast<int>(cols.size());
+                placed = true;
+            }
+            cols.push_back(j);
+            vals.push_back(a_vals[p]);
+        }
+        if (!placed) {
+            diag[i] = static_cast<int>(cols.size());
+            cols.push_back(i);
+            vals.push_back(0.0);
+        }
+        row_ptr[i + 1] = static_cast<int>(cols.size());
+    }
+}
+
+} // namespace
+
+JacobiPreconditioner::JacobiPreconditioner(const Matrix& A)
+    : JacobiPreconditioner(SparseMatrix(A)) {}
+
+JacobiPreconditioner::JacobiPreconditioner(const SparseMatrix& A) {
+    check_square(A);
+    int n = A.num_row();
+    Vector diagonal = A.diagonal();
+    inv_diag.resize(n);
+    for (int i = 0; i < n; i++) {
+        double d = diagonal[i];
+        if (d == 0) {
+            throw internals::exceptions::singular_matrix();
+        }
+        inv_diag[i] = 1 / d;
+    }
+}
+
+int JacobiPreconditioner::size() const {
+    return static_cast<int>(inv_diag.size());
+}
+
+void JacobiPreconditioner::apply(const Vector& r, Vector& z) const {
+    const double* rv = r.data();
+    double* zv = z.data();
+    int n = size();
+    for (int i = 0; i < n; i++) {
+        zv[i] = inv_diag[i] * rv[i];
+    }
+}
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(const Matrix& A,
+                                                     int block_size)
+    : BlockJacobiPreconditioner(SparseMatrix(A), block_size) {}
+
+BlockJacobiPreconditioner::BlockJacobiPreconditioner(const SparseMatrix& A,
+                                                     int block_size)
+    : n(A.num_row()), block_size(block_size) {
+    check_square(A);
+    if (block_size <= 0) {
+        throw internals::exceptions::invalid_argument();
+    }
+    const std::vector<int>& a_ptr = A.row_pointers();
+    const std::vector<int>& a_cols = A.column_indices();
+    const std::vector<double>& a_vals = A.get_values();
+
+    // the inverse of the block starting at row r0 is stored row-major at
+    // offset r0 * block_size, the blocks are at most block_size wide
+    inverses.resize(static_cast<size_t>(n) * block_size);
+    for (int r0 = 0; r0 < n; r0 += block_size) {
+        int nb = std::min(block_size, n - r0);
+        Matrix block(nb, nb);
+        for (int i = 0; i < nb; i++) {
+            auto first = a_cols.begin() + a_ptr[r0 + i];
+            auto last = a_cols.begin() + a_ptr[r0 + i + 1];
+            for (auto it = std::lower_bound(first, last, r0);
+                 it != last && *it < r0 + nb; ++it) {
+                block(i, *it - r0) = a_vals[it - a_cols.begin()];
+            }
+        }
+        Matrix inv = LUFactorization(std::move(block)).inverse();
+        std::copy(inv.data(), inv.data() + static_cast<size_t>(nb) * nb,
+                  inverses.data() + static_cast<size_t>(r0) * block_size);
+    }
+}
+
+int BlockJacobiPreconditioner::size() const { return n; }
+
+void BlockJacobiPreconditioner::apply(const Vector& r, Vector& z) const {
+    const double* rv = r.data();
+    double* zv = z.data();
+    for (int r0 = 0; r0 < n; r0 += block_size) {
+        int nb = std::min(block_size, n - r0);
+        const double* inv =
+            inverses.data() + static_cast<size_t>(r0) * block_size;
+        for (int i = 0; i < nb; i++) {
+            const double* row = inv + static_cast<long long>(i) * nb;
+            double value = 0;
+            for (int j = 0; j < nb; j++) {
+                value += row[j] * rv[r0 + j];
+            }
+            zv[r0 + i] = value;
+        }
+    }
+}
+
+SSORPreconditioner::SSORPreconditioner(const Matrix& A, double omega)
+    : SSORPreconditioner(SparseMatrix(A), omega) {}
+
+SSORPreconditioner::SSORPreconditioner(const SparseMatrix& A, double omega)
+    : n(A.num_row()), omega(omega) {
+    check_square(A);
+    if (!(omega > 0 && omega < 2)) {
+        throw internals::exceptions::invalid_argument();
+    }
+    compress(A, false, row_ptr, cols, vals, diag);
+    for (int i = 0; i < n; i++) {
+        if (vals[diag[i]] == 0) {
+            throw internals::exceptions::singular_matrix();
+        }
+    }
+}
+
+int SSORPreconditioner::size() const { return n; }
+
+void SSORPreconditioner::apply(const Vector& r, Vector& z) const {
+    const double* rv = r.data();
+    double* zv = z.data();
+
+    // (D + omega L) y = omega (2 - omega) r
+    double scale = omega * (2 - omega);
+    for (int i = 0; i < n; i++) {
+        double value = scale * rv[i];
+        for (int p = row_ptr[i]; p < diag[i]; p++) {
+            value -= omega * vals[p] * zv[cols[p]];
+        }
+        zv[i] = value / vals[diag[i]];
+    }
+
+    // (D + omega U) z = D y
+    for (int i = n - 1; i >= 0; i--) {
+        double d = vals[diag[i]];
+        double value = d * zv[i];
+        for (int p = diag[i] + 1; p < row_ptr[i + 1]; p++) {
+            value -= omega * vals[p] * zv[cols[p]];
+        }
+        zv[i] = value / d;
+    }
+}
+
+ILU0Preconditioner::ILU0Preconditioner(const Matrix& A)
+    : ILU0Preconditioner(SparseMatrix(A)) {}
+
+ILU0Preconditioner::ILU0Preconditioner(const SparseMatrix& A)
+    : n(A.num_row()) {
+    check_square(A);
+    compress(A, false, row_ptr, cols, vals, diag);
+
+    // row i is eliminated by the finished rows k < i in its pattern, pos
+    // maps a column to its entry in row i or -1 outside the pattern
+    std::vector<int> pos(n, -1);
+    for (int i = 0; i < n; i++) {
+        for (int p = row_ptr[i]; p < row_ptr[i + 1]; p++) {
+            pos[cols[p]] = p;
+        }
+        for (int p = row_ptr[i]; p < diag[i]; p++) {
+            int k = cols[p];
+            double factor = vals[p] / vals[diag[k]];
+            vals[p] = factor;
+            for (int q = diag[k] + 1; q < row_ptr[k + 1]; q++) {
+                int target = pos[cols[q]];
+                if (target >= 0) {
+                    vals[target] -= factor * vals[q];
+                }
+            }
+        }
+        for (int p = row_ptr[i]; p < row_ptr[i + 1]; p++) {
+            pos[cols[p]] = -1;
+        }
+        if (vals[diag[i]] == 0) {
+            throw internals::exceptions::singular_matrix();
+        }
+    }
+}
+
+int ILU0Preconditioner::size() const { return n; }
+
+void ILU0Preconditioner::apply(const Vector& r, Vector& z) const {
+    const double* rv = r.data();
+    double* zv = z.data();
+    for (int i = 0; i < n; i++) {
+        double value = rv[i];
+        for (int p = row_ptr[i]; p < diag[i]; p++) {
+            value -= vals[p] * zv[cols[p]];
+        }
+        zv[i] = value;
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        double value = zv[i];
+        for (int p = diag[i] + 1; p < row_ptr[i + 1]; p++) {
+            value -= vals[p] * zv[cols[p]];
+        }
+        zv[i] = value / vals[diag[i]];
+    }
+}
+
+IC0Preconditioner::IC0Preconditioner(const Matrix& A)
+    : IC0Preconditioner(SparseMatrix(A)) {}
+
+IC0Preconditioner::IC0Preconditioner(const SparseMatrix& A)
+    : n(A.num_row()) {
+    check_square(A);
+    if (!A.is_symmetric()) {
+        throw internals::exceptions::non_symmetric_matrix();
+    }
+    std::vector<int> diag;
+    compress(A, true, row_ptr, cols, vals, diag);
+
+    // l_ik = (a_ik - sum_j l_ij l_kj) / l_kk over the columns j < k in the
+    // patterns of both rows, found by merging the sorted rows
+    for (int i = 0; i < n; i++) {
+        int last = row_ptr[i + 1] - 1;
+        for (int p = row_ptr[i]; p <= last; p++) {
+            int k = cols[p];
+            double value = vals[p];
+            int q = row_ptr[k];
+            int q_end = row_ptr[k + 1] - 1;
+            for (int s = row_ptr[i]; s < p && q < q_end;) {
+                if (cols[s] == cols[q]) {
+                    value -= vals[s++] * vals[q++];
+                }
+                else if (cols[s] < cols[q]) {
+                    s++;
+                }
+                else {
+                    q++;
+                }
+            }
+            if (p < last) {
+                vals[p] = value / vals[q_end];
+                continue;
+            }
+            if (!(value > 0)) {
+                throw internals::exceptions::not_positive_definite();
+            }
+            vals[p] = std::sqrt(value);
+        }
+    }
+}
+
+int IC0Preconditioner::size() const { return n; }
+
+void IC0Preconditioner::apply(const Vector& r, Vector& z) const {
+    const double* rv = r.data();
+    double* zv = z.data();
+
+    // L y = r, then L^T z = y column by column of L^T, i.e. by rows of L
+    for (int i = 0; i < n; i++) {
+        int last = row_ptr[i + 1] - 1;
+        double value = rv[i];
+        for (int p = row_ptr[i]; p < last; p++) {
+            value -= vals[p] * zv[cols[p]];
+        }
+        zv[i] = value / vals[last];
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        int last = row_ptr[i + 1] - 1;
+        zv[i] /= vals[last];
+        double value = zv[i];
+        for (int p = row_ptr[i]; p < last; p++) {
+            zv[cols[p]] -= vals[p] * value;
+        }
+    }
+}
+
+} // namespace astra
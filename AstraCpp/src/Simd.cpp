@@ -0,0 +1,732 @@
+#include "pch.h"
+
+#include "../internals/Simd.h"
+
+#include <atomic>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) ||           \
+    defined(_M_IX86)
+#define ASTRA_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+#endif
+
+// GCC and Clang only emit instructions the target allows, so every
+// instruction set block below is compiled for its own target. MSVC accepts
+// all intrinsics without flags.
+#define ASTRA_PRAGMA(x) _Pragma(#x)
+#if defined(__clang__)
+#define ASTRA_TARGET_BEGIN(isa)                                                \
+    ASTRA_PRAGMA(clang attribute push(__attribute__((target(isa))),            \
+                                      apply_to = function))
+#define ASTRA_TARGET_END ASTRA_PRAGMA(clang attribute pop)
+#elif defined(__GNUC__)
+#define ASTRA_TARGET_BEGIN(isa)                                                \
+    ASTRA_PRAGMA(GCC push_options) ASTRA_PRAGMA(GCC target(isa))
+#define ASTRA_TARGET_END ASTRA_PRAGMA(GCC pop_options)
+#else
+#define ASTRA_TARGET_BEGIN(isa)
+#define ASTRA_TARGET_END
+#endif
+
+// the GEMM micro-kernel keeps its tile in registers only once the loops over
+// it are fully unrolled, which GCC does not do on its own at -O2
+#if defined(__clang__)
+#define ASTRA_UNROLL ASTRA_PRAGMA(unroll)
+#elif defined(__GNUC__)
+#define ASTRA_UNROLL ASTRA_PRAGMA(GCC unroll 32)
+#else
+#define ASTRA_UNROLL
+#endif
+
+namespace astra::internals::simd {
+
+namespace {
+
+    template <typename S>
+    struct Kernels {
+        S (*sum)(const S*, int);
+        S (*prod)(const S*, int);
+        S (*sum_sq)(const S*, int);
+        S (*dot)(const S*, const S*, int);
+        S (*min)(const S*, int);
+        S (*max)(const S*, int);
+        void (*fill)(S*, int, S);
+        void (*replace)(S*, int, S, S);
+        void (*add)(const S*, const S*, S*, int);
+        void (*sub)(const S*, const S*, S*, int);
+        void (*mul)(const S*, const S*, S*, int);
+        void (*div)(const S*, const S*, S*, int);
+        void (*mul_scalar)(const S*, S, S*, int);
+        void (*div_scalar)(const S*, S, S*, int);
+        int gemm_mr;
+        int gemm_nr;
+        void (*gemm)(int, S, const S*, const S*, S*, int, int, int);
+    };
+
+    // horizontal steps over a register spilled to memory, they run once per
+    // call and are shared by the wider registers of every instruction set
+    template <typename S, int W>
+    S fold_sum(const S* t) {
+        S total = t[0];
+        for (int i = 1; i < W; ++i) {
+            total += t[i];
+        }
+        return total;
+    }
+
+    template <typename S, int W>
+    S fold_prod(const S* t) {
+        S total = t[0];
+        for (int i = 1; i < W; ++i) {
+            total *= t[i];
+        }
+        return total;
+    }
+
+    template <typename S, int W>
+    S fold_min(const S* t) {
+        S m = t[0];
+        for (int i = 1; i < W; ++i) {
+            m = t[i] < m ? t[i] : m;
+        }
+        return m;
+    }
+
+    template <typename S, int W>
+    S fold_max(const S* t) {
+        S m = t[0];
+        for (int i = 1; i < W; ++i) {
+            m = t[i] > m ? t[i] : m;
+        }
+        return m;
+    }
+
+    // portable fallback, one element per "register"
+    namespace scalar {
+
+        template <typename V>
+        inline V loadu(const V* p) {
+            return *p;
+        }
+        template <typename V>
+        inline void storeu(V* p, V v) {
+            *p = v;
+        }
+        template <typename V>
+        inline V set1(V x) {
+            return x;
+        }
+        template <typename V>
+        inline V vadd(V a, V b) {
+            return a + b;
+        }
+        template <typename V>
+        inline V vsub(V a, V b) {
+            return a - b;
+        }
+        template <typename V>
+        inline V vmul(V a, V b) {
+            return a * b;
+        }
+        template <typename V>
+        inline V vdiv(V a, V b) {
+            return a / b;
+        }
+        template <typename V>
+        inline V vmin(V a, V b) {
+            return b < a ? b : a;
+        }
+        template <typename V>
+        inline V vmax(V a, V b) {
+            return b > a ? b : a;
+        }
+        template <typename V>
+        inline V vfmadd(V a, V b, V c) {
+            return a * b + c;
+        }
+        template <typename V>
+        inline V vreplace(V a, V old_v, V new_v) {
+            return a == old_v ? new_v : a;
+        }
+        template <typename V>
+        inline V hsum(V a) {
+            return a;
+        }
+        template <typename V>
+        inline V hprod(V a) {
+            return a;
+        }
+        template <typename V>
+        inline V hmin(V a) {
+            return a;
+        }
+        template <typename V>
+        inline V hmax(V a) {
+            return a;
+        }
+
+        namespace f64 {
+            using S = double;
+            using V = double;
+            const int W = 1;
+            const int GEMM_MR = 4;
+            const int GEMM_NV = 4;
+
+#include "../internals/SimdKernels.inl"
+
+        } // namespace f64
+
+        namespace f32 {
+            using S = float;
+            using V = float;
+            const int W = 1;
+            const int GEMM_MR = 4;
+            const int GEMM_NV = 4;
+
+#include "../internals/SimdKernels.inl"
+
+        } // namespace f32
+
+    } // namespace scalar
+
+#if defined(ASTRA_X86)
+
+    ASTRA_TARGET_BEGIN("sse2")
+    namespace sse2 {
+
+        namespace f64 {
+            using S = double;
+            using V = __m128d;
+            const int W = 2;
+            // 12 accumulators, 2 rows of B and a broadcast in 16 registers
+            const int GEMM_MR = 6;
+            const int GEMM_NV = 2;
+
+            inline V loadu(const S* p) { return _mm_loadu_pd(p); }
+            inline void storeu(S* p, V v) { _mm_storeu_pd(p, v); }
+            inline V set1(S x) { return _mm_set1_pd(x); }
+            inline V vadd(V a, V b) { return _mm_add_pd(a, b); }
+            inline V vsub(V a, V b) { return _mm_sub_pd(a, b); }
+            inline V vmul(V a, V b) { return _mm_mul_pd(a, b); }
+            inline V vdiv(V a, V b) { return _mm_div_pd(a, b); }
+            inline V vfmadd(V a, V b, V c) {
+                return _mm_add_pd(_mm_mul_pd(a, b), c);
+            }
+            inline V vmin(V a, V b) { return _mm_min_pd(a, b); }
+            inline V vmax(V a, V b) { return _mm_max_pd(a, b); }
+            inline V vreplace(V a, V old_v, V new_v) {
+                // no blend before SSE4.1, select with masks
+                V mask = _mm_cmpeq_pd(a, old_v);
+                return _mm_or_pd(_mm_and_pd(mask, new_v),
+                                 _mm_andnot_pd(mask, a));
+            }
+            inline S hsum(V a) {
+                return _mm_cvtsd_f64(_mm_add_sd(a, _mm_unpackhi_pd(a, a)));
+            }
+            inline S hprod(V a) {
+                return _mm_cvtsd_f64(_mm_mul_sd(a, _mm_unpackhi_pd(a, a)));
+            }
+            inline S hmin(V a) {
+                return _mm_cvtsd_f64(_mm_min_sd(a, _mm_unpackhi_pd(a, a)));
+            }
+            inline S hmax(V a) {
+                return _mm_cvtsd_f64(_mm_max_sd(a, _mm_unpackhi_pd(a, a)));
+            }
+
+#include "../internals/SimdKernels.inl"
+
+        } // namespace f64
+
+        namespace f32 {
+            using S = float;
+            using V = __m128;
+            const int W = 4;
+            const int GEMM_MR = 6;
+            const int GEMM_NV = 2;
+
+            inline V loadu(const S* p) { return _mm_loadu_ps(p); }
+            inline void storeu(S* p, V v) { _mm_storeu_ps(p, v); }
+            inline V set1(S x) { return _mm_set1_ps(x); }
+            inline V vadd(V a, V b) { return _mm_add_ps(a, b); }
+            inline V vsub(V a, V b) { return _mm_sub_ps(a, b); }
+            inline V vmul(V a, V b) { return _mm_mul_ps(a, b); }
+            inline V vdiv(V a, V b) { return _mm_div_ps(a, b); }
+            inline V vfmadd(V a, V b, V c) {
+                return _mm_add_ps(_mm_mul_ps(a, b), c);
+            }
+            inline V vmin(V a, V b) { return _mm_min_ps(a, b); }
+            inline V vmax(V a, V b) { return _mm_max_ps(a, b); }
+            inline V vreplace(V a, V old_v, V new_v) {
+                V mask = _mm_cmpeq_ps(a, old_v);
+                return _mm_or_ps(_mm_and_ps(mask, new_v),
+                                 _mm_andnot_ps(mask, a));
+            }
+            inline S hsum(V a) {
+                alignas(16) S t[W];
+                _mm_store_ps(t, a);
+                return fold_sum<S, W>(t);
+            }
+            inline S hprod(V a) {
+                alignas(16) S t[W];
+                _mm_store_ps(t, a);
+                return fold_prod<S, W>(t);
+            }
+            inline S hmin(V a) {
+                alignas(16) S t[W];
+                _mm_store_ps(t, a);
+                return fold_min<S, W>(t);
+            }
+            inline S hmax(V a) {
+                alignas(16) S t[W];
+                _mm_store_ps(t, a);
+                return fold_max<S, W>(t);
+            }
+
+#include "../internals/SimdKernels.inl"
+
+        } // namespace f32
+
+    } // namespace sse2
+    ASTRA_TARGET_END
+
+    ASTRA_TARGET_BEGIN("avx2,fma")
+    namespace avx2 {
+
+        namespace f64 {
+            using S = double;
+            using V = __m256d;
+            const int W = 4;
+            const int GEMM_MR = 6;
+            const int GEMM_NV = 2;
+
+            inline V loadu(const S* p) { return _mm256_loadu_pd(p); }
+            inline void storeu(S* p, V v) { _mm256_storeu_pd(p, v); }
+            inline V set1(S x) { return _mm256_set1_pd(x); }
+            inline V vadd(V a, V b) { return _mm256_add_pd(a, b); }
+            inline V vsub(V a, V b) { return _mm256_sub_pd(a, b); }
+            inline V vmul(V a, V b) { return _mm256_mul_pd(a, b); }
+            inline V vdiv(V a, V b) { return _mm256_div_pd(a, b); }
+            inline V vfmadd(V a, V b, V c) {
+                return _mm256_fmadd_pd(a, b, c);
+            }
+            inline V vmin(V a, V b) { return _mm256_min_pd(a, b); }
+            inline V vmax(V a, V b) { return _mm256_max_pd(a, b); }
+            inline V vreplace(V a, V old_v, V new_v) {
+                return _mm256_blendv_pd(a, new_v,
+                                        _mm256_cmp_pd(a, old_v, _CMP_EQ_OQ));
+            }
+            inline S hsum(V a) {
+                __m128d x = _mm_add_pd(_mm256_castpd256_pd128(a),
+                                       _mm256_extractf128_pd(a, 1));
+                return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x)));
+            }
+            inline S hprod(V a) {
+                __m128d x = _mm_mul_pd(_mm256_castpd256_pd128(a),
+                                       _mm256_extractf128_pd(a, 1));
+                return _mm_cvtsd_f64(_mm_mul_sd(x, _mm_unpackhi_pd(x, x)));
+            }
+            inline S hmin(V a) {
+                __m128d x = _mm_min_pd(_mm256_castpd256_pd128(a),
+                                       _mm256_extractf128_pd(a, 1));
+                return _mm_cvtsd_f64(_mm_min_sd(x, _mm_unpackhi_pd(x, x)));
+            }
+            inline S hmax(V a) {
+                __m128d x = _mm_max_pd(_mm256_castpd256_pd128(a),
+                                       _mm256_extractf128_pd(a, 1));
+                return _mm_cvtsd_f64(_mm_max_sd(x, _mm_unpackhi_pd(x, x)));
+            }
+
+#include "../internals/SimdKernels.inl"
+
+        } // namespace f64
+
+        namespace f32 {
+            using S = float;
+            using V = __m256;
+            const int W = 8;
+            const int GEMM_MR = 6;
+            const int GEMM_NV = 2;
+
+            inline V loadu(const S* p) { return _mm256_loadu_ps(p); }
+            inline void storeu(S* p, V v) { _mm256_storeu_ps(p, v); }
+            inline V set1(S x) { return _mm256_set1_ps(x); }
+            inline V vadd(V a, V b) { return _mm256_add_ps(a, b); }
+            inline V vsub(V a, V b) { return _mm256_sub_ps(a, b); }
+            inline V vmul(V a, V b) { return _mm256_mul_ps(a, b); }
+            inline V vdiv(V a, V b) { return _mm256_div_ps(a, b); }
+            inline V vfmadd(V a, V b, V c) {
+                return _mm256_fmadd_ps(a, b, c);
+            }
+            inline V vmin(V a, V b) { return _mm256_min_ps(a, b); }
+            inline V vmax(V a, V b) { return _mm256_max_ps(a, b); }
+            inline V vreplace(V a, V old_v, V new_v) {
+                return _mm256_blendv_ps(a, new_v,
+                                        _mm256_cmp_ps(a, old_v, _CMP_EQ_OQ));
+            }
+            inline S hsum(V a) {
+                alignas(32) S t[W];
+                _mm256_store_ps(t, a);
+                return fold_sum<S, W>(t);
+            }
+            inline S hprod(V a) {
+                alignas(32) S t[W];
+                _mm256_store_ps(t, a);
+                return fold_prod<S, W>(t);
+            }
+            inline S hmin(V a) {
+                alignas(32) S t[W];
+                _mm256_store_ps(t, a);
+                return fold_min<S, W>(t);
+            }
+            inline S hmax(V a) {
+                alignas(32) S t[W];
+                _mm256_store_ps(t, a);
+                return fold_max<S, W>(t);
+            }
+
+#include "../internals/SimdKernels.inl"
+
+        } // namespace f32
+
+    } // namespace avx2
+    ASTRA_TARGET_END
+
+    ASTRA_TARGET_BEGIN("avx512f")
+    namespace avx512 {
+
+        // the unmasked min/max read an undefined source register, which some
+        // GCC versions warn about, the all-lanes masked form does not. The
+        // horizontal steps go through memory rather than the _mm512_reduce_*
+        // sequences for the same reason.
+
+        namespace f64 {
+            using S = double;
+            using V = __m512d;
+            const int W = 8;
+            // 24 accumulators of the 32 registers
+            const int GEMM_MR = 12;
+            const int GEMM_NV = 2;
+
+            inline V loadu(const S* p) { return _mm512_loadu_pd(p); }
+            inline void storeu(S* p, V v) { _mm512_storeu_pd(p, v); }
+            inline V set1(S x) { return _mm512_set1_pd(x); }
+            inline V vadd(V a, V b) { return _mm512_add_pd(a, b); }
+            inline V vsub(V a, V b) { return _mm512_sub_pd(a, b); }
+            inline V vmul(V a, V b) { return _mm512_mul_pd(a, b); }
+            inline V vdiv(V a, V b) { return _mm512_div_pd(a, b); }
+            inline V vfmadd(V a, V b, V c) {
+                return _mm512_fmadd_pd(a, b, c);
+            }
+            inline V vmin(V a, V b) {
+                return _mm512_mask_min_pd(a, 0xFF, a, b);
+            }
+            inline V vmax(V a, V b) {
+                return _mm512_mask_max_pd(a, 0xFF, a, b);
+            }
+            inline V vreplace(V a, V old_v, V new_v) {
+                __mmask8 eq = _mm512_cmp_pd_mask(a, old_v, _CMP_EQ_OQ);
+                return _mm512_mask_blend_pd(eq, a, new_v);
+            }
+            inline S hsum(V a) {
+                alignas(64) S t[W];
+                _mm512_store_pd(t, a);
+                return fold_sum<S, W>(t);
+            }
+            inline S hprod(V a) {
+                alignas(64) S t[W];
+                _mm512_store_pd(t, a);
+                return fold_prod<S, W>(t);
+            }
+            inline S hmin(V a) {
+                alignas(64) S t[W];
+                _mm512_store_pd(t, a);
+                return fold_min<S, W>(t);
+            }
+            inline S hmax(V a) {
+                alignas(64) S t[W];
+                _mm512_store_pd(t, a);
+                return fold_max<S, W>(t);
+            }
+
+#include "../internals/SimdKernels.inl"
+
+        } // namespace f64
+
+        namespace f32 {
+            using S = float;
+            using V = __m512;
+            const int W = 16;
+            const int GEMM_MR = 12;
+            const int GEMM_NV = 2;
+
+            inline V loadu(const S* p) { return _mm512_loadu_ps(p); }
+            inline void storeu(S* p, V v) { _mm512_storeu_ps(p, v); }
+            inline V set1(S x) { return _mm512_set1_ps(x); }
+            inline V vadd(V a, V b) { return _mm512_add_ps(a, b); }
+            inline V vsub(V a, V b) { return _mm512_sub_ps(a, b); }
+            inline V vmul(V a, V b) { return _mm512_mul_ps(a, b); }
+            inline V vdiv(V a, V b) { return _mm512_div_ps(a, b); }
+            inline V vfmadd(V a, V b, V c) {
+                return _mm512_fmadd_ps(a, b, c);
+            }
+            inline V vmin(V a, V b) {
+                return _mm512_mask_min_ps(a, 0xFFFF, a, b);
+            }
+            inline V vmax(V a, V b) {
+                return _mm512_mask_max_ps(a, 0xFFFF, a, b);
+            }
+            inline V vreplace(V a, V old_v, V new_v) {
+                __mmask16 eq = _mm512_cmp_ps_mask(a, old_v, _CMP_EQ_OQ);
+                return _mm512_mask_blend_ps(eq, a, new_v);
+            }
+            inline S hsum(V a) {
+                alignas(64) S t[W];
+                _mm512_store_ps(t, a);
+                return fold_sum<S, W>(t);
+            }
+            inline S hprod(V a) {
+                alignas(64) S t[W];
+                _mm512_store_ps(t, a);
+                return fold_prod<S, W>(t);
+            }
+            inline S hmin(V a) {
+                alignas(64) S t[W];
+                _mm512_store_ps(t, a);
+                return fold_min<S, W>(t);
+            }
+            inline S hmax(V a) {
+                alignas(64) S t[W];
+                _mm512_store_ps(t, a);
+                return fold_max<S, W>(t);
+            }
+
+#include "../internals/SimdKernels.inl"
+
+        } // namespace f32
+
+    } // namespace avx512
+    ASTRA_TARGET_END
+
+#endif // ASTRA_X86
+
+    Isa detect() {
+#if defined(ASTRA_X86)
+#if defined(_MSC_VER) && !defined(__clang__)
+        int info[4];
+        __cpuid(info, 0);
+        int max_leaf = info[0];
+
+        __cpuid(info, 1);
+        bool sse2 = (info[3] & (1 << 26)) != 0;
+        bool osxsave = (info[2] & (1 << 27)) != 0;
+        bool avx = (info[2] & (1 << 28)) != 0;
+        bool fma = (info[2] & (1 << 12)) != 0;
+
+        // the OS must save the YMM (and ZMM) registers on context switches
+        unsigned long long xcr0 = osxsave ? _xgetbv(0) : 0;
+        bool ymm_state = (xcr0 & 0x6) == 0x6;
+        bool zmm_state = (xcr0 & 0xE6) == 0xE6;
+
+        int ebx7 = 0;
+        if (max_leaf >= 7) {
+            __cpuidex(info, 7, 0);
+            ebx7 = info[1];
+        }
+
+        if (avx && zmm_state && (ebx7 & (1 << 16))) {
+            return Isa::avx512;
+        }
+        if (avx && fma && ymm_state && (ebx7 & (1 << 5))) {
+            return Isa::avx2;
+        }
+        return sse2 ? Isa::sse2 : Isa::scalar;
+#else
+        // also checks that the OS has enabled the wider register state
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f")) {
+            return Isa::avx512;
+        }
+        if (__builtin_cpu_supports("avx2") &&
+            __builtin_cpu_supports("fma")) {
+            return Isa::avx2;
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return Isa::sse2;
+        }
+        return Isa::scalar;
+#endif
+#else
+        return Isa::scalar;
+#endif
+    }
+
+    // the kernel table of one element type for an instruction set, the
+    // namespace picks f64 or f32
+#if defined(ASTRA_X86)
+#define ASTRA_TABLE_FOR(ns)                                                    \
+    switch (isa) {                                                             \
+    case Isa::avx512:                                                          \
+        return &avx512::ns::kernels;                                           \
+    case Isa::avx2:                                                            \
+        return &avx2::ns::kernels;                                             \
+    case Isa::sse2:                                                            \
+        return &sse2::ns::kernels;                                             \
+    default:                                                                   \
+        return &scalar::ns::kernels;                                           \
+    }
+#else
+#define ASTRA_TABLE_FOR(ns) return &scalar::ns::kernels;
+#endif
+
+    const Kernels<double>* f64_table_for(Isa isa) { ASTRA_TABLE_FOR(f64) }
+
+    const Kernels<float>* f32_table_for(Isa isa) { ASTRA_TABLE_FOR(f32) }
+
+#undef ASTRA_TABLE_FOR
+
+    struct Dispatch {
+        std::atomic<Isa> isa;
+        std::atomic<const Kernels<double>*> f64;
+        std::atomic<const Kernels<float>*> f32;
+
+        Dispatch()
+            : isa(detected_isa()), f64(f64_table_for(detected_isa())),
+              f32(f32_table_for(detected_isa())) {}
+    };
+
+    // function-local so the kernels are usable during static initialization
+    Dispatch& dispatch() {
+        static Dispatch instance;
+        return instance;
+    }
+
+    const Kernels<double>& active(const double*) {
+        return *dispatch().f64.load(std::memory_order_relaxed);
+    }
+
+    const Kernels<float>& active(const float*) {
+        return *dispatch().f32.load(std::memory_order_relaxed);
+    }
+
+} // namespace
+
+Isa detected_isa() {
+    static const Isa isa = detect();
+    return isa;
+}
+
+Isa active_isa() { return dispatch().isa.load(std::memory_order_relaxed); }
+
+Isa set_isa(Isa isa) {
+    if (isa > detected_isa()) {
+        isa = detected_isa();
+    }
+    dispatch().isa.store(isa, std::memory_order_relaxed);
+    dispatch().f64.store(f64_table_for(isa), std::memory_order_relaxed);
+    dispatch().f32.store(f32_table_for(isa), std::memory_order_relaxed);
+    return isa;
+}
+
+double sum(const double* a, int n) { return active(a).sum(a, n); }
+
+double prod(const double* a, int n) { return active(a).prod(a, n); }
+
+double sum_sq(const double* a, int n) { return active(a).sum_sq(a, n); }
+
+double dot(const double* a, const double* b, int n) {
+    return active(a).dot(a, b, n);
+}
+
+double min(const double* a, int n) { return active(a).min(a, n); }
+
+double max(const double* a, int n) { return active(a).max(a, n); }
+
+void fill(double* a, int n, double val) { active(a).fill(a, n, val); }
+
+void replace(double* a, int n, double old_val, double new_val) {
+    active(a).replace(a, n, old_val, new_val);
+}
+
+void add(const double* a, const double* b, double* dst, int n) {
+    active(a).add(a, b, dst, n);
+}
+
+void sub(const double* a, const double* b, double* dst, int n) {
+    active(a).sub(a, b, dst, n);
+}
+
+void mul(const double* a, const double* b, double* dst, int n) {
+    active(a).mul(a, b, dst, n);
+}
+
+void div(const double* a, const double* b, double* dst, int n) {
+    active(a).div(a, b, dst, n);
+}
+
+void mul_scalar(const double* a, double s, double* dst, int n) {
+    active(a).mul_scalar(a, s, dst, n);
+}
+
+void div_scalar(const double* a, double s, double* dst, int n) {
+    active(a).div_scalar(a, s, dst, n);
+}
+
+float sum(const float* a, int n) { return active(a).sum(a, n); }
+
+float prod(const float* a, int n) { return active(a).prod(a, n); }
+
+float sum_sq(const float* a, int n) { return active(a).sum_sq(a, n); }
+
+float dot(const float* a, const float* b, int n) {
+    return active(a).dot(a, b, n);
+}
+
+float min(const float* a, int n) { return active(a).min(a, n); }
+
+float max(const float* a, int n) { return active(a).max(a, n); }
+
+void fill(float* a, int n, float val) { active(a).fill(a, n, val); }
+
+void replace(float* a, int n, float old_val, float new_val) {
+    active(a).replace(a, n, old_val, new_val);
+}
+
+void add(const float* a, const float* b, float* dst, int n) {
+    active(a).add(a, b, dst, n);
+}
+
+void sub(const float* a, const float* b, float* dst, int n) {
+    active(a).sub(a, b, dst, n);
+}
+
+void mul(const float* a, const float* b, float* dst, int n) {
+    active(a).mul(a, b, dst, n);
+}
+
+void div(const float* a, const float* b, float* dst, int n) {
+    active(a).div(a, b, dst, n);
+}
+
+void mul_scalar(const float* a, float s, float* dst, int n) {
+    active(a).mul_scalar(a, s, dst, n);
+}
+
+void div_scalar(const float* a, float s, float* dst, int n) {
+    active(a).div_scalar(a, s, dst, n);
+}
+
+template <>
+GemmKernel<double> gemm_kernel<double>() {
+    const Kernels<double>& k = active(static_cast<const double*>(nullptr));
+    return {k.gemm_mr, k.gemm_nr, k.gemm};
+}
+
+template <>
+GemmKernel<float> gemm_kernel<float>() {
+    const Kernels<float>& k = active(static_cast<const float*>(nullptr));
+    return {k.gemm_mr, k.gemm_nr, k.gemm};
+}
+} // namespace astra::internals::simd
@@ -1,14 +1,632 @@
 #include "pch.h"
 
+#include "../include/BandedMatrix.h"
+#include "../include/CirculantMatrix.h"
 #include "../include/Matrix.h"
 #include "../internals/Exceptions.h"
 #include "../include/Decomposer.h"
+#include "../include/LUFactorization.h"
+#include "../include/Preconditioner.h"
 #include "../include/Solver.h"
+#include "../include/SparseFactorization.h"
+#include "../include/SparseMatrix.h"
+#include "../include/SymmetricMatrix.h"
+#include "../include/ToeplitzMatrix.h"
+#include "../include/TriangularMatrix.h"
+#include "../include/TridiagonalMatrix.h"
 #include "../include/Vector.h"
+#include "../internals/Fft.h"
+#include "../internals/Gemm.h"
+#include "../internals/MathUtils.h"
+#include "../internals/Simd.h"
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <utility>
+#include <vector>
 
 namespace astra {
 
-Vector Solver::forward_sub(Matrix L, Vector b) {
+namespace {
+
+// solves L L^T x = b for the Cholesky factor L. L^T is applied column by
+// column so that both substitutions read L along its rows.
+Vector cholesky_solve(const Matrix& L, const VectorView& b) {
+    int n = L.num_row();
+    const double* l = L.data();
+    Vector x(b);
+    double* xv = x.data();
+
+    for (int i = 0; i < n; i++) {
+        const double* row = l + static_cast<long long>(i) * n;
+        double value = xv[i];
+        for (int p = 0; p < i; p++) {
+            value -= row[p] * xv[p];
+        }
+        xv[i] = value / row[i];
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        const double* row = l + static_cast<long long>(i) * n;
+        xv[i] /= row[i];
+        for (int p = 0; p < i; p++) {
+            xv[p] -= row[p] * xv[i];
+        }
+    }
+    return x;
+}
+
+// the factorizations read one triangle only, so the symmetric solvers are
+// taken only when the two triangles agree exactly
+bool exactly_symmetric(const MatrixView& A) {
+    int n = A.num_row();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < i; j++) {
+            if (A.unchecked(i, j) != A.unchecked(j, i)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// true when a pivot L(k, k)^2 of a Cholesky factor is zero within the
+// tolerance LUFactorization skips its pivots with, such a system is left to
+// the rank based classification
+bool negligible_pivot(const Matrix& L) {
+    int n = L.num_row();
+    const double* l = L.data();
+    for (int k = 0; k < n; k++) {
+        double pivot = l[static_cast<long long>(k) * n + k];
+        if (internals::mathutils::nearly_equal(pivot * pivot, 0.0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// the same for L in packed storage, where row i starts at i * (i + 1) / 2
+bool negligible_pivot(const TriangularMatrix& L) {
+    int n = L.num_row();
+    const double* l = L.data();
+    for (int k = 0; k < n; k++) {
+        double pivot = l[static_cast<long long>(k) * (k + 1) / 2 + k];
+        if (internals::mathutils::nearly_equal(pivot * pivot, 0.0)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+Vector cholesky_solve(const TriangularMatrix& L, const Vector& b) {
+    int n = L.num_row();
+    const double* l = L.data();
+    Vector x(b);
+    double* xv = x.data();
+
+    for (int i = 0; i < n; i++) {
+        const double* row = l + static_cast<long long>(i) * (i + 1) / 2;
+        xv[i] = (xv[i] - internals::simd::dot(row, xv, i)) / row[i];
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        const double* row = l + static_cast<long long>(i) * (i + 1) / 2;
+        xv[i] /= row[i];
+        for (int p = 0; p < i; p++) {
+            xv[p] -= row[p] * xv[i];
+        }
+    }
+    return x;
+}
+
+// solves T x = b for the Toeplitz T(i, j) = t[i - j] by the Levinson
+// recursion. f and g solve T_k f = e_0 and T_k g = e_(k-1) for the leading
+// k x k block, extended by a zero each is off by a single entry in the
+// new row (ef) or the new first row (eg), and a combination of the two
+// cancels it. For symmetric T, g is f reversed and only f is kept
+// (Levinson-Durbin), which halves the work.
+// Without pivoting the recursion breaks down on a singular leading block and
+// loses accuracy near one, so it returns false, leaving x unfinished, once
+// t[0] or a denominator is below sqrt(eps) relative to the terms it is
+// formed from.
+bool levinson(const ToeplitzMatrix& T, const Vector& b, Vector& x) {
+    int n = T.num_row();
+    const std::vector<double>& col = T.first_column();
+    const std::vector<double>& row = T.first_row();
+    bool symmetric = T.is_symmetric();
+    const double tol = std::sqrt(std::numeric_limits<double>::epsilon());
+
+    double largest = 0;
+    for (int k = 0; k < n; k++) {
+        largest = std::max({largest, std::abs(col[k]), std::abs(row[k])});
+    }
+    if (!(std::abs(col[0]) > tol * largest)) {
+        return false;
+    }
+
+    std::vector<double> f(n, 0.0);
+    std::vector<double> g(symmetric ? 0 : n, 0.0);
+    f[0] = 1 / col[0];
+    if (!symmetric) {
+        g[0] = f[0];
+    }
+    x[0] = b[0] / col[0];
+
+    for (int k = 1; k < n; k++) {
+        // errors of the extended vectors in the new last and first rows
+        double ef = 0;
+        double eg = 0;
+        for (int j = 0; j < k; j++) {
+            ef += col[k - j] * f[j];
+        }
+        if (symmetric) {
+            eg = ef;
+        }
+        else {
+            for (int j = 0; j < k; j++) {
+                eg += row[j + 1] * g[j];
+            }
+        }
+        double denom = 1 - ef * eg;
+        if (!(std::abs(denom) > tol * std::max(1.0, std::abs(ef * eg)))) {
+            // the leading (k + 1) x (k + 1) block is nearly singular
+            return false;
+        }
+
+        // f <- ([f; 0] - ef [0; g]) / denom, g <- ([0; g] - eg [f; 0])
+        if (symmetric) {
+            for (int j = 0; j <= k / 2; j++) {
+                double lo = f[j];
+                double hi = f[k - j];
+                f[j] = (lo - ef * hi) / denom;
+                f[k - j] = (hi - ef * lo) / denom;
+            }
+        }
+        else {
+            for (int j = k; j > 0; j--) {
+                g[j] = g[j - 1];
+            }
+            g[0] = 0;
+            for (int j = 0; j <= k; j++) {
+                double fj = f[j];
+                f[j] = (fj - ef * g[j]) / denom;
+                g[j] = (g[j] - eg * fj) / denom;
+            }
+        }
+
+        // x <- [x; 0] + (b[k] - row k of T times [x; 0]) g
+        double ex = 0;
+        for (int j = 0; j < k; j++) {
+            ex += col[k - j] * x[j];
+        }
+        double scale = b[k] - ex;
+        for (int j = 0; j <= k; j++) {
+            x[j] += scale * (symmetric ? f[k - j] : g[j]);
+        }
+    }
+    return true;
+}
+
+// the diagonal entries of the k x k triangle R of an m x n QR factorization,
+// stored with leading dimension ld, below max(m, n) * eps * max |R(i, i)|
+// count as zero, so the rank test does not depend on the scale of A
+double rank_tolerance(const double* r, int ld, int k, int m, int n) {
+    double largest = 0;
+    for (int i = 0; i < k; i++) {
+        const double* row = r + static_cast<long long>(i) * ld;
+        largest = std::max(largest, std::abs(row[i]));
+    }
+    return std::max(m, n) * std::numeric_limits<double>::epsilon() * largest;
+}
+
+// solves A x = b from the LDL^T factors of A into the n-vector x, returns
+// false without touching x when D is singular, with 1x1 pivots zero within
+// the tolerance of LUFactorization
+bool ldlt_solve(const Decomposer::LDLTResult& f, const VectorView& b,
+                Vector& x) {
+    int n = f.L.num_row();
+    const double* l = f.L.data();
+    const double* d = f.D.data();
+
+    std::vector<double> y(n);
+    for (int i = 0; i < n; i++) {
+        y[i] = b[f.perm[i]];
+    }
+
+    for (int i = 0; i < n; i++) {
+        const double* row = l + static_cast<long long>(i) * n;
+        for (int p = 0; p < i; p++) {
+            y[i] -= row[p] * y[p];
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        double d11 = d[i * n + i];
+        if (i + 1 < n && d[(i + 1) * n + i] != 0) {
+            double d21 = d[(i + 1) * n + i];
+            double d22 = d[(i + 1) * n + i + 1];
+            double det = d11 * d22 - d21 * d21;
+            if (det == 0) {
+                return false;
+            }
+            double y0 = y[i];
+            double y1 = y[i + 1];
+            y[i] = (d22 * y0 - d21 * y1) / det;
+            y[i + 1] = (d11 * y1 - d21 * y0) / det;
+            i++;
+            continue;
+        }
+        if (internals::mathutils::nearly_equal(d11, 0.0)) {
+            return false;
+        }
+        y[i] /= d11;
+    }
+
+    for (int i = n - 1; i >= 0; i--) {
+        const double* row = l + static_cast<long long>(i) * n;
+        for (int p = 0; p < i; p++) {
+            y[p] -= row[p] * y[i];
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        x[f.perm[i]] = y[i];
+    }
+    return true;
+}
+
+// the operators y = A x of a square matrix matching b, for the Krylov
+// methods
+Solver::LinearOperator matrix_operator(const Matrix& A, const Vector& b) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+    if (A.num_col() != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    return [&A](const Vector& x, Vector& y) { y = A * x; };
+}
+
+Solver::LinearOperator sparse_operator(const SparseMatrix& A,
+                                       const Vector& b) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+    if (A.num_col() != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    return [&A](const Vector& x, Vector& y) { A.multiply(x, y); };
+}
+
+void check_controls(double tol, int max_iter) {
+    if (!(tol >= 0) || max_iter < 0) {
+        throw internals::exceptions::invalid_argument();
+    }
+}
+
+void check_preconditioner(const Preconditioner& M, const Vector& b) {
+    if (M.size() != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+}
+
+double norm(const Vector& v) {
+    return std::sqrt(internals::simd::dot(v.data(), v.data(), v.get_size()));
+}
+
+double dot(const Vector& a, const Vector& b) {
+    return internals::simd::dot(a.data(), b.data(), a.get_size());
+}
+
+// y += alpha * x
+void axpy(double alpha, const Vector& x, Vector& y) {
+    const double* xv = x.data();
+    double* yv = y.data();
+    int n = y.get_size();
+    for (int i = 0; i < n; i++) {
+        yv[i] += alpha * xv[i];
+    }
+}
+
+// preconditioned conjugate gradients, M = null means M = I
+Solver::IterativeResult conjugate_gradient(const Solver::LinearOperator& A,
+                                           const Preconditioner* M,
+                                           const Vector& b, double tol,
+                                           int max_iter) {
+    check_controls(tol, max_iter);
+    int n = b.get_size();
+    Vector x(n);
+    std::vector<double> history{1.0};
+    double bnorm = norm(b);
+    if (bnorm == 0) {
+        return Solver::IterativeResult(std::move(x), 0, true, {0.0});
+    }
+
+    // z = M^{-1} r, which is r itself without a preconditioner
+    Vector r(b);
+    Vector z(n);
+    if (M != nullptr) {
+        M->apply(r, z);
+    }
+    const Vector& zr = (M != nullptr) ? z : r;
+    Vector p(zr);
+    Vector q(n);
+    double rz = dot(r, zr);
+    double target = tol * bnorm;
+    int its = 0;
+    bool converged = false;
+    while (its < max_iter) {
+        A(p, q);
+        double curvature = dot(p, q);
+        if (!(curvature > 0)) {
+            break;
+        }
+        double alpha = rz / curvature;
+        axpy(alpha, p, x);
+        axpy(-alpha, q, r);
+        its++;
+
+        double rnorm = norm(r);
+        history.push_back(rnorm / bnorm);
+        if (rnorm <= target) {
+            converged = true;
+            break;
+        }
+
+        // p = z + beta * p
+        if (M != nullptr) {
+            M->apply(r, z);
+        }
+        double rz_next = dot(r, zr);
+        double beta = rz_next / rz;
+        rz = rz_next;
+        double* pv = p.data();
+        const double* zv = zr.data();
+        for (int i = 0; i < n; i++) {
+            pv[i] = zv[i] + beta * pv[i];
+        }
+    }
+    return Solver::IterativeResult(std::move(x), its, converged,
+                                   std::move(history));
+}
+
+// GMRES(restart) preconditioned from the right, on A M^{-1} u = b with
+// x = M^{-1} u, so the residual it minimises is that of the original system
+Solver::IterativeResult restarted_gmres(const Solver::LinearOperator& A,
+                                        const Preconditioner* M,
+                                        const Vector& b, int restart,
+                                        double tol, int max_iter) {
+    check_controls(tol, max_iter);
+    if (restart <= 0) {
+        throw internals::exceptions::invalid_argument();
+    }
+    int n = b.get_size();
+    Vector x(n);
+    std::vector<double> history{1.0};
+    double bnorm = norm(b);
+    if (bnorm == 0) {
+        return Solver::IterativeResult(std::move(x), 0, true, {0.0});
+    }
+
+    // the basis vectors and the (m + 1) x m Hessenberg matrix of a cycle,
+    // the latter made upper triangular by the rotations (cs, sn) as its
+    // columns arrive, with g the rotated right-hand side beta * e_1
+    int m = std::min(restart, n);
+    std::vector<Vector> basis(m + 1, Vector(n));
+    std::vector<double> h(static_cast<size_t>(m + 1) * m);
+    std::vector<double> cs(m);
+    std::vector<double> sn(m);
+    std::vector<double> g(m + 1);
+    std::vector<double> y(m);
+    Vector r(b);
+    Vector w(n);
+    Vector z(n);
+    double target = tol * bnorm;
+    int its = 0;
+    bool converged = false;
+    bool stalled = false;
+    auto at = [&h, m](int i, int j) -> double& { return h[i * m + j]; };
+
+    while (!converged && !stalled && its < max_iter) {
+        // the true residual, r = b for the zero start
+        if (its > 0) {
+            A(x, w);
+            const double* bv = b.data();
+            const double* wv = w.data();
+            double* rv = r.data();
+            for (int i = 0; i < n; i++) {
+                rv[i] = bv[i] - wv[i];
+            }
+        }
+        double beta = norm(r);
+        if (beta <= target) {
+            converged = true;
+            break;
+        }
+        std::fill(g.begin(), g.end(), 0.0);
+        g[0] = beta;
+        double* v0 = basis[0].data();
+        const double* rv = r.data();
+        for (int i = 0; i < n; i++) {
+            v0[i] = rv[i] / beta;
+        }
+
+        int k = 0;
+        while (k < m && its < max_iter) {
+            if (M != nullptr) {
+                M->apply(basis[k], z);
+                A(z, w);
+            }
+            else {
+                A(basis[k], w);
+            }
+            its++;
+            for (int i = 0; i <= k; i++) {
+                at(i, k) = dot(w, basis[i]);
+                axpy(-at(i, k), basis[i], w);
+            }
+            double next = norm(w);
+
+            for (int i = 0; i < k; i++) {
+                double hi = at(i, k);
+                double hn = at(i + 1, k);
+                at(i, k) = cs[i] * hi + sn[i] * hn;
+                at(i + 1, k) = cs[i] * hn - sn[i] * hi;
+            }
+            double diag = std::hypot(at(k, k), next);
+            if (diag == 0) {
+                // A maps the basis into its span without reaching b, the
+                // column adds nothing and no later one would
+                stalled = true;
+                break;
+            }
+            cs[k] = at(k, k) / diag;
+            sn[k] = next / diag;
+            at(k, k) = diag;
+            g[k + 1] = -sn[k] * g[k];
+            g[k] *= cs[k];
+            k++;
+
+            // next = 0 leaves g[k] = 0, the solution lies in the basis
+            history.push_back(std::abs(g[k]) / bnorm);
+            if (std::abs(g[k]) <= target) {
+                converged = true;
+                break;
+            }
+            double* vn = basis[k].data();
+            const double* wv = w.data();
+            for (int i = 0; i < n; i++) {
+                vn[i] = wv[i] / next;
+            }
+        }
+
+        // x += M^{-1} V y with R y = g over the k columns of the cycle
+        for (int i = k - 1; i >= 0; i--) {
+            double value = g[i];
+            for (int j = i + 1; j < k; j++) {
+                value -= at(i, j) * y[j];
+            }
+            y[i] = value / at(i, i);
+        }
+        if (M == nullptr) {
+            for (int i = 0; i < k; i++) {
+                axpy(y[i], basis[i], x);
+            }
+            continue;
+        }
+        std::fill(w.data(), w.data() + n, 0.0);
+        for (int i = 0; i < k; i++) {
+            axpy(y[i], basis[i], w);
+        }
+        M->apply(w, z);
+        axpy(1.0, z, x);
+    }
+    return Solver::IterativeResult(std::move(x), its, converged,
+                                   std::move(history));
+}
+
+// BiCGSTAB preconditioned from the right, r stays the true residual
+Solver::IterativeResult stabilized_bicg(const Solver::LinearOperator& A,
+                                        const Preconditioner* M,
+                                        const Vector& b, double tol,
+                                        int max_iter) {
+    check_controls(tol, max_iter);
+    int n = b.get_size();
+    Vector x(n);
+    std::vector<double> history{1.0};
+    double bnorm = norm(b);
+    if (bnorm == 0) {
+        return Solver::IterativeResult(std::move(x), 0, true, {0.0});
+    }
+
+    // the shadow residual is the initial one, r = b for the zero start.
+    // p_hat = M^{-1} p and s_hat = M^{-1} s are p and s without M.
+    const Vector& shadow = b;
+    Vector r(b);
+    Vector p(n);
+    Vector v(n);
+    Vector t(n);
+    Vector p_hat(n);
+    Vector s_hat(n);
+    const Vector& pm = (M != nullptr) ? p_hat : p;
+    const Vector& sm = (M != nullptr) ? s_hat : r;
+    double rho = 1;
+    double alpha = 1;
+    double omega = 1;
+    double target = tol * bnorm;
+    int its = 0;
+    bool converged = false;
+    while (its < max_iter) {
+        double rho_next = dot(shadow, r);
+        if (rho_next == 0) {
+            break;
+        }
+
+        // p = r + beta * (p - omega * v)
+        double beta = (rho_next / rho) * (alpha / omega);
+        rho = rho_next;
+        double* pv = p.data();
+        const double* rv = r.data();
+        const double* vv = v.data();
+        for (int i = 0; i < n; i++) {
+            pv[i] = rv[i] + beta * (pv[i] - omega * vv[i]);
+        }
+
+        if (M != nullptr) {
+            M->apply(p, p_hat);
+        }
+        A(pm, v);
+        double sv = dot(shadow, v);
+        if (sv == 0) {
+            break;
+        }
+        alpha = rho / sv;
+
+        // r becomes the half step residual s = r - alpha * v
+        axpy(-alpha, v, r);
+        axpy(alpha, pm, x);
+        its++;
+        double snorm = norm(r);
+        if (snorm <= target) {
+            history.push_back(snorm / bnorm);
+            converged = true;
+            break;
+        }
+
+        if (M != nullptr) {
+            M->apply(r, s_hat);
+        }
+        A(sm, t);
+        double tt = dot(t, t);
+        if (tt == 0) {
+            history.push_back(snorm / bnorm);
+            break;
+        }
+        omega = dot(t, r) / tt;
+        axpy(omega, sm, x);
+        axpy(-omega, t, r);
+
+        double rnorm = norm(r);
+        history.push_back(rnorm / bnorm);
+        if (rnorm <= target) {
+            converged = true;
+            break;
+        }
+        if (omega == 0) {
+            break;
+        }
+    }
+    return Solver::IterativeResult(std::move(x), its, converged,
+                                   std::move(history));
+}
+
+} // namespace
+
+Vector Solver::forward_sub(const Matrix& L, const Vector& b) {
+    return forward_sub(MatrixView(L), VectorView(b));
+}
+
+Vector Solver::forward_sub(const MatrixView& L, const VectorView& b) {
     int m = b.get_size();
 
     if (L.num_col() != m) {
@@ -21,23 +639,61 @@ Vector Solver::forward_sub(Matrix L, Vector b) {
 
     Vector x(m);
 
+    // substitute on the raw storage, row v of L starts at l + v * ld
+    const double* l = &L.unchecked(0, 0);
+    const double* bv = &b.unchecked(0);
+    double* xv = x.data();
+    long long ld = L.leading_dim();
+    long long stride = b.get_stride();
+
     for (int v = 0; v < m; v++) {
-        if (L(v, v) == 0) {
+        const double* row = l + v * ld;
+        if (row[v] == 0) {
             // the diagonal is zero
-            x[v] = 0;
+            xv[v] = 0;
             continue;
         }
 
-        double value = b[v];
+        double value = bv[v * stride];
         for (int i = 0; i < v; i++) {
-            value -= L(v, i) * x[i];
+            value -= row[i] * xv[i];
         }
-        x[v] = value / L(v, v);
+        xv[v] = value / row[v];
     }
     return x;
 }
 
-Vector astra::Solver::backward_sub(Matrix U, Vector b) {
+Vector Solver::forward_sub(const TriangularMatrix& L, const Vector& b) {
+    int m = b.get_size();
+    if (L.num_col() != m) {
+        throw astra::internals::exceptions::
+            variable_and_value_number_mismatch();
+    }
+    else if (L.triangle() != Triangle::lower) {
+        throw astra::internals::exceptions::matrix_not_lower_triangular();
+    }
+
+    // row v is the v + 1 entries from l, followed directly by row v + 1
+    Vector x(m);
+    const double* row = L.data();
+    double* xv = x.data();
+    for (int v = 0; v < m; v++) {
+        if (row[v] == 0) {
+            xv[v] = 0;
+        }
+        else {
+            xv[v] = (b[v] - internals::simd::dot(row, xv, v)) / row[v];
+        }
+        row += v + 1;
+    }
+    return x;
+}
+
+Vector Solver::backward_sub(const Matrix& U, const Vector& b) {
+    return backward_sub(MatrixView(U), VectorView(b));
+}
+
+Vector Solver::backward_sub(const MatrixView& U, const VectorView& b) {
     int m = b.get_size();
 
     if (U.num_col() != m) {
@@ -50,22 +706,197 @@ Vector astra::Solver::backward_sub(Matrix U, Vector b) {
 
     Vector x(m);
 
+    // substitute on the raw storage, row v of U starts at u + v * ld
+    const double* u = &U.unchecked(0, 0);
+    const double* bv = &b.unchecked(0);
+    double* xv = x.data();
+    long long ld = U.leading_dim();
+    long long stride = b.get_stride();
+
     for (int v = m - 1; v > -1; v--) {
-        if (U(v, v) == 0) {
-            x[v] = 0;
+        const double* row = u + v * ld;
+        if (row[v] == 0) {
+            xv[v] = 0;
             continue;
         }
 
-        double value = b[v];
+        double value = bv[v * stride];
         for (int i = v + 1; i < m; i++) {
-            value -= U(v, i) * x[i];
+            value -= row[i] * xv[i];
+        }
+        xv[v] = value / row[v];
+    }
+    return x;
+}
+
+Vector Solver::backward_sub(const TriangularMatrix& U, const Vector& b) {
+    int m = b.get_size();
+    if (U.num_col() != m) {
+        throw astra::internals::exceptions::
+            variable_and_value_number_mismatch();
+    }
+    else if (U.triangle() != Triangle::upper) {
+        throw astra::internals::exceptions::matrix_not_upper_triangular();
+    }
+
+    // row v is the m - v entries from u, starting with the diagonal, so
+    // the rows are walked back from the last single entry
+    Vector x(m);
+    const double* row = U.data() + static_cast<long long>(m) * (m + 1) / 2;
+    double* xv = x.data();
+    for (int v = m - 1; v > -1; v--) {
+        row -= m - v;
+        if (row[0] == 0) {
+            xv[v] = 0;
+            continue;
         }
-        x[v] = value / U(v, v);
+        double value = b[v] - internals::simd::dot(row + 1, xv + v + 1,
+                                                   m - v - 1);
+        xv[v] = value / row[0];
     }
     return x;
 }
 
-Vector Solver::solve(Matrix A, Vector b) {
+Vector Solver::solve(const Matrix& A, const Vector& b) {
+    return solve(MatrixView(A), VectorView(b));
+}
+
+Vector Solver::solve(const SparseMatrix& A, const Vector& b) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+    if (A.num_col() != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    // SparseCholesky reads one triangle, so it is only used when the other
+    // one is exactly the same
+    if (A.is_symmetric(0)) {
+        try {
+            return SparseCholesky(A).solve(b);
+        }
+        catch (const internals::exceptions::not_positive_definite&) {
+            // symmetric but indefinite, fall through to LU
+        }
+    }
+    return SparseLU(A).solve(b);
+}
+
+Vector Solver::solve(const SymmetricMatrix& A, const Vector& b) {
+    if (A.num_col() != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    try {
+        TriangularMatrix L = Decomposer::cholesky(A);
+        if (!negligible_pivot(L)) {
+            return cholesky_solve(L, b);
+        }
+    }
+    catch (const internals::exceptions::not_positive_definite&) {
+        // indefinite, LDL^T needs the full storage for its pivoting
+    }
+    // indefinite or singular, the dense path pivots and classifies
+    return solve(A.to_dense(), b);
+}
+
+Vector Solver::solve(const ToeplitzMatrix& A, const Vector& b) {
+    if (A.num_col() != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    Vector x(A.num_row());
+    if (levinson(A, b, x)) {
+        return x;
+    }
+    // a leading block is (nearly) singular, the dense solver pivots past it
+    // and classifies singular systems
+    return solve(A.to_dense(), b);
+}
+
+Vector Solver::solve(const CirculantMatrix& A, const Vector& b) {
+    int n = A.num_row();
+    if (n != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    const std::vector<std::complex<double>>& eigen = A.eigenvalues();
+    double largest = 0;
+    for (const auto& value : eigen) {
+        largest = std::max(largest, std::abs(value));
+    }
+    double tol = n * std::numeric_limits<double>::epsilon() * largest;
+
+    std::vector<std::complex<double>> work(b.data(), b.data() + n);
+    internals::fft::transform(work.data(), n, false);
+    for (int k = 0; k < n; k++) {
+        if (!(std::abs(eigen[k]) > tol)) {
+            throw internals::exceptions::singular_matrix();
+        }
+        work[k] /= eigen[k];
+    }
+    internals::fft::transform(work.data(), n, true);
+    Vector x(n);
+    for (int i = 0; i < n; i++) {
+        x[i] = work[i].real();
+    }
+    return x;
+}
+
+Vector Solver::solve(const BandedMatrix& A, const Vector& b) {
+    if (A.num_col() != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    BandedLU lu(A);
+    if (!lu.is_singular()) {
+        return lu.solve(b);
+    }
+    // a pivot is (nearly) zero, the dense solver classifies the system
+    return solve(A.to_dense(), b);
+}
+
+Vector Solver::solve(const TridiagonalMatrix& A, const Vector& b) {
+    if (A.num_col() != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    if (A.is_diagonally_dominant()) {
+        try {
+            return thomas(A, b);
+        }
+        catch (const internals::exceptions::singular_matrix&) {
+            // a zero row can still be dominant, let LU decide
+        }
+    }
+    return solve(A.to_banded(), b);
+}
+
+Vector Solver::thomas(const TridiagonalMatrix& A, const Vector& b) {
+    int n = A.num_row();
+    if (n != b.get_size()) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+    const std::vector<double>& sub = A.sub_diagonal();
+    const std::vector<double>& diag = A.main_diagonal();
+    const std::vector<double>& super = A.super_diagonal();
+
+    // forward sweep: row i becomes x[i] + c[i] x[i + 1] = d[i]
+    std::vector<double> c(n);
+    Vector d(n);
+    double pivot = diag[0];
+    for (int i = 0; i < n; i++) {
+        if (i > 0) {
+            pivot = diag[i] - sub[i - 1] * c[i - 1];
+        }
+        if (internals::mathutils::nearly_equal(pivot, 0.0)) {
+            throw internals::exceptions::singular_matrix();
+        }
+        c[i] = (i + 1 < n) ? super[i] / pivot : 0;
+        d[i] = (i > 0) ? (b[i] - sub[i - 1] * d[i - 1]) / pivot
+                       : b[i] / pivot;
+    }
+    for (int i = n - 2; i >= 0; i--) {
+        d[i] -= c[i] * d[i + 1];
+    }
+    return d;
+}
+
+Vector Solver::solve(const MatrixView& A, const VectorView& b) {
     // Unique Solution    : rank(A) = rank([A | b]) = n 
     // Infinite Solutions : rank(A) = rank([A | b]) < n 
     // No Solution        : rank(A) < rank([A | b])
@@ -74,6 +905,45 @@ Vector Solver::solve(Matrix A, Vector b) {
         throw internals::exceptions::variable_and_value_number_mismatch();
     }
 
+    // a square system whose factorization has no zero pivot has the unique
+    // solution, so the ranks below are only computed to classify the
+    // remaining systems. Exactly symmetric systems are tried with Cholesky
+    // when the diagonal is positive and with LDL^T otherwise, which take
+    // about half the work of LU. Pivots are zero within the same tolerance
+    // in all three.
+    if (A.num_row() == A.num_col()) {
+        if (exactly_symmetric(A)) {
+            bool positive_diagonal = true;
+            for (int i = 0; i < A.num_row(); i++) {
+                if (!(A.unchecked(i, i) > 0)) {
+                    positive_diagonal = false;
+                    break;
+                }
+            }
+            if (positive_diagonal) {
+                try {
+                    Matrix L = Decomposer::cholesky(A);
+                    if (!negligible_pivot(L)) {
+                        return cholesky_solve(L, b);
+                    }
+                }
+                catch (const internals::exceptions::not_positive_definite&) {
+                    // symmetric but indefinite, fall through to LDL^T
+                }
+            }
+
+            Vector x(A.num_row());
+            if (ldlt_solve(Decomposer::ldlt(A), b, x)) {
+                return x;
+            }
+        }
+
+        LUFactorization lu(A);
+        if (!lu.is_singular()) {
+            return lu.solve(b);
+        }
+    }
+
     // make the vector a single col matrix
     Matrix b_mat(b.get_size(), 1);
     for (int i = 0; i < b.get_size(); i++) {
@@ -81,7 +951,7 @@ Vector Solver::solve(Matrix A, Vector b) {
     }
 
     // create A|b
-    Matrix A_aug_b = A;
+    Matrix A_aug_b(A);
     A_aug_b.join(b_mat);
 
     // get the ranks and var no.
@@ -101,10 +971,271 @@ Vector Solver::solve(Matrix A, Vector b) {
 
     // unique soln
     auto plu_res = Decomposer::palu(A);
-    b = plu_res.P * b;
+    Vector pb = MatrixView(plu_res.P) * b;
 
-    Vector y = forward_sub(plu_res.L, b);
+    Vector y = forward_sub(plu_res.L, pb);
     Vector x = backward_sub(plu_res.U, y);
     return x;
 }
+
+Vector Solver::least_squares(const Matrix& A, const Vector& b) {
+    return least_squares(MatrixView(A), VectorView(b));
+}
+
+Vector Solver::least_squares(const MatrixView& A, const VectorView& b) {
+    int m = A.num_row();
+    int n = A.num_col();
+    if (b.get_size() != m) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+
+    const double* src = &A.unchecked(0, 0);
+    long long ld = A.leading_dim();
+    Vector x(n);
+    double* xv = x.data();
+
+    if (m >= n) {
+        // factor [A | b], the last column becomes Q^T b
+        Matrix aug(m, n + 1);
+        double* dst = aug.data();
+        for (int i = 0; i < m; i++) {
+            const double* row = src + i * ld;
+            double* out = dst + static_cast<long long>(i) * (n + 1);
+            for (int j = 0; j < n; j++) {
+                out[j] = row[j];
+            }
+            out[n] = b[i];
+        }
+
+        auto res = Decomposer::qr(std::move(aug));
+        const double* r = res.QR.data();
+        int ldr = n + 1;
+        double tol = rank_tolerance(r, ldr, n, m, n);
+
+        // R x = (Q^T b)[0:n]
+        for (int i = n - 1; i >= 0; i--) {
+            const double* row = r + static_cast<long long>(i) * ldr;
+            if (!(std::abs(row[i]) > tol)) {
+                throw internals::exceptions::rank_deficient_matrix();
+            }
+            double value = row[n];
+            for (int j = i + 1; j < n; j++) {
+                value -= row[j] * xv[j];
+            }
+            xv[i] = value / row[i];
+        }
+        return x;
+    }
+
+    // A^T = Q R, so A = R^T Q^T and x = Q [y; 0] with R^T y = b
+    Matrix at(n, m);
+    double* dst = at.data();
+    for (int i = 0; i < m; i++) {
+        const double* row = src + i * ld;
+        for (int j = 0; j < n; j++) {
+            dst[static_cast<long long>(j) * m + i] = row[j];
+        }
+    }
+
+    auto res = Decomposer::qr(std::move(at));
+    const double* q = res.QR.data();
+    double tol = rank_tolerance(q, m, m, m, n);
+
+    for (int i = 0; i < m; i++) {
+        const double* row = q + static_cast<long long>(i) * m;
+        if (!(std::abs(row[i]) > tol)) {
+            throw internals::exceptions::rank_deficient_matrix();
+        }
+        double value = b[i];
+        for (int p = 0; p < i; p++) {
+            value -= q[static_cast<long long>(p) * m + i] * xv[p];
+        }
+        xv[i] = value / row[i];
+    }
+
+    // apply H_{m-1} first, reflector k only touches the entries k .. n - 1
+    for (int k = m - 1; k >= 0; k--) {
+        double dot = xv[k];
+        for (int i = k + 1; i < n; i++) {
+            dot += q[static_cast<long long>(i) * m + k] * xv[i];
+        }
+        dot *= res.tau[k];
+        xv[k] -= dot;
+        for (int i = k + 1; i < n; i++) {
+            xv[i] -= dot * q[static_cast<long long>(i) * m + k];
+        }
+    }
+    return x;
+}
+
+Matrix Solver::pinv(const Matrix& A) { return pinv(MatrixView(A)); }
+
+Matrix Solver::pinv(const MatrixView& A) {
+    int m = A.num_row();
+    int n = A.num_col();
+    auto res = Decomposer::svd(A);
+    int k = res.S.get_size();
+
+    const double* s = res.S.data();
+    double tol = std::max(m, n) * std::numeric_limits<double>::epsilon() *
+                 s[0];
+
+    // only the singular values above tol take part in the product
+    int r = 0;
+    while (r < k && s[r] > tol) {
+        r++;
+    }
+
+    Matrix result(n, m);
+    if (r == 0) {
+        return result;
+    }
+
+    // A^+ = (V S^+) U^T with V S^+ stored n x r and U^T stored r x m
+    std::vector<double> vs(static_cast<long long>(n) * r);
+    std::vector<double> ut(static_cast<long long>(r) * m);
+    const double* vt = res.VT.data();
+    const double* u = res.U.data();
+    for (int j = 0; j < r; j++) {
+        const double* row = vt + static_cast<long long>(j) * n;
+        double inv = 1.0 / s[j];
+        for (int i = 0; i < n; i++) {
+            vs[static_cast<long long>(i) * r + j] = row[i] * inv;
+        }
+    }
+    for (int c = 0; c < m; c++) {
+        const double* row = u + static_cast<long long>(c) * k;
+        for (int j = 0; j < r; j++) {
+            ut[static_cast<long long>(j) * m + c] = row[j];
+        }
+    }
+
+    internals::gemm::gemm(n, m, r, 1.0, vs.data(), r, ut.data(), m, 0.0,
+                          result.data(), m);
+    return result;
+}
+
+Solver::IterativeResult Solver::cg(const Matrix& A, const Vector& b,
+                                   double tol, int max_iter) {
+    return conjugate_gradient(matrix_operator(A, b), nullptr, b, tol,
+                              max_iter);
+}
+
+Solver::IterativeResult Solver::cg(const LinearOperator& A, const Vector& b,
+                                   double tol, int max_iter) {
+    return conjugate_gradient(A, nullptr, b, tol, max_iter);
+}
+
+Solver::IterativeResult Solver::cg(const Matrix& A, const Vector& b,
+                                   const Preconditioner& M, double tol,
+                                   int max_iter) {
+    check_preconditioner(M, b);
+    return conjugate_gradient(matrix_operator(A, b), &M, b, tol, max_iter);
+}
+
+Solver::IterativeResult Solver::cg(const LinearOperator& A, const Vector& b,
+                                   const Preconditioner& M, double tol,
+                                   int max_iter) {
+    check_preconditioner(M, b);
+    return conjugate_gradient(A, &M, b, tol, max_iter);
+}
+
+Solver::IterativeResult Solver::gmres(const Matrix& A, const Vector& b,
+                                      int restart, double tol,
+                                      int max_iter) {
+    return restarted_gmres(matrix_operator(A, b), nullptr, b, restart, tol,
+                           max_iter);
+}
+
+Solver::IterativeResult Solver::gmres(const LinearOperator& A,
+                                      const Vector& b, int restart,
+                                      double tol, int max_iter) {
+    return restarted_gmres(A, nullptr, b, restart, tol, max_iter);
+}
+
+Solver::IterativeResult Solver::gmres(const Matrix& A, const Vector& b,
+                                      const Preconditioner& M, int restart,
+                                      double tol, int max_iter) {
+    check_preconditioner(M, b);
+    return restarted_gmres(matrix_operator(A, b), &M, b, restart, tol,
+                           max_iter);
+}
+
+Solver::IterativeResult Solver::gmres(const LinearOperator& A,
+                                      const Vector& b,
+                                      const Preconditioner& M, int restart,
+                                      double tol, int max_iter) {
+    check_preconditioner(M, b);
+    return restarted_gmres(A, &M, b, restart, tol, max_iter);
+}
+
+Solver::IterativeResult Solver::bicgstab(const Matrix& A, const Vector& b,
+                                         double tol, int max_iter) {
+    return stabilized_bicg(matrix_operator(A, b), nullptr, b, tol,
+                           max_iter);
+}
+
+Solver::IterativeResult Solver::bicgstab(const LinearOperator& A,
+                                         const Vector& b, double tol,
+                                         int max_iter) {
+    return stabilized_bicg(A, nullptr, b, tol, max_iter);
+}
+
+Solver::IterativeResult Solver::bicgstab(const Matrix& A, const Vector& b,
+                                         const Preconditioner& M, double tol,
+                                         int max_iter) {
+    check_preconditioner(M, b);
+    return stabilized_bicg(matrix_operator(A, b), &M, b, tol, max_iter);
+}
+
+Solver::IterativeResult Solver::bicgstab(const LinearOperator& A,
+                                         const Vector& b,
+                                         const Preconditioner& M, double tol,
+                                         int max_iter) {
+    check_preconditioner(M, b);
+    return stabilized_bicg(A, &M, b, tol, max_iter);
+}
+Solver::IterativeResult Solver::cg(const SparseMatrix& A, const Vector& b,
+                                   double tol, int max_iter) {
+    return conjugate_gradient(sparse_operator(A, b), nullptr, b, tol,
+                              max_iter);
+}
+
+Solver::IterativeResult Solver::cg(const SparseMatrix& A, const Vector& b,
+                                   const Preconditioner& M, double tol,
+                                   int max_iter) {
+    check_preconditioner(M, b);
+    return conjugate_gradient(sparse_operator(A, b), &M, b, tol, max_iter);
+}
+
+Solver::IterativeResult Solver::gmres(const SparseMatrix& A, const Vector& b,
+                                      int restart, double tol,
+                                      int max_iter) {
+    return restarted_gmres(sparse_operator(A, b), nullptr, b, restart, tol,
+                           max_iter);
+}
+
+Solver::IterativeResult Solver::gmres(const SparseMatrix& A, const Vector& b,
+                                      const Preconditioner& M, int restart,
+                                      double tol, int max_iter) {
+    check_preconditioner(M, b);
+    return restarted_gmres(sparse_operator(A, b), &M, b, restart, tol,
+                           max_iter);
+}
+
+Solver::IterativeResult Solver::bicgstab(const SparseMatrix& A,
+                                         const Vector& b, double tol,
+                                         int max_iter) {
+    return stabilized_bicg(sparse_operator(A, b), nullptr, b, tol,
+                           max_iter);
+}
+
+Solver::IterativeResult Solver::bicgstab(const SparseMatrix& A,
+                                         const Vector& b,
+                                         const Preconditioner& M, double tol,
+                                         int max_iter) {
+    check_preconditioner(M, b);
+    return stabilized_bicg(sparse_operator(A, b), &M, b, tol, max_iter);
+}
+
 } // namespace astra
@@ -0,0 +1,397 @@
+#include "pch.h"
+
+#include "../include/SparseFactorization.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Ordering.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace astra {
+
+namespace {
+
+// a kept diagonal pivot must be at least this fraction of the largest
+// candidate of its column
+const double DIAGONAL_PIVOT_TOL = 0.1;
+
+// refactor keeps the old pivot order while every pivot is at least this
+// fraction of the largest entry below it
+const double REFACTOR_PIVOT_TOL = 1e-3;
+
+void check_square(const SparseMatrix& A) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+}
+
+void check_pattern(const SparseMatrix& A, const std::vector<int>& ptr,
+                   const std::vector<int>& idx) {
+    if (A.row_pointers() != ptr || A.column_indices() != idx) {
+        throw internals::exceptions::invalid_argument();
+    }
+}
+
+void check_rhs(int n, const Vector& b) {
+    if (b.get_size() != n) {
+        throw internals::exceptions::variable_and_value_number_mismatch();
+    }
+}
+
+} // namespace
+
+SparseCholesky::SparseCholesky(const SparseMatrix& A)
+    : n(A.num_row()), a_ptr(A.row_pointers()), a_idx(A.column_indices()) {
+    check_square(A);
+    if (!A.is_symmetric()) {
+        throw internals::exceptions::non_symmetric_matrix();
+    }
+    perm = internals::ordering::minimum_degree(n, a_ptr, a_idx);
+    std::vector<int> pinv(n);
+    for (int k = 0; k < n; k++) {
+        pinv[perm[k]] = k;
+    }
+
+    // row i of the lower triangle of C = P A P^T comes from row perm[i] of
+    // A, which holds column perm[i] as well since A is symmetric
+    c_ptr.assign(n + 1, 0);
+    for (int i = 0; i < n; i++) {
+        int r = perm[i];
+        for (int p = a_ptr[r]; p < a_ptr[r + 1]; p++) {
+            int j = pinv[a_idx[p]];
+            if (j <= i) {
+                c_idx.push_back(j);
+                c_src.push_back(p);
+            }
+        }
+        c_ptr[i + 1] = static_cast<int>(c_idx.size());
+    }
+
+    // elimination tree by Liu's algorithm, with path compression through
+    // ancestor
+    parent.assign(n, -1);
+    std::vector<int> ancestor(n, -1);
+    for (int i = 0; i < n; i++) {
+        for (int p = c_ptr[i]; p < c_ptr[i + 1]; p++) {
+            int k = c_idx[p];
+            while (k != -1 && k < i) {
+                int next = ancestor[k];
+                ancestor[k] = i;
+                if (next == -1) {
+                    parent[k] = i;
+                }
+                k = next;
+            }
+        }
+    }
+
+    // row i of L is the part of the tree reached from the entries of row i
+    // of C, every node on the way gains an entry in its column
+    std::vector<int> counts(n, 1);
+    std::vector<int> flag(n, -1);
+    for (int i = 0; i < n; i++) {
+        flag[i] = i;
+        for (int p = c_ptr[i]; p < c_ptr[i + 1]; p++) {
+            for (int k = c_idx[p]; flag[k] != i; k = parent[k]) {
+                counts[k]++;
+                flag[k] = i;
+            }
+        }
+    }
+    l_ptr.assign(n + 1, 0);
+    for (int j = 0; j < n; j++) {
+        l_ptr[j + 1] = l_ptr[j] + counts[j];
+    }
+    l_idx.resize(l_ptr[n]);
+    l_val.resize(l_ptr[n]);
+
+    factor(A.get_values());
+}
+
+void SparseCholesky::factor(const std::vector<double>& values) {
+    std::vector<double> x(n, 0.0);
+    std::vector<int> next(l_ptr.begin(), l_ptr.end() - 1);
+    std::vector<int> stack(n);
+    std::vector<int> flag(n, -1);
+
+    for (int k = 0; k < n; k++) {
+        // scatter row k of C and collect the pattern of row k of L in
+        // topological order in stack[top .. n - 1]
+        int top = n;
+        flag[k] = k;
+        for (int p = c_ptr[k]; p < c_ptr[k + 1]; p++) {
+            int j = c_idx[p];
+            x[j] = values[c_src[p]];
+            int len = 0;
+            for (; flag[j] != k; j = parent[j]) {
+                stack[len++] = j;
+                flag[j] = k;
+            }
+            while (len > 0) {
+                stack[--top] = stack[--len];
+            }
+        }
+
+        // L(k, j) = x[j] / L(j, j) in that order, each one updating the
+        // entries further up the tree
+        double d = x[k];
+        x[k] = 0;
+        for (; top < n; top++) {
+            int j = stack[top];
+            double lkj = x[j] / l_val[l_ptr[j]];
+            x[j] = 0;
+            for (int p = l_ptr[j] + 1; p < next[j]; p++) {
+                x[l_idx[p]] -= l_val[p] * lkj;
+            }
+            d -= lkj * lkj;
+            int q = next[j]++;
+            l_idx[q] = k;
+            l_val[q] = lkj;
+        }
+        if (!(d > 0)) {
+            throw internals::exceptions::not_positive_definite();
+        }
+        int q = next[k]++;
+        l_idx[q] = k;
+        l_val[q] = std::sqrt(d);
+    }
+}
+
+void SparseCholesky::refactor(const SparseMatrix& A) {
+    check_pattern(A, a_ptr, a_idx);
+    if (!A.is_symmetric()) {
+        throw internals::exceptions::non_symmetric_matrix();
+    }
+    factor(A.get_values());
+}
+
+int SparseCholesky::size() const { return n; }
+
+int SparseCholesky::factor_nnz() const { return l_ptr[n]; }
+
+const std::vector<int>& SparseCholesky::permutation() const { return perm; }
+
+Vector SparseCholesky::solve(const Vector& b) const {
+    check_rhs(n, b);
+    std::vector<double> x(n);
+    for (int i = 0; i < n; i++) {
+        x[i] = b[perm[i]];
+    }
+    for (int j = 0; j < n; j++) {
+        x[j] /= l_val[l_ptr[j]];
+        for (int p = l_ptr[j] + 1; p < l_ptr[j + 1]; p++) {
+            x[l_idx[p]] -= l_val[p] * x[j];
+        }
+    }
+    for (int j = n - 1; j >= 0; j--) {
+        double value = x[j];
+        for (int p = l_ptr[j] + 1; p < l_ptr[j + 1]; p++) {
+            value -= l_val[p] * x[l_idx[p]];
+        }
+        x[j] = value / l_val[l_ptr[j]];
+    }
+
+    Vector result(n);
+    for (int i = 0; i < n; i++) {
+        result[perm[i]] = x[i];
+    }
+    return result;
+}
+
+SparseLU::SparseLU(const SparseMatrix& A)
+    : n(A.num_row()), a_ptr(A.row_pointers()), a_idx(A.column_indices()) {
+    check_square(A);
+    col_perm = internals::ordering::minimum_degree(n, a_ptr, a_idx);
+    factor(A.to_csc());
+}
+
+void SparseLU::factor(const SparseMatrix::CSC& csc) {
+    step_of_row.assign(n, -1);
+    row_of_step.assign(n, -1);
+    l_ptr.assign(1, 0);
+    u_ptr.assign(1, 0);
+    l_idx.clear();
+    l_val.clear();
+    u_idx.clear();
+    u_val.clear();
+
+    std::vector<double> x(n, 0.0);
+    std::vector<int> pattern(n);
+    std::vector<int> stack(n);
+    std::vector<int> resume(n);
+    std::vector<int> mark(n, -1);
+
+    for (int k = 0; k < n; k++) {
+        int c = col_perm[k];
+
+        // rows reached from column c in the graph of L, where a pivot row
+        // leads to the rows of its column of L, end up in pattern[top ..
+        // n - 1] in topological order (depth-first, without recursion)
+        int top = n;
+        for (int p = csc.col_ptr[c]; p < csc.col_ptr[c + 1]; p++) {
+            int start = csc.row_idx[p];
+            if (mark[start] == k) {
+                continue;
+            }
+            int head = 0;
+            stack[0] = start;
+            while (head >= 0) {
+                int r = stack[head];
+                int step = step_of_row[r];
+                if (mark[r] != k) {
+                    mark[r] = k;
+                    resume[head] = (step < 0) ? 0 : l_ptr[step];
+                }
+                int end = (step < 0) ? 0 : l_ptr[step + 1];
+                bool done = true;
+                for (int q = resume[head]; q < end; q++) {
+                    int i = l_idx[q];
+                    if (mark[i] == k) {
+                        continue;
+                    }
+                    resume[head] = q + 1;
+                    stack[++head] = i;
+                    done = false;
+                    break;
+                }
+                if (done) {
+                    head--;
+                    pattern[--top] = r;
+                }
+            }
+        }
+
+        // x = L \ A(:, c) over that pattern
+        for (int p = csc.col_ptr[c]; p < csc.col_ptr[c + 1]; p++) {
+            x[csc.row_idx[p]] = csc.values[p];
+        }
+        for (int t = top; t < n; t++) {
+            int r = pattern[t];
+            int step = step_of_row[r];
+            if (step < 0) {
+                continue;
+            }
+            double xr = x[r];
+            for (int q = l_ptr[step]; q < l_ptr[step + 1]; q++) {
+                x[l_idx[q]] -= l_val[q] * xr;
+            }
+        }
+
+        // pivot rows give U(:, k), the largest remaining entry is the
+        // pivot unless the diagonal one is close enough
+        int pivot_row = -1;
+        double largest = 0;
+        for (int t = top; t < n; t++) {
+            int r = pattern[t];
+            if (step_of_row[r] >= 0) {
+                u_idx.push_back(step_of_row[r]);
+                u_val.push_back(x[r]);
+            }
+            else if (std::abs(x[r]) > largest) {
+                largest = std::abs(x[r]);
+                pivot_row = r;
+            }
+        }
+        if (pivot_row < 0) {
+            throw internals::exceptions::singular_matrix();
+        }
+        if (step_of_row[c] < 0 && mark[c] == k &&
+            std::abs(x[c]) >= DIAGONAL_PIVOT_TOL * largest) {
+            pivot_row = c;
+        }
+        double pivot = x[pivot_row];
+        u_idx.push_back(k);
+        u_val.push_back(pivot);
+        u_ptr.push_back(static_cast<int>(u_idx.size()));
+        step_of_row[pivot_row] = k;
+        row_of_step[k] = pivot_row;
+
+        for (int t = top; t < n; t++) {
+            int r = pattern[t];
+            if (step_of_row[r] < 0) {
+                l_idx.push_back(r);
+                l_val.push_back(x[r] / pivot);
+            }
+            x[r] = 0;
+        }
+        l_ptr.push_back(static_cast<int>(l_idx.size()));
+    }
+}
+
+void SparseLU::refactor(const SparseMatrix& A) {
+    check_pattern(A, a_ptr, a_idx);
+    SparseMatrix::CSC csc = A.to_csc();
+    std::vector<double> x(n, 0.0);
+
+    // the stored U(:, k) lists its rows in the order of the triangular
+    // solve, so the solve runs over the known pattern without a search
+    for (int k = 0; k < n; k++) {
+        int c = col_perm[k];
+        for (int p = csc.col_ptr[c]; p < csc.col_ptr[c + 1]; p++) {
+            x[csc.row_idx[p]] = csc.values[p];
+        }
+        for (int p = u_ptr[k]; p < u_ptr[k + 1] - 1; p++) {
+            int step = u_idx[p];
+            int r = row_of_step[step];
+            double xr = x[r];
+            u_val[p] = xr;
+            x[r] = 0;
+            for (int q = l_ptr[step]; q < l_ptr[step + 1]; q++) {
+                x[l_idx[q]] -= l_val[q] * xr;
+            }
+        }
+
+        int pivot_row = row_of_step[k];
+        double pivot = x[pivot_row];
+        double largest = 0;
+        for (int q = l_ptr[k]; q < l_ptr[k + 1]; q++) {
+            largest = std::max(largest, std::abs(x[l_idx[q]]));
+        }
+        if (pivot == 0 || std::abs(pivot) < REFACTOR_PIVOT_TOL * largest) {
+            // the old pivot order does not suit the new values
+            factor(csc);
+            return;
+        }
+        u_val[u_ptr[k + 1] - 1] = pivot;
+        x[pivot_row] = 0;
+        for (int q = l_ptr[k]; q < l_ptr[k + 1]; q++) {
+            l_val[q] = x[l_idx[q]] / pivot;
+            x[l_idx[q]] = 0;
+        }
+    }
+}
+
+int SparseLU::size() const { return n; }
+
+int SparseLU::factor_nnz() const { return l_ptr[n] + u_ptr[n]; }
+
+const std::vector<int>& SparseLU::permutation() const { return col_perm; }
+
+Vector SparseLU::solve(const Vector& b) const {
+    check_rhs(n, b);
+
+    // L y = b with L in the row numbering of A, y in step numbering
+    std::vector<double> x(b.data(), b.data() + n);
+    std::vector<double> y(n);
+    for (int k = 0; k < n; k++) {
+        double value = x[row_of_step[k]];
+        y[k] = value;
+        for (int q = l_ptr[k]; q < l_ptr[k + 1]; q++) {
+            x[l_idx[q]] -= l_val[q] * value;
+        }
+    }
+    for (int k = n - 1; k >= 0; k--) {
+        y[k] /= u_val[u_ptr[k + 1] - 1];
+        for (int p = u_ptr[k]; p < u_ptr[k + 1] - 1; p++) {
+            y[u_idx[p]] -= u_val[p] * y[k];
+        }
+    }
+
+    Vector result(n);
+    for (int k = 0; k < n; k++) {
+        result[col_perm[k]] = y[k];
+    }
+    return result;
+}
+
+} // namespace astra
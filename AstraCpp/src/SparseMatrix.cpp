@@ -0,0 +1,358 @@
+#include "pch.h"
+
+#include "../include/MatrixView.h"
+#include "../include/SparseMatrix.h"
+#include "../internals/Exceptions.h"
+#include "../internals/MathUtils.h"
+#include "../internals/ThreadPool.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace astra {
+
+namespace {
+
+void check_size(int row, int col) {
+    if (row <= 0 || col <= 0) {
+        throw internals::exceptions::invalid_size();
+    }
+}
+
+// checks ptr, idx and values as a compressed form with n slices of indices
+// below bound, increasing within each slice
+void check_compressed(int n, int bound, const std::vector<int>& ptr,
+                      const std::vector<int>& idx,
+                      const std::vector<double>& values) {
+    if (ptr.size() != static_cast<size_t>(n) + 1 || ptr[0] != 0 ||
+        idx.size() != values.size() ||
+        static_cast<size_t>(ptr[n]) != idx.size()) {
+        throw internals::exceptions::invalid_argument();
+    }
+    for (int i = 0; i < n; i++) {
+        if (ptr[i + 1] < ptr[i]) {
+            throw internals::exceptions::invalid_argument();
+        }
+        for (int p = ptr[i]; p < ptr[i + 1]; p++) {
+            bool sorted = p == ptr[i] || idx[p - 1] < idx[p];
+            if (idx[p] < 0 || idx[p] >= bound || !sorted) {
+                throw internals::exceptions::invalid_argument();
+            }
+        }
+    }
+}
+
+// the compressed form of the transpose of (ptr, idx, values), n slices of
+// indices below bound. A counting pass over idx and a scatter in slice
+// order leave every slice of the result sorted.
+void transpose_compressed(int n, int bound, const std::vector<int>& ptr,
+                          const std::vector<int>& idx,
+                          const std::vector<double>& values,
+                          std::vector<int>& t_ptr, std::vector<int>& t_idx,
+                          std::vector<double>& t_values) {
+    t_ptr.assign(bound + 1, 0);
+    for (int j : idx) {
+        t_ptr[j + 1]++;
+    }
+    for (int j = 0; j < bound; j++) {
+        t_ptr[j + 1] += t_ptr[j];
+    }
+    t_idx.resize(idx.size());
+    t_values.resize(values.size());
+    std::vector<int> next(t_ptr.begin(), t_ptr.end() - 1);
+    for (int i = 0; i < n; i++) {
+        for (int p = ptr[i]; p < ptr[i + 1]; p++) {
+            int q = next[idx[p]]++;
+            t_idx[q] = i;
+            t_values[q] = values[p];
+        }
+    }
+}
+
+} // namespace
+
+SparseMatrix::SparseMatrix(int row, int col)
+    : rows(row), cols(col), row_ptr(), col_idx(), values() {
+    check_size(row, col);
+    row_ptr.assign(row + 1, 0);
+}
+
+SparseMatrix::SparseMatrix(int row, int col,
+                           const std::vector<int>& row_idx,
+                           const std::vector<int>& col_idx,
+                           const std::vector<double>& values)
+    : SparseMatrix(row, col) {
+    size_t count = values.size();
+    if (row_idx.size() != count || col_idx.size() != count) {
+        throw internals::exceptions::invalid_argument();
+    }
+    for (size_t k = 0; k < count; k++) {
+        if (row_idx[k] < 0 || row_idx[k] >= row || col_idx[k] < 0 ||
+            col_idx[k] >= col) {
+            throw internals::exceptions::index_out_of_range();
+        }
+    }
+
+    // bucket the triplets by column, then scatter them to their rows in
+    // column order, which sorts every row
+    std::vector<int> col_ptr(col + 1, 0);
+    for (int j : col_idx) {
+        col_ptr[j + 1]++;
+    }
+    for (int j = 0; j < col; j++) {
+        col_ptr[j + 1] += col_ptr[j];
+    }
+    std::vector<int> by_col(count);
+    std::vector<int> next(col_ptr.begin(), col_ptr.end() - 1);
+    for (size_t k = 0; k < count; k++) {
+        by_col[next[col_idx[k]]++] = static_cast<int>(k);
+    }
+
+    std::vector<int> counts(row + 1, 0);
+    for (int i : row_idx) {
+        counts[i + 1]++;
+    }
+    for (int i = 0; i < row; i++) {
+        counts[i + 1] += counts[i];
+    }
+    std::vector<int> sorted(count);
+    next.assign(counts.begin(), counts.end() - 1);
+    for (int k : by_col) {
+        sorted[next[row_idx[k]]++] = k;
+    }
+
+    // duplicates are now adjacent within their row and are summed
+    this->col_idx.reserve(count);
+    this->values.reserve(count);
+    for (int i = 0; i < row; i++) {
+        int start = static_cast<int>(this->col_idx.size());
+        for (int p = counts[i]; p < counts[i + 1]; p++) {
+            int k = sorted[p];
+            if (static_cast<int>(this->col_idx.size()) > start &&
+                this->col_idx.back() == col_idx[k]) {
+                this->values.back() += values[k];
+                continue;
+            }
+            this->col_idx.push_back(col_idx[k]);
+            this->values.push_back(values[k]);
+        }
+        row_ptr[i + 1] = static_cast<int>(this->col_idx.size());
+    }
+}
+
+SparseMatrix::SparseMatrix(const Matrix& dense)
+    : SparseMatrix(MatrixView(dense)) {}
+
+SparseMatrix::SparseMatrix(const MatrixView& dense)
+    : SparseMatrix(dense.num_row(), dense.num_col()) {
+    for (int i = 0; i < rows; i++) {
+        for (int j = 0; j < cols; j++) {
+            double value = dense(i, j);
+            if (value != 0) {
+                col_idx.push_back(j);
+                values.push_back(value);
+            }
+        }
+        row_ptr[i + 1] = static_cast<int>(col_idx.size());
+    }
+}
+
+SparseMatrix SparseMatrix::from_csr(int row, int col,
+                                    std::vector<int> row_ptr,
+                                    std::vector<int> col_idx,
+                                    std::vector<double> values) {
+    check_size(row, col);
+    check_compressed(row, col, row_ptr, col_idx, values);
+    SparseMatrix result(row, col);
+    result.row_ptr = std::move(row_ptr);
+    result.col_idx = std::move(col_idx);
+    result.values = std::move(values);
+    return result;
+}
+
+SparseMatrix SparseMatrix::from_csc(int row, int col, const CSC& csc) {
+    check_size(row, col);
+    check_compressed(col, row, csc.col_ptr, csc.row_idx, csc.values);
+    SparseMatrix result(row, col);
+    transpose_compressed(col, row, csc.col_ptr, csc.row_idx, csc.values,
+                         result.row_ptr, result.col_idx, result.values);
+    return result;
+}
+
+SparseMatrix SparseMatrix::identity(int n) {
+    SparseMatrix result(n, n);
+    for (int i = 0; i < n; i++) {
+        result.col_idx.push_back(i);
+        result.values.push_back(1.0);
+        result.row_ptr[i + 1] = i + 1;
+    }
+    return result;
+}
+
+int SparseMatrix::num_row() const { return rows; }
+
+int SparseMatrix::num_col() const { return cols; }
+
+int SparseMatrix::nnz() const { return static_cast<int>(values.size()); }
+
+const std::vector<int>& SparseMatrix::row_pointers() const { return row_ptr; }
+
+const std::vector<int>& SparseMatrix::column_indices() const {
+    return col_idx;
+}
+
+const std::vector<double>& SparseMatrix::get_values() const { return values; }
+
+double SparseMatrix::operator()(int i, int j) const {
+    if (i < 0 || i >= rows || j < 0 || j >= cols) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    auto first = col_idx.begin() + row_ptr[i];
+    auto last = col_idx.begin() + row_ptr[i + 1];
+    auto it = std::lower_bound(first, last, j);
+    if (it == last || *it != j) {
+        return 0;
+    }
+    return values[it - col_idx.begin()];
+}
+
+Vector SparseMatrix::diagonal() const {
+    int n = std::min(rows, cols);
+    Vector result(n);
+    double* d = result.data();
+    for (int i = 0; i < n; i++) {
+        d[i] = (*this)(i, i);
+    }
+    return result;
+}
+
+Matrix SparseMatrix::to_dense() const {
+    Matrix result(rows, cols);
+    double* a = result.data();
+    for (int i = 0; i < rows; i++) {
+        double* row = a + static_cast<long long>(i) * cols;
+        for (int p = row_ptr[i]; p < row_ptr[i + 1]; p++) {
+            row[col_idx[p]] = values[p];
+        }
+    }
+    return result;
+}
+
+SparseMatrix::CSC SparseMatrix::to_csc() const {
+    CSC result;
+    transpose_compressed(rows, cols, row_ptr, col_idx, values,
+                         result.col_ptr, result.row_idx, result.values);
+    return result;
+}
+
+SparseMatrix SparseMatrix::transpose() const {
+    SparseMatrix result(cols, rows);
+    transpose_compressed(rows, cols, row_ptr, col_idx, values,
+                         result.row_ptr, result.col_idx, result.values);
+    return result;
+}
+
+bool SparseMatrix::is_symmetric(double tol) const {
+    if (rows != cols) {
+        return false;
+    }
+
+    // merge row i with column i, which is row i of the transpose
+    SparseMatrix t = transpose();
+    for (int i = 0; i < rows; i++) {
+        int p = row_ptr[i];
+        int q = t.row_ptr[i];
+        while (p < row_ptr[i + 1] || q < t.row_ptr[i + 1]) {
+            int j = (p < row_ptr[i + 1]) ? col_idx[p] : cols;
+            int k = (q < t.row_ptr[i + 1]) ? t.col_idx[q] : cols;
+            double a = (j <= k) ? values[p] : 0.0;
+            double b = (k <= j) ? t.values[q] : 0.0;
+            if (!internals::mathutils::nearly_equal(a, b, tol)) {
+                return false;
+            }
+            p += (j <= k) ? 1 : 0;
+            q += (k <= j) ? 1 : 0;
+        }
+    }
+    return true;
+}
+
+void SparseMatrix::multiply(const Vector& x, Vector& y) const {
+    if (x.get_size() != cols || y.get_size() != rows) {
+        throw internals::exceptions::matrix_size_mismatch();
+    }
+    const double* xv = x.data();
+    double* yv = y.data();
+
+    // split by rows, each thread needs at least MIN_PARALLEL_WORK entries
+    long long per_row = std::max(1LL, static_cast<long long>(nnz()) / rows);
+    int grain = static_cast<int>(std::max(
+        1LL, internals::threading::MIN_PARALLEL_WORK / per_row));
+
+    internals::threading::parallel_for(0, rows, grain, [&](int lo, int hi) {
+        for (int i = lo; i < hi; i++) {
+            double sum = 0;
+            for (int p = row_ptr[i]; p < row_ptr[i + 1]; p++) {
+                sum += values[p] * xv[col_idx[p]];
+            }
+            yv[i] = sum;
+        }
+    });
+}
+
+Vector SparseMatrix::operator*(const Vector& x) const {
+    Vector y(rows);
+    multiply(x, y);
+    return y;
+}
+
+Matrix SparseMatrix::operator*(const Matrix& B) const {
+    if (B.num_row() != cols) {
+        throw internals::exceptions::matrix_multiplication_size_mismatch();
+    }
+    int k = B.num_col();
+    Matrix result(rows, k);
+    const double* b = B.data();
+    double* c = result.data();
+
+    long long per_row =
+        std::max(1LL, static_cast<long long>(nnz()) / rows) * k;
+    int grain = static_cast<int>(std::max(
+        1LL, internals::threading::MIN_PARALLEL_WORK / per_row));
+
+    internals::threading::parallel_for(0, rows, grain, [&](int lo, int hi) {
+        for (int i = lo; i < hi; i++) {
+            double* out = c + static_cast<long long>(i) * k;
+            for (int p = row_ptr[i]; p < row_ptr[i + 1]; p++) {
+                const double* in = b + static_cast<long long>(col_idx[p]) * k;
+                double value = values[p];
+                for (int j = 0; j < k; j++) {
+                    out[j] += value * in[j];
+                }
+            }
+        }
+    });
+    return result;
+}
+
+bool SparseMatrix::operator==(const SparseMatrix& other) const {
+    return rows == other.rows && cols == other.cols &&
+           row_ptr == other.row_ptr && col_idx == other.col_idx &&
+           values == other.values;
+}
+
+bool SparseMatrix::operator!=(const SparseMatrix& other) const {
+    return !(*this == other);
+}
+
+std::ostream& operator<<(std::ostream& os, const SparseMatrix& mat) {
+    for (int i = 0; i < mat.rows; i++) {
+        for (int p = mat.row_ptr[i]; p < mat.row_ptr[i + 1]; p++) {
+            os << "(" << i << ", " << mat.col_idx[p] << ") " << mat.values[p]
+               << "\n";
+        }
+    }
+    return os;
+}
+
+} // namespace astra
@@ -0,0 +1,110 @@
+#include "pch.h"
+
+#include "../include/SymmetricMatrix.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Simd.h"
+
+#include <algorithm>
+
+namespace astra {
+
+SymmetricMatrix::SymmetricMatrix(int n) : n(n) {
+    if (n <= 0) {
+        throw internals::exceptions::invalid_size();
+    }
+    packed.assign(static_cast<size_t>(n) * (n + 1) / 2, 0.0);
+}
+
+SymmetricMatrix::SymmetricMatrix(const Matrix& A)
+    : SymmetricMatrix(MatrixView(A)) {}
+
+SymmetricMatrix::SymmetricMatrix(const MatrixView& A) : n(A.num_row()) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+    if (!A.is_symmetric()) {
+        throw internals::exceptions::non_symmetric_matrix();
+    }
+    packed.resize(static_cast<size_t>(n) * (n + 1) / 2);
+    double* out = packed.data();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            *out++ = A.unchecked(i, j);
+        }
+    }
+}
+
+long long SymmetricMatrix::offset(int i, int j) const {
+    long long row = std::max(i, j);
+    return row * (row + 1) / 2 + std::min(i, j);
+}
+
+int SymmetricMatrix::num_row() const { return n; }
+
+int SymmetricMatrix::num_col() const { return n; }
+
+const double* SymmetricMatrix::data() const { return packed.data(); }
+
+double& SymmetricMatrix::operator()(int i, int j) {
+    if (i < 0 || i >= n || j < 0 || j >= n) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    return packed[offset(i, j)];
+}
+
+double SymmetricMatrix::operator()(int i, int j) const {
+    if (i < 0 || i >= n || j < 0 || j >= n) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    return packed[offset(i, j)];
+}
+
+Matrix SymmetricMatrix::to_dense() const {
+    Matrix result(n, n);
+    double* out = result.data();
+    const double* row = packed.data();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            out[static_cast<long long>(i) * n + j] = row[j];
+            out[static_cast<long long>(j) * n + i] = row[j];
+        }
+        row += i + 1;
+    }
+    return result;
+}
+
+void SymmetricMatrix::multiply(const Vector& x, Vector& y) const {
+    if (x.get_size() != n || y.get_size() != n) {
+        throw internals::exceptions::matrix_size_mismatch();
+    }
+    const double* xv = x.data();
+    double* yv = y.data();
+    std::fill(yv, yv + n, 0.0);
+
+    // row i of the lower triangle is also column i of the upper one
+    const double* row = packed.data();
+    for (int i = 0; i < n; i++) {
+        double xi = xv[i];
+        for (int j = 0; j < i; j++) {
+            yv[j] += row[j] * xi;
+        }
+        yv[i] += internals::simd::dot(row, xv, i + 1);
+        row += i + 1;
+    }
+}
+
+Vector SymmetricMatrix::operator*(const Vector& x) const {
+    Vector y(n);
+    multiply(x, y);
+    return y;
+}
+
+bool SymmetricMatrix::operator==(const SymmetricMatrix& other) const {
+    return n == other.n && packed == other.packed;
+}
+
+bool SymmetricMatrix::operator!=(const SymmetricMatrix& other) const {
+    return !(*this == other);
+}
+
+} // namespace astra
@@ -0,0 +1,179 @@
+#include "pch.h"
+
+#include "../include/Parallel.h"
+#include "../internals/Exceptions.h"
+#include "../internals/ThreadPool.h"
+
+#include <exception>
+#include <memory>
+
+namespace astra {
+
+namespace internals::threading {
+
+namespace {
+
+// set while the current thread is executing a chunk, nested parallel_for
+// calls then run inline instead of waiting on the (busy) pool
+thread_local bool in_parallel_region = false;
+
+// completion state shared by the chunks of a single parallel_for call
+struct Job {
+    std::mutex mtx;
+    std::condition_variable done;
+    int remaining;
+    std::exception_ptr error;
+};
+
+void run_chunk(Job& job, const std::function<void(int, int)>& body, int lo,
+               int hi) {
+    in_parallel_region = true;
+    try {
+        body(lo, hi);
+    } catch (...) {
+        std::lock_guard<std::mutex> lock(job.mtx);
+        if (!job.error) {
+            job.error = std::current_exception();
+        }
+    }
+    in_parallel_region = false;
+
+    std::lock_guard<std::mutex> lock(job.mtx);
+    if (--job.remaining == 0) {
+        job.done.notify_one();
+    }
+}
+
+int default_num_threads() {
+    unsigned int hw = std::thread::hardware_concurrency();
+    return (hw == 0) ? 1 : static_cast<int>(hw);
+}
+} // namespace
+
+ThreadPool& ThreadPool::instance() {
+    static ThreadPool pool(default_num_threads());
+    return pool;
+}
+
+ThreadPool::ThreadPool(int num_threads) : stopping(false), num_threads(1) {
+    start(num_threads);
+}
+
+ThreadPool::~ThreadPool() { stop(); }
+
+void ThreadPool::start(int n) {
+    std::lock_guard<std::mutex> lock(mtx);
+    stopping = false;
+    num_threads = n;
+    // the calling thread takes a chunk itself, so one thread less is needed
+    for (int i = 0; i < n - 1; ++i) {
+        workers.emplace_back([this] { worker_loop(); });
+    }
+}
+
+void ThreadPool::stop() {
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        stopping = true;
+    }
+    task_ready.notify_all();
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    workers.clear();
+}
+
+void ThreadPool::resize(int n) {
+    if (n <= 0) {
+        throw astra::internals::exceptions::invalid_argument();
+    }
+    if (n == size()) {
+        return;
+    }
+    stop();
+    start(n);
+}
+
+int ThreadPool::size() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return num_threads;
+}
+
+void ThreadPool::worker_loop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mtx);
+            task_ready.wait(lock, [this] { return stopping || !tasks.empty(); });
+
+            // drain queued work before exiting so no caller waits forever
+            if (tasks.empty()) {
+                return;
+            }
+            task = std::move(tasks.front());
+            tasks.pop_front();
+        }
+        task();
+    }
+}
+
+void ThreadPool::parallel_for(int begin, int end, int grain,
+                              const std::function<void(int, int)>& body) {
+    int length = end - begin;
+    if (length <= 0) {
+        return;
+    }
+    if (grain < 1) {
+        grain = 1;
+    }
+
+    int chunks = (length + grain - 1) / grain;
+    int threads = size();
+    if (chunks > threads) {
+        chunks = threads;
+    }
+
+    if (chunks <= 1 || in_parallel_region) {
+        body(begin, end);
+        return;
+    }
+
+    auto job = std::make_shared<Job>();
+    job->remaining = chunks;
+
+    // spread the remainder over the first chunks so sizes differ by at most 1
+    int base = length / chunks;
+    int extra = length % chunks;
+    int lo = begin + base + (extra > 0 ? 1 : 0);
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (int c = 1; c < chunks; ++c) {
+            int hi = lo + base + (c < extra ? 1 : 0);
+            tasks.emplace_back(
+                [job, &body, lo, hi] { run_chunk(*job, body, lo, hi); });
+            lo = hi;
+        }
+    }
+    task_ready.notify_all();
+
+    // the caller works on the first chunk instead of idling
+    run_chunk(*job, body, begin, begin + base + (extra > 0 ? 1 : 0));
+
+    std::unique_lock<std::mutex> lock(job->mtx);
+    job->done.wait(lock, [&job] { return job->remaining == 0; });
+
+    if (job->error) {
+        std::rethrow_exception(job->error);
+    }
+}
+} // namespace internals::threading
+
+void set_num_threads(int n) {
+    internals::threading::ThreadPool::instance().resize(n);
+}
+
+int get_num_threads() {
+    return internals::threading::ThreadPool::instance().size();
+}
+} // namespace astra
@@ -0,0 +1,139 @@
+#include "pch.h"
+
+#include "../include/ToeplitzMatrix.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Fft.h"
+
+#include <utility>
+
+namespace astra {
+
+namespace {
+
+// below this order the direct product is cheaper than three transforms
+const int FFT_MIN_ORDER = 64;
+
+} // namespace
+
+ToeplitzMatrix::ToeplitzMatrix(std::vector<double> column)
+    : column(column), row(std::move(column)) {
+    if (this->column.empty()) {
+        throw internals::exceptions::invalid_size();
+    }
+    embed();
+}
+
+ToeplitzMatrix::ToeplitzMatrix(std::vector<double> column,
+                               std::vector<double> row)
+    : column(std::move(column)), row(std::move(row)) {
+    if (this->column.empty()) {
+        throw internals::exceptions::invalid_size();
+    }
+    if (this->row.size() != this->column.size() ||
+        this->row[0] != this->column[0]) {
+        throw internals::exceptions::invalid_argument();
+    }
+    embed();
+}
+
+void ToeplitzMatrix::embed() {
+    int n = num_row();
+    if (n < FFT_MIN_ORDER) {
+        return;
+    }
+    // the first column of the circulant is t[0 .. n - 1], zeros, then
+    // t[-(n - 1) .. -1], so its leading n x n block is this matrix
+    int m = internals::fft::next_power_of_two(2 * n - 1);
+    spectrum.assign(m, 0.0);
+    for (int k = 0; k < n; k++) {
+        spectrum[k] = column[k];
+    }
+    for (int k = 1; k < n; k++) {
+        spectrum[m - k] = row[k];
+    }
+    internals::fft::transform(spectrum.data(), m, false);
+}
+
+int ToeplitzMatrix::num_row() const {
+    return static_cast<int>(column.size());
+}
+
+int ToeplitzMatrix::num_col() const {
+    return static_cast<int>(column.size());
+}
+
+const std::vector<double>& ToeplitzMatrix::first_column() const {
+    return column;
+}
+
+const std::vector<double>& ToeplitzMatrix::first_row() const { return row; }
+
+double ToeplitzMatrix::operator()(int i, int j) const {
+    int n = num_row();
+    if (i < 0 || i >= n || j < 0 || j >= n) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    return (i >= j) ? column[i - j] : row[j - i];
+}
+
+bool ToeplitzMatrix::is_symmetric() const { return row == column; }
+
+Matrix ToeplitzMatrix::to_dense() const {
+    int n = num_row();
+    Matrix result(n, n);
+    double* out = result.data();
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            out[static_cast<long long>(i) * n + j] =
+                (i >= j) ? column[i - j] : row[j - i];
+        }
+    }
+    return result;
+}
+
+void ToeplitzMatrix::multiply(const Vector& x, Vector& y) const {
+    int n = num_row();
+    if (x.get_size() != n || y.get_size() != n) {
+        throw internals::exceptions::matrix_size_mismatch();
+    }
+    if (spectrum.empty()) {
+        for (int i = 0; i < n; i++) {
+            double sum = 0;
+            for (int j = 0; j < n; j++) {
+                sum += ((i >= j) ? column[i - j] : row[j - i]) * x[j];
+            }
+            y[i] = sum;
+        }
+        return;
+    }
+
+    int m = static_cast<int>(spectrum.size());
+    std::vector<std::complex<double>> work(m, 0.0);
+    for (int j = 0; j < n; j++) {
+        work[j] = x[j];
+    }
+    internals::fft::transform(work.data(), m, false);
+    for (int k = 0; k < m; k++) {
+        work[k] *= spectrum[k];
+    }
+    internals::fft::transform(work.data(), m, true);
+    for (int i = 0; i < n; i++) {
+        y[i] = work[i].real();
+    }
+}
+
+Vector ToeplitzMatrix::operator*(const Vector& x) const {
+    Vector y(num_row());
+    multiply(x, y);
+    return y;
+}
+
+bool ToeplitzMatrix::operator==(const ToeplitzMatrix& other) const {
+    return column == other.column && row == other.row;
+}
+
+bool ToeplitzMatrix::operator!=(const ToeplitzMatrix& other) const {
+    return !(*this == other);
+}
+
+} // namespace astra
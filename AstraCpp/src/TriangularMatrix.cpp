@@ -0,0 +1,142 @@
+#include "pch.h"
+
+#include "../include/TriangularMatrix.h"
+#include "../internals/Exceptions.h"
+#include "../internals/Simd.h"
+
+#include <algorithm>
+
+namespace astra {
+
+TriangularMatrix::TriangularMatrix(int n, Triangle part)
+    : n(n), part(part) {
+    if (n <= 0) {
+        throw internals::exceptions::invalid_size();
+    }
+    packed.assign(static_cast<size_t>(n) * (n + 1) / 2, 0.0);
+}
+
+TriangularMatrix::TriangularMatrix(const Matrix& A, Triangle part,
+                                   bool unit_diagonal)
+    : TriangularMatrix(MatrixView(A), part, unit_diagonal) {}
+
+TriangularMatrix::TriangularMatrix(const MatrixView& A, Triangle part,
+                                   bool unit_diagonal)
+    : n(A.num_row()), part(part) {
+    if (A.num_row() != A.num_col()) {
+        throw internals::exceptions::non_square_matrix();
+    }
+    packed.resize(static_cast<size_t>(n) * (n + 1) / 2);
+    double* out = packed.data();
+    for (int i = 0; i < n; i++) {
+        int first = (part == Triangle::lower) ? 0 : i;
+        int last = (part == Triangle::lower) ? i : n - 1;
+        for (int j = first; j <= last; j++) {
+            *out++ = (unit_diagonal && j == i) ? 1.0 : A.unchecked(i, j);
+        }
+    }
+}
+
+long long TriangularMatrix::offset(int i, int j) const {
+    long long row = i;
+    if (part == Triangle::lower) {
+        return row * (row + 1) / 2 + j;
+    }
+    return row * (2LL * n - row + 1) / 2 + (j - i);
+}
+
+int TriangularMatrix::num_row() const { return n; }
+
+int TriangularMatrix::num_col() const { return n; }
+
+Triangle TriangularMatrix::triangle() const { return part; }
+
+double* TriangularMatrix::data() { return packed.data(); }
+
+const double* TriangularMatrix::data() const { return packed.data(); }
+
+double& TriangularMatrix::operator()(int i, int j) {
+    bool inside = (part == Triangle::lower) ? j <= i : j >= i;
+    if (i < 0 || i >= n || j < 0 || j >= n || !inside) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    return packed[offset(i, j)];
+}
+
+double TriangularMatrix::operator()(int i, int j) const {
+    if (i < 0 || i >= n || j < 0 || j >= n) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    bool inside = (part == Triangle::lower) ? j <= i : j >= i;
+    return inside ? packed[offset(i, j)] : 0;
+}
+
+Matrix TriangularMatrix::to_dense() const {
+    Matrix result(n, n);
+    double* out = result.data();
+    const double* in = packed.data();
+    for (int i = 0; i < n; i++) {
+        int first = (part == Triangle::lower) ? 0 : i;
+        int count = (part == Triangle::lower) ? i + 1 : n - i;
+        std::copy(in, in + count, out + static_cast<long long>(i) * n + first);
+        in += count;
+    }
+    return result;
+}
+
+TriangularMatrix TriangularMatrix::transpose() const {
+    Triangle other =
+        (part == Triangle::lower) ? Triangle::upper : Triangle::lower;
+    TriangularMatrix result(n, other);
+    const double* in = packed.data();
+    for (int i = 0; i < n; i++) {
+        int first = (part == Triangle::lower) ? 0 : i;
+        int last = (part == Triangle::lower) ? i : n - 1;
+        for (int j = first; j <= last; j++) {
+            result.packed[result.offset(j, i)] = *in++;
+        }
+    }
+    return result;
+}
+
+double TriangularMatrix::det() const {
+    double det = 1;
+    for (int i = 0; i < n; i++) {
+        det *= packed[offset(i, i)];
+    }
+    return det;
+}
+
+void TriangularMatrix::multiply(const Vector& x, Vector& y) const {
+    if (x.get_size() != n || y.get_size() != n) {
+        throw internals::exceptions::matrix_size_mismatch();
+    }
+    const double* xv = x.data();
+    const double* row = packed.data();
+    for (int i = 0; i < n; i++) {
+        if (part == Triangle::lower) {
+            y[i] = internals::simd::dot(row, xv, i + 1);
+            row += i + 1;
+        }
+        else {
+            y[i] = internals::simd::dot(row, xv + i, n - i);
+            row += n - i;
+        }
+    }
+}
+
+Vector TriangularMatrix::operator*(const Vector& x) const {
+    Vector y(n);
+    multiply(x, y);
+    return y;
+}
+
+bool TriangularMatrix::operator==(const TriangularMatrix& other) const {
+    return n == other.n && part == other.part && packed == other.packed;
+}
+
+bool TriangularMatrix::operator!=(const TriangularMatrix& other) const {
+    return !(*this == other);
+}
+
+} // namespace astra
@@ -0,0 +1,680 @@
+#include "pch.h"
+
+#include "../internals/Exceptions.h"
+#include "../internals/Gemm.h"
+#include "../internals/Tridiagonal.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace astra::internals::tridiagonal {
+
+namespace {
+
+const double EPS = std::numeric_limits<double>::epsilon();
+
+inline double* row_of(double* a, int ld, int i) {
+    return a + static_cast<long long>(i) * ld;
+}
+
+// finds root j of 1 + rho * sum(z_i^2 / (dl_i - x)) for ascending poles dl
+// and rho > 0. The root is found as an offset from the nearer pole so that
+// delta[i] = dl_i - root keeps its relative accuracy, each step solving a
+// model that matches the two neighbouring poles (the "middle way" of Li)
+// inside a bisection bracket.
+double secular_root(int k, const double* dl, const double* z, double rho,
+                    int j, double* delta, double* shift) {
+    int origin;
+    double lo;
+    double hi;
+    if (j < k - 1) {
+        double mid = (dl[j + 1] - dl[j]) / 2;
+        double f = 1;
+        for (int i = 0; i < k; i++) {
+            f += rho * z[i] * z[i] / ((dl[i] - dl[j]) - mid);
+        }
+        if (f >= 0) {
+            origin = j;
+            lo = 0;
+            hi = mid;
+        }
+        else {
+            origin = j + 1;
+            lo = -mid;
+            hi = 0;
+        }
+    }
+    else {
+        origin = k - 1;
+        lo = 0;
+        hi = 0;
+        for (int i = 0; i < k; i++) {
+            hi += z[i] * z[i];
+        }
+        hi *= rho;
+    }
+
+    for (int i = 0; i < k; i++) {
+        shift[i] = dl[i] - dl[origin];
+    }
+
+    double tau = (lo + hi) / 2;
+    for (int iter = 0; iter < 100; iter++) {
+        double psi = 0;
+        double dpsi = 0;
+        double phi = 0;
+        double dphi = 0;
+        for (int i = 0; i <= j; i++) {
+            double t = z[i] / (shift[i] - tau);
+            psi += z[i] * t;
+            dpsi += t * t;
+        }
+        for (int i = j + 1; i < k; i++) {
+            double t = z[i] / (shift[i] - tau);
+            phi += z[i] * t;
+            dphi += t * t;
+        }
+
+        double f = 1 + rho * (psi + phi);
+        if (f == 0) {
+            break;
+        }
+        if (f < 0) {
+            lo = tau;
+        }
+        else {
+            hi = tau;
+        }
+        if (std::abs(f) <= 8 * k * EPS * (1 + rho * (phi - psi)) ||
+            hi - lo <= 2 * EPS * std::max(std::abs(lo), std::abs(hi))) {
+            break;
+        }
+
+        double step;
+        double left = shift[j] - tau;
+        if (j < k - 1) {
+            double right = shift[j + 1] - tau;
+            double b = dpsi * left * left;
+            double e = dphi * right * right;
+            double a0 = 1 + rho * ((psi - b / left) + (phi - e / right));
+            double qb = a0 * (left + right) + rho * (b + e);
+            double qc = left * right * f;
+            double disc = qb * qb - 4 * a0 * qc;
+            double den = qb + std::copysign(std::sqrt(std::max(disc, 0.0)),
+                                            qb);
+            step = (den != 0) ? 2 * qc / den : 0;
+        }
+        else {
+            double b = dpsi * left * left;
+            double a0 = 1 + rho * (psi - b / left);
+            step = (a0 > 0) ? left + rho * b / a0 : 0;
+        }
+
+        double next = tau + step;
+        if (step == 0 || !(next > lo && next < hi)) {
+            next = (lo + hi) / 2;
+        }
+        if (next == tau) {
+            break;
+        }
+        tau = next;
+    }
+
+    for (int i = 0; i < k; i++) {
+        delta[i] = shift[i] - tau;
+    }
+    return dl[origin] + tau;
+}
+
+// merges the eigensystems of the two halves 0 .. m - 1 and m .. n - 1, held
+// in d and in the diagonal blocks of q, with the rank-one tear
+// rho * u * u^T, u = e_{m-1} + sign * e_m
+void merge(double* d, int n, int m, double rho, double sign, double* q,
+           int ldq) {
+    // z = Q^T u is the last row of Q1 and the first row of Q2
+    std::vector<double> z(n);
+    for (int i = 0; i < m; i++) {
+        z[i] = row_of(q, ldq, m - 1)[i];
+    }
+    for (int i = m; i < n; i++) {
+        z[i] = sign * row_of(q, ldq, m)[i];
+    }
+    double znorm = 0;
+    for (int i = 0; i < n; i++) {
+        znorm += z[i] * z[i];
+    }
+    rho *= znorm;
+    znorm = std::sqrt(znorm);
+    for (int i = 0; i < n; i++) {
+        z[i] /= znorm;
+    }
+
+    std::vector<int> order(n);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&](int a, int b) { return d[a] < d[b]; });
+
+    // columns of Q with entries in the upper and in the lower half
+    std::vector<char> top(n);
+    std::vector<char> bottom(n);
+    double dmax = 0;
+    double zmax = 0;
+    for (int i = 0; i < n; i++) {
+        top[i] = i < m;
+        bottom[i] = i >= m;
+        dmax = std::max(dmax, std::abs(d[i]));
+        zmax = std::max(zmax, std::abs(z[i]));
+    }
+    double tol = 8 * EPS * std::max(dmax, zmax);
+
+    // deflate small components of z, and one of every two nearly equal
+    // poles after rotating its component of z into the other
+    std::vector<int> kept;
+    std::vector<int> deflated;
+    int prev = -1;
+    for (int p = 0; p < n; p++) {
+        int i = order[p];
+        if (rho * std::abs(z[i]) <= tol) {
+            deflated.push_back(i);
+            continue;
+        }
+        if (prev < 0) {
+            prev = i;
+            continue;
+        }
+
+        double s = z[prev];
+        double c = z[i];
+        double r = std::hypot(c, s);
+        c /= r;
+        s = -s / r;
+        if (std::abs((d[i] - d[prev]) * c * s) <= tol) {
+            z[i] = r;
+            z[prev] = 0;
+            for (int row = 0; row < n; row++) {
+                double* values = row_of(q, ldq, row);
+                double x = values[prev];
+                double y = values[i];
+                values[prev] = c * x + s * y;
+                values[i] = c * y - s * x;
+            }
+            double t = d[prev] * c * c + d[i] * s * s;
+            d[i] = d[prev] * s * s + d[i] * c * c;
+            d[prev] = t;
+            top[i] = top[i] || top[prev];
+            bottom[i] = bottom[i] || bottom[prev];
+            deflated.push_back(prev);
+        }
+        else {
+            kept.push_back(prev);
+        }
+        prev = i;
+    }
+    if (prev >= 0) {
+        kept.push_back(prev);
+    }
+    std::sort(kept.begin(), kept.end(),
+              [&](int a, int b) { return d[a] < d[b]; });
+
+    int k = static_cast<int>(kept.size());
+    std::vector<double> dl(k);
+    std::vector<double> zl(k);
+    for (int i = 0; i < k; i++) {
+        dl[i] = d[kept[i]];
+        zl[i] = z[kept[i]];
+    }
+
+    // roots of the secular equation, del(i, j) = dl_i - lambda_j
+    std::vector<double> lambda(k);
+    std::vector<double> del(static_cast<size_t>(k) * k);
+    std::vector<double> delta(k);
+    std::vector<double> shift(k);
+    for (int j = 0; j < k; j++) {
+        lambda[j] = secular_root(k, dl.data(), zl.data(), rho, j,
+                                 delta.data(), shift.data());
+        for (int i = 0; i < k; i++) {
+            del[static_cast<size_t>(i) * k + j] = delta[i];
+        }
+    }
+
+    // z recomputed from the roots (Gu and Eisenstat) makes the eigenvectors
+    // of the computed roots numerically orthogonal; the common factor
+    // 1 / sqrt(rho) is dropped as the vectors are normalized anyway
+    std::vector<double> u(static_cast<size_t>(k) * k);
+    for (int i = 0; i < k; i++) {
+        const double* row = del.data() + static_cast<size_t>(i) * k;
+        double w = row[i];
+        for (int j = 0; j < k; j++) {
+            if (j != i) {
+                w *= row[j] / (dl[i] - dl[j]);
+            }
+        }
+        double zhat = std::copysign(std::sqrt(std::max(-w, 0.0)), zl[i]);
+        double* out = u.data() + static_cast<size_t>(i) * k;
+        for (int j = 0; j < k; j++) {
+            out[j] = zhat / row[j];
+        }
+    }
+    std::vector<double> norms(k, 0.0);
+    for (int i = 0; i < k; i++) {
+        const double* row = u.data() + static_cast<size_t>(i) * k;
+        for (int j = 0; j < k; j++) {
+            norms[j] += row[j] * row[j];
+        }
+    }
+    for (int j = 0; j < k; j++) {
+        norms[j] = 1 / std::sqrt(norms[j]);
+    }
+    for (int i = 0; i < k; i++) {
+        double* row = u.data() + static_cast<size_t>(i) * k;
+        for (int j = 0; j < k; j++) {
+            row[j] *= norms[j];
+        }
+    }
+
+    // the upper rows of the new vectors only come from columns with entries
+    // in the upper half and the lower rows likewise, so each half is one
+    // product over just those columns
+    std::vector<int> upper_cols;
+    std::vector<int> lower_cols;
+    for (int i = 0; i < k; i++) {
+        if (top[kept[i]]) {
+            upper_cols.push_back(i);
+        }
+        if (bottom[kept[i]]) {
+            lower_cols.push_back(i);
+        }
+    }
+    std::vector<double> vectors(static_cast<size_t>(n) * k, 0.0);
+    auto multiply = [&](const std::vector<int>& cols, int r0, int rows) {
+        int width = static_cast<int>(cols.size());
+        if (width == 0 || k == 0) {
+            return;
+        }
+        std::vector<double> qs(static_cast<size_t>(rows) * width);
+        std::vector<double> us(static_cast<size_t>(width) * k);
+        for (int r = 0; r < rows; r++) {
+            const double* src = row_of(q, ldq, r0 + r);
+            for (int c = 0; c < width; c++) {
+                qs[static_cast<size_t>(r) * width + c] = src[kept[cols[c]]];
+            }
+        }
+        for (int c = 0; c < width; c++) {
+            std::copy(u.begin() + static_cast<size_t>(cols[c]) * k,
+                      u.begin() + static_cast<size_t>(cols[c] + 1) * k,
+                      us.begin() + static_cast<size_t>(c) * k);
+        }
+        gemm::gemm(rows, k, width, 1.0, qs.data(), width, us.data(), k, 0.0,
+                   vectors.data() + static_cast<size_t>(r0) * k, k);
+    };
+    multiply(upper_cols, 0, m);
+    multiply(lower_cols, m, n - m);
+
+    // deflated pairs are kept as they are, then everything is sorted
+    int nd = static_cast<int>(deflated.size());
+    std::vector<double> kept_vectors(static_cast<size_t>(n) * nd);
+    for (int r = 0; r < n; r++) {
+        const double* src = row_of(q, ldq, r);
+        for (int c = 0; c < nd; c++) {
+            kept_vectors[static_cast<size_t>(r) * nd + c] = src[deflated[c]];
+        }
+    }
+    std::vector<double> values(n);
+    for (int j = 0; j < k; j++) {
+        values[j] = lambda[j];
+    }
+    for (int c = 0; c < nd; c++) {
+        values[k + c] = d[deflated[c]];
+    }
+    std::vector<int> sorted(n);
+    std::iota(sorted.begin(), sorted.end(), 0);
+    std::sort(sorted.begin(), sorted.end(),
+              [&](int a, int b) { return values[a] < values[b]; });
+
+    for (int c = 0; c < n; c++) {
+        d[c] = values[sorted[c]];
+    }
+    for (int r = 0; r < n; r++) {
+        double* out = row_of(q, ldq, r);
+        const double* from_merge = vectors.data() + static_cast<size_t>(r) * k;
+        const double* from_deflated =
+            kept_vectors.data() + static_cast<size_t>(r) * nd;
+        for (int c = 0; c < n; c++) {
+            int s = sorted[c];
+            out[c] = (s < k) ? from_merge[s] : from_deflated[s - k];
+        }
+    }
+}
+
+// number of eigenvalues below x, from the signs of the pivots of T - x I
+int count_below(const double* d, const double* e, int n, double x,
+                double pivmin) {
+    int count = 0;
+    double q = d[0] - x;
+    for (int i = 0;; i++) {
+        if (std::abs(q) <= pivmin) {
+            q = -pivmin;
+        }
+        if (q < 0) {
+            count++;
+        }
+        if (i == n - 1) {
+            break;
+        }
+        q = d[i + 1] - x - e[i] * e[i] / q;
+    }
+    return count;
+}
+
+// sorts the eigenvalues in d ascending, moving the columns of z along
+void sort_pairs(double* d, int n, double* z, int ldz) {
+    if (z == nullptr) {
+        std::sort(d, d + n);
+        return;
+    }
+    for (int i = 0; i < n - 1; i++) {
+        int smallest = i;
+        for (int j = i + 1; j < n; j++) {
+            if (d[j] < d[smallest]) {
+                smallest = j;
+            }
+        }
+        if (smallest == i) {
+            continue;
+        }
+        std::swap(d[i], d[smallest]);
+        for (int r = 0; r < n; r++) {
+            double* row = row_of(z, ldz, r);
+            std::swap(row[i], row[smallest]);
+        }
+    }
+}
+
+} // namespace
+
+void ql(double* d, const double* e_in, int n, double* z, int ldz) {
+    if (n == 0) {
+        return;
+    }
+    std::vector<double> e(n, 0.0);
+    std::copy(e_in, e_in + n - 1, e.begin());
+
+    for (int l = 0; l < n; l++) {
+        int iter = 0;
+        int m;
+        do {
+            // look for a negligible off-diagonal entry to split at
+            for (m = l; m < n - 1; m++) {
+                double dd = std::abs(d[m]) + std::abs(d[m + 1]);
+                if (std::abs(e[m]) <= EPS * dd) {
+                    break;
+                }
+            }
+            if (m == l) {
+                break;
+            }
+            if (iter++ == 60) {
+                throw exceptions::no_convergence();
+            }
+
+            // implicit shift from the leading 2x2 block
+            double g = (d[l + 1] - d[l]) / (2 * e[l]);
+            double r = std::hypot(g, 1.0);
+            g = d[m] - d[l] + e[l] / (g + std::copysign(r, g));
+            double s = 1;
+            double c = 1;
+            double p = 0;
+            int i;
+            for (i = m - 1; i >= l; i--) {
+                double f = s * e[i];
+                double b = c * e[i];
+                r = std::hypot(f, g);
+                e[i + 1] = r;
+                if (r == 0) {
+                    // underflow, the matrix splits here
+                    d[i + 1] -= p;
+                    e[m] = 0;
+                    break;
+                }
+                s = f / r;
+                c = g / r;
+                g = d[i + 1] - p;
+                r = (d[i] - g) * s + 2 * c * b;
+                p = s * r;
+                d[i + 1] = g + p;
+                g = c * r - b;
+
+                if (z != nullptr) {
+                    for (int k = 0; k < n; k++) {
+                        double* row = row_of(z, ldz, k);
+                        f = row[i + 1];
+                        row[i + 1] = s * row[i] + c * f;
+                        row[i] = c * row[i] - s * f;
+                    }
+                }
+            }
+            if (r == 0 && i >= l) {
+                continue;
+            }
+            d[l] -= p;
+            e[l] = g;
+            e[m] = 0;
+        } while (m != l);
+    }
+
+    sort_pairs(d, n, z, ldz);
+}
+
+void divide_and_conquer(double* d, const double* e, int n, double* q,
+                        int ldq) {
+    if (n <= DC_LEAF) {
+        for (int r = 0; r < n; r++) {
+            double* row = row_of(q, ldq, r);
+            for (int c = 0; c < n; c++) {
+                row[c] = (r == c) ? 1.0 : 0.0;
+            }
+        }
+        ql(d, e, n, q, ldq);
+        return;
+    }
+
+    // T = diag(T1, T2) + rho * u * u^T, with the tear taken off the two
+    // diagonal entries it touches
+    int m = n / 2;
+    double beta = e[m - 1];
+    double rho = std::abs(beta);
+    double sign = (beta < 0) ? -1.0 : 1.0;
+    d[m - 1] -= rho;
+    d[m] -= rho;
+
+    for (int r = 0; r < n; r++) {
+        double* row = row_of(q, ldq, r);
+        int c0 = (r < m) ? m : 0;
+        int c1 = (r < m) ? n : m;
+        for (int c = c0; c < c1; c++) {
+            row[c] = 0;
+        }
+    }
+    divide_and_conquer(d, e, m, q, ldq);
+    divide_and_conquer(d + m, e + m, n - m, row_of(q, ldq, m) + m, ldq);
+    merge(d, n, m, rho, sign, q, ldq);
+}
+
+void bisect(const double* d, const double* e, int n, int lo, int hi,
+            double* w) {
+    // Gershgorin interval holding every eigenvalue
+    double low = d[0];
+    double high = d[0];
+    double emax = 1;
+    for (int i = 0; i < n; i++) {
+        double radius = ((i > 0) ? std::abs(e[i - 1]) : 0) +
+                        ((i < n - 1) ? std::abs(e[i]) : 0);
+        low = std::min(low, d[i] - radius);
+        high = std::max(high, d[i] + radius);
+        if (i < n - 1) {
+            emax = std::max(emax, e[i] * e[i]);
+        }
+    }
+    double pivmin = std::numeric_limits<double>::min() * emax;
+    double width = std::max(std::abs(low), std::abs(high));
+    if (width == 0) {
+        // T is zero, the interval has collapsed onto its eigenvalues
+        std::fill(w, w + (hi - lo), 0.0);
+        return;
+    }
+    low -= 2 * EPS * width * n + pivmin;
+    high += 2 * EPS * width * n + pivmin;
+    double tol = 2 * EPS * width;
+
+    for (int idx = lo; idx < hi; idx++) {
+        // the previous eigenvalue is a lower bound for this one
+        double a = (idx > lo) ? w[idx - lo - 1] - tol : low;
+        double b = high;
+        while (b - a > tol + 2 * EPS * std::abs(a + b)) {
+            double mid = (a + b) / 2;
+            if (mid == a || mid == b) {
+                break;
+            }
+            if (count_below(d, e, n, mid, pivmin) > idx) {
+                b = mid;
+            }
+            else {
+                a = mid;
+            }
+        }
+        w[idx - lo] = (a + b) / 2;
+    }
+}
+
+void inverse_iteration(const double* d, const double* e, int n,
+                       const double* w, int k, double* z, int ldz) {
+    double tnorm = 0;
+    for (int i = 0; i < n; i++) {
+        double sum = std::abs(d[i]) + ((i > 0) ? std::abs(e[i - 1]) : 0) +
+                     ((i < n - 1) ? std::abs(e[i]) : 0);
+        tnorm = std::max(tnorm, sum);
+    }
+    // eigenvalues closer than ortol get orthogonalized vectors, equal ones
+    // are pulled pertol apart so the iterations do not find the same vector
+    // a zero T has no scale of its own, the tolerances are then absolute
+    double scale = (tnorm > 0) ? tnorm : 1;
+    double ortol = 1e-3 * scale;
+    double pertol = 10 * EPS * scale;
+    double tiny = EPS * scale;
+
+    std::vector<double> dd(n);
+    std::vector<double> dl(n);
+    std::vector<double> du(n);
+    std::vector<double> du2(n);
+    std::vector<char> swapped(n);
+    std::vector<double> x(n);
+    unsigned long long seed = 0x9e3779b97f4a7c15ULL;
+
+    int cluster = 0;
+    double shifted = 0;
+    for (int j = 0; j < k; j++) {
+        double lambda = w[j];
+        if (j > 0) {
+            if (w[j] - w[j - 1] > ortol) {
+                cluster = j;
+            }
+            else if (lambda - shifted < pertol) {
+                lambda = shifted + pertol;
+            }
+        }
+        shifted = lambda;
+
+        // LU of T - lambda I with partial pivoting, U has two
+        // superdiagonals after a row swap
+        for (int i = 0; i < n; i++) {
+            dd[i] = d[i] - lambda;
+            du2[i] = 0;
+            if (i < n - 1) {
+                dl[i] = e[i];
+                du[i] = e[i];
+            }
+        }
+        for (int i = 0; i < n - 1; i++) {
+            if (std::abs(dd[i]) >= std::abs(dl[i])) {
+                swapped[i] = 0;
+                double fact = (dd[i] != 0) ? dl[i] / dd[i] : 0;
+                dl[i] = fact;
+                dd[i + 1] -= fact * du[i];
+            }
+            else {
+                swapped[i] = 1;
+                double fact = dd[i] / dl[i];
+                dd[i] = dl[i];
+                dl[i] = fact;
+                double temp = du[i];
+                du[i] = dd[i + 1];
+                dd[i + 1] = temp - fact * dd[i + 1];
+                if (i < n - 2) {
+                    du2[i] = du[i + 1];
+                    du[i + 1] = -fact * du[i + 1];
+                }
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            if (std::abs(dd[i]) < tiny) {
+                dd[i] = std::copysign(tiny, dd[i]);
+            }
+        }
+
+        for (int i = 0; i < n; i++) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            x[i] = static_cast<double>(seed >> 11) * 0x1.0p-53 - 0.5;
+        }
+
+        for (int iter = 0; iter < 3; iter++) {
+            for (int i = 0; i < n - 1; i++) {
+                if (swapped[i]) {
+                    double temp = x[i];
+                    x[i] = x[i + 1];
+                    x[i + 1] = temp - dl[i] * x[i];
+                }
+                else {
+                    x[i + 1] -= dl[i] * x[i];
+                }
+            }
+            for (int i = n - 1; i >= 0; i--) {
+                double value = x[i];
+                if (i < n - 1) {
+                    value -= du[i] * x[i + 1];
+                }
+                if (i < n - 2) {
+                    value -= du2[i] * x[i + 2];
+                }
+                x[i] = value / dd[i];
+            }
+
+            for (int c = cluster; c < j; c++) {
+                double dot = 0;
+                for (int i = 0; i < n; i++) {
+                    dot += row_of(z, ldz, i)[c] * x[i];
+                }
+                for (int i = 0; i < n; i++) {
+                    x[i] -= dot * row_of(z, ldz, i)[c];
+                }
+            }
+
+            double norm = 0;
+            for (int i = 0; i < n; i++) {
+                norm += x[i] * x[i];
+            }
+            norm = std::sqrt(norm);
+            for (int i = 0; i < n; i++) {
+                x[i] /= norm;
+            }
+        }
+
+        for (int i = 0; i < n; i++) {
+            row_of(z, ldz, i)[j] = x[i];
+        }
+    }
+}
+
+} // namespace astra::internals::tridiagonal
@@ -0,0 +1,174 @@
+#include "pch.h"
+
+#include "../include/TridiagonalMatrix.h"
+#include "../internals/Exceptions.h"
+#include "../internals/ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace astra {
+
+TridiagonalMatrix::TridiagonalMatrix(int n) {
+    if (n <= 0) {
+        throw internals::exceptions::invalid_size();
+    }
+    sub.assign(n - 1, 0.0);
+    diag.assign(n, 0.0);
+    super.assign(n - 1, 0.0);
+}
+
+TridiagonalMatrix::TridiagonalMatrix(std::vector<double> sub,
+                                     std::vector<double> diag,
+                                     std::vector<double> super)
+    : sub(std::move(sub)), diag(std::move(diag)), super(std::move(super)) {
+    if (this->diag.empty()) {
+        throw internals::exceptions::invalid_size();
+    }
+    if (this->sub.size() + 1 != this->diag.size() ||
+        this->super.size() + 1 != this->diag.size()) {
+        throw internals::exceptions::invalid_argument();
+    }
+}
+
+int TridiagonalMatrix::num_row() const {
+    return static_cast<int>(diag.size());
+}
+
+int TridiagonalMatrix::num_col() const {
+    return static_cast<int>(diag.size());
+}
+
+const std::vector<double>& TridiagonalMatrix::sub_diagonal() const {
+    return sub;
+}
+
+const std::vector<double>& TridiagonalMatrix::main_diagonal() const {
+    return diag;
+}
+
+const std::vector<double>& TridiagonalMatrix::super_diagonal() const {
+    return super;
+}
+
+double& TridiagonalMatrix::operator()(int i, int j) {
+    int n = num_row();
+    if (i < 0 || i >= n || j < 0 || j >= n || std::abs(i - j) > 1) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    if (j == i) {
+        return diag[i];
+    }
+    return (j < i) ? sub[j] : super[i];
+}
+
+double TridiagonalMatrix::operator()(int i, int j) const {
+    int n = num_row();
+    if (i < 0 || i >= n || j < 0 || j >= n) {
+        throw internals::exceptions::index_out_of_range();
+    }
+    if (j == i) {
+        return diag[i];
+    }
+    if (j == i - 1) {
+        return sub[j];
+    }
+    if (j == i + 1) {
+        return super[i];
+    }
+    return 0;
+}
+
+bool TridiagonalMatrix::is_diagonally_dominant() const {
+    int n = num_row();
+    for (int i = 0; i < n; i++) {
+        double off = 0;
+        if (i > 0) {
+            off += std::abs(sub[i - 1]);
+        }
+        if (i + 1 < n) {
+            off += std::abs(super[i]);
+        }
+        if (std::abs(diag[i]) < off) {
+            return false;
+        }
+    }
+    return true;
+}
+
+Matrix TridiagonalMatrix::to_dense() const {
+    int n = num_row();
+    Matrix result(n, n);
+    double* out = result.data();
+    for (int i = 0; i < n; i++) {
+        double* row = out + static_cast<long long>(i) * n;
+        row[i] = diag[i];
+        if (i > 0) {
+            row[i - 1] = sub[i - 1];
+        }
+        if (i + 1 < n) {
+            row[i + 1] = super[i];
+        }
+    }
+    return result;
+}
+
+BandedMatrix TridiagonalMatrix::to_banded() const {
+    int n = num_row();
+    if (n == 1) {
+        BandedMatrix result(1, 0, 0);
+        result(0, 0) = diag[0];
+        return result;
+    }
+    BandedMatrix result(n, 1, 1);
+    for (int i = 0; i < n; i++) {
+        result(i, i) = diag[i];
+        if (i > 0) {
+            result(i, i - 1) = sub[i - 1];
+        }
+        if (i + 1 < n) {
+            result(i, i + 1) = super[i];
+        }
+    }
+    return result;
+}
+
+void TridiagonalMatrix::multiply(const Vector& x, Vector& y) const {
+    int n = num_row();
+    if (x.get_size() != n || y.get_size() != n) {
+        throw internals::exceptions::matrix_size_mismatch();
+    }
+    const double* xv = x.data();
+    double* yv = y.data();
+    int grain = static_cast<int>(internals::threading::MIN_PARALLEL_WORK / 3);
+
+    internals::threading::parallel_for(0, n, grain, [&](int lo, int hi) {
+        for (int i = lo; i < hi; i++) {
+            double sum = diag[i] * xv[i];
+            if (i > 0) {
+                sum += sub[i - 1] * xv[i - 1];
+            }
+            if (i + 1 < n) {
+                sum += super[i] * xv[i + 1];
+            }
+            yv[i] = sum;
+        }
+    });
+}
+
+Vector TridiagonalMatrix::operator*(const Vector& x) const {
+    Vector y(num_row());
+    multiply(x, y);
+    return y;
+}
+
+bool TridiagonalMatrix::operator==(const TridiagonalMatrix& other) const {
+    return sub == other.sub && diag == other.diag && super == other.super;
+}
+
+bool TridiagonalMatrix::operator!=(const TridiagonalMatrix& other) const {
+    return !(*this == other);
+}
+
+} // namespace astra
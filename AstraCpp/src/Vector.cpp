@@ -4,63 +4,95 @@
 #include "../include/Matrix.h"
 #include "../internals/Exceptions.h"
 #include "../internals/MathUtils.h"
+#include "../internals/Memory.h"
+#include "../internals/Simd.h"
 
+#include <complex>
 #include <iostream>
 
 
 namespace astra {
 
-Vector::Vector(int size) : size(size), current_index(0), values(nullptr) {
+template <typename T>
+BasicVector<T>::BasicVector(int size)
+    : size(size), current_index(0), values(nullptr) {
     if (size <= 0) {
         throw astra::internals::exceptions::invalid_size();
     }
-    this->values = new double[size];
+    this->values = internals::memory::allocate<T>(size);
 
     for (int i = 0; i < size; ++i) {
-        this->values[i] = 0;
+        this->values[i] = T(0);
     }
 }
 
-Vector::Vector(int size, const double values[])
+template <typename T>
+BasicVector<T>::BasicVector(int size, const T values[])
     : size(size), current_index(size), values(nullptr) {
     if (size <= 0) {
         throw astra::internals::exceptions::invalid_size();
     }
-    this->values = new double[size];
+    this->values = internals::memory::allocate<T>(size);
 
     for (int i = 0; i < size; ++i) {
         this->values[i] = values[i];
     }
 }
 
-Vector::Vector(const Vector& other)
+template <typename T>
+BasicVector<T>::BasicVector(const BasicVector& other)
     : size(other.size), current_index(other.current_index), values(nullptr) {
 
     if (size > 0) {
-        this->values = new double[size];
+        this->values = internals::memory::allocate<T>(size);
         for (int i = 0; i < size; ++i) {
             this->values[i] = other.values[i];
         }
     }
 }
 
-Vector::Vector(std::initializer_list<double> values)
+template <typename T>
+BasicVector<T>::BasicVector(BasicVector&& other) noexcept
+    : size(other.size), current_index(other.current_index),
+      values(other.values) {
+    other.size = 0;
+    other.current_index = 0;
+    other.values = nullptr;
+}
+
+template <typename T>
+BasicVector<T>::BasicVector(const BasicVectorView<T>& view)
+    : size(view.get_size()), current_index(view.get_size()),
+      values(internals::memory::allocate<T>(view.get_size())) {
+    const T* data = &view[0];
+    int stride = view.get_stride();
+    for (int i = 0; i < size; ++i) {
+        values[i] = data[static_cast<long long>(i) * stride];
+    }
+}
+
+template <typename T>
+BasicVector<T>::BasicVector(std::initializer_list<T> values)
     : size(values.size()), current_index(values.size()),
-      values(new double[values.size()]) {
+      values(internals::memory::allocate<T>(
+          static_cast<int>(values.size()))) {
     int i = 0;
-    for (double val : values) {
+    for (const T& val : values) {
         this->values[i++] = val;
     }
 }
 
-Vector::~Vector() {
-    delete[] values;
+template <typename T>
+BasicVector<T>::~BasicVector() {
+    internals::memory::deallocate(values);
     values = nullptr;
 }
 
-int Vector::get_size() const { return size; }
+template <typename T>
+int BasicVector<T>::get_size() const { return size; }
 
-Vector& Vector::operator<<(double val) {
+template <typename T>
+BasicVector<T>& BasicVector<T>::operator<<(T val) {
     if (current_index < size) {
         values[current_index++] = val;
     }
@@ -70,86 +102,32 @@ Vector& Vector::operator<<(double val) {
     return *this;
 }
 
-Vector &Vector::operator,(double val) { return (*this << val); }
-
-double Vector::operator*(const Vector& other) const {
-    if (this->size != other.size) {
-        throw astra::internals::exceptions::vector_size_mismatch();
-    }
-    double result = 0;
-    for (int i = 0; i < size; ++i) {
-        result += this->values[i] * other.values[i];
-    }
-    return result;
-}
-
-Vector operator*(const Vector& vec, double scalar) {
-    Vector result(vec.size);
-    for (int i = 0; i < vec.size; i++) {
-        result.values[i] = vec.values[i] * scalar;
-    }
-    return result;
-}
-
-Vector operator*(double scalar, const Vector& vec) {
-    return vec * scalar;
-}
-
-Vector Vector::operator/(double scalar) const {
-    if (scalar == 0) {
-        throw astra::internals::exceptions::zero_division();
-    }
-    Vector result(size);
-    for (int i = 0; i < size; i++) {
-        result.values[i] = this->values[i] / scalar;
-    }
-    return result;
-}
+template <typename T>
+BasicVector<T>& BasicVector<T>::operator,(T val) { return (*this << val); }
 
-Vector Vector::operator+(const Vector& other) const {
+template <typename T>
+T BasicVector<T>::operator*(const BasicVector& other) const {
     if (this->size != other.size) {
         throw astra::internals::exceptions::vector_size_mismatch();
     }
-
-    Vector result(size);
-
-    for (int i = 0; i < size; ++i) {
-        result.values[i] = this->values[i] + other.values[i];
-    }
-    return result;
-}
-
-Vector Vector::operator-(const Vector& other) const {
-    if (this->size != other.size) {
-        throw astra::internals::exceptions::vector_size_mismatch();
-    }
-    Vector result(size);
-
-    for (int i = 0; i < size; ++i) {
-        result.values[i] = this->values[i] - other.values[i];
-    }
-    return result;
-}
-
-double& Vector::operator[](int i) {
-    if (i < 0 || i >= size) {
-        throw astra::internals::exceptions::index_out_of_range();
+    if constexpr (internals::mathutils::is_complex_v<T>) {
+        T result = T(0);
+        for (int i = 0; i < size; ++i) {
+            result += std::conj(values[i]) * other.values[i];
+        }
+        return result;
     }
-    return values[i];
-}
-
-const double& Vector::operator[](int i) const {
-    if (i < 0 || i >= size) {
-        throw astra::internals::exceptions::index_out_of_range();
+    else {
+        return internals::simd::dot(values, other.values, size);
     }
-    return values[i];
 }
 
-Vector Vector::operator^(const Vector& other) const {
+template <typename T>
+BasicVector<T> BasicVector<T>::operator^(const BasicVector& other) const {
     if (this->size != 3 || other.size != 3) {
         throw astra::internals::exceptions::cross_product_size_error();
     }
-    Vector result(3);
+    BasicVector result(3);
     result.values[0] =
         this->values[1] * other.values[2] - this->values[2] * other.values[1];
     result.values[1] =
@@ -159,15 +137,17 @@ Vector Vector::operator^(const Vector& other) const {
     return result;
 }
 
-Vector& Vector::operator=(const Vector& other) {
+template <typename T>
+BasicVector<T>& BasicVector<T>::operator=(const BasicVector& other) {
     if (this == &other) {
         return *this;
     }
 
-    delete[] values;
-
-    size = other.size;
-    values = new double[size];
+    if (size != other.size) {
+        internals::memory::deallocate(values);
+        size = other.size;
+        values = internals::memory::allocate<T>(size);
+    }
     for (int i = 0; i < size; ++i) {
         values[i] = other.values[i];
     }
@@ -175,7 +155,27 @@ Vector& Vector::operator=(const Vector& other) {
     return *this;
 }
 
-bool Vector::operator==(const Vector& other) const {
+template <typename T>
+BasicVector<T>& BasicVector<T>::operator=(BasicVector&& other) noexcept {
+    if (this == &other) {
+        return *this;
+    }
+
+    internals::memory::deallocate(values);
+
+    size = other.size;
+    current_index = other.current_index;
+    values = other.values;
+
+    other.size = 0;
+    other.current_index = 0;
+    other.values = nullptr;
+
+    return *this;
+}
+
+template <typename T>
+bool BasicVector<T>::operator==(const BasicVector& other) const {
     if (this->size != other.size) {
         return false;
     }
@@ -188,55 +188,46 @@ bool Vector::operator==(const Vector& other) const {
     return true;
 }
 
-bool Vector::operator!=(const Vector& other) const { return !(*this == other); }
-
-double Vector::mag() const {
-    double sum_of_squares = 0.0;
-    for (int i = 0; i < size; ++i) {
-        sum_of_squares += values[i] * values[i];
-    }
-    return astra::internals::mathutils::sqrt(sum_of_squares);
+template <typename T>
+bool BasicVector<T>::operator!=(const BasicVector& other) const {
+    return !(*this == other);
 }
 
-double Vector::sum() const {
-    double sum = 0.0;
-    for (int i = 0; i < size; ++i) {
-        sum += values[i];
-    }
-    return sum;
+template <typename T>
+typename BasicVector<T>::real_type BasicVector<T>::mag() const {
+    return BasicVectorView<T>(*this).mag();
 }
 
-double Vector::avg() const { return sum() / size; }
+template <typename T>
+T BasicVector<T>::sum() const { return internals::simd::sum(values, size); }
 
-double Vector::min() const {
-    double min = values[0];
-    for (int i = 1; i < size; ++i) {
-        if (values[i] < min) {
-            min = values[i];
-        }
-    }
-    return min;
+template <typename T>
+T BasicVector<T>::avg() const {
+    return sum() / static_cast<real_type>(size);
 }
 
-double Vector::max() const {
-    double max = values[0];
-    for (int i = 1; i < size; ++i) {
-        if (values[i] > max) {
-            max = values[i];
-        }
-    }
-    return max;
-}
+template <typename T>
+T BasicVector<T>::min() const { return internals::simd::min(values, size); }
 
-Vector Vector::normalize() const {
-    double mag = this->mag();
+template <typename T>
+T BasicVector<T>::max() const { return internals::simd::max(values, size); }
+
+template <typename T>
+BasicVector<T> BasicVector<T>::normalize() const {
+    real_type mag = this->mag();
     if (mag == 0) {
         throw astra::internals::exceptions::zero_division();
     }
-    return *this / mag;
+    return *this / T(mag);
+}
+
+template <typename T>
+BasicVectorView<T> BasicVector<T>::segment(int start, int end) const {
+    return BasicVectorView<T>(*this).segment(start, end);
 }
 
-std::ostream& operator<<(std::ostream& ost, const Vector& v) {
+template <typename T>
+std::ostream& operator<<(std::ostream& ost, const BasicVector<T>& v) {
     ost << "[";
     for (int i = 0; i < v.size; ++i) {
         ost << v.values[i];
@@ -248,48 +239,42 @@ std::ostream& operator<<(std::ostream& ost, const Vector& v) {
     return ost;
 }
 
-std::istream& operator>>(std::istream& in, Vector& v) {
+template <typename T>
+std::istream& operator>>(std::istream& in, BasicVector<T>& v) {
     int i = 0;
     while (i < v.size && in >> v.values[i]) {
         ++i;
     }
 
     for (; i < v.size; ++i) {
-        v.values[i] = 0.0;
+        v.values[i] = T(0);
     }
     return in;
 }
 
-Vector operator*(const Matrix& mat, const Vector& vec) {
-    if (mat.num_col() != vec.get_size()) {
-        throw astra::internals::exceptions::matrix_size_mismatch();
-    }
-    Vector result(mat.num_row());
-
-    for (int i = 0; i < mat.num_row(); ++i) {
-        double sum = 0.0;
-
-        for (int j = 0; j < mat.num_col(); ++j) {
-            sum += mat(i, j) * vec[j];
-        }
-        result[i] = sum;
-    }
-    return result;
+template <typename T>
+BasicVector<T> operator*(const BasicMatrix<T>& mat,
+                         const BasicVector<T>& vec) {
+    return BasicMatrixView<T>(mat) * BasicVectorView<T>(vec);
 }
 
-double Vector::angle(const Vector& v1, const Vector& v2) {
+template <typename T>
+typename BasicVector<T>::real_type
+BasicVector<T>::angle(const BasicVector& v1, const BasicVector& v2) {
     if (v1.get_size() != v2.get_size()) {
         throw astra::internals::exceptions::vector_size_mismatch();
     }
 
-    double mag_v1 = v1.mag();
-    double mag_v2 = v2.mag();
+    real_type mag_v1 = v1.mag();
+    real_type mag_v2 = v2.mag();
 
     if (mag_v1 == 0 || mag_v2 == 0) {
         throw astra::internals::exceptions::null_vector();
     }
 
-    double dot_product = v1 * v2;
+    // for complex vectors the real part of the inner product, i.e. the
+    // angle between them as real vectors of twice the length
+    double dot_product = internals::mathutils::real(v1 * v2);
 
     double cos_theta = dot_product / (mag_v1 * mag_v2);
 
@@ -297,10 +282,28 @@ double Vector::angle(const Vector& v1, const Vector& v2) {
 
     double angle_radians = std::acos(cos_theta);
 
-    return angle_radians;
+    return static_cast<real_type>(angle_radians);
 }
 
-double Vector::angle_deg(const Vector& v1, const Vector& v2) {
-    return astra::internals::mathutils::rad_to_deg(angle(v1, v2));
+template <typename T>
+typename BasicVector<T>::real_type
+BasicVector<T>::angle_deg(const BasicVector& v1, const BasicVector& v2) {
+    return static_cast<real_type>(
+        astra::internals::mathutils::rad_to_deg(angle(v1, v2)));
 }
+
+#define ASTRA_INSTANTIATE_VECTOR(T)                                            \
+    template class BasicVector<T>;                                             \
+    template std::ostream& operator<< <T>(std::ostream&,                       \
+                                          const BasicVector<T>&);              \
+    template std::istream& operator>> <T>(std::istream&, BasicVector<T>&);     \
+    template BasicVector<T> operator*(const BasicMatrix<T>&,                   \
+                                      const BasicVector<T>&);
+
+ASTRA_INSTANTIATE_VECTOR(float)
+ASTRA_INSTANTIATE_VECTOR(double)
+ASTRA_INSTANTIATE_VECTOR(std::complex<float>)
+ASTRA_INSTANTIATE_VECTOR(std::complex<double>)
+
+#undef ASTRA_INSTANTIATE_VECTOR
 } // namespace astra
@@ -0,0 +1,155 @@
+#include "pch.h"
+
+#include "../include/VectorView.h"
+#include "../include/Vector.h"
+#include "../internals/Exceptions.h"
+#include "../internals/MathUtils.h"
+#include "../internals/Simd.h"
+
+#include <complex>
+#include <iostream>
+
+namespace astra {
+
+template <typename T>
+BasicVectorView<T>::BasicVectorView(const T* data, int size, int stride)
+    : data(data), size(size), stride(stride) {
+    if (size <= 0) {
+        throw astra::internals::exceptions::invalid_size();
+    }
+    if (stride <= 0) {
+        throw astra::internals::exceptions::invalid_argument();
+    }
+}
+
+template <typename T>
+BasicVectorView<T>::BasicVectorView(const BasicVector<T>& vec)
+    : data(vec.values), size(vec.size), stride(1) {}
+
+template <typename T>
+int BasicVectorView<T>::get_size() const { return size; }
+
+template <typename T>
+int BasicVectorView<T>::get_stride() const { return stride; }
+
+template <typename T>
+BasicVectorView<T> BasicVectorView<T>::segment(int start, int end) const {
+    if (start < 0 || start >= size || end < 0 || end >= size) {
+        throw astra::internals::exceptions::index_out_of_range();
+    }
+    if (start > end) {
+        throw astra::internals::exceptions::invalid_argument();
+    }
+    return BasicVectorView(data + static_cast<long long>(start) * stride,
+                           end - start + 1, stride);
+}
+
+template <typename T>
+T BasicVectorView<T>::sum() const {
+    if (stride == 1) {
+        return internals::simd::sum(data, size);
+    }
+    T sum = T(0);
+    for (int i = 0; i < size; ++i) {
+        sum += data[static_cast<long long>(i) * stride];
+    }
+    return sum;
+}
+
+template <typename T>
+T BasicVectorView<T>::avg() const {
+    return sum() / static_cast<real_type>(size);
+}
+
+template <typename T>
+T BasicVectorView<T>::min() const {
+    if (stride == 1) {
+        return internals::simd::min(data, size);
+    }
+    T min = data[0];
+    for (int i = 1; i < size; ++i) {
+        T val = data[static_cast<long long>(i) * stride];
+        if (internals::mathutils::less(val, min)) {
+            min = val;
+        }
+    }
+    return min;
+}
+
+template <typename T>
+T BasicVectorView<T>::max() const {
+    if (stride == 1) {
+        return internals::simd::max(data, size);
+    }
+    T max = data[0];
+    for (int i = 1; i < size; ++i) {
+        T val = data[static_cast<long long>(i) * stride];
+        if (internals::mathutils::less(max, val)) {
+            max = val;
+        }
+    }
+    return max;
+}
+
+template <typename T>
+typename BasicVectorView<T>::real_type BasicVectorView<T>::mag() const {
+    if constexpr (!internals::mathutils::is_complex_v<T>) {
+        if (stride == 1) {
+            return static_cast<real_type>(astra::internals::mathutils::sqrt(
+                internals::simd::sum_sq(data, size)));
+        }
+    }
+    real_type sum_of_squares = 0;
+    for (int i = 0; i < size; ++i) {
+        sum_of_squares += internals::mathutils::abs_sq(
+            data[static_cast<long long>(i) * stride]);
+    }
+    return static_cast<real_type>(
+        astra::internals::mathutils::sqrt(sum_of_squares));
+}
+
+template <typename T>
+std::ostream& operator<<(std::ostream& ost, const BasicVectorView<T>& v) {
+    ost << "[";
+    for (int i = 0; i < v.size; ++i) {
+        ost << v.data[static_cast<long long>(i) * v.stride];
+        if (i < v.size - 1) {
+            ost << ", ";
+        }
+    }
+    ost << "]\n";
+    return ost;
+}
+
+template <typename T>
+T BasicVectorView<T>::dot(const BasicVectorView& lhs,
+                          const BasicVectorView& rhs) {
+    if (lhs.size != rhs.size) {
+        throw astra::internals::exceptions::vector_size_mismatch();
+    }
+    if constexpr (!internals::mathutils::is_complex_v<T>) {
+        if (lhs.stride == 1 && rhs.stride == 1) {
+            return internals::simd::dot(lhs.data, rhs.data, lhs.size);
+        }
+    }
+    T result = T(0);
+    for (int i = 0; i < lhs.size; ++i) {
+        result += internals::mathutils::conj(
+                      lhs.data[static_cast<long long>(i) * lhs.stride]) *
+                  rhs.data[static_cast<long long>(i) * rhs.stride];
+    }
+    return result;
+}
+
+#define ASTRA_INSTANTIATE_VECTOR_VIEW(T)                                       \
+    template class BasicVectorView<T>;                                         \
+    template std::ostream& operator<< <T>(std::ostream&,                       \
+                                          const BasicVectorView<T>&);
+
+ASTRA_INSTANTIATE_VECTOR_VIEW(float)
+ASTRA_INSTANTIATE_VECTOR_VIEW(double)
+ASTRA_INSTANTIATE_VECTOR_VIEW(std::complex<float>)
+ASTRA_INSTANTIATE_VECTOR_VIEW(std::complex<double>)
+
+#undef ASTRA_INSTANTIATE_VECTOR_VIEW
+} // namespace astra
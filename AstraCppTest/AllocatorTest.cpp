@@ -0,0 +1,113 @@
+#include "pch.h"
+
+#include <cstdint>
+#include <iostream>
+#include <new>
+#include "gtest/gtest.h"
+
+#include "Allocator.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "Memory.h"
+
+namespace astra {
+
+// Allocator that counts the live blocks it has handed out
+class CountingAllocator : public Allocator {
+  public:
+    int live = 0;
+    int total = 0;
+
+    void* allocate(std::size_t bytes, std::size_t alignment) override {
+        ++live;
+        ++total;
+        return ::operator new(bytes, std::align_val_t(alignment));
+    }
+
+    void deallocate(void* ptr, std::size_t /*bytes*/,
+                    std::size_t alignment) override {
+        --live;
+        ::operator delete(ptr, std::align_val_t(alignment));
+    }
+};
+
+// Test fixture class for the storage allocator
+class AllocatorTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+
+    void TearDown() override { set_allocator(nullptr); }
+
+    static bool is_aligned(const double* ptr) {
+        return reinterpret_cast<std::uintptr_t>(ptr) %
+                   internals::memory::ALIGNMENT ==
+               0;
+    }
+};
+
+TEST_F(AllocatorTest, default_allocator_is_set) {
+    EXPECT_NE(get_allocator(), nullptr);
+}
+
+TEST_F(AllocatorTest, padded_size) {
+    EXPECT_EQ(internals::memory::padded_size(1), internals::memory::SIMD_WIDTH);
+    EXPECT_EQ(internals::memory::padded_size(8), 8);
+    EXPECT_EQ(internals::memory::padded_size(9), 16);
+}
+
+TEST_F(AllocatorTest, buffers_are_aligned) {
+    Matrix m(3, 5);
+    Vector v(7);
+    EXPECT_TRUE(is_aligned(&m(0, 0)));
+    EXPECT_TRUE(is_aligned(&v[0]));
+
+    m.transpose();
+    EXPECT_TRUE(is_aligned(&m(0, 0)));
+
+    m.resize(6, 6);
+    EXPECT_TRUE(is_aligned(&m(0, 0)));
+
+    m.join(Matrix(6, 1));
+    EXPECT_TRUE(is_aligned(&m(0, 0)));
+
+    Matrix e = m + m;
+    EXPECT_TRUE(is_aligned(&e(0, 0)));
+}
+
+TEST_F(AllocatorTest, padding_is_zeroed) {
+    Vector v{1, 2, 3};
+    const double* data = &v[0];
+    for (int i = 3; i < internals::memory::SIMD_WIDTH; ++i) {
+        EXPECT_EQ(data[i], 0.0);
+    }
+}
+
+TEST_F(AllocatorTest, custom_allocator_is_used) {
+    CountingAllocator counter;
+    set_allocator(&counter);
+    EXPECT_EQ(get_allocator(), &counter);
+    {
+        Matrix m(4, 4);
+        Vector v(4);
+        Matrix copy = m;
+        EXPECT_EQ(counter.live, 3);
+    }
+    EXPECT_EQ(counter.live, 0);
+    EXPECT_EQ(counter.total, 3);
+}
+
+TEST_F(AllocatorTest, buffer_returns_to_its_allocator) {
+    CountingAllocator counter;
+    set_allocator(&counter);
+    Matrix* m = new Matrix(2, 2, {1, 2, 3, 4});
+    set_allocator(nullptr);
+
+    Matrix copy = *m; // from the default allocator
+    EXPECT_EQ(counter.total, 1);
+
+    delete m;
+    EXPECT_EQ(counter.live, 0);
+    EXPECT_EQ(copy, Matrix(2, 2, {1, 2, 3, 4}));
+}
+
+} // namespace astra
@@ -0,0 +1,135 @@
+#include "pch.h"
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "BandedMatrix.h"
+#include "Matrix.h"
+#include "LUFactorization.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for BandedMatrix
+class BandedMatrixTest : public ::testing::Test {
+  protected:
+    Matrix* dense;
+    BandedMatrix* A;
+
+    void SetUp() override {
+        // one diagonal below and two above
+        dense = new Matrix(5, 5, {1, 2, 3, 0, 0,
+                                  4, 5, 6, 7, 0,
+                                  0, 8, 9, 1, 2,
+                                  0, 0, 3, 4, 5,
+                                  0, 0, 0, 6, 7});
+        A = new BandedMatrix(*dense, 1, 2);
+    }
+
+    void TearDown() override {
+        delete dense;
+        delete A;
+    }
+};
+
+TEST_F(BandedMatrixTest, storage) {
+    EXPECT_EQ(A->num_row(), 5);
+    EXPECT_EQ(A->lower_bandwidth(), 1);
+    EXPECT_EQ(A->upper_bandwidth(), 2);
+    EXPECT_EQ(A->to_dense(), *dense);
+    const BandedMatrix& C = *A;
+    EXPECT_EQ(C(2, 4), 2);
+    EXPECT_EQ(C(4, 0), 0);
+
+    // row 0 starts one position in, past the column left of the matrix
+    EXPECT_EQ(A->data()[1], 1);
+    EXPECT_EQ(A->data()[4], 4);
+
+    BandedMatrix B(5, 1, 2);
+    EXPECT_NE(B, *A);
+    for (int i = 0; i < 5; i++) {
+        for (int j = std::max(0, i - 1); j <= std::min(4, i + 2); j++) {
+            B(i, j) = (*dense)(i, j);
+        }
+    }
+    EXPECT_EQ(B, *A);
+
+    Vector x({1, -1, 2, 0.5, -2});
+    EXPECT_EQ(*A * x, *dense * x);
+
+    EXPECT_THROW(B(4, 0), internals::exceptions::index_out_of_range);
+    EXPECT_THROW(C(5, 0), internals::exceptions::index_out_of_range);
+    EXPECT_THROW(BandedMatrix(*dense, 1, 1),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(BandedMatrix(3, 3, 0),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(BandedMatrix(0, 0, 0), internals::exceptions::invalid_size);
+    EXPECT_THROW(*A * Vector(4), internals::exceptions::matrix_size_mismatch);
+}
+
+TEST_F(BandedMatrixTest, lu_solve) {
+    Vector b({1, 2, 3, 4, 5});
+    BandedLU lu(*A);
+    EXPECT_FALSE(lu.is_singular());
+    Vector x = lu.solve(b);
+    Vector expected = Solver::solve(*dense, b);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_NEAR(x[i], expected[i], 1e-12);
+    }
+    EXPECT_NEAR(lu.det(), LUFactorization(*dense).det(), 1e-9);
+    EXPECT_EQ(Solver::solve(*A, b), x);
+
+    // a zero first pivot needs a row exchange
+    BandedMatrix P(Matrix(3, 3, {0, 1, 0,
+                                 2, 0, 1,
+                                 0, 3, 4}), 1, 1);
+    Vector y = Solver::solve(P, Vector({1, 2, 3}));
+    Vector r = P * y;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NEAR(r[i], i + 1.0, 1e-12);
+    }
+
+    // a wide system against the dense solver
+    int n = 300;
+    BandedMatrix W(n, 3, 5);
+    for (int i = 0; i < n; i++) {
+        for (int j = std::max(0, i - 3); j <= std::min(n - 1, i + 5); j++) {
+            W(i, j) = std::sin(1.0 + i * 7 + j * 3);
+        }
+    }
+    Vector c(n);
+    for (int i = 0; i < n; i++) {
+        c[i] = std::cos(i * 0.1);
+    }
+    Vector z = BandedLU(W).solve(c);
+    Vector rz = W * z;
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(rz[i], c[i], 1e-8);
+    }
+
+    BandedMatrix S(Matrix(2, 2, {1, 2,
+                                 2, 4}), 1, 1);
+    EXPECT_TRUE(BandedLU(S).is_singular());
+    EXPECT_THROW(BandedLU(S).solve(Vector({1, 1})),
+                 internals::exceptions::singular_matrix);
+    EXPECT_THROW(lu.solve(Vector(3)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+}
+
+TEST_F(BandedMatrixTest, nearly_singular_solve) {
+    // rank deficient up to 1e-12, the pivot is below LU's tolerance and the
+    // dense solver classifies the system
+    BandedMatrix S(Matrix(3, 3, {1, 2, 0,
+                                 2, 4 + 1e-12, 0,
+                                 0, 0, 3}), 1, 1);
+    EXPECT_TRUE(BandedLU(S).is_singular());
+    EXPECT_THROW(Solver::solve(S, Vector({1, 1, 1})),
+                 internals::exceptions::no_solution);
+    EXPECT_THROW(Solver::solve(S, Vector({1, 2, 3})),
+                 internals::exceptions::infinite_solutions);
+}
+
+} // namespace astra
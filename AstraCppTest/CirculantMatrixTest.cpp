@@ -0,0 +1,86 @@
+#include "pch.h"
+
+#include <cmath>
+#include <complex>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "CirculantMatrix.h"
+#include "Matrix.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for CirculantMatrix
+class CirculantMatrixTest : public ::testing::Test {
+  protected:
+    CirculantMatrix* A;
+
+    void SetUp() override { A = new CirculantMatrix({5, 1, 2, 0, -1}); }
+
+    void TearDown() override { delete A; }
+};
+
+TEST_F(CirculantMatrixTest, storage_and_product) {
+    EXPECT_EQ(A->num_row(), 5);
+    EXPECT_EQ(A->to_dense(), Matrix(5, 5, {5, -1, 0, 2, 1,
+                                           1, 5, -1, 0, 2,
+                                           2, 1, 5, -1, 0,
+                                           0, 2, 1, 5, -1,
+                                           -1, 0, 2, 1, 5}));
+    EXPECT_EQ(A->first_row(), std::vector<double>({5, -1, 0, 2, 1}));
+    EXPECT_EQ(CirculantMatrix::from_first_row(A->first_row()), *A);
+    EXPECT_EQ((*A)(0, 3), 2);
+
+    // the eigenvalues are the transform of the first column, the first
+    // one the sum of its entries
+    EXPECT_NEAR(A->eigenvalues()[0].real(), 7, 1e-12);
+    EXPECT_NEAR(A->eigenvalues()[0].imag(), 0, 1e-12);
+
+    Vector x({1, -2, 0.5, 3, 1});
+    Vector y = *A * x;
+    Vector expected = A->to_dense() * x;
+    for (int i = 0; i < 5; i++) {
+        EXPECT_NEAR(y[i], expected[i], 1e-12);
+    }
+
+    EXPECT_THROW(CirculantMatrix(std::vector<double>()),
+                 internals::exceptions::invalid_size);
+    EXPECT_THROW((*A)(0, 5), internals::exceptions::index_out_of_range);
+    EXPECT_THROW(*A * Vector(4), internals::exceptions::matrix_size_mismatch);
+}
+
+TEST_F(CirculantMatrixTest, fft_solve) {
+    Vector b({1, 2, 3, 4, 5});
+    Vector x = Solver::solve(*A, b);
+    Vector expected = Solver::solve(A->to_dense(), b);
+    for (int i = 0; i < 5; i++) {
+        EXPECT_NEAR(x[i], expected[i], 1e-12);
+    }
+
+    // orders with and without a power of two
+    for (int n : {256, 1000}) {
+        std::vector<double> c(n);
+        Vector rhs(n);
+        for (int k = 0; k < n; k++) {
+            c[k] = 1.0 / (1 + k);
+            rhs[k] = std::sin(k * 0.05);
+        }
+        c[0] = 8;
+        CirculantMatrix C(c);
+        Vector r = C * Solver::solve(C, rhs);
+        for (int i = 0; i < n; i++) {
+            EXPECT_NEAR(r[i], rhs[i], 1e-10);
+        }
+    }
+
+    // constant columns have a single nonzero eigenvalue
+    EXPECT_THROW(Solver::solve(CirculantMatrix({1, 1, 1}), Vector(3)),
+                 internals::exceptions::singular_matrix);
+    EXPECT_THROW(Solver::solve(*A, Vector(3)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+}
+
+} // namespace astra
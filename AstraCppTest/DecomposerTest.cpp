@@ -1,5 +1,8 @@
 #include "pch.h"
 
+#include <algorithm>
+#include <cmath>
+#include <complex>
 #include <iostream>
 #include "gtest/gtest.h"
 
@@ -141,9 +144,630 @@ TEST_F(DecomposerTest, lower_triangular_matrix) {
     EXPECT_TRUE(result.U.is_upper_triangular());
 }
 
+TEST_F(DecomposerTest, lu_packs_palu_factors) {
 
+    Matrix mat(3, 3, {2, 1, 1,
+                      4, -6, 0,
+                      -2, 7, 2});
 
+    auto packed = Decomposer::lu(mat);
+    auto result = Decomposer::palu(mat);
+
+    EXPECT_EQ(packed.swaps, result.swaps);
+    ASSERT_EQ(packed.pivots.size(), 3u);
+    EXPECT_EQ(packed.pivots[0], 1);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            double expected = (j < i) ? result.L(i, j) : result.U(i, j);
+            EXPECT_NEAR(packed.LU(i, j), expected, 1e-12);
+        }
+    }
+}
+
+TEST_F(DecomposerTest, lu_blocked_reconstructs_matrix) {
+
+    // larger than one panel so the trailing GEMM update is exercised
+    int n = 150;
+    Matrix mat(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            mat(i, j) = ((i * 37 + j * 11) % 23) / 7.0 - 1.5 + (i == j);
+        }
+    }
+
+    auto packed = Decomposer::lu(mat);
+
+    Matrix L = Matrix::identity(n);
+    Matrix U(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            if (j < i) {
+                L(i, j) = packed.LU(i, j);
+            }
+            else {
+                U(i, j) = packed.LU(i, j);
+            }
+        }
+    }
+
+    // applying the swaps in order to A gives L * U
+    Matrix pa(mat);
+    for (int k = 0; k < n; k++) {
+        EXPECT_GE(packed.pivots[k], k);
+        if (packed.pivots[k] != k) {
+            pa.row_swap(k, packed.pivots[k]);
+        }
+    }
+    Matrix lu = L * U;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            EXPECT_NEAR(lu(i, j), pa(i, j), 1e-9);
+        }
+    }
+}
+
+TEST_F(DecomposerTest, lu_in_place_and_errors) {
+
+    Matrix mat(2, 2, {0, 1,
+                      3, 4});
+
+    auto packed = Decomposer::lu(Matrix(mat));
+    EXPECT_EQ(packed.swaps, 1);
+    EXPECT_EQ(packed.LU, Matrix(2, 2, {3, 4, 0, 1}));
+    EXPECT_DOUBLE_EQ(mat.det(), -3);
+
+    EXPECT_THROW(Decomposer::lu(Matrix(2, 3)),
+                 internals::exceptions::non_square_matrix);
+    EXPECT_THROW(Decomposer::lu(mat.block(0, 0, 1, 0)),
+                 internals::exceptions::non_square_matrix);
+}
+
+TEST_F(DecomposerTest, cholesky_blocked_reconstructs_matrix) {
+
+    // A = B * B^T + n * I is positive definite, and larger than one block
+    int n = 150;
+    Matrix B(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            B(i, j) = ((i * 37 + j * 11) % 23) / 7.0 - 1.5;
+        }
+    }
+    Matrix Bt(B);
+    Bt.transpose();
+    Matrix mat = B * Bt + Matrix::identity(n) * n;
+
+    Matrix L = Decomposer::cholesky(mat);
+    Matrix Lt(L);
+    Lt.transpose();
+    Matrix llt = L * Lt;
+    for (int i = 0; i < n; i++) {
+        EXPECT_GT(L(i, i), 0);
+        for (int j = i + 1; j < n; j++) {
+            EXPECT_EQ(L(i, j), 0);
+        }
+        for (int j = 0; j < n; j++) {
+            EXPECT_NEAR(llt(i, j), mat(i, j), 1e-8);
+        }
+    }
+}
+
+TEST_F(DecomposerTest, cholesky_errors) {
+
+    Matrix indefinite(2, 2, {1, 2,
+                             2, 1});
+    EXPECT_THROW(Decomposer::cholesky(indefinite),
+                 internals::exceptions::not_positive_definite);
+    EXPECT_THROW(Decomposer::cholesky(Matrix(2, 2, {1, 2, 0, 1})),
+                 internals::exceptions::non_symmetric_matrix);
+    EXPECT_THROW(Decomposer::cholesky(Matrix(2, 3)),
+                 internals::exceptions::non_square_matrix);
+}
+
+TEST_F(DecomposerTest, ldlt_indefinite_matrix) {
+
+    // a zero diagonal forces 2x2 pivots
+    int n = 9;
+    Matrix mat(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            double value = (i == j) ? ((i % 3 == 0) ? 0 : i - 4.0)
+                                    : ((i * 5 + j * 3) % 7) - 3.0;
+            mat(i, j) = value;
+            mat(j, i) = value;
+        }
+    }
+
+    auto res = Decomposer::ldlt(mat);
+    Matrix Lt(res.L);
+    Lt.transpose();
+    Matrix ldlt = res.L * res.D * Lt;
+
+    bool has_block = false;
+    for (int i = 0; i < n; i++) {
+        EXPECT_EQ(res.L(i, i), 1);
+        if (i + 1 < n && res.D(i + 1, i) != 0) {
+            has_block = true;
+        }
+        for (int j = 0; j < n; j++) {
+            EXPECT_NEAR(ldlt(i, j), mat(res.perm[i], res.perm[j]), 1e-9);
+        }
+    }
+    EXPECT_TRUE(has_block);
+
+    auto swap = Decomposer::ldlt(Matrix(2, 2, {0, 1, 1, 0}));
+    EXPECT_EQ(swap.D, Matrix(2, 2, {0, 1, 1, 0}));
+    EXPECT_EQ(swap.L, Matrix::identity(2));
+
+    EXPECT_THROW(Decomposer::ldlt(Matrix(2, 2, {1, 2, 0, 1})),
+                 internals::exceptions::non_symmetric_matrix);
+}
+
+TEST_F(DecomposerTest, qr_blocked_tall_matrix) {
+
+    // several panels and row blocks; A^T A = R^T Q^T Q R = R^T R
+    int m = 600;
+    int n = 70;
+    Matrix mat(m, n);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            mat(i, j) = ((i * 37 + j * 11) % 23) / 7.0 - 1.5 + (i == j);
+        }
+    }
+
+    auto res = Decomposer::qr(mat);
+    EXPECT_EQ(res.QR.num_row(), m);
+    EXPECT_EQ(res.tau.size(), static_cast<size_t>(n));
+
+    Matrix R(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = i; j < n; j++) {
+            R(i, j) = res.QR(i, j);
+        }
+    }
+    Matrix Rt(R);
+    Rt.transpose();
+    Matrix At(mat);
+    At.transpose();
+    Matrix rtr = Rt * R;
+    Matrix ata = At * mat;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            EXPECT_NEAR(rtr(i, j), ata(i, j), 1e-7);
+        }
+    }
+}
+
+TEST_F(DecomposerTest, qr_reflectors_rebuild_matrix) {
+
+    Matrix mat(3, 4, {1, 2, 3, 4,
+                      0, 5, 6, 7,
+                      2, 1, 0, 9});
+    auto res = Decomposer::qr(mat);
+
+    // Q R, applying H_2, H_1 and H_0 in turn to the columns of R
+    Matrix qr(3, 4);
+    for (int i = 0; i < 3; i++) {
+        for (int j = i; j < 4; j++) {
+            qr(i, j) = res.QR(i, j);
+        }
+    }
+    for (int k = 2; k >= 0; k--) {
+        for (int j = 0; j < 4; j++) {
+            double dot = qr(k, j);
+            for (int i = k + 1; i < 3; i++) {
+                dot += res.QR(i, k) * qr(i, j);
+            }
+            dot *= res.tau[k];
+            qr(k, j) -= dot;
+            for (int i = k + 1; i < 3; i++) {
+                qr(i, j) -= dot * res.QR(i, k);
+            }
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 4; j++) {
+            EXPECT_NEAR(qr(i, j), mat(i, j), 1e-12);
+        }
+    }
+}
+
+TEST_F(DecomposerTest, eigh_small_matrix) {
+
+    Matrix mat(3, 3, {2, 1, 0,
+                      1, 2, 0,
+                      0, 0, 5});
+    auto res = Decomposer::eigh(mat);
+
+    EXPECT_NEAR(res.values[0], 1, 1e-12);
+    EXPECT_NEAR(res.values[1], 3, 1e-12);
+    EXPECT_NEAR(res.values[2], 5, 1e-12);
 
+    // eigenvectors up to sign
+    double s = 1 / std::sqrt(2.0);
+    EXPECT_NEAR(std::abs(res.vectors(0, 0)), s, 1e-12);
+    EXPECT_NEAR(res.vectors(0, 0), -res.vectors(1, 0), 1e-12);
+    EXPECT_NEAR(res.vectors(0, 1), res.vectors(1, 1), 1e-12);
+    EXPECT_NEAR(std::abs(res.vectors(2, 2)), 1, 1e-12);
 
+    EXPECT_EQ(Decomposer::eigvalsh(mat), Vector({1, 3, 5}));
+    EXPECT_EQ(Decomposer::eigvalsh(Matrix(1, 1, {-4})), Vector({-4}));
+
+    EXPECT_THROW(Decomposer::eigh(Matrix(2, 3)),
+                 internals::exceptions::non_square_matrix);
+    EXPECT_THROW(Decomposer::eigh(Matrix(2, 2, {1, 2, 0, 1})),
+                 internals::exceptions::non_symmetric_matrix);
+    EXPECT_THROW(Decomposer::eigh(mat, 0),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(Decomposer::eigh(mat, 4),
+                 internals::exceptions::invalid_argument);
+}
+
+TEST_F(DecomposerTest, eigh_divide_and_conquer) {
+
+    // larger than a panel of the reduction and a leaf of divide and
+    // conquer, with a repeated eigenvalue from the block copy
+    int n = 150;
+    Matrix mat(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            double value = ((i * 37 + j * 11) % 23) / 7.0 - 1.5;
+            if (i >= 100) {
+                value = (i - j == 100) ? 3.0 : 0.0;
+            }
+            mat(i, j) = value;
+            mat(j, i) = value;
+        }
+    }
+
+    auto res = Decomposer::eigh(mat);
+    Matrix av = mat * res.vectors;
+    Matrix vt(res.vectors);
+    vt.transpose();
+    Matrix vtv = vt * res.vectors;
+    for (int i = 0; i < n; i++) {
+        if (i > 0) {
+            EXPECT_LE(res.values[i - 1], res.values[i]);
+        }
+        for (int j = 0; j < n; j++) {
+            EXPECT_NEAR(av(i, j), res.vectors(i, j) * res.values[j], 1e-10);
+            EXPECT_NEAR(vtv(i, j), (i == j) ? 1.0 : 0.0, 1e-12);
+        }
+    }
+
+    Vector values = Decomposer::eigvalsh(mat);
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(values[i], res.values[i], 1e-10);
+    }
+}
+
+TEST_F(DecomposerTest, eigh_top_k) {
+
+    int n = 80;
+    int k = 5;
+    Matrix mat(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            double value = ((i * 13 + j * 29) % 17) / 5.0 - 1.6;
+            mat(i, j) = value;
+            mat(j, i) = value;
+        }
+    }
+
+    auto all = Decomposer::eigh(mat);
+    auto top = Decomposer::eigh(mat, k);
+    EXPECT_EQ(top.values.get_size(), k);
+    EXPECT_EQ(top.vectors.num_row(), n);
+    EXPECT_EQ(top.vectors.num_col(), k);
+
+    Matrix av = mat * top.vectors;
+    for (int j = 0; j < k; j++) {
+        EXPECT_NEAR(top.values[j], all.values[n - k + j], 1e-10);
+        double norm = 0;
+        for (int i = 0; i < n; i++) {
+            EXPECT_NEAR(av(i, j), top.vectors(i, j) * top.values[j], 1e-10);
+            norm += top.vectors(i, j) * top.vectors(i, j);
+        }
+        EXPECT_NEAR(norm, 1, 1e-12);
+    }
+
+    // the identity has one eigenvalue of multiplicity n, the inverse
+    // iteration has to return orthogonal vectors for it
+    auto ones = Decomposer::eigh(Matrix::identity(6), 3);
+    Matrix vt(ones.vectors);
+    vt.transpose();
+    Matrix vtv = vt * ones.vectors;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NEAR(ones.values[i], 1, 1e-12);
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(vtv(i, j), (i == j) ? 1.0 : 0.0, 1e-12);
+        }
+    }
+}
+
+TEST_F(DecomposerTest, eigh_top_k_repeated_eigenvalues) {
+
+    // every eigenvalue is repeated, the vectors still have to be orthonormal,
+    // including for the zero matrix whose tridiagonal has no scale
+    int n = 150;
+    int k = 40;
+    Matrix zero(n, n);
+    Matrix scaled(n, n);
+    for (int i = 0; i < n; i++) {
+        scaled(i, i) = 1e-8;
+    }
+    for (const Matrix* mat : {&zero, &scaled}) {
+        auto res = Decomposer::eigh(*mat, k);
+        Matrix vt(res.vectors);
+        vt.transpose();
+        Matrix vtv = vt * res.vectors;
+        for (int i = 0; i < k; i++) {
+            EXPECT_NEAR(res.values[i], (*mat)(0, 0), 1e-20);
+            for (int j = 0; j < k; j++) {
+                EXPECT_NEAR(vtv(i, j), (i == j) ? 1.0 : 0.0, 1e-12);
+            }
+        }
+    }
+
+    auto res = Decomposer::eigh(zero, k);
+    for (int i = 0; i < k; i++) {
+        EXPECT_EQ(res.values[i], 0);
+    }
+}
+
+TEST_F(DecomposerTest, svd_thin_and_full) {
+
+    Matrix tall(5, 3, {1, 2, 0,
+                       0, 1, 3,
+                       4, 0, 1,
+                       2, 2, 2,
+                       -1, 0, 5});
+    Matrix wide(tall);
+    wide.transpose();
+
+    for (const Matrix* mat : {&tall, &wide}) {
+        int m = mat->num_row();
+        int n = mat->num_col();
+        int k = (m < n) ? m : n;
+        for (bool full : {false, true}) {
+            auto res = Decomposer::svd(*mat, full);
+            int ucols = full ? m : k;
+            int vrows = full ? n : k;
+            EXPECT_EQ(res.U.num_row(), m);
+            EXPECT_EQ(res.U.num_col(), ucols);
+            EXPECT_EQ(res.S.get_size(), k);
+            EXPECT_EQ(res.VT.num_row(), vrows);
+            EXPECT_EQ(res.VT.num_col(), n);
+
+            // U S V^T over the first k columns rebuilds the matrix
+            for (int i = 0; i < m; i++) {
+                for (int j = 0; j < n; j++) {
+                    double value = 0;
+                    for (int p = 0; p < k; p++) {
+                        value += res.U(i, p) * res.S[p] * res.VT(p, j);
+                    }
+                    EXPECT_NEAR(value, (*mat)(i, j), 1e-12);
+                }
+            }
+
+            Matrix ut(res.U);
+            ut.transpose();
+            Matrix utu = ut * res.U;
+            for (int i = 0; i < ucols; i++) {
+                for (int j = 0; j < ucols; j++) {
+                    EXPECT_NEAR(utu(i, j), (i == j) ? 1.0 : 0.0, 1e-12);
+                }
+            }
+            Matrix v(res.VT);
+            v.transpose();
+            Matrix vtv = res.VT * v;
+            for (int i = 0; i < vrows; i++) {
+                for (int j = 0; j < vrows; j++) {
+                    EXPECT_NEAR(vtv(i, j), (i == j) ? 1.0 : 0.0, 1e-12);
+                }
+            }
+        }
+    }
+
+    // the singular values of a diagonal matrix are its absolute entries
+    Matrix diag(3, 3, {0, 0, 0,
+                       0, -4, 0,
+                       0, 0, 2});
+    Vector s = Decomposer::singular_values(diag);
+    EXPECT_NEAR(s[0], 4, 1e-14);
+    EXPECT_NEAR(s[1], 2, 1e-14);
+    EXPECT_NEAR(s[2], 0, 1e-14);
+}
+
+TEST_F(DecomposerTest, svd_divide_and_conquer) {
+
+    // larger than a panel of the bidiagonalization and a leaf of divide
+    // and conquer, the repeated rows make the matrix rank deficient
+    int m = 150;
+    int n = 120;
+    Matrix mat(m, n);
+    for (int i = 0; i < m; i++) {
+        int source = (i >= 100) ? i - 100 : i;
+        for (int j = 0; j < n; j++) {
+            mat(i, j) = ((source * 37 + j * 11) % 23) / 7.0 - 1.5;
+        }
+    }
+
+    auto res = Decomposer::svd(mat);
+    Matrix us(res.U);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            us(i, j) *= res.S[j];
+        }
+    }
+    Matrix usvt = us * res.VT;
+    Matrix ut(res.U);
+    ut.transpose();
+    Matrix utu = ut * res.U;
+    for (int i = 0; i < n; i++) {
+        if (i > 0) {
+            EXPECT_GE(res.S[i - 1], res.S[i]);
+        }
+        for (int j = 0; j < n; j++) {
+            EXPECT_NEAR(utu(i, j), (i == j) ? 1.0 : 0.0, 1e-12);
+        }
+    }
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < n; j++) {
+            EXPECT_NEAR(usvt(i, j), mat(i, j), 1e-10);
+        }
+    }
+
+    Vector values = Decomposer::singular_values(mat);
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(values[i], res.S[i], 1e-10);
+    }
+}
+
+TEST_F(DecomposerTest, randomized_svd_low_rank) {
+
+    // a rank 6 matrix, the sketch of 5 + 10 columns captures its range
+    int m = 300;
+    int n = 120;
+    int k = 5;
+    Matrix left(m, 6);
+    Matrix right(6, n);
+    for (int i = 0; i < m; i++) {
+        for (int j = 0; j < 6; j++) {
+            left(i, j) = ((i * 7 + j * 13) % 11) / 5.0 - 1.0;
+        }
+    }
+    for (int i = 0; i < 6; i++) {
+        for (int j = 0; j < n; j++) {
+            right(i, j) = (((i + 1) * j * 5) % 17) / (3.0 * (i + 1)) - 0.5;
+        }
+    }
+    Matrix mat = left * right;
+
+    auto full = Decomposer::svd(mat);
+    auto res = Decomposer::randomized_svd(mat, k);
+    EXPECT_EQ(res.U.num_row(), m);
+    EXPECT_EQ(res.U.num_col(), k);
+    EXPECT_EQ(res.S.get_size(), k);
+    EXPECT_EQ(res.VT.num_row(), k);
+    EXPECT_EQ(res.VT.num_col(), n);
+
+    Matrix ut(res.U);
+    ut.transpose();
+    Matrix utav = ut * mat;
+    double tol = 1e-9 * full.S[0];
+    for (int j = 0; j < k; j++) {
+        EXPECT_NEAR(res.S[j], full.S[j], tol);
+
+        // u_j^T A = s_j v_j^T
+        for (int i = 0; i < n; i++) {
+            EXPECT_NEAR(utav(j, i), res.S[j] * res.VT(j, i), tol);
+        }
+    }
+
+    // the same seed gives the same factors, another seed the same values
+    auto again = Decomposer::randomized_svd(mat, k);
+    auto other = Decomposer::randomized_svd(mat, k, 10, 2, 42);
+    for (int j = 0; j < k; j++) {
+        EXPECT_EQ(again.S[j], res.S[j]);
+        EXPECT_NEAR(other.S[j], res.S[j], tol);
+        for (int i = 0; i < m; i++) {
+            EXPECT_EQ(again.U(i, j), res.U(i, j));
+        }
+    }
+
+    // the sketch is capped at min(m, n) columns
+    Matrix wide(mat);
+    wide.transpose();
+    auto capped = Decomposer::randomized_svd(wide, 120, 10, 0);
+    EXPECT_NEAR(capped.S[0], full.S[0], tol);
+
+    EXPECT_THROW(Decomposer::randomized_svd(mat, 0),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(Decomposer::randomized_svd(mat, 121),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(Decomposer::randomized_svd(mat, 5, -1),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(Decomposer::randomized_svd(mat, 5, 10, -1),
+                 internals::exceptions::invalid_argument);
+}
+
+TEST_F(DecomposerTest, eig_small_matrix) {
+
+    // a rotation has the complex pair +-i
+    Matrix rot(2, 2, {0, -1,
+                      1, 0});
+    auto res = Decomposer::eig(rot);
+    EXPECT_NEAR(res.values[0].real(), 0, 1e-14);
+    EXPECT_NEAR(std::abs(res.values[0].imag()), 1, 1e-14);
+    EXPECT_NEAR(std::abs(res.values[0] - std::conj(res.values[1])), 0,
+                1e-14);
+    for (int j = 0; j < 2; j++) {
+        for (int i = 0; i < 2; i++) {
+            std::complex<double> av = rot(i, 0) * res.vectors(0, j) +
+                                      rot(i, 1) * res.vectors(1, j);
+            EXPECT_NEAR(std::abs(av - res.values[j] * res.vectors(i, j)), 0,
+                        1e-14);
+        }
+    }
+
+    // a triangular matrix keeps its diagonal
+    Matrix tri(3, 3, {1, 2, 3,
+                      0, 4, 5,
+                      0, 0, 6});
+    VectorC values = Decomposer::eigvals(tri);
+    EXPECT_NEAR(std::abs(values[0] - 1.0), 0, 1e-14);
+    EXPECT_NEAR(std::abs(values[1] - 4.0), 0, 1e-14);
+    EXPECT_NEAR(std::abs(values[2] - 6.0), 0, 1e-14);
+
+    EXPECT_THROW(Decomposer::eig(Matrix(2, 3)),
+                 internals::exceptions::non_square_matrix);
+    EXPECT_THROW(Decomposer::eigvals(Matrix(3, 2)),
+                 internals::exceptions::non_square_matrix);
+}
+
+TEST_F(DecomposerTest, eig_aggressive_deflation) {
+
+    // large enough for deflation windows, with real and complex
+    // eigenvalues and rows of very different scale for the balancing
+    int n = 120;
+    Matrix mat(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double value = ((i * 29 + j * 13) % 31) / 9.0 - 1.7;
+            mat(i, j) = (i < 10) ? value * 1e4 : value;
+        }
+    }
+
+    auto res = Decomposer::eig(mat);
+    double trace = 0;
+    std::complex<double> sum = 0;
+    for (int j = 0; j < n; j++) {
+        trace += mat(j, j);
+        sum += res.values[j];
+        double norm = 0;
+        for (int i = 0; i < n; i++) {
+            std::complex<double> av = 0;
+            for (int p = 0; p < n; p++) {
+                av += mat(i, p) * res.vectors(p, j);
+            }
+            norm += std::norm(res.vectors(i, j));
+            EXPECT_NEAR(std::abs(av - res.values[j] * res.vectors(i, j)), 0,
+                        1e-8);
+        }
+        EXPECT_NEAR(norm, 1, 1e-12);
+    }
+    EXPECT_NEAR(sum.real(), trace, 1e-8);
+    EXPECT_NEAR(sum.imag(), 0, 1e-8);
+
+    // the same eigenvalues without the Schur vectors
+    VectorC values = Decomposer::eigvals(mat);
+    for (int j = 0; j < n; j++) {
+        double nearest = std::abs(values[j] - res.values[0]);
+        for (int i = 1; i < n; i++) {
+            nearest = std::min(nearest, std::abs(values[j] - res.values[i]));
+        }
+        EXPECT_LT(nearest, 1e-8);
+    }
+}
 
-} // namespace astra
\ No newline at end of file
+} // namespace astra
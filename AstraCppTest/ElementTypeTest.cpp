@@ -0,0 +1,147 @@
+#include "pch.h"
+
+#include <complex>
+#include <type_traits>
+#include "gtest/gtest.h"
+
+#include "Matrix.h"
+#include "Vector.h"
+
+namespace astra {
+
+using cd = std::complex<double>;
+using cf = std::complex<float>;
+
+// Test fixture class for the float and complex instantiations of Matrix and
+// Vector
+class ElementTypeTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(ElementTypeTest, aliases_keep_double) {
+    EXPECT_TRUE((std::is_same<Matrix, BasicMatrix<double>>::value));
+    EXPECT_TRUE((std::is_same<Vector::value_type, double>::value));
+    EXPECT_TRUE((std::is_same<MatrixCF::real_type, float>::value));
+    EXPECT_TRUE((std::is_same<decltype(VectorC(1).mag()), double>::value));
+}
+
+TEST_F(ElementTypeTest, float_matrix_arithmetic) {
+    MatrixF a(2, 2, {1.5f, 2.0f, -3.0f, 4.0f});
+    MatrixF b(2, 2, {0.5f, 1.0f, 1.0f, -2.0f});
+
+    MatrixF c = (a + b) * 2.0f - a / 2.0f;
+    EXPECT_FLOAT_EQ(c(0, 0), 3.25f);
+    EXPECT_FLOAT_EQ(c(0, 1), 5.0f);
+    EXPECT_FLOAT_EQ(c(1, 0), -2.5f);
+    EXPECT_FLOAT_EQ(c(1, 1), 2.0f);
+
+    MatrixF p = a * b;
+    EXPECT_FLOAT_EQ(p(0, 0), 2.75f);
+    EXPECT_FLOAT_EQ(p(1, 1), -11.0f);
+    EXPECT_FLOAT_EQ(a.sum(), 4.5f);
+    EXPECT_FLOAT_EQ(a.min(), -3.0f);
+    EXPECT_FLOAT_EQ(a.det(), 12.0f);
+}
+
+TEST_F(ElementTypeTest, float_gemm_matches_double) {
+    // large enough for the packed GEMM path
+    Matrix a(70, 50);
+    Matrix b(50, 40);
+    for (int i = 0; i < 70; ++i) {
+        for (int j = 0; j < 50; ++j) {
+            a(i, j) = ((i * 7 + j * 3) % 11) * 0.25 - 1.0;
+        }
+    }
+    for (int i = 0; i < 50; ++i) {
+        for (int j = 0; j < 40; ++j) {
+            b(i, j) = ((i * 5 + j) % 13) * 0.125 - 0.5;
+        }
+    }
+    MatrixF af(70, 50);
+    MatrixF bf(50, 40);
+    for (int i = 0; i < 70; ++i) {
+        for (int j = 0; j < 50; ++j) {
+            af(i, j) = static_cast<float>(a(i, j));
+        }
+    }
+    for (int i = 0; i < 50; ++i) {
+        for (int j = 0; j < 40; ++j) {
+            bf(i, j) = static_cast<float>(b(i, j));
+        }
+    }
+
+    Matrix c = a * b;
+    MatrixF cf = af * bf;
+    for (int i = 0; i < 70; ++i) {
+        for (int j = 0; j < 40; ++j) {
+            EXPECT_NEAR(cf(i, j), c(i, j), 1e-4);
+        }
+    }
+}
+
+TEST_F(ElementTypeTest, float_vector_and_views) {
+    VectorF v{3.0f, 4.0f};
+    EXPECT_FLOAT_EQ(v.mag(), 5.0f);
+    EXPECT_FLOAT_EQ(v * v, 25.0f);
+    VectorF n = v.normalize();
+    EXPECT_FLOAT_EQ(n[0], 0.6f);
+
+    MatrixF m(3, 3, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+    EXPECT_FLOAT_EQ(m.block(1, 1, 2, 2).sum(), 28.0f);
+    EXPECT_FLOAT_EQ(m.col_view(2).sum(), 18.0f);
+
+    VectorF r = m * VectorF{1.0f, 0.0f, -1.0f};
+    EXPECT_FLOAT_EQ(r[0], -2.0f);
+    EXPECT_FLOAT_EQ(r[2], -2.0f);
+}
+
+TEST_F(ElementTypeTest, complex_matrix_product) {
+    MatrixC a(2, 2, {cd(1, 1), cd(0, 2), cd(3, 0), cd(1, -1)});
+    MatrixC b(2, 1, {cd(2, 0), cd(0, 1)});
+
+    MatrixC p = a * b;
+    // (1+i)*2 + 2i*i = 2 + 2i - 2, 3*2 + (1-i)*i = 6 + i + 1
+    EXPECT_EQ(p(0, 0), cd(0, 2));
+    EXPECT_EQ(p(1, 0), cd(7, 1));
+
+    MatrixC s = a * cd(0, 1) + a;
+    EXPECT_EQ(s(0, 0), cd(0, 2));
+    EXPECT_EQ(s(1, 1), cd(2, 0));
+    EXPECT_EQ(a.trace(), cd(2, 0));
+}
+
+TEST_F(ElementTypeTest, complex_dot_conjugates_lhs) {
+    VectorC u{cd(1, 2), cd(3, -1)};
+    VectorC v{cd(0, 1), cd(2, 0)};
+
+    // v * v is the squared magnitude
+    EXPECT_EQ(u * u, cd(15, 0));
+    EXPECT_NEAR(u.mag(), std::sqrt(15.0), 1e-6);
+    // conj(1+2i)*i + conj(3-i)*2 = (2 + i) + (6 + 2i)
+    EXPECT_EQ(u * v, cd(8, 3));
+    EXPECT_EQ(VectorViewC(u) * VectorViewC(v), cd(8, 3));
+    EXPECT_EQ(VectorC(u + v) * v, cd(8, 3) + v * v);
+}
+
+TEST_F(ElementTypeTest, complex_det_inv_and_ordering) {
+    MatrixCF a(2, 2, {cf(2, 1), cf(1, 0), cf(0, 1), cf(3, -1)});
+    cf det = a.det();
+    // (2+i)(3-i) - i = 7 + i - i
+    EXPECT_NEAR(det.real(), 7.0f, 1e-5);
+    EXPECT_NEAR(det.imag(), 0.0f, 1e-5);
+
+    MatrixCF id = a * a.inv();
+    EXPECT_TRUE(id.is_identity());
+
+    // complex min and max order by real part, then imaginary part
+    EXPECT_EQ(a.min(), cf(0, 1));
+    EXPECT_EQ(a.max(), cf(3, -1));
+    VectorCF v{cf(1, 5), cf(1, -2), cf(0, 9)};
+    EXPECT_EQ(v.min(), cf(0, 9));
+    EXPECT_EQ(v.max(), cf(1, 5));
+}
+
+} // namespace astra
@@ -0,0 +1,139 @@
+#include "pch.h"
+
+#include <complex>
+#include "gtest/gtest.h"
+
+#include "FixedMatrix.h"
+#include "Matrix.h"
+#include "Exceptions.h"
+#include "MathUtils.h"
+
+namespace astra {
+
+// Test fixture class for FixedMatrix
+class FixedMatrixTest : public ::testing::Test {
+  protected:
+    Matrix3 m3{2, -1, 0, -1, 2, -1, 0, -1, 2};
+    Matrix4 m4{4, 3, 2, 1, 0, 1, -1, 2, 3, 0, 2, 5, 1, 2, 0, 3};
+
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(FixedMatrixTest, construction_and_access) {
+    Matrix2 zero;
+    EXPECT_EQ(zero(1, 1), 0);
+    EXPECT_EQ(m3(1, 2), -1);
+    m3(1, 2) = 5;
+    EXPECT_EQ(m3(1, 2), 5);
+    EXPECT_EQ(Matrix3::num_row(), 3);
+    EXPECT_EQ((FixedMatrix<2, 5>::num_col()), 5);
+#if ASTRA_BOUNDS_CHECK
+    EXPECT_THROW(m3(3, 0), astra::internals::exceptions::index_out_of_range);
+    EXPECT_THROW(m3(0, -1), astra::internals::exceptions::index_out_of_range);
+#endif
+    EXPECT_EQ(Matrix3::identity(), Matrix3(1, 0, 0, 0, 1, 0, 0, 0, 1));
+}
+
+TEST_F(FixedMatrixTest, arithmetic) {
+    Matrix2 a{1, 2, 3, 4};
+    Matrix2 b{0, 1, 1, 0};
+    EXPECT_EQ(a + b, Matrix2(1, 3, 4, 4));
+    EXPECT_EQ(a - b, Matrix2(1, 1, 2, 4));
+    EXPECT_EQ(-a, Matrix2(-1, -2, -3, -4));
+    EXPECT_EQ(a * 2.0, Matrix2(2, 4, 6, 8));
+    EXPECT_EQ(2.0 * a, a + a);
+    EXPECT_EQ(a / 2.0, Matrix2(0.5, 1, 1.5, 2));
+    EXPECT_EQ(a.sum(), 10);
+    EXPECT_EQ(a.trace(), 5);
+}
+
+TEST_F(FixedMatrixTest, products_match_matrix) {
+    FixedMatrix<2, 3> a{1, 2, 3, 4, 5, 6};
+    FixedMatrix<3, 2> b{7, 8, 9, 10, 11, 12};
+    FixedMatrix<2, 2> c = a * b;
+    EXPECT_EQ(Matrix(c), Matrix(a) * Matrix(b));
+
+    Vector3 v{1, -2, 3};
+    EXPECT_EQ(Vector(m3 * v), Matrix(m3) * Vector(v));
+
+    Matrix at(a);
+    at.transpose();
+    EXPECT_EQ(Matrix(a.transposed()), at);
+    EXPECT_EQ(a.transposed()(2, 1), 6);
+}
+
+TEST_F(FixedMatrixTest, det_matches_matrix) {
+    EXPECT_DOUBLE_EQ(Matrix2(1, 2, 3, 4).det(), -2);
+    EXPECT_NEAR(m3.det(), Matrix(m3).det(), 1e-12);
+    EXPECT_NEAR(m4.det(), Matrix(m4).det(), 1e-9);
+
+    FixedMatrix<5, 5> m5;
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 5; ++j) {
+            m5(i, j) = (i == j) ? 4 : 1.0 / (i + j + 1);
+        }
+    }
+    EXPECT_NEAR(m5.det(), Matrix(m5).det(), 1e-9);
+    EXPECT_TRUE(Matrix2(1, 2, 2, 4).is_singular());
+}
+
+TEST_F(FixedMatrixTest, inverse_up_to_five) {
+    Matrix2 m2{4, 7, 2, 6};
+    EXPECT_EQ(m2 * m2.inv(), Matrix2::identity());
+    EXPECT_EQ(m3 * m3.inv(), Matrix3::identity());
+    EXPECT_EQ(m4 * m4.inv(), Matrix4::identity());
+    Matrix expected = Matrix(m4).inv();
+    Matrix4 inverse = m4.inv();
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            EXPECT_NEAR(inverse(i, j), expected(i, j), 1e-12);
+        }
+    }
+
+    FixedMatrix<5, 5> m5;
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 5; ++j) {
+            m5(i, j) = (i + 2 * j) % 5 + (i == j);
+        }
+    }
+    EXPECT_EQ(m5 * m5.inv(), (FixedMatrix<5, 5>::identity()));
+
+    EXPECT_THROW(Matrix2(1, 2, 2, 4).inv(),
+                 astra::internals::exceptions::singular_matrix);
+    EXPECT_THROW(Matrix3(1, 2, 3, 4, 5, 6, 7, 8, 9).inv(),
+                 astra::internals::exceptions::singular_matrix);
+    EXPECT_THROW(Matrix4().inv(),
+                 astra::internals::exceptions::singular_matrix);
+    EXPECT_THROW((FixedMatrix<5, 5>().inv()),
+                 astra::internals::exceptions::singular_matrix);
+}
+
+TEST_F(FixedMatrixTest, conversion_to_and_from_matrix) {
+    Matrix dynamic = m3;
+    EXPECT_EQ(dynamic.num_row(), 3);
+    EXPECT_EQ(dynamic(2, 1), -1);
+
+    Matrix3 back(dynamic);
+    EXPECT_EQ(back, m3);
+    EXPECT_THROW(Matrix3(Matrix(3, 2)),
+                 astra::internals::exceptions::matrix_size_mismatch);
+}
+
+TEST_F(FixedMatrixTest, usable_in_constant_expressions) {
+    constexpr Matrix3 rot{0, -1, 0, 1, 0, 0, 0, 0, 1};
+    static_assert(rot.det() == 1, "rotations have determinant one");
+    static_assert((rot * rot.inv()).trace() == 3, "inverse");
+    static_assert((rot * Vector3(1, 0, 0))[1] == 1, "rotating a vector");
+    EXPECT_EQ(rot.transposed(), rot.inv());
+}
+
+TEST_F(FixedMatrixTest, complex_elements) {
+    using cd = std::complex<double>;
+    FixedMatrix<2, 2, cd> a{cd(2, 1), cd(1, 0), cd(0, 1), cd(3, -1)};
+    EXPECT_NEAR(std::abs(a.det() - cd(7, 0)), 0, 1e-12);
+    EXPECT_EQ(a * a.inv(), (FixedMatrix<2, 2, cd>::identity()));
+}
+
+} // namespace astra
@@ -0,0 +1,105 @@
+#include "pch.h"
+
+#include <complex>
+#include <sstream>
+#include "gtest/gtest.h"
+
+#include "FixedVector.h"
+#include "Vector.h"
+#include "Exceptions.h"
+#include "MathUtils.h"
+
+namespace astra {
+
+// Test fixture class for FixedVector
+class FixedVectorTest : public ::testing::Test {
+  protected:
+    Vector3 a{1, 2, 3};
+    Vector3 b{4, -5, 6};
+
+    void SetUp() override {}
+
+    void TearDown() override {}
+};
+
+TEST_F(FixedVectorTest, construction_and_access) {
+    Vector3 zero;
+    EXPECT_EQ(zero[0], 0);
+    EXPECT_EQ(zero[2], 0);
+    EXPECT_EQ(a[1], 2);
+    a[1] = 7;
+    EXPECT_EQ(a[1], 7);
+    EXPECT_EQ(Vector3::get_size(), 3);
+#if ASTRA_BOUNDS_CHECK
+    EXPECT_THROW(a[3], astra::internals::exceptions::index_out_of_range);
+    EXPECT_THROW(a[-1], astra::internals::exceptions::index_out_of_range);
+#endif
+}
+
+TEST_F(FixedVectorTest, arithmetic) {
+    EXPECT_EQ(a + b, Vector3(5, -3, 9));
+    EXPECT_EQ(a - b, Vector3(-3, 7, -3));
+    EXPECT_EQ(-a, Vector3(-1, -2, -3));
+    EXPECT_EQ(a * 2.0, Vector3(2, 4, 6));
+    EXPECT_EQ(2.0 * a, Vector3(2, 4, 6));
+    EXPECT_EQ(b / 2.0, Vector3(2, -2.5, 3));
+    EXPECT_THROW(a / 0.0, astra::internals::exceptions::zero_division);
+    EXPECT_EQ(a * b, 12);
+    EXPECT_EQ(a.sum(), 6);
+}
+
+TEST_F(FixedVectorTest, cross_product_matches_vector) {
+    Vector3 c = a ^ b;
+    Vector expected = Vector(a) ^ Vector(b);
+    EXPECT_EQ(Vector(c), expected);
+    EXPECT_EQ(c * a, 0);
+    EXPECT_EQ(c * b, 0);
+}
+
+TEST_F(FixedVectorTest, mag_normalize_and_angle) {
+    Vector2 v{3, 4};
+    EXPECT_DOUBLE_EQ(v.mag(), 5);
+    EXPECT_EQ(v.normalize(), Vector2(0.6, 0.8));
+    EXPECT_THROW(Vector2().normalize(),
+                 astra::internals::exceptions::zero_division);
+
+    EXPECT_NEAR(Vector3::angle(a, b), Vector::angle(Vector(a), Vector(b)),
+                1e-12);
+    EXPECT_NEAR(Vector2::angle_deg(Vector2(1, 0), Vector2(0, 2)), 90, 1e-9);
+    EXPECT_THROW(Vector3::angle(a, Vector3()),
+                 astra::internals::exceptions::null_vector);
+}
+
+TEST_F(FixedVectorTest, conversion_to_and_from_vector) {
+    Vector dynamic = a;
+    EXPECT_EQ(dynamic.get_size(), 3);
+    EXPECT_EQ(dynamic, Vector({1, 2, 3}));
+
+    Vector3 back(dynamic);
+    EXPECT_EQ(back, a);
+    EXPECT_THROW(Vector3(Vector{1, 2}),
+                 astra::internals::exceptions::vector_size_mismatch);
+
+    std::ostringstream os;
+    os << a;
+    EXPECT_EQ(os.str(), "[1, 2, 3]\n");
+}
+
+TEST_F(FixedVectorTest, usable_in_constant_expressions) {
+    constexpr Vector3 x{1, 0, 0};
+    constexpr Vector3 y{0, 1, 0};
+    constexpr Vector3 z = x ^ y;
+    static_assert(z[2] == 1, "cross product of the unit vectors");
+    static_assert((x + y) * (x + y) == 2, "dot product");
+    static_assert((x * 3.0).sum() == 3, "scaling");
+    EXPECT_EQ(z, Vector3(0, 0, 1));
+}
+
+TEST_F(FixedVectorTest, complex_elements) {
+    using cd = std::complex<double>;
+    FixedVector<2, cd> u{cd(1, 2), cd(3, -1)};
+    EXPECT_EQ(u * u, cd(15, 0));
+    EXPECT_NEAR(u.mag(), std::sqrt(15.0), 1e-12);
+}
+
+} // namespace astra
@@ -0,0 +1,147 @@
+#include "pch.h"
+
+#include "gtest/gtest.h"
+
+#include "LUFactorization.h"
+#include "Matrix.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+#include "MathUtils.h"
+
+namespace astra {
+
+// Test fixture class for LUFactorization
+class LUFactorizationTest : public ::testing::Test {
+  protected:
+    Matrix* A;
+
+    void SetUp() override {
+        A = new Matrix(4, 4, {1, 2, -1, 5,
+                              3, 6, -3, -2,
+                              7, -5, 3, -1,
+                              5, 10, 2, -7});
+    }
+
+    void TearDown() override { delete A; }
+
+    // diagonally dominant n x n matrix spanning several solve blocks
+    static Matrix large(int n) {
+        Matrix mat(n, n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                mat(i, j) = ((i * 13 + j * 7) % 17) / 5.0 - 1.6;
+            }
+            mat(i, i) += n;
+        }
+        return mat;
+    }
+};
+
+TEST_F(LUFactorizationTest, solve_vector) {
+    LUFactorization lu(*A);
+    EXPECT_EQ(lu.size(), 4);
+    EXPECT_FALSE(lu.is_singular());
+
+    Vector x = lu.solve(Vector{22, -2, 2, 3});
+    EXPECT_EQ(*A * x, Vector({22, -2, 2, 3}));
+    EXPECT_EQ(x, Solver::solve(*A, Vector{22, -2, 2, 3}));
+}
+
+TEST_F(LUFactorizationTest, solve_many_right_hand_sides) {
+    LUFactorization lu(*A);
+    Matrix B(4, 3, {1, 0, 2,
+                    0, 1, -1,
+                    3, 4, 0,
+                    -2, 5, 1});
+    Matrix X = lu.solve(B);
+    EXPECT_EQ(X.num_row(), 4);
+    EXPECT_EQ(X.num_col(), 3);
+    Matrix product = *A * X;
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(product(i, j), B(i, j), 1e-12);
+        }
+    }
+
+    for (int j = 0; j < 3; j++) {
+        EXPECT_EQ(X.get_col(j), lu.solve(B.col_view(j)));
+    }
+}
+
+TEST_F(LUFactorizationTest, blocked_solve_large_system) {
+    int n = 200;
+    Matrix mat = large(n);
+    LUFactorization lu(mat);
+
+    Matrix B(n, 5);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < 5; j++) {
+            B(i, j) = (i + 1) * (j - 2);
+        }
+    }
+    Matrix residual = mat * lu.solve(B) - B;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < 5; j++) {
+            EXPECT_NEAR(residual(i, j), 0, 1e-9);
+        }
+    }
+}
+
+TEST_F(LUFactorizationTest, det_and_inverse) {
+    LUFactorization lu(*A);
+    EXPECT_NEAR(lu.det(), A->det(), 1e-9);
+    // A needs a row swap to be inverted, which Matrix::inv does not do
+    Matrix product = *A * lu.inverse();
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 4; j++) {
+            EXPECT_NEAR(product(i, j), (i == j) ? 1 : 0, 1e-12);
+        }
+    }
+    Matrix mat(3, 3, {1, 2, 3,
+                      0, 1, 4,
+                      5, 6, 0});
+    Matrix inverse = LUFactorization(mat).inverse();
+    Matrix expected = mat.inv();
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(inverse(i, j), expected(i, j), 1e-12);
+        }
+    }
+
+    Matrix swapped(2, 2, {0, 2, 3, 1});
+    EXPECT_DOUBLE_EQ(LUFactorization(swapped).det(), -6);
+}
+
+TEST_F(LUFactorizationTest, singular_matrix) {
+    Matrix mat(3, 3, {1, 2, 3,
+                      4, 5, 6,
+                      7, 8, 9});
+    LUFactorization lu(mat);
+    EXPECT_TRUE(lu.is_singular());
+    EXPECT_EQ(lu.det(), 0.0);
+    EXPECT_THROW(lu.solve(Vector{1, 2, 3}),
+                 internals::exceptions::singular_matrix);
+    EXPECT_THROW(lu.inverse(), internals::exceptions::singular_matrix);
+}
+
+TEST_F(LUFactorizationTest, invalid_sizes) {
+    EXPECT_THROW(LUFactorization(Matrix(2, 3)),
+                 internals::exceptions::non_square_matrix);
+
+    LUFactorization lu(*A);
+    EXPECT_THROW(lu.solve(Vector{1, 2, 3}),
+                 internals::exceptions::variable_and_value_number_mismatch);
+    EXPECT_THROW(lu.solve(Matrix(3, 2)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+}
+
+TEST_F(LUFactorizationTest, factor_view_and_packed_factors) {
+    Matrix big = large(6);
+    LUFactorization lu(big.block(1, 1, 4, 4));
+    EXPECT_EQ(lu.size(), 4);
+    EXPECT_EQ(lu.get_pivots().size(), 4u);
+    EXPECT_EQ(lu.packed(), Decomposer::lu(big.block(1, 1, 4, 4)).LU);
+}
+
+} // namespace astra
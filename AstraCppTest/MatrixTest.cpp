@@ -160,6 +160,60 @@ TEST_F(MatrixTest, matrix_subtraction_empty) {
     EXPECT_EQ(result(1, 1), 4);
 }
 
+TEST_F(MatrixTest, fused_expression) {
+    Matrix matA(2, 2, {1, 2, 3, 4});
+    Matrix matB(2, 2, {5, 6, 7, 8});
+    Matrix matC(2, 2, {1, 1, 2, 2});
+
+    Matrix result = matA + matB - matC * 2.0 + 0.5 * matA / 0.25;
+
+    EXPECT_EQ(result, Matrix(2, 2, {6, 10, 12, 16}));
+}
+
+TEST_F(MatrixTest, expression_assignment_aliasing) {
+    Matrix matA(2, 2, {1, 2, 3, 4});
+    Matrix matB(2, 2, {1, 1, 1, 1});
+    const double* storage = &matA(0, 0);
+
+    matA = matA * 3.0 - matB;
+
+    EXPECT_EQ(matA, Matrix(2, 2, {2, 5, 8, 11}));
+    // same size, so the existing buffer is reused
+    EXPECT_EQ(&matA(0, 0), storage);
+}
+
+TEST_F(MatrixTest, expression_assignment_resizes) {
+    Matrix matA(1, 1);
+    Matrix matB(2, 3, {1, 2, 3, 4, 5, 6});
+
+    matA = matB + matB;
+
+    EXPECT_EQ(matA.num_row(), 2);
+    EXPECT_EQ(matA.num_col(), 3);
+    EXPECT_EQ(matA(1, 2), 12);
+}
+
+TEST_F(MatrixTest, expression_nested_size_mismatch) {
+    Matrix matA(2, 2);
+    Matrix matB(2, 2);
+    Matrix matC(3, 2);
+
+    EXPECT_THROW(matA + matB - matC,
+                 astra::internals::exceptions::matrix_size_mismatch);
+    EXPECT_THROW((matA + matB) / 0.0,
+                 astra::internals::exceptions::zero_division);
+}
+
+TEST_F(MatrixTest, expression_as_product_operand) {
+    Matrix matA(2, 2, {1, 2, 3, 4});
+    Matrix matB(2, 2, {1, 0, 0, 1});
+
+    EXPECT_EQ((matA + matB) * matB, Matrix(2, 2, {2, 2, 3, 5}));
+    EXPECT_EQ(matB * (matA - matB), Matrix(2, 2, {0, 2, 3, 3}));
+    EXPECT_EQ(matA * 2.0, matA + matA);
+    EXPECT_TRUE(matA * 2.0 != matA);
+}
+
 TEST_F(MatrixTest, matrix_multiplication) {
     Matrix matA(2, 2);
     Matrix matB(2, 2);
@@ -237,6 +291,50 @@ TEST_F(MatrixTest, matrix_multiplication_identity_reverse) {
     EXPECT_EQ(result(1, 1), 4);
 }
 
+TEST_F(MatrixTest, matrix_multiplication_large_blocked) {
+    // sizes cross the cache blocks and leave partial register tiles
+    const int m = 131, k = 300, n = 77;
+    Matrix matA(m, k);
+    Matrix matB(k, n);
+
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < k; ++j) {
+            matA(i, j) = (i * 7 + j * 3) % 11 - 5;
+        }
+    }
+    for (int i = 0; i < k; ++i) {
+        for (int j = 0; j < n; ++j) {
+            matB(i, j) = (i * 5 + j * 2) % 13 - 6;
+        }
+    }
+
+    Matrix result = matA * matB;
+
+    ASSERT_EQ(result.num_row(), m);
+    ASSERT_EQ(result.num_col(), n);
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            double expected = 0.0;
+            for (int p = 0; p < k; ++p) {
+                expected += matA(i, p) * matB(p, j);
+            }
+            EXPECT_EQ(result(i, j), expected);
+        }
+    }
+}
+
+TEST_F(MatrixTest, matrix_multiplication_large_identity) {
+    Matrix matA(100, 60);
+    for (int i = 0; i < 100; ++i) {
+        for (int j = 0; j < 60; ++j) {
+            matA(i, j) = i - 2 * j;
+        }
+    }
+
+    EXPECT_EQ(Matrix::identity(100) * matA, matA);
+    EXPECT_EQ(matA * Matrix::identity(60), matA);
+}
+
 TEST_F(MatrixTest, transpose_square_matrix_in_place) {
     Matrix mat(2, 2, {1.0, 2.0, 
                       3.0, 4.0});
@@ -633,6 +731,46 @@ TEST_F(MatrixTest, matrix_assignment_different_size) {
     EXPECT_EQ(matB(1, 1), 4);
 }
 
+TEST_F(MatrixTest, matrix_move_constructor) {
+    Matrix matA(2, 2, {1, 2, 3, 4});
+    Matrix matB(std::move(matA));
+
+    EXPECT_EQ(matB.num_row(), 2);
+    EXPECT_EQ(matB.num_col(), 2);
+    EXPECT_EQ(matB(0, 0), 1);
+    EXPECT_EQ(matB(1, 1), 4);
+
+    EXPECT_EQ(matA.num_row(), 0);
+    EXPECT_EQ(matA.num_col(), 0);
+}
+
+TEST_F(MatrixTest, matrix_move_assignment) {
+    Matrix matA(2, 3, {1, 2, 3, 4, 5, 6});
+    Matrix matB(1, 1);
+
+    matB = std::move(matA);
+
+    EXPECT_EQ(matB.num_row(), 2);
+    EXPECT_EQ(matB.num_col(), 3);
+    EXPECT_EQ(matB(1, 2), 6);
+    EXPECT_EQ(matA.num_row(), 0);
+
+    // a moved-from matrix can be assigned again
+    matA = matB;
+    EXPECT_EQ(matA, matB);
+}
+
+TEST_F(MatrixTest, moved_from_matrix_vector_product) {
+    Matrix matA(2, 2, {1, 2, 3, 4});
+    Vector vecA({1, 1});
+    Matrix matB = std::move(matA);
+    Vector vecB = std::move(vecA);
+
+    // 0 x 0 operands are rejected like any empty result, not divided by
+    EXPECT_THROW(matA * vecA, astra::internals::exceptions::invalid_size);
+    EXPECT_EQ(matB * vecB, Vector({3, 7}));
+}
+
 TEST_F(MatrixTest, matrix_equality) {
     Matrix matA(2, 2);
     Matrix matB(2, 2);
@@ -1973,8 +2111,17 @@ TEST_F(MatrixTest, nullspace_hilbert_matrix) {
     EXPECT_TRUE(nullspace.is_zero());
 }
 
+TEST_F(MatrixTest, unchecked_access_and_data) {
+    Matrix mat(2, 3, {1, 2, 3, 4, 5, 6});
+    EXPECT_EQ(mat.unchecked(1, 2), 6);
+    mat.unchecked(0, 1) = 7;
+    EXPECT_EQ(mat(0, 1), 7);
 
-
-
+    const Matrix& cmat = mat;
+    EXPECT_EQ(cmat.unchecked(1, 0), 4);
+    EXPECT_EQ(cmat.data()[1 * 3 + 2], 6);
+    mat.data()[3] = -1;
+    EXPECT_EQ(mat(1, 0), -1);
+}
 
 } // namespace astra
\ No newline at end of file
@@ -0,0 +1,157 @@
+#include "pch.h"
+
+#include <iostream>
+#include "gtest/gtest.h"
+
+#include "Matrix.h"
+#include "MatrixView.h"
+#include "Vector.h"
+#include "VectorView.h"
+#include "Decomposer.h"
+#include "Solver.h"
+#include "Exceptions.h"
+#include "MathUtils.h"
+
+namespace astra {
+
+// Test fixture class for MatrixView
+class MatrixViewTest : public ::testing::Test {
+  protected:
+    Matrix* m;
+
+    void SetUp() override {
+        m = new Matrix(4, 4, {1, 2, 3, 4,
+                              5, 6, 7, 8,
+                              9, 10, 11, 12,
+                              13, 14, 15, 16});
+    }
+
+    void TearDown() override { delete m; }
+};
+
+TEST_F(MatrixViewTest, view_whole_matrix) {
+    MatrixView v(*m);
+    EXPECT_EQ(v.num_row(), 4);
+    EXPECT_EQ(v.num_col(), 4);
+    EXPECT_EQ(v.leading_dim(), 4);
+    EXPECT_EQ(v(2, 3), 12);
+    EXPECT_EQ(v.sum(), m->sum());
+}
+
+TEST_F(MatrixViewTest, view_invalid_construction) {
+    double data[4] = {1, 2, 3, 4};
+    EXPECT_THROW(MatrixView(data, 0, 2, 2),
+                 astra::internals::exceptions::invalid_size);
+    EXPECT_THROW(MatrixView(data, 2, 2, 1),
+                 astra::internals::exceptions::invalid_argument);
+}
+
+TEST_F(MatrixViewTest, block_shares_storage) {
+    MatrixView b = m->block(1, 1, 2, 3);
+    EXPECT_EQ(b.num_row(), 2);
+    EXPECT_EQ(b.num_col(), 3);
+    EXPECT_EQ(b.leading_dim(), 4);
+    EXPECT_EQ(b(0, 0), 6);
+    EXPECT_EQ(b(1, 2), 12);
+
+    (*m)(2, 3) = 100;
+    EXPECT_EQ(b(1, 2), 100);
+}
+
+TEST_F(MatrixViewTest, block_out_of_range) {
+    EXPECT_THROW(m->block(0, 0, 4, 1),
+                 astra::internals::exceptions::index_out_of_range);
+    EXPECT_THROW(m->block(2, 0, 1, 1),
+                 astra::internals::exceptions::invalid_argument);
+#if ASTRA_BOUNDS_CHECK
+    MatrixView b = m->block(1, 1, 2, 2);
+    EXPECT_THROW(b(2, 0), astra::internals::exceptions::index_out_of_range);
+#endif
+}
+
+TEST_F(MatrixViewTest, nested_block) {
+    MatrixView b = m->block(1, 1, 3, 3).block(1, 0, 2, 1);
+    Matrix expected(2, 2, {10, 11,
+                           14, 15});
+    EXPECT_EQ(Matrix(b), expected);
+    EXPECT_EQ(m->submatrix(2, 1, 3, 2), expected);
+}
+
+TEST_F(MatrixViewTest, row_and_col_views) {
+    VectorView r = m->row_view(2);
+    VectorView c = m->col_view(1);
+    EXPECT_EQ(r.get_stride(), 1);
+    EXPECT_EQ(c.get_stride(), 4);
+    EXPECT_EQ(Vector(r), Vector({9, 10, 11, 12}));
+    EXPECT_EQ(Vector(c), Vector({2, 6, 10, 14}));
+    EXPECT_EQ(r * c, 9 * 2 + 10 * 6 + 11 * 10 + 12 * 14);
+    EXPECT_EQ(m->get_col(1), Vector(c));
+}
+
+TEST_F(MatrixViewTest, block_trace_and_triangular) {
+    Matrix a(3, 3, {1, 2, 3,
+                    0, 4, 5,
+                    0, 0, 6});
+    EXPECT_EQ(a.block(1, 1, 2, 2).trace(), 10);
+    EXPECT_TRUE(a.block(1, 1, 2, 2).is_upper_triangular());
+    EXPECT_FALSE(a.block(0, 0, 1, 1).is_lower_triangular());
+    EXPECT_THROW(a.block(0, 0, 1, 2).trace(),
+                 astra::internals::exceptions::non_square_matrix);
+}
+
+TEST_F(MatrixViewTest, block_rank) {
+    EXPECT_EQ(m->block(0, 0, 1, 1).rank(), 2);
+    EXPECT_EQ(m->block(0, 0, 3, 3).rank(), m->rank());
+}
+
+TEST_F(MatrixViewTest, block_product) {
+    Matrix product = m->block(0, 0, 1, 2) * m->block(1, 1, 3, 2);
+    Matrix expected = m->submatrix(0, 0, 1, 2) * m->submatrix(1, 1, 3, 2);
+    EXPECT_EQ(product, expected);
+    EXPECT_THROW(m->block(0, 0, 1, 2) * m->block(0, 0, 1, 1),
+                 astra::internals::exceptions::
+                     matrix_multiplication_size_mismatch);
+}
+
+TEST_F(MatrixViewTest, large_block_product) {
+    int n = 150;
+    Matrix big(n, n);
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            big(i, j) = (i * 7 + j * 3) % 11 - 5.0;
+        }
+    }
+    Matrix product = big.block(3, 5, 102, 124) * big.block(10, 0, 129, 89);
+    Matrix expected =
+        big.submatrix(3, 5, 102, 124) * big.submatrix(10, 0, 129, 89);
+    EXPECT_EQ(product, expected);
+}
+
+TEST_F(MatrixViewTest, block_vector_product) {
+    Vector x{1, -1, 2, 0};
+    Vector result = m->block(1, 0, 2, 3) * VectorView(x);
+    EXPECT_EQ(result, Vector({5 - 6 + 14, 9 - 10 + 22}));
+    EXPECT_THROW(m->block(0, 0, 2, 2) * m->col_view(3),
+                 astra::internals::exceptions::matrix_size_mismatch);
+
+    Vector strided =
+        m->block(0, 0, 2, 2) * m->col_view(3).segment(0, 2);
+    EXPECT_EQ(strided, m->submatrix(0, 0, 2, 2) * Vector({4, 8, 12}));
+}
+
+TEST_F(MatrixViewTest, solve_on_block) {
+    Matrix aug(3, 4, {2, 1, -1, 8,
+                      -3, -1, 2, -11,
+                      -2, 1, 2, -3});
+    Vector x = Solver::solve(aug.block(0, 0, 2, 2), aug.col_view(3));
+    EXPECT_TRUE(internals::mathutils::nearly_equal(x[0], 2.0));
+    EXPECT_TRUE(internals::mathutils::nearly_equal(x[1], 3.0));
+    EXPECT_TRUE(internals::mathutils::nearly_equal(x[2], -1.0));
+}
+
+TEST_F(MatrixViewTest, palu_on_block) {
+    auto plu = Decomposer::palu(m->block(0, 0, 1, 1));
+    EXPECT_EQ(plu.P * Matrix(m->block(0, 0, 1, 1)), plu.L * plu.U);
+}
+
+} // namespace astra
@@ -0,0 +1,98 @@
+#include "pch.h"
+
+#include <iostream>
+#include "gtest/gtest.h"
+
+#include "Matrix.h"
+#include "Parallel.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for the thread pool settings
+class ParallelTest : public ::testing::Test {
+  protected:
+    int saved_threads = 1;
+
+    void SetUp() override { saved_threads = get_num_threads(); }
+
+    void TearDown() override { set_num_threads(saved_threads); }
+
+    static Matrix make_matrix(int r, int c, int seed) {
+        Matrix mat(r, c);
+        for (int i = 0; i < r; ++i) {
+            for (int j = 0; j < c; ++j) {
+                mat(i, j) = (i * seed + j * 3 + seed) % 17 - 8;
+            }
+        }
+        return mat;
+    }
+};
+
+TEST_F(ParallelTest, default_thread_count_positive) {
+    EXPECT_GE(get_num_threads(), 1);
+}
+
+TEST_F(ParallelTest, set_num_threads) {
+    set_num_threads(3);
+    EXPECT_EQ(get_num_threads(), 3);
+
+    set_num_threads(1);
+    EXPECT_EQ(get_num_threads(), 1);
+}
+
+TEST_F(ParallelTest, set_num_threads_invalid) {
+    EXPECT_THROW(set_num_threads(0),
+                 astra::internals::exceptions::invalid_argument);
+    EXPECT_THROW(set_num_threads(-2),
+                 astra::internals::exceptions::invalid_argument);
+}
+
+TEST_F(ParallelTest, multiplication_same_for_any_thread_count) {
+    Matrix matA = make_matrix(300, 200, 5);
+    Matrix matB = make_matrix(200, 150, 7);
+
+    set_num_threads(1);
+    Matrix serial = matA * matB;
+
+    set_num_threads(4);
+    Matrix parallel = matA * matB;
+
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST_F(ParallelTest, addition_subtraction_same_for_any_thread_count) {
+    Matrix matA = make_matrix(400, 300, 3);
+    Matrix matB = make_matrix(400, 300, 11);
+
+    set_num_threads(1);
+    Matrix sum_serial = matA + matB;
+    Matrix diff_serial = matA - matB;
+
+    set_num_threads(4);
+    Matrix sum_parallel = matA + matB;
+    Matrix diff_parallel = matA - matB;
+
+    EXPECT_EQ(sum_serial, sum_parallel);
+    EXPECT_EQ(diff_serial, diff_parallel);
+    EXPECT_EQ(sum_parallel(399, 299), matA(399, 299) + matB(399, 299));
+}
+
+TEST_F(ParallelTest, matrix_vector_same_for_any_thread_count) {
+    Matrix mat = make_matrix(2000, 90, 13);
+    Vector vec(90);
+    for (int i = 0; i < 90; ++i) {
+        vec[i] = i % 5 - 2;
+    }
+
+    set_num_threads(1);
+    Vector serial = mat * vec;
+
+    set_num_threads(4);
+    Vector parallel = mat * vec;
+
+    EXPECT_EQ(serial, parallel);
+}
+
+} // namespace astra
@@ -0,0 +1,196 @@
+#include "pch.h"
+
+#include <cmath>
+#include "gtest/gtest.h"
+
+#include "Preconditioner.h"
+#include "Matrix.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for the preconditioners
+class PreconditionerTest : public ::testing::Test {
+  protected:
+    void SetUp() override {}
+
+    void TearDown() override {}
+
+    // the 5-point Laplacian on a k x k grid, with a varying diagonal shift
+    // so that Jacobi scaling is not trivial
+    static Matrix laplacian(int k) {
+        int n = k * k;
+        Matrix mat(n, n);
+        for (int i = 0; i < n; i++) {
+            int row = i / k;
+            int col = i % k;
+            mat(i, i) = 4 + (i % 5) * 0.5;
+            if (col > 0) {
+                mat(i, i - 1) = -1;
+            }
+            if (col + 1 < k) {
+                mat(i, i + 1) = -1;
+            }
+            if (row > 0) {
+                mat(i, i - k) = -1;
+            }
+            if (row + 1 < k) {
+                mat(i, i + k) = -1;
+            }
+        }
+        return mat;
+    }
+
+    static Vector rhs(int n) {
+        Vector b(n);
+        for (int i = 0; i < n; i++) {
+            b[i] = std::sin(0.1 * i) + 0.5;
+        }
+        return b;
+    }
+};
+
+TEST_F(PreconditionerTest, exact_for_tridiagonal_matrix) {
+
+    // without fill, ILU(0) and IC(0) of a tridiagonal matrix are exact and
+    // so is block Jacobi with a single block
+    int n = 12;
+    Matrix mat(n, n);
+    for (int i = 0; i < n; i++) {
+        mat(i, i) = 3 + i * 0.1;
+        if (i > 0) {
+            mat(i, i - 1) = -1;
+            mat(i - 1, i) = -1;
+        }
+    }
+    Vector b = rhs(n);
+    Vector expected = Solver::solve(mat, b);
+
+    ILU0Preconditioner ilu(mat);
+    IC0Preconditioner ic(mat);
+    BlockJacobiPreconditioner block(mat, n);
+    for (const Preconditioner* m :
+         {static_cast<const Preconditioner*>(&ilu),
+          static_cast<const Preconditioner*>(&ic),
+          static_cast<const Preconditioner*>(&block)}) {
+        EXPECT_EQ(m->size(), n);
+        Vector z(n);
+        m->apply(b, z);
+        for (int i = 0; i < n; i++) {
+            EXPECT_NEAR(z[i], expected[i], 1e-12);
+        }
+    }
+
+    JacobiPreconditioner jacobi(mat);
+    Vector z(n);
+    jacobi.apply(b, z);
+    for (int i = 0; i < n; i++) {
+        EXPECT_DOUBLE_EQ(z[i], b[i] / mat(i, i));
+    }
+}
+
+TEST_F(PreconditionerTest, preconditioned_cg) {
+    Matrix mat = laplacian(20);
+    int n = mat.num_row();
+    Vector b = rhs(n);
+    Vector expected = Solver::solve(mat, b);
+
+    auto plain = Solver::cg(mat, b, 1e-10);
+    ASSERT_TRUE(plain.converged);
+
+    JacobiPreconditioner jacobi(mat);
+    BlockJacobiPreconditioner block(mat, 20);
+    SSORPreconditioner ssor(mat, 1.2);
+    IC0Preconditioner ic(mat);
+
+    // one setup serves several solves
+    for (int rep = 0; rep < 2; rep++) {
+        for (const Preconditioner* m :
+             {static_cast<const Preconditioner*>(&jacobi),
+              static_cast<const Preconditioner*>(&block),
+              static_cast<const Preconditioner*>(&ssor),
+              static_cast<const Preconditioner*>(&ic)}) {
+            auto res = Solver::cg(mat, b, *m, 1e-10);
+            EXPECT_TRUE(res.converged);
+            EXPECT_LE(res.iterations, plain.iterations);
+            EXPECT_LE(res.residuals.back(), 1e-10);
+            for (int i = 0; i < n; i++) {
+                EXPECT_NEAR(res.x[i], expected[i], 1e-8);
+            }
+        }
+    }
+    EXPECT_LT(Solver::cg(mat, b, ic, 1e-10).iterations,
+              plain.iterations / 2);
+    EXPECT_LT(Solver::cg(mat, b, ssor, 1e-10).iterations,
+              plain.iterations / 2);
+}
+
+TEST_F(PreconditionerTest, preconditioned_gmres_and_bicgstab) {
+
+    // the Laplacian with an upwinded convection term
+    Matrix mat = laplacian(16);
+    int n = mat.num_row();
+    for (int i = 1; i < n; i++) {
+        if (mat(i, i - 1) != 0) {
+            mat(i, i - 1) -= 0.8;
+        }
+    }
+    Vector b = rhs(n);
+    Vector expected = Solver::solve(mat, b);
+    ILU0Preconditioner ilu(mat);
+
+    auto plain = Solver::gmres(mat, b, 20, 1e-10);
+    auto pre = Solver::gmres(mat, b, ilu, 20, 1e-10);
+    auto plain_stab = Solver::bicgstab(mat, b, 1e-10);
+    auto pre_stab = Solver::bicgstab(mat, b, ilu, 1e-10);
+    EXPECT_LT(pre.iterations, plain.iterations);
+    EXPECT_LT(pre_stab.iterations, plain_stab.iterations);
+    for (const auto* res : {&plain, &pre, &plain_stab, &pre_stab}) {
+        EXPECT_TRUE(res->converged);
+        for (int i = 0; i < n; i++) {
+            EXPECT_NEAR(res->x[i], expected[i], 1e-8);
+        }
+    }
+
+    // an operator together with a preconditioner built from its matrix
+    Solver::LinearOperator op = [&mat](const Vector& x, Vector& y) {
+        y = mat * x;
+    };
+    auto res_op = Solver::gmres(op, b, ilu, 20, 1e-10);
+    EXPECT_TRUE(res_op.converged);
+    EXPECT_EQ(res_op.iterations, pre.iterations);
+}
+
+TEST_F(PreconditionerTest, errors) {
+    Matrix mat(3, 3, {2, 1, 0,
+                      3, 0, 1,
+                      0, 1, 2});
+
+    EXPECT_THROW(JacobiPreconditioner(Matrix(2, 3)),
+                 internals::exceptions::non_square_matrix);
+    EXPECT_THROW(JacobiPreconditioner{mat},
+                 internals::exceptions::singular_matrix);
+    EXPECT_THROW(SSORPreconditioner{mat},
+                 internals::exceptions::singular_matrix);
+    EXPECT_THROW(BlockJacobiPreconditioner(mat, 0),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(IC0Preconditioner{mat},
+                 internals::exceptions::non_symmetric_matrix);
+    EXPECT_THROW(IC0Preconditioner(Matrix(2, 2, {1, 2, 2, 1})),
+                 internals::exceptions::not_positive_definite);
+
+    // the zero pivot only appears after the first row is eliminated
+    EXPECT_THROW(ILU0Preconditioner(Matrix(2, 2, {1, 2, 2, 4})),
+                 internals::exceptions::singular_matrix);
+
+    Matrix spd(2, 2, {2, 1, 1, 2});
+    EXPECT_THROW(SSORPreconditioner(spd, 2.0),
+                 internals::exceptions::invalid_argument);
+    JacobiPreconditioner jacobi(spd);
+    EXPECT_THROW(Solver::cg(Matrix(3, 3), Vector(3), jacobi),
+                 internals::exceptions::variable_and_value_number_mismatch);
+}
+
+} // namespace astra
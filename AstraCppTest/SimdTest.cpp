@@ -0,0 +1,248 @@
+#include "pch.h"
+
+#include <iostream>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "Matrix.h"
+#include "Vector.h"
+#include "Simd.h"
+#include "Gemm.h"
+#include "MathUtils.h"
+
+namespace astra {
+
+using internals::simd::Isa;
+
+// Test fixture class for the SIMD kernels, runs each check on every
+// instruction set the machine supports
+class SimdTest : public ::testing::Test {
+  protected:
+    Isa saved_isa = Isa::scalar;
+    std::vector<double> a;
+    std::vector<double> b;
+
+    void SetUp() override {
+        saved_isa = internals::simd::active_isa();
+        // sizes up to 67 cover the unrolled body and every tail length
+        for (int i = 0; i < 67; ++i) {
+            a.push_back(((i * 37) % 23) - 11.5);
+            b.push_back(((i * 11) % 7) + 0.25);
+        }
+    }
+
+    void TearDown() override { internals::simd::set_isa(saved_isa); }
+
+    std::vector<Isa> supported() const {
+        std::vector<Isa> isas;
+        for (Isa isa : {Isa::scalar, Isa::sse2, Isa::avx2, Isa::avx512}) {
+            if (isa <= internals::simd::detected_isa()) {
+                isas.push_back(isa);
+            }
+        }
+        return isas;
+    }
+};
+
+TEST_F(SimdTest, set_isa_is_clamped) {
+    EXPECT_EQ(internals::simd::set_isa(Isa::avx512),
+              internals::simd::detected_isa());
+    EXPECT_EQ(internals::simd::set_isa(Isa::scalar), Isa::scalar);
+    EXPECT_EQ(internals::simd::active_isa(), Isa::scalar);
+}
+
+TEST_F(SimdTest, reductions_match_reference) {
+    for (Isa isa : supported()) {
+        internals::simd::set_isa(isa);
+        for (int n = 1; n <= 67; ++n) {
+            // odd offsets make the loads unaligned
+            const double* x = a.data() + (67 - n) / 2;
+            double sum = 0.0, sum_sq = 0.0, dot = 0.0;
+            double mn = x[0], mx = x[0];
+            for (int i = 0; i < n; ++i) {
+                sum += x[i];
+                sum_sq += x[i] * x[i];
+                dot += x[i] * b[i];
+                mn = x[i] < mn ? x[i] : mn;
+                mx = x[i] > mx ? x[i] : mx;
+            }
+            EXPECT_TRUE(internals::mathutils::nearly_equal(
+                internals::simd::sum(x, n), sum));
+            EXPECT_TRUE(internals::mathutils::nearly_equal(
+                internals::simd::sum_sq(x, n), sum_sq));
+            EXPECT_TRUE(internals::mathutils::nearly_equal(
+                internals::simd::dot(x, b.data(), n), dot));
+            EXPECT_EQ(internals::simd::min(x, n), mn);
+            EXPECT_EQ(internals::simd::max(x, n), mx);
+        }
+        EXPECT_EQ(internals::simd::sum(a.data(), 0), 0.0);
+    }
+}
+
+TEST_F(SimdTest, prod_matches_reference) {
+    for (Isa isa : supported()) {
+        internals::simd::set_isa(isa);
+        for (int n = 0; n <= 20; ++n) {
+            double prod = 1.0;
+            for (int i = 0; i < n; ++i) {
+                prod *= b[i];
+            }
+            EXPECT_TRUE(internals::mathutils::nearly_equal(
+                internals::simd::prod(b.data(), n), prod));
+        }
+    }
+}
+
+TEST_F(SimdTest, element_wise_match_reference) {
+    for (Isa isa : supported()) {
+        internals::simd::set_isa(isa);
+        int n = 61;
+        std::vector<double> dst(n);
+
+        internals::simd::add(a.data() + 1, b.data(), dst.data(), n);
+        for (int i = 0; i < n; ++i) {
+            EXPECT_EQ(dst[i], a[i + 1] + b[i]);
+        }
+
+        internals::simd::sub(a.data(), b.data(), dst.data(), n);
+        for (int i = 0; i < n; ++i) {
+            EXPECT_EQ(dst[i], a[i] - b[i]);
+        }
+
+        internals::simd::div_scalar(a.data(), 3.0, dst.data(), n);
+        for (int i = 0; i < n; ++i) {
+            EXPECT_EQ(dst[i], a[i] / 3.0);
+        }
+
+        internals::simd::fill(dst.data(), n, 2.5);
+        internals::simd::replace(dst.data() + 3, n - 3, 2.5, -1.0);
+        EXPECT_EQ(dst[2], 2.5);
+        for (int i = 3; i < n; ++i) {
+            EXPECT_EQ(dst[i], -1.0);
+        }
+    }
+}
+
+TEST_F(SimdTest, float_kernels_match_reference) {
+    std::vector<float> x(a.begin(), a.end());
+    std::vector<float> y(b.begin(), b.end());
+    for (Isa isa : supported()) {
+        internals::simd::set_isa(isa);
+        // float registers are twice as wide, 67 still leaves every tail
+        for (int n = 1; n <= 67; ++n) {
+            float sum = 0.0f, dot = 0.0f;
+            float mn = x[0], mx = x[0];
+            for (int i = 0; i < n; ++i) {
+                sum += x[i];
+                dot += x[i] * y[i];
+                mn = x[i] < mn ? x[i] : mn;
+                mx = x[i] > mx ? x[i] : mx;
+            }
+            EXPECT_NEAR(internals::simd::sum(x.data(), n), sum, 1e-3);
+            EXPECT_NEAR(internals::simd::dot(x.data(), y.data(), n), dot,
+                        1e-2);
+            EXPECT_EQ(internals::simd::min(x.data(), n), mn);
+            EXPECT_EQ(internals::simd::max(x.data(), n), mx);
+        }
+
+        std::vector<float> dst(61);
+        internals::simd::mul(x.data() + 1, y.data(), dst.data(), 61);
+        for (int i = 0; i < 61; ++i) {
+            EXPECT_EQ(dst[i], x[i + 1] * y[i]);
+        }
+        internals::simd::fill(dst.data(), 61, 1.5f);
+        internals::simd::replace(dst.data() + 5, 56, 1.5f, 4.0f);
+        EXPECT_EQ(dst[4], 1.5f);
+        EXPECT_EQ(dst[60], 4.0f);
+    }
+}
+
+TEST_F(SimdTest, matrix_reductions_on_every_isa) {
+    Matrix m(5, 7);
+    for (int i = 0; i < 5; ++i) {
+        for (int j = 0; j < 7; ++j) {
+            m(i, j) = (i * 7 + j) % 9 - 4.0;
+        }
+    }
+    m(3, 5) = -20;
+    m(4, 6) = 30;
+
+    for (Isa isa : supported()) {
+        internals::simd::set_isa(isa);
+        EXPECT_EQ(m.min(), -20);
+        EXPECT_EQ(m.max(), 30);
+        EXPECT_EQ(m.sum(), m.get_row(0).sum() + m.get_row(1).sum() +
+                               m.get_row(2).sum() + m.get_row(3).sum() +
+                               m.get_row(4).sum());
+
+        Matrix r = m;
+        r.replace(-4, 100);
+        EXPECT_EQ(r(0, 0), 100);
+        EXPECT_EQ(r.max(), 100);
+
+        Matrix s = m + m - m * 2.0;
+        EXPECT_TRUE(s.is_zero());
+    }
+}
+
+TEST_F(SimdTest, vector_reductions_on_every_isa) {
+    Vector v{3, -7, 2, 9, -1, 4, 0, 5, -8, 6, 1};
+    for (Isa isa : supported()) {
+        internals::simd::set_isa(isa);
+        EXPECT_EQ(v.min(), -8);
+        EXPECT_EQ(v.max(), 9);
+        EXPECT_EQ(v.sum(), 14);
+        EXPECT_EQ(v * v, 286);
+        EXPECT_EQ(Vector(v + v), Vector(v * 2.0));
+    }
+}
+
+TEST_F(SimdTest, gemm_kernels_on_every_isa) {
+    // m and n leave edge tiles for every tile size, k spans two KC blocks
+    const int m = 37;
+    const int n = 53;
+    const int k = 300;
+    std::vector<double> A(m * k);
+    std::vector<double> B(k * n);
+    std::vector<double> C0(m * n);
+    for (int i = 0; i < m * k; ++i) {
+        A[i] = (i * 7) % 11 - 5.0;
+    }
+    for (int i = 0; i < k * n; ++i) {
+        B[i] = (i * 5) % 9 - 4.0;
+    }
+    for (int i = 0; i < m * n; ++i) {
+        C0[i] = i % 13;
+    }
+
+    // small integers, so every order of the sums is exact
+    std::vector<double> expected(m * n);
+    for (int i = 0; i < m; ++i) {
+        for (int j = 0; j < n; ++j) {
+            double total = 0;
+            for (int p = 0; p < k; ++p) {
+                total += A[i * k + p] * B[p * n + j];
+            }
+            expected[i * n + j] = 2 * total - C0[i * n + j];
+        }
+    }
+
+    std::vector<float> Af(A.begin(), A.end());
+    std::vector<float> Bf(B.begin(), B.end());
+
+    for (Isa isa : supported()) {
+        internals::simd::set_isa(isa);
+
+        std::vector<double> C = C0;
+        internals::gemm::gemm(m, n, k, 2.0, A.data(), k, B.data(), n, -1.0,
+                              C.data(), n);
+        EXPECT_EQ(C, expected);
+
+        std::vector<float> Cf(C0.begin(), C0.end());
+        internals::gemm::gemm(m, n, k, 2.0f, Af.data(), k, Bf.data(), n,
+                              -1.0f, Cf.data(), n);
+        EXPECT_EQ(std::vector<double>(Cf.begin(), Cf.end()), expected);
+    }
+}
+
+} // namespace astra
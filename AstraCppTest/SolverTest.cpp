@@ -1,5 +1,6 @@
 #include "pch.h"
 
+#include <cmath>
 #include <iostream>
 #include "gtest/gtest.h"
 
@@ -265,4 +266,286 @@ TEST_F(SolverTest, eqn_solve_test_fractional) {
     EXPECT_EQ(actual_ans, expected_ans);
 }
 
-} // namespace astra
\ No newline at end of file
+TEST_F(SolverTest, eqn_solve_symmetric_systems) {
+
+    // positive definite, solved by Cholesky
+    Matrix spd(3, 3, {4, 1, 2,
+                      1, 5, 3,
+                      2, 3, 6});
+    Vector b{7, 9, 11};
+    Vector x = Solver::solve(spd, b);
+    EXPECT_EQ(spd * x, b);
+
+    // indefinite with a positive diagonal, Cholesky fails and LDL^T is used
+    Matrix indefinite(3, 3, {1, 2, 0,
+                             2, 1, 3,
+                             0, 3, 1});
+    x = Solver::solve(indefinite, b);
+    EXPECT_EQ(indefinite * x, b);
+
+    // zero diagonal, needs a 2x2 pivot
+    Matrix saddle(3, 3, {0, 1, 2,
+                         1, 0, 3,
+                         2, 3, 0});
+    x = Solver::solve(saddle, b);
+    EXPECT_EQ(saddle * x, b);
+
+    Matrix singular(2, 2, {1, 1,
+                           1, 1});
+    EXPECT_THROW(Solver::solve(singular, Vector{1, 2}),
+                 internals::exceptions::no_solution);
+}
+
+TEST_F(SolverTest, eqn_solve_nearly_symmetric_and_singular_psd) {
+    // symmetric within 1e-6 but not exactly, Cholesky would read only the
+    // lower triangle and miss the 5e-7 entries
+    Matrix skew(2, 2, {2, 5e-7,
+                       -5e-7, 2});
+    Vector b{1, 1};
+    Vector x = Solver::solve(skew, b);
+    EXPECT_EQ(skew * x, b);
+    EXPECT_NEAR(x[0] - x[1], -2.5e-7, 1e-12);
+
+    // positive semidefinite, the second Cholesky pivot is zero up to
+    // rounding and the system is classified like the LU path does
+    Matrix psd(2, 2, {0.1, 0.3,
+                      0.3, 0.9});
+    EXPECT_THROW(Solver::solve(psd, Vector{1, 2}),
+                 internals::exceptions::no_solution);
+    EXPECT_THROW(Solver::solve(psd, Vector{1, 3}),
+                 internals::exceptions::infinite_solutions);
+
+    Matrix nearly_singular(2, 2, {1, 1,
+                                  1, 1.0000001});
+    EXPECT_THROW(Solver::solve(nearly_singular, Vector{1, 2}),
+                 internals::exceptions::no_solution);
+}
+
+TEST_F(SolverTest, least_squares_overdetermined) {
+
+    // fit y = 1 + 2t to points off the line, the normal equations give
+    // the same coefficients
+    Matrix A(4, 2, {1, 0,
+                    1, 1,
+                    1, 2,
+                    1, 3});
+    Vector b{1.5, 2.5, 5.5, 6.5};
+    Vector x = Solver::least_squares(A, b);
+    EXPECT_NEAR(x[0], 1.3, 1e-12);
+    EXPECT_NEAR(x[1], 1.8, 1e-12);
+
+    // a consistent square system has the exact solution
+    Matrix sq(2, 2, {2, 1,
+                     1, 3});
+    EXPECT_EQ(Solver::least_squares(sq, Vector{3, 5}), Vector({0.8, 1.4}));
+
+    EXPECT_THROW(Solver::least_squares(A, Vector{1, 2}),
+                 internals::exceptions::variable_and_value_number_mismatch);
+    Matrix rank_one(3, 2, {1, 2,
+                           2, 4,
+                           3, 6});
+    EXPECT_THROW(Solver::least_squares(rank_one, Vector{1, 2, 3}),
+                 internals::exceptions::rank_deficient_matrix);
+}
+
+TEST_F(SolverTest, least_squares_rank_test_is_scale_invariant) {
+    // well conditioned, only the entries are small
+    Matrix small(3, 2, {1e-7, 0,
+                        0, 1e-7,
+                        1e-7, 1e-7});
+    Vector x = Solver::least_squares(small, Vector{1e-7, 2e-7, 3e-7});
+    EXPECT_NEAR(x[0], 1, 1e-9);
+    EXPECT_NEAR(x[1], 2, 1e-9);
+
+    Matrix wide(1, 2, {1e-7, 1e-7});
+    x = Solver::least_squares(wide, Vector{2e-7});
+    EXPECT_NEAR(x[0], 1, 1e-9);
+    EXPECT_NEAR(x[1], 1, 1e-9);
+
+    // rank one, even though R(1, 1) is far from zero in absolute terms
+    Matrix large(3, 2, {1e10, 2e10,
+                        2e10, 4e10,
+                        3e10, 6e10});
+    EXPECT_THROW(Solver::least_squares(large, Vector{1, 2, 3}),
+                 internals::exceptions::rank_deficient_matrix);
+}
+
+TEST_F(SolverTest, least_squares_underdetermined) {
+
+    // x + y + z = 3 has the minimum norm solution (1, 1, 1)
+    Matrix A(1, 3, {1, 1, 1});
+    Vector x = Solver::least_squares(A, Vector{3});
+    EXPECT_EQ(x, Vector({1, 1, 1}));
+
+    Matrix B(2, 3, {1, 0, 1,
+                    0, 1, 1});
+    Vector b{2, 3};
+    x = Solver::least_squares(B, b);
+    EXPECT_EQ(B * x, b);
+
+    // the minimum norm solution is in the row space, x = B^T y
+    double y0 = x[0];
+    double y1 = x[1];
+    EXPECT_NEAR(x[2], y0 + y1, 1e-12);
+}
+
+TEST_F(SolverTest, pinv) {
+
+    // a full column rank matrix has the least-squares solution as A^+ b
+    Matrix A(4, 2, {1, 0,
+                    1, 1,
+                    1, 2,
+                    1, 3});
+    Matrix P = Solver::pinv(A);
+    EXPECT_EQ(P.num_row(), 2);
+    EXPECT_EQ(P.num_col(), 4);
+    Vector x = P * Vector{1.5, 2.5, 5.5, 6.5};
+    EXPECT_NEAR(x[0], 1.3, 1e-12);
+    EXPECT_NEAR(x[1], 1.8, 1e-12);
+
+    // the pseudo-inverse of the rank one u v^T is v u^T / (|u|^2 |v|^2)
+    Matrix rank_one(3, 2, {1, 2,
+                           2, 4,
+                           3, 6});
+    P = Solver::pinv(rank_one);
+    for (int i = 0; i < 2; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(P(i, j), (i + 1) * (j + 1) / 70.0, 1e-14);
+        }
+    }
+
+    // a wide rank one matrix with a zero column, A A^+ A = A
+    Matrix wide(2, 3, {1, 0, 1,
+                       2, 0, 2});
+    P = Solver::pinv(wide);
+    Matrix expected(3, 2, {0.1, 0.2,
+                           0, 0,
+                           0.1, 0.2});
+    Matrix apa = wide * P * wide;
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 2; j++) {
+            EXPECT_NEAR(P(i, j), expected(i, j), 1e-14);
+            EXPECT_NEAR(apa(j, i), wide(j, i), 1e-14);
+        }
+    }
+
+    EXPECT_EQ(Solver::pinv(Matrix(2, 3)), Matrix(3, 2));
+}
+
+TEST_F(SolverTest, cg_matrix_and_operator) {
+
+    // the 1D Laplacian, symmetric positive definite
+    int n = 60;
+    Matrix mat(n, n);
+    Vector b(n);
+    for (int i = 0; i < n; i++) {
+        mat(i, i) = 2;
+        if (i > 0) {
+            mat(i, i - 1) = -1;
+            mat(i - 1, i) = -1;
+        }
+        b[i] = std::sin(0.3 * i) + 1;
+    }
+
+    auto res = Solver::cg(mat, b, 1e-12);
+    EXPECT_TRUE(res.converged);
+    EXPECT_LE(res.iterations, n);
+    EXPECT_EQ(res.residuals.size(), static_cast<size_t>(res.iterations) + 1);
+    EXPECT_DOUBLE_EQ(res.residuals[0], 1.0);
+    EXPECT_LE(res.residuals.back(), 1e-12);
+    Vector expected = Solver::solve(mat, b);
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(res.x[i], expected[i], 1e-8);
+    }
+
+    // the same matrix without storing it
+    Solver::LinearOperator op = [n](const Vector& x, Vector& y) {
+        for (int i = 0; i < n; i++) {
+            double value = 2 * x[i];
+            if (i > 0) {
+                value -= x[i - 1];
+            }
+            if (i + 1 < n) {
+                value -= x[i + 1];
+            }
+            y[i] = value;
+        }
+    };
+    auto res_op = Solver::cg(op, b, 1e-12);
+    EXPECT_TRUE(res_op.converged);
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(res_op.x[i], expected[i], 1e-8);
+    }
+
+    auto capped = Solver::cg(mat, b, 1e-12, 3);
+    EXPECT_FALSE(capped.converged);
+    EXPECT_EQ(capped.iterations, 3);
+
+    auto zero = Solver::cg(mat, Vector(n));
+    EXPECT_TRUE(zero.converged);
+    EXPECT_EQ(zero.iterations, 0);
+    EXPECT_EQ(zero.x, Vector(n));
+
+    EXPECT_THROW(Solver::cg(Matrix(2, 3), Vector(2)),
+                 internals::exceptions::non_square_matrix);
+    EXPECT_THROW(Solver::cg(mat, Vector(3)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+    EXPECT_THROW(Solver::cg(mat, b, -1.0),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(Solver::cg(mat, b, 1e-10, -1),
+                 internals::exceptions::invalid_argument);
+}
+
+TEST_F(SolverTest, gmres_and_bicgstab_nonsymmetric) {
+
+    // upwinded convection-diffusion, diagonally dominant but not symmetric
+    int n = 80;
+    Matrix mat(n, n);
+    Vector b(n);
+    for (int i = 0; i < n; i++) {
+        mat(i, i) = 3;
+        if (i > 0) {
+            mat(i, i - 1) = -1.8;
+        }
+        if (i + 1 < n) {
+            mat(i, i + 1) = -0.6;
+        }
+        if (i + 7 < n) {
+            mat(i, i + 7) = 0.3;
+        }
+        b[i] = std::cos(0.2 * i);
+    }
+    Vector expected = Solver::solve(mat, b);
+
+    auto full = Solver::gmres(mat, b, n, 1e-12);
+    auto restarted = Solver::gmres(mat, b, 10, 1e-12);
+    auto stab = Solver::bicgstab(mat, b, 1e-12);
+    for (const auto* res : {&full, &restarted, &stab}) {
+        EXPECT_TRUE(res->converged);
+        EXPECT_EQ(res->residuals.size(),
+                  static_cast<size_t>(res->iterations) + 1);
+        for (int i = 0; i < n; i++) {
+            EXPECT_NEAR(res->x[i], expected[i], 1e-9);
+        }
+    }
+
+    // the residual of GMRES never grows, restarting can only slow it
+    for (size_t k = 1; k < full.residuals.size(); k++) {
+        EXPECT_LE(full.residuals[k], full.residuals[k - 1] * (1 + 1e-12));
+    }
+    EXPECT_LE(full.iterations, restarted.iterations);
+
+    auto capped = Solver::gmres(mat, b, 4, 1e-12, 6);
+    EXPECT_FALSE(capped.converged);
+    EXPECT_EQ(capped.iterations, 6);
+    EXPECT_LT(capped.residuals.back(), 1.0);
+
+    EXPECT_THROW(Solver::gmres(mat, b, 0),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(Solver::bicgstab(mat, b, 1e-10, -1),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(Solver::bicgstab(Matrix(3, 2), Vector(3)),
+                 internals::exceptions::non_square_matrix);
+}
+
+} // namespace astra
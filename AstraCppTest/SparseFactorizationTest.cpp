@@ -0,0 +1,187 @@
+#include "pch.h"
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "SparseFactorization.h"
+#include "SparseMatrix.h"
+#include "Matrix.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for SparseCholesky and SparseLU
+class SparseFactorizationTest : public ::testing::Test {
+  protected:
+    SparseMatrix* laplacian;
+    Vector* b;
+
+    void SetUp() override {
+        // the 5-point Laplacian on a 20 x 20 grid
+        int k = 20;
+        int n = k * k;
+        std::vector<int> rows;
+        std::vector<int> cols;
+        std::vector<double> vals;
+        auto add = [&](int i, int j, double value) {
+            rows.push_back(i);
+            cols.push_back(j);
+            vals.push_back(value);
+        };
+        for (int i = 0; i < n; i++) {
+            add(i, i, 4);
+            if (i % k > 0) {
+                add(i, i - 1, -1);
+            }
+            if (i % k + 1 < k) {
+                add(i, i + 1, -1);
+            }
+            if (i >= k) {
+                add(i, i - k, -1);
+            }
+            if (i + k < n) {
+                add(i, i + k, -1);
+            }
+        }
+        laplacian = new SparseMatrix(n, n, rows, cols, vals);
+        b = new Vector(n);
+        for (int i = 0; i < n; i++) {
+            (*b)[i] = (i % 7) - 3.0;
+        }
+    }
+
+    void TearDown() override {
+        delete laplacian;
+        delete b;
+    }
+
+    static void expect_solves(const SparseMatrix& A, const Vector& x,
+                              const Vector& rhs) {
+        Vector r = A * x;
+        for (int i = 0; i < rhs.get_size(); i++) {
+            EXPECT_NEAR(r[i], rhs[i], 1e-9);
+        }
+    }
+};
+
+TEST_F(SparseFactorizationTest, cholesky_solve_and_refactor) {
+    SparseCholesky chol(*laplacian);
+    EXPECT_EQ(chol.size(), 400);
+    expect_solves(*laplacian, chol.solve(*b), *b);
+
+    Vector dense = Solver::solve(laplacian->to_dense(), *b);
+    Vector sparse = Solver::solve(*laplacian, *b);
+    for (int i = 0; i < 400; i++) {
+        EXPECT_NEAR(sparse[i], dense[i], 1e-10);
+    }
+
+    // the banded natural order fills the whole band, about n * k entries
+    EXPECT_LT(chol.factor_nnz(), 400 * 20 / 2);
+
+    // same pattern, shifted values
+    std::vector<double> vals = laplacian->get_values();
+    for (int i = 0; i < 400; i++) {
+        for (int p = laplacian->row_pointers()[i];
+             p < laplacian->row_pointers()[i + 1]; p++) {
+            if (laplacian->column_indices()[p] == i) {
+                vals[p] += 1;
+            }
+        }
+    }
+    SparseMatrix shifted = SparseMatrix::from_csr(
+        400, 400, laplacian->row_pointers(), laplacian->column_indices(),
+        vals);
+    chol.refactor(shifted);
+    expect_solves(shifted, chol.solve(*b), *b);
+
+    EXPECT_THROW(chol.refactor(SparseMatrix::identity(400)),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(chol.solve(Vector(3)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+    EXPECT_THROW(SparseCholesky(SparseMatrix(2, 2, {0, 1}, {0, 0}, {1, 2})),
+                 internals::exceptions::non_symmetric_matrix);
+    EXPECT_THROW(SparseCholesky(SparseMatrix(2, 2, {0, 0, 1, 1},
+                                             {0, 1, 0, 1}, {1, 2, 2, 1})),
+                 internals::exceptions::not_positive_definite);
+}
+
+TEST_F(SparseFactorizationTest, lu_solve_and_refactor) {
+
+    // a convection term makes the Laplacian nonsymmetric
+    std::vector<double> vals = laplacian->get_values();
+    const std::vector<int>& ptr = laplacian->row_pointers();
+    const std::vector<int>& idx = laplacian->column_indices();
+    for (int i = 0; i < 400; i++) {
+        for (int p = ptr[i]; p < ptr[i + 1]; p++) {
+            if (idx[p] == i + 1) {
+                vals[p] = -1.5;
+            }
+            else if (idx[p] == i - 1) {
+                vals[p] = -0.5;
+            }
+        }
+    }
+    SparseMatrix A = SparseMatrix::from_csr(400, 400, ptr, idx, vals);
+    EXPECT_FALSE(A.is_symmetric());
+
+    SparseLU lu(A);
+    EXPECT_EQ(lu.size(), 400);
+    expect_solves(A, lu.solve(*b), *b);
+    expect_solves(A, Solver::solve(A, *b), *b);
+
+    for (double& v : vals) {
+        v *= 2;
+    }
+    SparseMatrix scaled = SparseMatrix::from_csr(400, 400, ptr, idx, vals);
+    lu.refactor(scaled);
+    expect_solves(scaled, lu.solve(*b), *b);
+
+    EXPECT_THROW(lu.refactor(SparseMatrix::identity(400)),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(SparseLU(SparseMatrix(2, 3)),
+                 internals::exceptions::non_square_matrix);
+}
+
+TEST_F(SparseFactorizationTest, lu_pivoting) {
+
+    // zero diagonal, the rows have to be exchanged
+    SparseMatrix A(4, 4, {0, 0, 1, 1, 2, 3, 3},
+                         {1, 2, 0, 3, 1, 2, 0},
+                         {2, 1, 3, 1, 4, 5, 1});
+    Vector rhs({1, 2, 3, 4});
+    SparseLU lu(A);
+    expect_solves(A, lu.solve(rhs), rhs);
+
+    // values far from the factored ones may need a new pivot order
+    SparseMatrix B(4, 4, {0, 0, 1, 1, 2, 3, 3},
+                         {1, 2, 0, 3, 1, 2, 0},
+                         {2, 1, 1e-14, 1, 4, 5, 1});
+    lu.refactor(B);
+    expect_solves(B, lu.solve(rhs), rhs);
+
+    // an indefinite symmetric matrix goes to LU through Solver::solve
+    SparseMatrix indefinite(2, 2, {0, 0, 1, 1}, {0, 1, 0, 1}, {1, 2, 2, 1});
+    expect_solves(indefinite, Solver::solve(indefinite, Vector({3, 3})),
+                  Vector({3, 3}));
+
+    // so does a nearly symmetric one, Cholesky would miss the upper triangle
+    SparseMatrix nearly(2, 2, {0, 0, 1, 1}, {0, 1, 0, 1}, {2, 5e-7, -5e-7, 2});
+    Vector x = Solver::solve(nearly, Vector({1, 1}));
+    EXPECT_NEAR(x[0] - x[1], -2.5e-7, 1e-12);
+    SparseMatrix scaled(2, 2, {0, 0, 1}, {0, 1, 1}, {1e-7, 1e-8, 1e-7});
+    x = Solver::solve(scaled, Vector({1e-7, 1e-7}));
+    EXPECT_NEAR(x[0], 0.9, 1e-12);
+    EXPECT_NEAR(x[1], 1, 1e-12);
+
+    EXPECT_THROW(SparseLU(SparseMatrix(2, 2, {0, 1}, {0, 0}, {1, 2})),
+                 internals::exceptions::singular_matrix);
+    EXPECT_THROW(Solver::solve(SparseMatrix(2, 2, {0, 1, 0, 1}, {0, 0, 1, 1},
+                                            {1, 2, 2, 4}),
+                               Vector({1, 1})),
+                 internals::exceptions::singular_matrix);
+}
+
+} // namespace astra
@@ -0,0 +1,194 @@
+#include "pch.h"
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "SparseMatrix.h"
+#include "Matrix.h"
+#include "Preconditioner.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for SparseMatrix
+class SparseMatrixTest : public ::testing::Test {
+  protected:
+    SparseMatrix* A;
+
+    void SetUp() override {
+        // unordered triplets with (1, 2) given twice
+        A = new SparseMatrix(3, 4, {2, 0, 1, 1, 0, 1},
+                                   {3, 0, 2, 0, 2, 2},
+                                   {5, 1, 2, 4, -3, 1.5});
+    }
+
+    void TearDown() override { delete A; }
+};
+
+TEST_F(SparseMatrixTest, coo_construction) {
+    EXPECT_EQ(A->num_row(), 3);
+    EXPECT_EQ(A->num_col(), 4);
+    EXPECT_EQ(A->nnz(), 5);
+    EXPECT_EQ(A->row_pointers(), std::vector<int>({0, 2, 4, 5}));
+    EXPECT_EQ(A->column_indices(), std::vector<int>({0, 2, 0, 2, 3}));
+    EXPECT_EQ(A->get_values(), std::vector<double>({1, -3, 4, 3.5, 5}));
+
+    EXPECT_EQ((*A)(1, 2), 3.5);
+    EXPECT_EQ((*A)(1, 1), 0);
+    EXPECT_EQ(A->to_dense(), Matrix(3, 4, {1, 0, -3, 0,
+                                           4, 0, 3.5, 0,
+                                           0, 0, 0, 5}));
+    EXPECT_EQ(A->diagonal(), Vector({1, 0, 0}));
+
+    EXPECT_THROW((*A)(3, 0), internals::exceptions::index_out_of_range);
+    EXPECT_THROW(SparseMatrix(0, 2), internals::exceptions::invalid_size);
+    EXPECT_THROW(SparseMatrix(2, 2, {0, 1}, {0}, {1, 2}),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(SparseMatrix(2, 2, {0, 2}, {0, 1}, {1, 2}),
+                 internals::exceptions::index_out_of_range);
+}
+
+TEST_F(SparseMatrixTest, conversions) {
+    Matrix dense = A->to_dense();
+    EXPECT_EQ(SparseMatrix(dense), *A);
+
+    auto csc = A->to_csc();
+    EXPECT_EQ(csc.col_ptr, std::vector<int>({0, 2, 2, 4, 5}));
+    EXPECT_EQ(csc.row_idx, std::vector<int>({0, 1, 0, 1, 2}));
+    EXPECT_EQ(csc.values, std::vector<double>({1, 4, -3, 3.5, 5}));
+    EXPECT_EQ(SparseMatrix::from_csc(3, 4, csc), *A);
+
+    SparseMatrix t = A->transpose();
+    dense.transpose();
+    EXPECT_EQ(t.to_dense(), dense);
+    EXPECT_EQ(t.transpose(), *A);
+
+    EXPECT_EQ(SparseMatrix::from_csr(3, 4, A->row_pointers(),
+                                     A->column_indices(), A->get_values()),
+              *A);
+    EXPECT_THROW(SparseMatrix::from_csr(2, 2, {0, 2, 2}, {1, 0}, {1, 2}),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(SparseMatrix::from_csr(2, 2, {0, 1}, {0}, {1}),
+                 internals::exceptions::invalid_argument);
+
+    EXPECT_EQ(SparseMatrix::identity(3).to_dense(), Matrix(3, 3, {1, 0, 0,
+                                                                 0, 1, 0,
+                                                                 0, 0, 1}));
+    EXPECT_FALSE(A->is_symmetric());
+    EXPECT_TRUE(SparseMatrix(3, 3, {0, 2, 1}, {2, 0, 1}, {7, 7, 2})
+                    .is_symmetric());
+    EXPECT_FALSE(SparseMatrix(2, 2, {0}, {1}, {1}).is_symmetric());
+
+    // nearly symmetric passes the default tolerance, not the exact test
+    SparseMatrix nearly(2, 2, {0, 0, 1, 1}, {0, 1, 0, 1}, {2, 5e-7, -5e-7, 2});
+    EXPECT_TRUE(nearly.is_symmetric());
+    EXPECT_FALSE(nearly.is_symmetric(0));
+    EXPECT_TRUE(SparseMatrix(2, 2, {0, 1}, {1, 0}, {3, 3}).is_symmetric(0));
+}
+
+TEST_F(SparseMatrixTest, products) {
+    Vector x({1, 2, 3, 4});
+    EXPECT_EQ(*A * x, A->to_dense() * x);
+    Vector y(3);
+    A->multiply(x, y);
+    EXPECT_EQ(y, Vector({-8, 14.5, 20}));
+
+    Matrix B(4, 2, {1, 0,
+                    0, 1,
+                    2, -1,
+                    1, 1});
+    EXPECT_EQ(*A * B, A->to_dense() * B);
+
+    EXPECT_THROW(*A * Vector(3), internals::exceptions::matrix_size_mismatch);
+    EXPECT_THROW(*A * Matrix(3, 2),
+                 internals::exceptions::matrix_multiplication_size_mismatch);
+
+    // enough rows to be split among the threads
+    int n = 60000;
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<double> vals;
+    for (int i = 0; i < n; i++) {
+        for (int k = 0; k < 4; k++) {
+            rows.push_back(i);
+            cols.push_back((i * 7 + k * 1291) % n);
+            vals.push_back(1.0 + ((i + k) % 5));
+        }
+    }
+    SparseMatrix big(n, n, rows, cols, vals);
+    Vector v(n);
+    for (int i = 0; i < n; i++) {
+        v[i] = (i % 13) - 6.0;
+    }
+    Vector w = big * v;
+    std::vector<double> expected(n, 0.0);
+    for (size_t k = 0; k < vals.size(); k++) {
+        expected[rows[k]] += vals[k] * v[cols[k]];
+    }
+    for (int i = 0; i < n; i++) {
+        EXPECT_DOUBLE_EQ(w[i], expected[i]);
+    }
+}
+
+TEST_F(SparseMatrixTest, iterative_solve) {
+
+    // the 5-point Laplacian on a 40 x 40 grid, assembled from triplets
+    int k = 40;
+    int n = k * k;
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<double> vals;
+    auto add = [&](int i, int j, double value) {
+        rows.push_back(i);
+        cols.push_back(j);
+        vals.push_back(value);
+    };
+    for (int i = 0; i < n; i++) {
+        add(i, i, 4);
+        if (i % k > 0) {
+            add(i, i - 1, -1);
+        }
+        if (i % k + 1 < k) {
+            add(i, i + 1, -1);
+        }
+        if (i >= k) {
+            add(i, i - k, -1);
+        }
+        if (i + k < n) {
+            add(i, i + k, -1);
+        }
+    }
+    SparseMatrix lap(n, n, rows, cols, vals);
+    EXPECT_TRUE(lap.is_symmetric());
+    Vector b(n);
+    for (int i = 0; i < n; i++) {
+        b[i] = 1;
+    }
+
+    IC0Preconditioner ic(lap);
+    auto plain = Solver::cg(lap, b, 1e-10);
+    auto pre = Solver::cg(lap, b, ic, 1e-10);
+    EXPECT_TRUE(plain.converged);
+    EXPECT_TRUE(pre.converged);
+    EXPECT_LT(pre.iterations, plain.iterations);
+
+    // the dense preconditioner of the same matrix behaves the same
+    auto dense = Solver::cg(lap, b, IC0Preconditioner(lap.to_dense()), 1e-10);
+    EXPECT_EQ(dense.iterations, pre.iterations);
+
+    Vector r = lap * pre.x;
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(r[i], b[i], 1e-8);
+    }
+
+    ILU0Preconditioner ilu(lap);
+    EXPECT_TRUE(Solver::gmres(lap, b, ilu, 30, 1e-10).converged);
+    EXPECT_TRUE(Solver::bicgstab(lap, b, ilu, 1e-10).converged);
+    EXPECT_THROW(Solver::cg(*A, Vector(3)),
+                 internals::exceptions::non_square_matrix);
+}
+
+} // namespace astra
@@ -0,0 +1,109 @@
+#include "pch.h"
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "SymmetricMatrix.h"
+#include "TriangularMatrix.h"
+#include "Decomposer.h"
+#include "Matrix.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for SymmetricMatrix
+class SymmetricMatrixTest : public ::testing::Test {
+  protected:
+    Matrix* dense;
+    SymmetricMatrix* A;
+
+    void SetUp() override {
+        dense = new Matrix(3, 3, {4, 2, -2,
+                                  2, 10, 2,
+                                  -2, 2, 5});
+        A = new SymmetricMatrix(*dense);
+    }
+
+    void TearDown() override {
+        delete dense;
+        delete A;
+    }
+};
+
+TEST_F(SymmetricMatrixTest, storage) {
+    EXPECT_EQ(A->num_row(), 3);
+    EXPECT_EQ(std::vector<double>(A->data(), A->data() + 6),
+              std::vector<double>({4, 2, 10, -2, 2, 5}));
+    EXPECT_EQ(A->to_dense(), *dense);
+
+    SymmetricMatrix B(3);
+    B(0, 2) = 1.5;
+    const SymmetricMatrix& C = B;
+    EXPECT_EQ(C(2, 0), 1.5);
+    EXPECT_NE(B, *A);
+
+    Vector x({1, -1, 3});
+    EXPECT_EQ(*A * x, *dense * x);
+
+    EXPECT_THROW(SymmetricMatrix(Matrix(2, 2, {1, 2,
+                                               3, 4})),
+                 internals::exceptions::non_symmetric_matrix);
+    EXPECT_THROW(SymmetricMatrix(Matrix(2, 3)),
+                 internals::exceptions::non_square_matrix);
+    EXPECT_THROW(SymmetricMatrix(0), internals::exceptions::invalid_size);
+    EXPECT_THROW(C(3, 0), internals::exceptions::index_out_of_range);
+    EXPECT_THROW(*A * Vector(2), internals::exceptions::matrix_size_mismatch);
+}
+
+TEST_F(SymmetricMatrixTest, cholesky_and_solve) {
+    TriangularMatrix L = Decomposer::cholesky(*A);
+    EXPECT_EQ(L.triangle(), Triangle::lower);
+    Matrix expected = Decomposer::cholesky(*dense);
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j <= i; j++) {
+            EXPECT_NEAR(L(i, j), expected(i, j), 1e-14);
+        }
+    }
+
+    // a larger system against the dense solver
+    int n = 150;
+    SymmetricMatrix S(n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j <= i; j++) {
+            S(i, j) = (i == j) ? n : std::cos(i * 0.3 + j * 0.7);
+        }
+    }
+    Vector b(n);
+    for (int i = 0; i < n; i++) {
+        b[i] = std::sin(i * 0.2);
+    }
+    Vector x = Solver::solve(S, b);
+    Vector y = Solver::solve(S.to_dense(), b);
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(x[i], y[i], 1e-12);
+    }
+
+    // an indefinite matrix falls back to the dense solver
+    SymmetricMatrix indefinite(Matrix(2, 2, {1, 2,
+                                             2, 1}));
+    EXPECT_THROW(Decomposer::cholesky(indefinite),
+                 internals::exceptions::not_positive_definite);
+    Vector z = Solver::solve(indefinite, Vector({3, 3}));
+    EXPECT_NEAR(z[0], 1, 1e-12);
+    EXPECT_NEAR(z[1], 1, 1e-12);
+
+    // so does a singular positive semidefinite one, which it classifies
+    SymmetricMatrix psd(Matrix(2, 2, {0.1, 0.3,
+                                      0.3, 0.9}));
+    EXPECT_THROW(Solver::solve(psd, Vector({1, 2})),
+                 internals::exceptions::no_solution);
+    EXPECT_THROW(Solver::solve(psd, Vector({1, 3})),
+                 internals::exceptions::infinite_solutions);
+    EXPECT_THROW(Solver::solve(*A, Vector(2)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+}
+
+} // namespace astra
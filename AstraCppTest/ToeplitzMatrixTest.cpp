@@ -0,0 +1,126 @@
+#include "pch.h"
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "ToeplitzMatrix.h"
+#include "Matrix.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for ToeplitzMatrix
+class ToeplitzMatrixTest : public ::testing::Test {
+  protected:
+    ToeplitzMatrix* A;
+
+    void SetUp() override {
+        A = new ToeplitzMatrix({4, 1, -2, 0.5}, {4, 3, 0, -1});
+    }
+
+    void TearDown() override { delete A; }
+
+    // t[k] = 0.8^|k| is the autocovariance of an AR(1) process
+    static std::vector<double> autocovariance(int n) {
+        std::vector<double> t(n);
+        for (int k = 0; k < n; k++) {
+            t[k] = std::pow(0.8, k);
+        }
+        return t;
+    }
+};
+
+TEST_F(ToeplitzMatrixTest, storage_and_product) {
+    EXPECT_EQ(A->num_row(), 4);
+    EXPECT_EQ(A->to_dense(), Matrix(4, 4, {4, 3, 0, -1,
+                                           1, 4, 3, 0,
+                                           -2, 1, 4, 3,
+                                           0.5, -2, 1, 4}));
+    EXPECT_EQ((*A)(3, 1), -2);
+    EXPECT_FALSE(A->is_symmetric());
+    EXPECT_TRUE(ToeplitzMatrix({1, 2, 3}).is_symmetric());
+
+    Vector x({1, -1, 2, 0.5});
+    EXPECT_EQ(*A * x, A->to_dense() * x);
+
+    // an order large enough for the circulant embedding, not a power of 2
+    int n = 300;
+    std::vector<double> col(n);
+    std::vector<double> row(n);
+    Vector v(n);
+    for (int k = 0; k < n; k++) {
+        col[k] = std::cos(k * 0.37);
+        row[k] = (k == 0) ? col[0] : std::sin(k * 0.11);
+        v[k] = 1.0 / (1 + k % 17);
+    }
+    ToeplitzMatrix T(col, row);
+    Vector fast = T * v;
+    Vector dense = T.to_dense() * v;
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(fast[i], dense[i], 1e-11);
+    }
+
+    EXPECT_THROW(ToeplitzMatrix({1, 2}, {2, 1}),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(ToeplitzMatrix({1, 2}, {1}),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(ToeplitzMatrix(std::vector<double>()),
+                 internals::exceptions::invalid_size);
+    EXPECT_THROW((*A)(4, 0), internals::exceptions::index_out_of_range);
+    EXPECT_THROW(*A * Vector(3), internals::exceptions::matrix_size_mismatch);
+}
+
+TEST_F(ToeplitzMatrixTest, levinson_solve) {
+    Vector b({1, 2, 3, 4});
+    Vector x = Solver::solve(*A, b);
+    Vector expected = Solver::solve(A->to_dense(), b);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(x[i], expected[i], 1e-12);
+    }
+
+    // the Yule-Walker equations of an AR(1) process give back its
+    // coefficient, 0.8, and zeros for the higher lags
+    int p = 50;
+    std::vector<double> t = autocovariance(p + 1);
+    Vector rhs(p);
+    for (int k = 0; k < p; k++) {
+        rhs[k] = t[k + 1];
+    }
+    t.pop_back();
+    Vector phi = Solver::solve(ToeplitzMatrix(t), rhs);
+    EXPECT_NEAR(phi[0], 0.8, 1e-12);
+    for (int k = 1; k < p; k++) {
+        EXPECT_NEAR(phi[k], 0, 1e-12);
+    }
+
+    EXPECT_THROW(Solver::solve(*A, Vector(3)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+}
+
+TEST_F(ToeplitzMatrixTest, levinson_breakdown_falls_back) {
+    // nonsingular with a singular leading block, [[0, 1], [1, 0]]
+    Vector x = Solver::solve(ToeplitzMatrix({0, 1}), Vector({2, 3}));
+    EXPECT_NEAR(x[0], 3, 1e-12);
+    EXPECT_NEAR(x[1], 2, 1e-12);
+
+    // the leading 2 x 2 block has determinant 1e-12, where the recursion
+    // would lose about 1e-3, the answer matches the pivoted dense solver
+    ToeplitzMatrix T({1, (1 - 1e-12) / 2, 0.3, -0.7}, {1, 2, -1, 0.5});
+    Vector b({1, 2, 3, 4});
+    x = Solver::solve(T, b);
+    Vector expected = Solver::solve(T.to_dense(), b);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(x[i], expected[i], 1e-9);
+    }
+
+    // singular systems are classified like dense ones
+    EXPECT_THROW(Solver::solve(ToeplitzMatrix({1, 1}), Vector({1, 1})),
+                 internals::exceptions::infinite_solutions);
+    EXPECT_THROW(Solver::solve(ToeplitzMatrix({1, 1}), Vector({1, 2})),
+                 internals::exceptions::no_solution);
+}
+
+} // namespace astra
@@ -0,0 +1,121 @@
+#include "pch.h"
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "TriangularMatrix.h"
+#include "Decomposer.h"
+#include "Matrix.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for TriangularMatrix
+class TriangularMatrixTest : public ::testing::Test {
+  protected:
+    Matrix* dense;
+    TriangularMatrix* L;
+
+    void SetUp() override {
+        dense = new Matrix(3, 3, {2, 0, 0,
+                                  1, 3, 0,
+                                  -1, 4, 5});
+        L = new TriangularMatrix(*dense, Triangle::lower);
+    }
+
+    void TearDown() override {
+        delete dense;
+        delete L;
+    }
+};
+
+TEST_F(TriangularMatrixTest, storage) {
+    EXPECT_EQ(L->num_row(), 3);
+    EXPECT_EQ(L->triangle(), Triangle::lower);
+    EXPECT_EQ(std::vector<double>(L->data(), L->data() + 6),
+              std::vector<double>({2, 1, 3, -1, 4, 5}));
+    EXPECT_EQ(L->to_dense(), *dense);
+    EXPECT_EQ(L->det(), 30);
+
+    TriangularMatrix U = L->transpose();
+    EXPECT_EQ(U.triangle(), Triangle::upper);
+    EXPECT_EQ(std::vector<double>(U.data(), U.data() + 6),
+              std::vector<double>({2, 1, -1, 3, 4, 5}));
+    Matrix t = *dense;
+    t.transpose();
+    EXPECT_EQ(U.to_dense(), t);
+    EXPECT_EQ(U.transpose(), *L);
+
+    const TriangularMatrix& C = U;
+    EXPECT_EQ(C(0, 2), -1);
+    EXPECT_EQ(C(2, 0), 0);
+    U(1, 2) = 7;
+    EXPECT_EQ(U.to_dense()(1, 2), 7);
+
+    Vector x({1, -2, 0.5});
+    EXPECT_EQ(*L * x, *dense * x);
+    EXPECT_EQ(U * x, U.to_dense() * x);
+
+    EXPECT_THROW(U(2, 0), internals::exceptions::index_out_of_range);
+    EXPECT_THROW(TriangularMatrix(0, Triangle::upper),
+                 internals::exceptions::invalid_size);
+    EXPECT_THROW(TriangularMatrix(Matrix(2, 3), Triangle::upper),
+                 internals::exceptions::non_square_matrix);
+    EXPECT_THROW(*L * Vector(2), internals::exceptions::matrix_size_mismatch);
+}
+
+TEST_F(TriangularMatrixTest, substitution_and_factors) {
+    Vector b({4, 5, 6});
+    EXPECT_EQ(Solver::forward_sub(*L, b), Solver::forward_sub(*dense, b));
+    TriangularMatrix U = L->transpose();
+    Vector x = Solver::backward_sub(U, b);
+    Vector expected = Solver::backward_sub(U.to_dense(), b);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NEAR(x[i], expected[i], 1e-15);
+    }
+    EXPECT_THROW(Solver::forward_sub(U, b),
+                 internals::exceptions::matrix_not_lower_triangular);
+    EXPECT_THROW(Solver::backward_sub(*L, b),
+                 internals::exceptions::matrix_not_upper_triangular);
+    EXPECT_THROW(Solver::forward_sub(*L, Vector(2)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+
+    // the factors of the compact LU and QR forms
+    Matrix A(3, 3, {4, 3, 2,
+                    6, 3, 1,
+                    2, 5, 7});
+    auto lu = Decomposer::lu(A);
+    TriangularMatrix lower = lu.lower();
+    TriangularMatrix upper = lu.upper();
+    EXPECT_EQ(lower(1, 1), 1);
+    Matrix product = lower.to_dense() * upper.to_dense();
+    Matrix permuted = A;
+    for (int k = 0; k < 3; k++) {
+        for (int j = 0; j < 3; j++) {
+            std::swap(permuted(k, j), permuted(lu.pivots[k], j));
+        }
+    }
+    for (int i = 0; i < 3; i++) {
+        for (int j = 0; j < 3; j++) {
+            EXPECT_NEAR(product(i, j), permuted(i, j), 1e-12);
+        }
+    }
+
+    Matrix tall(4, 2, {1, 2,
+                       3, 4,
+                       5, 6,
+                       7, 8});
+    auto qr = Decomposer::qr(tall);
+    TriangularMatrix r = qr.upper();
+    EXPECT_EQ(r.num_row(), 2);
+    EXPECT_EQ(r(0, 1), qr.QR(0, 1));
+    EXPECT_NEAR(std::abs(r(0, 0)), std::sqrt(84.0), 1e-12);
+    EXPECT_THROW(Decomposer::qr(Matrix(2, 3, {1, 2, 3,
+                                              4, 5, 6})).upper(),
+                 internals::exceptions::invalid_argument);
+}
+
+} // namespace astra
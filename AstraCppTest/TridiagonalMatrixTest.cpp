@@ -0,0 +1,110 @@
+#include "pch.h"
+
+#include <cmath>
+#include <vector>
+#include "gtest/gtest.h"
+
+#include "TridiagonalMatrix.h"
+#include "BandedMatrix.h"
+#include "Matrix.h"
+#include "Solver.h"
+#include "Vector.h"
+#include "Exceptions.h"
+
+namespace astra {
+
+// Test fixture class for TridiagonalMatrix
+class TridiagonalMatrixTest : public ::testing::Test {
+  protected:
+    TridiagonalMatrix* A;
+
+    void SetUp() override {
+        // the second difference matrix of an implicit diffusion step
+        A = new TridiagonalMatrix({-1, -1, -1}, {3, 3, 3, 3}, {-1, -1, -1});
+    }
+
+    void TearDown() override { delete A; }
+};
+
+TEST_F(TridiagonalMatrixTest, storage) {
+    EXPECT_EQ(A->num_row(), 4);
+    EXPECT_EQ(A->to_dense(), Matrix(4, 4, {3, -1, 0, 0,
+                                           -1, 3, -1, 0,
+                                           0, -1, 3, -1,
+                                           0, 0, -1, 3}));
+    EXPECT_EQ(A->to_banded().to_dense(), A->to_dense());
+    EXPECT_TRUE(A->is_diagonally_dominant());
+
+    TridiagonalMatrix B(4);
+    B(0, 1) = 2;
+    B(3, 2) = 5;
+    EXPECT_EQ(B.super_diagonal(), std::vector<double>({2, 0, 0}));
+    EXPECT_EQ(B.sub_diagonal(), std::vector<double>({0, 0, 5}));
+    const TridiagonalMatrix& C = B;
+    EXPECT_EQ(C(0, 3), 0);
+    EXPECT_NE(B, *A);
+
+    Vector x({1, 2, -1, 4});
+    EXPECT_EQ(*A * x, A->to_dense() * x);
+
+    EXPECT_THROW(B(0, 2), internals::exceptions::index_out_of_range);
+    EXPECT_THROW(TridiagonalMatrix({1}, {1, 2}, {}),
+                 internals::exceptions::invalid_argument);
+    EXPECT_THROW(TridiagonalMatrix(0), internals::exceptions::invalid_size);
+    EXPECT_THROW(*A * Vector(3), internals::exceptions::matrix_size_mismatch);
+}
+
+TEST_F(TridiagonalMatrixTest, thomas_and_solve) {
+    Vector b({1, 0, 2, -1});
+    Vector x = Solver::thomas(*A, b);
+    Vector expected = Solver::solve(A->to_dense(), b);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_NEAR(x[i], expected[i], 1e-12);
+    }
+    EXPECT_EQ(Solver::solve(*A, b), x);
+
+    // a zero leading pivot stops Thomas, solve pivots through BandedLU
+    TridiagonalMatrix P({1, 1}, {0, 2, 1}, {1, 3});
+    EXPECT_FALSE(P.is_diagonally_dominant());
+    EXPECT_THROW(Solver::thomas(P, Vector({1, 2, 3})),
+                 internals::exceptions::singular_matrix);
+    Vector y = Solver::solve(P, Vector({1, 2, 3}));
+    Vector r = P * y;
+    for (int i = 0; i < 3; i++) {
+        EXPECT_NEAR(r[i], i + 1.0, 1e-12);
+    }
+
+    // a long diffusion system
+    int n = 100000;
+    TridiagonalMatrix D(std::vector<double>(n - 1, -1.0),
+                        std::vector<double>(n, 2.5),
+                        std::vector<double>(n - 1, -1.0));
+    Vector c(n);
+    for (int i = 0; i < n; i++) {
+        c[i] = std::sin(i * 0.01);
+    }
+    Vector z = Solver::solve(D, c);
+    Vector rz = D * z;
+    for (int i = 0; i < n; i++) {
+        EXPECT_NEAR(rz[i], c[i], 1e-10);
+    }
+
+    EXPECT_EQ(Solver::solve(TridiagonalMatrix({}, {2}, {}), Vector({4})),
+              Vector({2}));
+    EXPECT_THROW(Solver::thomas(*A, Vector(3)),
+                 internals::exceptions::variable_and_value_number_mismatch);
+}
+
+TEST_F(TridiagonalMatrixTest, nearly_singular_solve) {
+    // the second pivot is 1e-12, Thomas stops and the dense solver
+    // classifies the system
+    TridiagonalMatrix S({2, 0}, {1, 4 + 1e-12, 3}, {2, 0});
+    EXPECT_THROW(Solver::thomas(S, Vector({1, 1, 1})),
+                 internals::exceptions::singular_matrix);
+    EXPECT_THROW(Solver::solve(S, Vector({1, 1, 1})),
+                 internals::exceptions::no_solution);
+    EXPECT_THROW(Solver::solve(S, Vector({1, 2, 3})),
+                 internals::exceptions::infinite_solutions);
+}
+
+} // namespace astra
@@ -3,6 +3,7 @@
 #include <iostream>
 
 #include "Vector.h"
+#include "Matrix.h"
 #include "gtest/gtest.h"
 
 #include "Exceptions.h"
@@ -51,6 +52,18 @@ TEST_F(VectorTest, copy_constructor) {
     EXPECT_EQ(v2[2], 3.0);
 }
 
+TEST_F(VectorTest, move_constructor) {
+    Vector v1{1.0, 2.0, 3.0};
+    Vector v2(std::move(v1));
+
+    EXPECT_EQ(v2.get_size(), 3);
+    EXPECT_EQ(v2[0], 1.0);
+    EXPECT_EQ(v2[1], 2.0);
+    EXPECT_EQ(v2[2], 3.0);
+
+    EXPECT_EQ(v1.get_size(), 0);
+}
+
 TEST_F(VectorTest, comma_initializer) {
     Vector v(3);
     v << 1, 3, 5;
@@ -80,8 +93,10 @@ TEST_F(VectorTest, index_out_of_range) {
     double arr[] = {1.0, 2.0, 3.0};
     Vector v(3, arr);
 
+#if ASTRA_BOUNDS_CHECK
     EXPECT_THROW(v[3], astra::internals::exceptions::index_out_of_range);
     EXPECT_THROW(v[-1], astra::internals::exceptions::index_out_of_range);
+#endif
 }
 
 TEST_F(VectorTest, vector_addition) {
@@ -337,7 +352,63 @@ TEST_F(VectorTest, copy_assignment_different_sizes) {
     EXPECT_EQ(v1[0], 4.0);
     EXPECT_EQ(v1[1], 5.0);
 
+#if ASTRA_BOUNDS_CHECK
     EXPECT_THROW(v1[2], astra::internals::exceptions::index_out_of_range);
+#endif
+}
+
+TEST_F(VectorTest, move_assignment) {
+    Vector v1{1.0, 2.0, 3.0};
+    Vector v2{4.0, 5.0};
+
+    v2 = std::move(v1);
+
+    EXPECT_EQ(v2.get_size(), 3);
+    EXPECT_EQ(v2[0], 1.0);
+    EXPECT_EQ(v2[2], 3.0);
+    EXPECT_EQ(v1.get_size(), 0);
+
+    // a moved-from vector can be assigned again
+    v1 = v2;
+    EXPECT_EQ(v1, v2);
+}
+
+TEST_F(VectorTest, fused_expression) {
+    Vector v1{1.0, 2.0, 3.0};
+    Vector v2{4.0, 5.0, 6.0};
+
+    Vector result = v1 + v2 * 2.0 - v1 / 0.5;
+
+    EXPECT_EQ(result, Vector({7.0, 8.0, 9.0}));
+}
+
+TEST_F(VectorTest, expression_assignment_aliasing) {
+    Vector x{1.0, 2.0, 3.0};
+    Vector p{1.0, 1.0, 1.0};
+    const double* storage = &x[0];
+
+    x = x + 0.5 * p;
+
+    EXPECT_EQ(x, Vector({1.5, 2.5, 3.5}));
+    EXPECT_EQ(&x[0], storage);
+}
+
+TEST_F(VectorTest, expression_dot_product) {
+    Vector v1{1.0, 2.0, 3.0};
+    Vector v2{4.0, 6.0, 3.0};
+
+    EXPECT_EQ((v2 - v1) * (v2 - v1), 25.0);
+    EXPECT_EQ(v1 * (v1 + v1), 28.0);
+    EXPECT_THROW((v1 + v2) * Vector({1.0, 2.0}),
+                 astra::internals::exceptions::vector_size_mismatch);
+}
+
+TEST_F(VectorTest, expression_matrix_vector_product) {
+    Matrix mat(2, 3, {1, 0, 0, 0, 1, 1});
+    Vector v1{1.0, 2.0, 3.0};
+
+    EXPECT_EQ(mat * (v1 + v1), Vector({2.0, 10.0}));
+    EXPECT_EQ((mat * 2.0) * v1, Vector({2.0, 10.0}));
 }
 
 TEST_F(VectorTest, equality_operator_valid) {
@@ -655,4 +726,16 @@ TEST_F(VectorTest, normalize_invalid_vector) {
     EXPECT_THROW(v.normalize(), astra::internals::exceptions::zero_division);
 }
 
+TEST_F(VectorTest, unchecked_access_and_data) {
+    Vector v{1, 2, 3};
+    EXPECT_EQ(v.unchecked(2), 3);
+    v.unchecked(0) = 5;
+    EXPECT_EQ(v[0], 5);
+    v.data()[1] = -2;
+    EXPECT_EQ(v[1], -2);
+
+    VectorView view(v.data(), 2, 2);
+    EXPECT_EQ(view.unchecked(1), 3);
+}
+
 } // namespace astra
\ No newline at end of file
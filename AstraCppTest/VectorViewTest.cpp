@@ -0,0 +1,80 @@
+#include "pch.h"
+
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+#include "Vector.h"
+#include "VectorView.h"
+#include "Exceptions.h"
+#include "MathUtils.h"
+
+namespace astra {
+
+// Test fixture class for VectorView
+class VectorViewTest : public ::testing::Test {
+  protected:
+    Vector* v;
+
+    void SetUp() override { v = new Vector{3, -1, 4, 1, -5, 9}; }
+
+    void TearDown() override { delete v; }
+};
+
+TEST_F(VectorViewTest, view_whole_vector) {
+    VectorView view(*v);
+    EXPECT_EQ(view.get_size(), 6);
+    EXPECT_EQ(view.get_stride(), 1);
+    EXPECT_EQ(view[5], 9);
+    EXPECT_EQ(view.sum(), v->sum());
+    EXPECT_EQ(view.mag(), v->mag());
+}
+
+TEST_F(VectorViewTest, view_invalid_construction) {
+    double data[2] = {1, 2};
+    EXPECT_THROW(VectorView(data, 0), astra::internals::exceptions::invalid_size);
+    EXPECT_THROW(VectorView(data, 2, 0),
+                 astra::internals::exceptions::invalid_argument);
+}
+
+TEST_F(VectorViewTest, segment_shares_storage) {
+    VectorView s = v->segment(1, 3);
+    EXPECT_EQ(s.get_size(), 3);
+    EXPECT_EQ(s[0], -1);
+    EXPECT_EQ(s.min(), -1);
+    EXPECT_EQ(s.max(), 4);
+    EXPECT_TRUE(internals::mathutils::nearly_equal(s.avg(), 4.0 / 3.0));
+
+    (*v)[2] = 10;
+    EXPECT_EQ(s[1], 10);
+#if ASTRA_BOUNDS_CHECK
+    EXPECT_THROW(s[3], astra::internals::exceptions::index_out_of_range);
+#endif
+}
+
+TEST_F(VectorViewTest, segment_invalid) {
+    EXPECT_THROW(v->segment(0, 6),
+                 astra::internals::exceptions::index_out_of_range);
+    EXPECT_THROW(v->segment(3, 2),
+                 astra::internals::exceptions::invalid_argument);
+}
+
+TEST_F(VectorViewTest, strided_view) {
+    VectorView odd(&(*v)[1], 3, 2);
+    EXPECT_EQ(Vector(odd), Vector({-1, 1, 9}));
+    EXPECT_EQ(Vector(odd.segment(1, 2)), Vector({1, 9}));
+
+    std::ostringstream os;
+    os << odd;
+    EXPECT_EQ(os.str(), "[-1, 1, 9]\n");
+}
+
+TEST_F(VectorViewTest, dot_product) {
+    VectorView even(&(*v)[0], 3, 2);
+    VectorView head = v->segment(0, 2);
+    EXPECT_EQ(even * head, 3 * 3 + 4 * -1 + -5 * 4);
+    EXPECT_THROW(even * v->segment(0, 1),
+                 astra::internals::exceptions::vector_size_mismatch);
+}
+
+} // namespace astra